@@ -143,7 +143,12 @@ int cace_amm_lookup_deref(cace_amm_lookup_t *res, const cace_amm_obj_store_t *st
 
     res->obj_type = path->ari_type;
 
+#if ENABLE_LUT_CACHE
+    int pop_res = cace_amm_actual_param_set_populate_cached(&(res->aparams), &(res->obj->aparam_cache),
+                                                            res->obj->fparams, &(ref->as_ref.params));
+#else
     int pop_res = cace_amm_actual_param_set_populate(&(res->aparams), res->obj->fparams, &(ref->as_ref.params));
+#endif /* ENABLE_LUT_CACHE */
     if (pop_res)
     {
         return 7 + pop_res;
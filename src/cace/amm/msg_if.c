@@ -17,11 +17,16 @@
  */
 #include "msg_if.h"
 
+#include "cace/util/defs.h"
+
 void cace_amm_msg_if_metadata_init(cace_amm_msg_if_metadata_t *meta)
 {
     cace_ari_init(&meta->src);
     cace_ari_init(&meta->dest);
     cace_ari_init(&meta->timestamp);
+    cace_data_init(&meta->encoded);
+    cace_amm_msg_if_span_list_init(meta->item_spans);
+    meta->defer_decode = false;
 }
 
 void cace_amm_msg_if_metadata_deinit(cace_amm_msg_if_metadata_t *meta)
@@ -29,4 +34,23 @@ void cace_amm_msg_if_metadata_deinit(cace_amm_msg_if_metadata_t *meta)
     cace_ari_deinit(&meta->dest);
     cace_ari_deinit(&meta->src);
     cace_ari_deinit(&meta->timestamp);
+    cace_amm_msg_if_span_list_clear(meta->item_spans);
+    cace_data_deinit(&meta->encoded);
+}
+
+int cace_amm_msg_if_metadata_get_encoded(const cace_amm_msg_if_metadata_t *meta, size_t index, cace_data_t *view)
+{
+    CHKERR1(meta);
+    CHKERR1(view);
+
+    if (index >= cace_amm_msg_if_span_list_size(meta->item_spans))
+    {
+        return 2;
+    }
+    const cace_amm_msg_if_span_t *span = cace_amm_msg_if_span_list_cget(meta->item_spans, index);
+    if (span->offset + span->len > meta->encoded.len)
+    {
+        return 3;
+    }
+    return cace_data_init_view(view, span->len, meta->encoded.ptr + span->offset);
 }
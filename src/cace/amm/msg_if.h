@@ -19,12 +19,29 @@
 #define CACE_AMM_MSG_IF_H_
 
 #include "cace/ari.h"
+#include "cace/cace_data.h"
 #include "cace/util/daemon_run.h"
 
+#include <m-array.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** The location of a single encoded item within a received message.
+ */
+typedef struct
+{
+    /// Offset from the start of the message
+    size_t offset;
+    /// Length of the encoded item
+    size_t len;
+} cace_amm_msg_if_span_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(cace_amm_msg_if_span_list, cace_amm_msg_if_span_t, M_POD_OPLIST)
+/// @endcond
+
 typedef struct
 {
     /// Source endpoint ID (opaque text)
@@ -33,12 +50,37 @@ typedef struct
     cace_ari_t dest;
     /// Time from local clock at which the message was first seen
     cace_ari_t timestamp;
+
+    /** The whole received message in encoded form, which transports
+     * receive into directly and which may include a transport header.
+     * This is left empty by transports which do not retain it.
+     */
+    cace_data_t encoded;
+    /** The location of each received item within #encoded, in the same
+     * order as the received ARI list.
+     */
+    cace_amm_msg_if_span_list_t item_spans;
+    /** Option set by the receiver before calling the receive function.
+     * When true, a transport which retains #encoded may leave received ARIs
+     * undefined after only checking they are well-formed, and the receiver
+     * decodes them from #item_spans as needed.
+     */
+    bool defer_decode;
 } cace_amm_msg_if_metadata_t;
 
 void cace_amm_msg_if_metadata_init(cace_amm_msg_if_metadata_t *meta);
 
 void cace_amm_msg_if_metadata_deinit(cace_amm_msg_if_metadata_t *meta);
 
+/** Get a view of the original encoded form of a received item.
+ *
+ * @param[in] meta The reception metadata.
+ * @param index The index of the item in the received ARI list.
+ * @param[out] view The uninitialized view to set.
+ * @return Zero if successful, or non-zero if the encoded form was not retained.
+ */
+int cace_amm_msg_if_metadata_get_encoded(const cace_amm_msg_if_metadata_t *meta, size_t index, cace_data_t *view);
+
 /** Message sending function.
  * @param[in] data The list of ARIs to send.
  * @param[in] meta The destination endpoint.
@@ -56,6 +56,7 @@ void cace_amm_obj_desc_init(cace_amm_obj_desc_t *obj)
 {
     cace_amm_idseg_val_init(&obj->obj_id);
     cace_amm_formal_param_list_init(obj->fparams);
+    cace_amm_actual_param_cache_init(&(obj->aparam_cache));
     obj->status = CACE_AMM_STATUS_CURRENT;
     cace_amm_user_data_init(&(obj->app_data));
 }
@@ -63,6 +64,7 @@ void cace_amm_obj_desc_init(cace_amm_obj_desc_t *obj)
 void cace_amm_obj_desc_deinit(cace_amm_obj_desc_t *obj)
 {
     cace_amm_user_data_deinit(&(obj->app_data));
+    cace_amm_actual_param_cache_deinit(&(obj->aparam_cache));
     cace_amm_formal_param_list_clear(obj->fparams);
     cace_amm_idseg_val_deinit(&obj->obj_id);
 }
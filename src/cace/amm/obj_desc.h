@@ -40,6 +40,9 @@ typedef struct cace_amm_obj_desc_s
     /// Formal parameters of this object instance, which may be empty
     cace_amm_formal_param_list_t fparams;
 
+    /// Actual parameters already normalized from #fparams, see cace_amm_lookup_deref()
+    cace_amm_actual_param_cache_t aparam_cache;
+
     /// The status of this object, which can change over time
     cace_amm_status_t status;
 
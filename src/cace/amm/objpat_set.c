@@ -202,3 +202,79 @@ bool cace_amm_objpat_set_match(const cace_ari_t *set, const cace_amm_lookup_t *d
         return cace_amm_objpat_match(set, deref);
     }
 }
+
+static bool cace_amm_objpat_part_ref_match(const cace_ari_objpat_part_t *part, const cace_ari_idseg_t *id)
+{
+    const cace_util_range_int64_t *range_int64 = NULL;
+    const m_string_t              *text        = NULL;
+    if (cace_ari_objpat_part_cget_special(*part))
+    {
+        return true;
+    }
+    else if ((range_int64 = cace_ari_objpat_part_cget_range_int64(*part)))
+    {
+        if (id->form == CACE_ARI_IDSEG_INT)
+        {
+            return cace_util_range_int64_contains(*range_int64, id->as_int);
+        }
+    }
+    else if ((text = cace_ari_objpat_part_cget_text(*part)))
+    {
+        if (id->form == CACE_ARI_IDSEG_TEXT)
+        {
+            return m_string_equal_p(*text, id->as_text);
+        }
+    }
+    return false;
+}
+
+static bool cace_amm_objpat_path_match(const cace_ari_t *val, const cace_ari_objpath_t *path)
+{
+    const cace_ari_objpat_t *pat = cace_ari_cget_objpat(val);
+    if (!pat)
+    {
+        return false;
+    }
+
+    bool type_match;
+    if (cace_ari_objpat_part_cget_special(pat->type_pat))
+    {
+        type_match = true;
+    }
+    else
+    {
+        type_match = path->has_ari_type && cace_amm_objpat_part_type_match(&pat->type_pat, path->ari_type);
+    }
+
+    return (type_match && cace_amm_objpat_part_ref_match(&pat->org_pat, &path->org_id)
+            && cace_amm_objpat_part_ref_match(&pat->model_pat, &path->model_id)
+            && cace_amm_objpat_part_ref_match(&pat->obj_pat, &path->obj_id));
+}
+
+bool cace_amm_objpat_set_match_path(const cace_ari_t *set, const cace_ari_objpath_t *path)
+{
+    if (!set || !path)
+    {
+        return false;
+    }
+
+    const cace_ari_ac_t *as_ac = cace_ari_cget_ac(set);
+    if (as_ac)
+    {
+        cace_ari_list_it_t sub_it;
+        for (cace_ari_list_it(sub_it, as_ac->items); !cace_ari_list_end_p(sub_it); cace_ari_list_next(sub_it))
+        {
+            const cace_ari_t *sub_item = cace_ari_list_cref(sub_it);
+            // any match stops early
+            if (cace_amm_objpat_path_match(sub_item, path))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    else
+    {
+        return cace_amm_objpat_path_match(set, path);
+    }
+}
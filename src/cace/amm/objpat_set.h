@@ -59,6 +59,17 @@ int cace_amm_objpat_set_from_obj(cace_ari_t *set, const cace_amm_lookup_t *deref
  */
 bool cace_amm_objpat_set_match(const cace_ari_t *set, const cace_amm_lookup_t *deref);
 
+/** Determine if an object path matches a pattern set without needing to
+ * dereference it, for use where no object store is available.
+ * Each ID segment is checked only in the form present in the path, so an
+ * integer range never matches a text ID and vice versa.
+ *
+ * @param[in] set The pattern set to match against.
+ * @param[in] path The object path to match.
+ * @return True if it is a match.
+ */
+bool cace_amm_objpat_set_match_path(const cace_ari_t *set, const cace_ari_objpath_t *path);
+
 #ifdef __cplusplus
 } // extern C
 #endif
@@ -17,6 +17,7 @@
  */
 #include "parameters.h"
 
+#include "cace/ari/algo.h"
 #include "cace/ari/text.h"
 #include "cace/util/defs.h"
 #include "cace/util/logging.h"
@@ -317,3 +318,123 @@ int cace_amm_actual_param_set_populate(cace_ari_itemized_t *obj, const cace_amm_
 
     return retval;
 }
+
+static void cace_amm_actual_param_cache_entry_init(cace_amm_actual_param_cache_entry_t *entry)
+{
+    entry->valid          = false;
+    entry->hash           = 0;
+    entry->gparams.state  = CACE_ARI_PARAMS_NONE;
+    cace_ari_itemized_init(&(entry->aparams));
+}
+
+static void cace_amm_actual_param_cache_entry_deinit(cace_amm_actual_param_cache_entry_t *entry)
+{
+    cace_ari_itemized_deinit(&(entry->aparams));
+    cace_ari_params_deinit(&(entry->gparams));
+    entry->valid = false;
+}
+
+void cace_amm_actual_param_cache_init(cace_amm_actual_param_cache_t *cache)
+{
+    CHKVOID(cache);
+    pthread_mutex_init(&(cache->mutex), NULL);
+    for (size_t ix = 0; ix < CACE_AMM_ACTUAL_PARAM_CACHE_SIZE; ++ix)
+    {
+        cace_amm_actual_param_cache_entry_init(&(cache->entries[ix]));
+    }
+}
+
+void cace_amm_actual_param_cache_deinit(cace_amm_actual_param_cache_t *cache)
+{
+    CHKVOID(cache);
+    for (size_t ix = 0; ix < CACE_AMM_ACTUAL_PARAM_CACHE_SIZE; ++ix)
+    {
+        cace_amm_actual_param_cache_entry_deinit(&(cache->entries[ix]));
+    }
+    pthread_mutex_destroy(&(cache->mutex));
+}
+
+void cace_amm_actual_param_cache_reset(cace_amm_actual_param_cache_t *cache)
+{
+    CHKVOID(cache);
+    pthread_mutex_lock(&(cache->mutex));
+    for (size_t ix = 0; ix < CACE_AMM_ACTUAL_PARAM_CACHE_SIZE; ++ix)
+    {
+        cace_amm_actual_param_cache_entry_t *entry = &(cache->entries[ix]);
+
+        cace_ari_itemized_reset(&(entry->aparams));
+        cace_ari_params_deinit(&(entry->gparams));
+        entry->valid = false;
+    }
+    pthread_mutex_unlock(&(cache->mutex));
+}
+
+/** Copy a normalized set of actual parameters.
+ * The names are bound to the new ordered items, unlike
+ * cace_ari_itemized_init_set() which would share the source items.
+ * Container values are shared between the copies.
+ */
+static void cace_amm_actual_param_set_copy(cace_ari_itemized_t *obj, const cace_amm_formal_param_list_t fparams,
+                                           const cace_ari_itemized_t *src)
+{
+    cace_ari_itemized_reset(obj);
+    cace_ari_array_set(obj->ordered, src->ordered);
+
+    cace_amm_formal_param_list_it_t fit;
+    size_t                          pix = 0;
+    for (cace_amm_formal_param_list_it(fit, fparams); !cace_amm_formal_param_list_end_p(fit);
+         cace_amm_formal_param_list_next(fit), ++pix)
+    {
+        const cace_amm_formal_param_t *fparam = cace_amm_formal_param_list_cref(fit);
+
+        cace_named_ari_ptr_dict_set_at(obj->named, m_string_get_cstr(fparam->name),
+                                       cace_ari_array_get(obj->ordered, pix));
+    }
+    obj->any_undefined = src->any_undefined;
+}
+
+int cace_amm_actual_param_set_populate_cached(cace_ari_itemized_t *obj, cace_amm_actual_param_cache_t *cache,
+                                              const cace_amm_formal_param_list_t fparams,
+                                              const cace_ari_params_t         *gparams)
+{
+    CHKERR1(obj);
+    CHKERR1(cache);
+    CHKERR1(fparams);
+    CHKERR1(gparams);
+
+    const size_t                         hash  = cace_ari_params_hash(gparams);
+    cace_amm_actual_param_cache_entry_t *entry = &(cache->entries[hash % CACE_AMM_ACTUAL_PARAM_CACHE_SIZE]);
+
+    pthread_mutex_lock(&(cache->mutex));
+    const bool found = entry->valid && (entry->hash == hash) && cace_ari_params_equal(&(entry->gparams), gparams);
+    if (found)
+    {
+        cace_amm_actual_param_set_copy(obj, fparams, &(entry->aparams));
+    }
+    pthread_mutex_unlock(&(cache->mutex));
+    if (found)
+    {
+        return 0;
+    }
+
+    // convert without holding the lock, which may dereference other objects
+    int retval = cace_amm_actual_param_set_populate(obj, fparams, gparams);
+    if (retval)
+    {
+        // failures are not cached
+        return retval;
+    }
+
+    pthread_mutex_lock(&(cache->mutex));
+    // replace any earlier entry
+    entry->valid = false;
+    if (!cace_ari_params_copy(&(entry->gparams), gparams))
+    {
+        cace_amm_actual_param_set_copy(&(entry->aparams), fparams, obj);
+        entry->hash  = hash;
+        entry->valid = true;
+    }
+    pthread_mutex_unlock(&(cache->mutex));
+
+    return 0;
+}
@@ -24,6 +24,8 @@
 #include "cace/ari/itemized.h"
 #include "cace/config.h"
 
+#include <pthread.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,6 +70,64 @@ M_DEQUE_DEF(cace_amm_formal_param_list, cace_amm_formal_param_t)
 int cace_amm_actual_param_set_populate(cace_ari_itemized_t *obj, const cace_amm_formal_param_list_t fparams,
                                        const cace_ari_params_t *gparams);
 
+#ifndef CACE_AMM_ACTUAL_PARAM_CACHE_SIZE
+/** Number of entries in each cace_amm_actual_param_cache_t.
+ * This is a direct-mapped cache so collisions replace older entries.
+ */
+#define CACE_AMM_ACTUAL_PARAM_CACHE_SIZE 8
+#endif /* CACE_AMM_ACTUAL_PARAM_CACHE_SIZE */
+
+/// A single normalized result within a cace_amm_actual_param_cache_t
+typedef struct
+{
+    /// True if this entry is populated
+    bool valid;
+    /// Hash of the #gparams from cace_ari_params_hash()
+    size_t hash;
+    /// A copy of the given parameters which were normalized
+    cace_ari_params_t gparams;
+    /// The actual parameters normalized from #gparams
+    cace_ari_itemized_t aparams;
+} cace_amm_actual_param_cache_entry_t;
+
+/** Cache of actual parameters normalized for a single object.
+ * This avoids repeating type conversion when the same given parameters
+ * are dereferenced many times, such as from a report template.
+ * Access to the cache is thread safe.
+ */
+typedef struct
+{
+    /// Mutex for the state of #entries
+    pthread_mutex_t mutex;
+    /// Entries indexed by hash value
+    cace_amm_actual_param_cache_entry_t entries[CACE_AMM_ACTUAL_PARAM_CACHE_SIZE];
+} cace_amm_actual_param_cache_t;
+
+void cace_amm_actual_param_cache_init(cace_amm_actual_param_cache_t *cache);
+
+void cace_amm_actual_param_cache_deinit(cace_amm_actual_param_cache_t *cache);
+
+/** Invalidate all entries of a cache.
+ * This must be done if the formal parameters of the object change.
+ *
+ * @param[in,out] cache The cache to clear.
+ */
+void cace_amm_actual_param_cache_reset(cace_amm_actual_param_cache_t *cache);
+
+/** Populate actual parameters, first checking a cache of earlier results.
+ * Successful results are added to the cache.
+ *
+ * @param[in,out] obj The struct to initialize.
+ * @param[in,out] cache The cache associated with the formal parameters.
+ * @param[in] fparams Formal parameters to normalize to.
+ * @param[in] gparams Given parameters to normalize from.
+ * @return Zero upon success, with the same meaning as
+ * cace_amm_actual_param_set_populate().
+ */
+int cace_amm_actual_param_set_populate_cached(cace_ari_itemized_t *obj, cace_amm_actual_param_cache_t *cache,
+                                              const cace_amm_formal_param_list_t fparams,
+                                              const cace_ari_params_t         *gparams);
+
 #ifdef __cplusplus
 } // extern C
 #endif
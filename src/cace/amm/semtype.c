@@ -20,6 +20,7 @@
 #include "lookup.h"
 
 #include "cace/ari/algo.h"
+#include "cace/ari/tbl_cols.h"
 #include "cace/ari/text.h"
 #include "cace/config.h"
 #include "cace/util/defs.h"
@@ -27,7 +28,7 @@
 
 #include <m-dict.h>
 
-static bool cace_amm_semtype_use_constraints(const cace_amm_semtype_use_t *semtype, const cace_ari_t *val)
+bool cace_amm_semtype_use_constraints(const cace_amm_semtype_use_t *semtype, const cace_ari_t *val)
 {
     cace_amm_semtype_cnst_array_it_t it;
     for (cace_amm_semtype_cnst_array_it(it, semtype->constraints); !cace_amm_semtype_cnst_array_end_p(it);
@@ -838,7 +839,7 @@ int cace_amm_type_set_tblt_from_name(cace_amm_type_t *type, const cace_amm_looku
             CACE_LOG_ERR("No columns parameter");
             return 3;
         }
-        const cace_ari_tbl_t *pval_tbl = cace_ari_get_tbl(*pval);
+        const cace_ari_tbl_t *pval_tbl = cace_ari_cget_tbl(*pval);
         if (!pval_tbl)
         {
             CACE_LOG_ERR("No columns parameter as TBL");
@@ -850,20 +851,12 @@ int cace_amm_type_set_tblt_from_name(cace_amm_type_t *type, const cace_amm_looku
             return 3;
         }
 
-        cace_ari_array_it_t tbl_it;
-        cace_ari_array_it(tbl_it, pval_tbl->items);
-        while (!cace_ari_array_end_p(tbl_it))
+        const size_t nrows = cace_ari_tbl_num_rows(pval_tbl);
+        for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
         {
-            const cace_ari_t *name_item = cace_ari_array_cref(tbl_it);
-            cace_ari_array_next(tbl_it);
-            if (cace_ari_array_end_p(tbl_it))
-            {
-                CACE_LOG_ERR("Inconsistent items in TBL");
-                break;
-            }
-
-            const cace_ari_t *datatype_item = cace_ari_array_cref(tbl_it);
-            cace_ari_array_next(tbl_it);
+            cace_ari_t        name_buf, datatype_buf;
+            const cace_ari_t *name_item     = cace_ari_tbl_cview(pval_tbl, row_ix, 0, &name_buf);
+            const cace_ari_t *datatype_item = cace_ari_tbl_cview(pval_tbl, row_ix, 1, &datatype_buf);
 
             cace_amm_named_type_t *col_item = cace_amm_named_type_array_push_new(semtype->columns);
             {
@@ -947,45 +940,43 @@ static cace_amm_type_match_res_t cace_amm_semtype_tblt_match(const cace_amm_type
         return CACE_AMM_TYPE_MATCH_NEGATIVE;
     }
 
-    cace_amm_named_type_array_it_t col_it;
-    cace_amm_named_type_array_it(col_it, semtype->columns);
+    const size_t nrows = cace_ari_tbl_num_rows(val);
 
-    cace_ari_array_it_t val_it;
-    for (cace_ari_array_it(val_it, val->items); !cace_ari_array_end_p(val_it);
-         cace_ari_array_next(val_it), cace_amm_named_type_array_next(col_it))
+    // walk column-major so each column type is resolved once
+    for (size_t col_ix = 0; col_ix < val->ncols; ++col_ix)
     {
-        const cace_ari_t *val_item = cace_ari_array_cref(val_it);
-
-        // wrap back around to first column
-        if (cace_amm_named_type_array_end_p(col_it))
-        {
-            cace_amm_named_type_array_it(col_it, semtype->columns);
-        }
-        const cace_amm_named_type_t *col     = cace_amm_named_type_array_ref(col_it);
+        const cace_amm_named_type_t *col     = cace_amm_named_type_array_cget(semtype->columns, col_ix);
         const cace_amm_type_t       *typeobj = &(col->typeobj);
 
-        const cace_amm_type_match_res_t got = cace_amm_type_match(typeobj, val_item);
-
-        if (cace_log_is_enabled_for(LOG_DEBUG))
+        for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
         {
-            cace_ari_t ariname = CACE_ARI_INIT_UNDEFINED;
-            cace_amm_type_get_name(typeobj, &ariname);
+            cace_ari_t        item_buf;
+            const cace_ari_t *val_item = cace_ari_tbl_cview(val, row_ix, col_ix, &item_buf);
 
-            m_string_t buf;
-            m_string_init(buf);
-            cace_ari_text_encode(buf, &ariname, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
-            CACE_LOG_DEBUG("TBLT match for column %s, type %s", m_string_get_cstr(col->name), m_string_get_cstr(buf));
-            m_string_clear(buf);
-            cace_ari_deinit(&ariname);
+            const cace_amm_type_match_res_t got = cace_amm_type_match(typeobj, val_item);
 
-            m_string_init(buf);
-            cace_ari_text_encode(buf, val_item, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
-            CACE_LOG_DEBUG("for value %s match %d", m_string_get_cstr(buf), (int)got);
-            m_string_clear(buf);
-        }
-        if (got == CACE_AMM_TYPE_MATCH_NEGATIVE)
-        {
-            return CACE_AMM_TYPE_MATCH_NEGATIVE;
+            if (cace_log_is_enabled_for(LOG_DEBUG))
+            {
+                cace_ari_t ariname = CACE_ARI_INIT_UNDEFINED;
+                cace_amm_type_get_name(typeobj, &ariname);
+
+                m_string_t buf;
+                m_string_init(buf);
+                cace_ari_text_encode(buf, &ariname, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+                CACE_LOG_DEBUG("TBLT match for column %s, type %s", m_string_get_cstr(col->name),
+                               m_string_get_cstr(buf));
+                m_string_clear(buf);
+                cace_ari_deinit(&ariname);
+
+                m_string_init(buf);
+                cace_ari_text_encode(buf, val_item, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+                CACE_LOG_DEBUG("for value %s match %d", m_string_get_cstr(buf), (int)got);
+                m_string_clear(buf);
+            }
+            if (got == CACE_AMM_TYPE_MATCH_NEGATIVE)
+            {
+                return CACE_AMM_TYPE_MATCH_NEGATIVE;
+            }
         }
     }
 
@@ -1009,36 +1000,44 @@ static int cace_amm_semtype_tblt_convert(const cace_amm_type_t *self, cace_ari_t
     }
 
     // special case for needs-to-be-empty
-    const size_t nrows = (inval->ncols == 0) ? 0 : (cace_ari_array_size(inval->items) / inval->ncols);
+    const size_t nrows = cace_ari_tbl_num_rows(inval);
 
     cace_ari_tbl_t *outval = cace_ari_set_tbl(out, NULL);
-    cace_ari_tbl_reset(outval, inval->ncols, nrows);
+    cace_ari_tbl_reset(outval, inval->ncols, 0);
+    if (cace_ari_tbl_is_packed(inval))
+    {
+        // output keeps the same form as the input
+        cace_ari_tbl_pack(outval);
+    }
 
     int retval = 0;
 
-    cace_amm_named_type_array_it_t col_it;
-    cace_amm_named_type_array_it(col_it, semtype->columns);
-
-    // input and output have exact same size
-    cace_ari_array_it_t inval_it, outval_it;
-    for (cace_ari_array_it(inval_it, inval->items), cace_ari_array_it(outval_it, outval->items);
-         !cace_ari_array_end_p(inval_it);
-         cace_ari_array_next(inval_it), cace_ari_array_next(outval_it), cace_amm_named_type_array_next(col_it))
+    for (size_t row_ix = 0; (row_ix < nrows) && !retval; ++row_ix)
     {
-        const cace_ari_t *in_item  = cace_ari_array_cref(inval_it);
-        cace_ari_t       *out_item = cace_ari_array_ref(outval_it);
-
-        if (cace_amm_named_type_array_end_p(col_it))
+        for (size_t col_ix = 0; col_ix < inval->ncols; ++col_ix)
         {
-            cace_amm_named_type_array_it(col_it, semtype->columns);
-        }
-        const cace_amm_type_t *typeobj = &(cace_amm_named_type_array_ref(col_it)->typeobj);
+            cace_ari_t        item_buf;
+            const cace_ari_t *in_item  = cace_ari_tbl_cview(inval, row_ix, col_ix, &item_buf);
+            cace_ari_t        out_item = CACE_ARI_INIT_UNDEFINED;
 
-        int res = cace_amm_type_convert(typeobj, out_item, in_item);
-        if (res)
-        {
-            retval = res;
-            break;
+            const cace_amm_type_t *typeobj = &(cace_amm_named_type_array_cget(semtype->columns, col_ix)->typeobj);
+
+            int res = cace_amm_type_convert(typeobj, &out_item, in_item);
+            if (res)
+            {
+                cace_ari_deinit(&out_item);
+                retval = res;
+                break;
+            }
+
+            if (outval->cols)
+            {
+                cace_ari_tbl_cols_push_move(outval->cols, &out_item);
+            }
+            else
+            {
+                cace_ari_array_push_move(outval->items, &out_item);
+            }
         }
     }
 
@@ -69,6 +69,14 @@ static inline void cace_amm_semtype_use_deinit(cace_amm_semtype_use_t *obj)
     obj->base = NULL;
 }
 
+/** Check the constraints of a type use, without matching the base type.
+ *
+ * @param[in] semtype The type use to check.
+ * @param[in] val The value to check.
+ * @return True if all constraints are satisfied.
+ */
+bool cace_amm_semtype_use_constraints(const cace_amm_semtype_use_t *semtype, const cace_ari_t *val);
+
 typedef struct cace_amm_lookup_s    cace_amm_lookup_t;
 typedef struct cace_amm_obj_store_s cace_amm_obj_store_t;
 
@@ -42,7 +42,7 @@ void cace_amm_semtype_cnst_deinit(cace_amm_semtype_cnst_t *obj)
             break;
 #if PCRE_FOUND
         case AMM_SEMTYPE_CNST_TEXTPAT:
-            pcre2_code_free(obj->as_textpat);
+            cace_util_regex_release(obj->as_textpat);
             obj->as_textpat = NULL;
             break;
 #endif /* PCRE_FOUND */
@@ -93,13 +93,10 @@ int cace_amm_semtype_cnst_set_textpat(cace_amm_semtype_cnst_t *obj, const char *
 #if PCRE_FOUND
     cace_amm_semtype_cnst_deinit(obj);
 
-    const int   opts        = PCRE2_ANCHORED | PCRE2_ENDANCHORED;
-    int         errorcode   = 0;
-    PCRE2_SIZE  erroroffset = 0;
-    pcre2_code *cfg         = pcre2_compile((PCRE2_SPTR8)pat, strlen(pat), opts, &errorcode, &erroroffset, NULL);
+    // patterns are shared among all constraints with the same text
+    cace_util_regex_t *cfg = cace_util_regex_acquire(pat, strlen(pat));
     if (!cfg)
     {
-        CACE_LOG_ERR("Failed to compile regex pattern (error %d at %z): %s", errorcode, erroroffset, pat);
         return 2;
     }
 
@@ -181,21 +178,8 @@ bool cace_amm_semtype_cnst_is_valid(const cace_amm_semtype_cnst_t *obj, const ca
             {
                 return false;
             }
-            const pcre2_code *cfg = obj->as_textpat;
-
-            pcre2_match_data *md   = pcre2_match_data_create_from_pattern(cfg, NULL);
-            const int         opts = 0;
             // ignore terminating null
-            int res = pcre2_match(cfg, (PCRE2_SPTR8)(data->ptr), data->len - 1, 0, opts, md, NULL);
-            pcre2_match_data_free(md);
-
-            if ((res < 0) && cace_log_is_enabled_for(LOG_DEBUG))
-            {
-                PCRE2_UCHAR8 buf[128];
-                pcre2_get_error_message(res, buf, sizeof(buf));
-                CACE_LOG_DEBUG("Match regex result %d (%s) for: %s", res, buf, (const char *)(data->ptr));
-            }
-            retval = (res > 0);
+            retval = cace_util_regex_match(obj->as_textpat, (const char *)(data->ptr), data->len - 1);
             break;
         }
 #endif /* PCRE_FOUND */
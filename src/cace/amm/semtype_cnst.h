@@ -26,7 +26,7 @@
 #include "cace/config.h"
 #include "cace/util/range.h"
 #if PCRE_FOUND
-#include <pcre2.h>
+#include "cace/util/regex.h"
 #endif /* PCRE_FOUND */
 
 #ifdef __cplusplus
@@ -68,7 +68,7 @@ typedef struct cace_amm_semtype_cnst_s
         cace_util_range_size_t as_strlen;
 #if PCRE_FOUND
         /// Used when #type is ::AMM_SEMTYPE_CNST_TEXTPAT
-        pcre2_code *as_textpat;
+        cace_util_regex_t *as_textpat;
 #endif /* PCRE_FOUND */
     };
 } cace_amm_semtype_cnst_t;
@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "type_prog.h"
+#include "semtype.h"
+
+#include "cace/ari/tbl_cols.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+
+void cace_amm_type_prog_init(cace_amm_type_prog_t *prog)
+{
+    CHKVOID(prog);
+    cace_amm_type_instr_array_init(prog->instrs);
+}
+
+void cace_amm_type_prog_deinit(cace_amm_type_prog_t *prog)
+{
+    CHKVOID(prog);
+    cace_amm_type_instr_array_clear(prog->instrs);
+}
+
+/** Append a single instruction.
+ *
+ * @return The index of the new instruction.
+ */
+static size_t cace_amm_type_prog_push(cace_amm_type_prog_t *prog, cace_amm_type_prog_op_t op,
+                                      const cace_amm_type_t *type)
+{
+    const cace_amm_type_instr_t instr = {
+        .op     = op,
+        .span   = 1,
+        .nsub   = 0,
+        .type   = type,
+        .kernel = NULL,
+    };
+
+    const size_t idx = cace_amm_type_instr_array_size(prog->instrs);
+    cace_amm_type_instr_array_push_back(prog->instrs, instr);
+    return idx;
+}
+
+/// Set the span of an instruction after its sub-programs are appended
+static void cace_amm_type_prog_close(cace_amm_type_prog_t *prog, size_t idx, size_t nsub)
+{
+    cace_amm_type_instr_t *instr = cace_amm_type_instr_array_get(prog->instrs, idx);
+
+    instr->span = cace_amm_type_instr_array_size(prog->instrs) - idx;
+    instr->nsub = nsub;
+}
+
+static int cace_amm_type_prog_emit(cace_amm_type_prog_t *prog, const cace_amm_type_t *type);
+
+/** Emit the base of a type use.
+ * Built-in types are stable and are inlined, other types are owned by
+ * their own TYPEDEF and are referenced to avoid following circular uses.
+ */
+static int cace_amm_type_prog_emit_base(cace_amm_type_prog_t *prog, const cace_amm_type_t *base)
+{
+    if (base->type_class == CACE_AMM_TYPE_BUILTIN)
+    {
+        return cace_amm_type_prog_emit(prog, base);
+    }
+    cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_REF, base);
+    return 0;
+}
+
+static int cace_amm_type_prog_emit(cace_amm_type_prog_t *prog, const cace_amm_type_t *type)
+{
+    int retval = 0;
+    switch (type->type_class)
+    {
+        case CACE_AMM_TYPE_BUILTIN:
+        {
+            const size_t           idx   = cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_BUILTIN, type);
+            cace_amm_type_instr_t *instr = cace_amm_type_instr_array_get(prog->instrs, idx);
+
+            instr->kernel = cace_amm_type_get_builtin_kernel(type->as_builtin.ari_type);
+            break;
+        }
+        case CACE_AMM_TYPE_USE:
+        {
+            const cace_amm_semtype_use_t *semtype = type->as_semtype;
+            if (!semtype->base)
+            {
+                CACE_LOG_ERR("Cannot compile a type use which is not bound");
+                retval = 3;
+                break;
+            }
+
+            if (cace_amm_semtype_cnst_array_empty_p(semtype->constraints))
+            {
+                // the use is just an alias
+                retval = cace_amm_type_prog_emit_base(prog, semtype->base);
+            }
+            else
+            {
+                const size_t idx = cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_USE, type);
+                retval           = cace_amm_type_prog_emit_base(prog, semtype->base);
+                cace_amm_type_prog_close(prog, idx, 1);
+            }
+            break;
+        }
+        case CACE_AMM_TYPE_ULIST:
+        {
+            const cace_amm_semtype_ulist_t *semtype = type->as_semtype;
+
+            const size_t idx = cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_ULIST, type);
+            retval           = cace_amm_type_prog_emit(prog, &(semtype->item_type));
+            cace_amm_type_prog_close(prog, idx, 1);
+            break;
+        }
+        case CACE_AMM_TYPE_TBLT:
+        {
+            const cace_amm_semtype_tblt_t *semtype = type->as_semtype;
+
+            const size_t idx = cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_TBLT, type);
+
+            cace_amm_named_type_array_it_t it;
+            for (cace_amm_named_type_array_it(it, semtype->columns); !retval && !cace_amm_named_type_array_end_p(it);
+                 cace_amm_named_type_array_next(it))
+            {
+                const cace_amm_named_type_t *col = cace_amm_named_type_array_cref(it);
+                retval                           = cace_amm_type_prog_emit(prog, &(col->typeobj));
+            }
+            cace_amm_type_prog_close(prog, idx, cace_amm_named_type_array_size(semtype->columns));
+            break;
+        }
+        case CACE_AMM_TYPE_UNION:
+        {
+            const cace_amm_semtype_union_t *semtype = type->as_semtype;
+
+            const size_t idx = cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_UNION, type);
+
+            cace_amm_type_array_it_t it;
+            for (cace_amm_type_array_it(it, semtype->choices); !retval && !cace_amm_type_array_end_p(it);
+                 cace_amm_type_array_next(it))
+            {
+                retval = cace_amm_type_prog_emit(prog, cace_amm_type_array_cref(it));
+            }
+            cace_amm_type_prog_close(prog, idx, cace_amm_type_array_size(semtype->choices));
+            break;
+        }
+        case CACE_AMM_TYPE_DLIST:
+        case CACE_AMM_TYPE_UMAP:
+        case CACE_AMM_TYPE_SEQ:
+            // sub-types have their own programs, see cace_amm_type_compile()
+            cace_amm_type_prog_push(prog, CACE_AMM_TYPE_PROG_OP_GENERIC, type);
+            break;
+        default:
+            CACE_LOG_ERR("Cannot compile an invalid type");
+            retval = 2;
+            break;
+    }
+    return retval;
+}
+
+int cace_amm_type_prog_build(cace_amm_type_prog_t *prog, const cace_amm_type_t *type)
+{
+    CHKERR1(prog);
+    CHKERR1(type);
+
+    cace_amm_type_instr_array_reset(prog->instrs);
+    int res = cace_amm_type_prog_emit(prog, type);
+    if (res)
+    {
+        cace_amm_type_instr_array_reset(prog->instrs);
+    }
+    return res;
+}
+
+/** Match a built-in type using its kernel.
+ * The caller has already handled the undefined value.
+ */
+static inline cace_amm_type_match_res_t cace_amm_type_prog_kernel_match(const cace_amm_type_instr_t *pc,
+                                                                        const cace_ari_t            *ari)
+{
+    if (ari->is_ref)
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+    const cace_ari_lit_t *lit = &(ari->as_lit);
+    // explicit type matching
+    if (lit->has_ari_type && (lit->ari_type != pc->type->as_builtin.ari_type))
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+
+    const cace_amm_type_kernel_t *kernel = pc->kernel;
+    const uint32_t                bit    = UINT32_C(1) << lit->prim_type;
+    if (kernel->call_mask & bit)
+    {
+        return pc->type->match(pc->type, ari);
+    }
+    if (!(kernel->prim_mask & bit))
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+    if (kernel->has_range)
+    {
+        switch (lit->prim_type)
+        {
+            case CACE_ARI_PRIM_UINT64:
+                return cace_amm_type_match_pos_neg(lit->value.as_uint64 <= kernel->uint_max);
+            case CACE_ARI_PRIM_INT64:
+                return cace_amm_type_match_pos_neg((lit->value.as_int64 >= kernel->int_min)
+                                                   && (lit->value.as_int64 <= kernel->int_max));
+            default:
+                break;
+        }
+    }
+    return CACE_AMM_TYPE_MATCH_POSITIVE;
+}
+
+static cace_amm_type_match_res_t cace_amm_type_prog_match_at(const cace_amm_type_instr_t *pc, const cace_ari_t *ari);
+
+/// Match every item of an AC against a single item sub-program
+static cace_amm_type_match_res_t cace_amm_type_prog_match_ulist(const cace_amm_type_instr_t *pc, const cace_ari_t *ari)
+{
+    const cace_amm_semtype_ulist_t *semtype = pc->type->as_semtype;
+
+    const struct cace_ari_ac_s *val = cace_ari_cget_ac(ari);
+    if (!val)
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+
+    // overall size constraints
+    const size_t valsize = cace_ari_list_size(val->items);
+    if ((semtype->size.has_min && (valsize < semtype->size.i_min))
+        || (semtype->size.has_max && (valsize > semtype->size.i_max)))
+    {
+        CACE_LOG_DEBUG("AC size out of range: %zu", valsize);
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+
+    const cace_amm_type_instr_t *item_pc = pc + 1;
+    // homogeneous list of a built-in type
+    const bool use_kernel = (item_pc->op == CACE_AMM_TYPE_PROG_OP_BUILTIN) && item_pc->kernel;
+
+    cace_ari_list_it_t val_it;
+    for (cace_ari_list_it(val_it, val->items); !cace_ari_list_end_p(val_it); cace_ari_list_next(val_it))
+    {
+        const cace_ari_t *val_item = cace_ari_list_cref(val_it);
+
+        cace_amm_type_match_res_t got;
+        if (use_kernel)
+        {
+            got = cace_ari_is_undefined(val_item) ? CACE_AMM_TYPE_MATCH_UNDEFINED
+                                                  : cace_amm_type_prog_kernel_match(item_pc, val_item);
+        }
+        else
+        {
+            got = cace_amm_type_prog_match_at(item_pc, val_item);
+        }
+        if (got == CACE_AMM_TYPE_MATCH_NEGATIVE)
+        {
+            return got;
+        }
+    }
+
+    return CACE_AMM_TYPE_MATCH_POSITIVE;
+}
+
+/// Match every cell of a TBL against its column sub-program
+static cace_amm_type_match_res_t cace_amm_type_prog_match_tblt(const cace_amm_type_instr_t *pc, const cace_ari_t *ari)
+{
+    const struct cace_ari_tbl_s *val = cace_ari_cget_tbl(ari);
+    if (!val)
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+    if (val->ncols != pc->nsub)
+    {
+        CACE_LOG_DEBUG("TBLT needs %zu columns, value has %zu columns", pc->nsub, val->ncols);
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+    if (pc->nsub == 0)
+    {
+        return cace_amm_type_match_pos_neg(cace_ari_array_empty_p(val->items));
+    }
+
+    const size_t nrows = cace_ari_tbl_num_rows(val);
+
+    // walk column-major so each column sub-program is applied in turn
+    const cace_amm_type_instr_t *col_pc = pc + 1;
+    for (size_t col = 0; col < pc->nsub; ++col, col_pc += col_pc->span)
+    {
+        for (size_t row = 0; row < nrows; ++row)
+        {
+            cace_ari_t        buf;
+            const cace_ari_t *val_item = cace_ari_tbl_cview(val, row, col, &buf);
+
+            if (cace_amm_type_prog_match_at(col_pc, val_item) == CACE_AMM_TYPE_MATCH_NEGATIVE)
+            {
+                CACE_LOG_DEBUG("TBLT match failed for column %zu", col);
+                return CACE_AMM_TYPE_MATCH_NEGATIVE;
+            }
+        }
+    }
+
+    return CACE_AMM_TYPE_MATCH_POSITIVE;
+}
+
+/// Match the sub-program starting at a specific instruction
+static cace_amm_type_match_res_t cace_amm_type_prog_match_at(const cace_amm_type_instr_t *pc, const cace_ari_t *ari)
+{
+    switch (pc->op)
+    {
+        case CACE_AMM_TYPE_PROG_OP_REF:
+            return cace_amm_type_match(pc->type, ari);
+        case CACE_AMM_TYPE_PROG_OP_GENERIC:
+            if (!(pc->type->match))
+            {
+                return CACE_AMM_TYPE_MATCH_NEGATIVE;
+            }
+            return pc->type->match(pc->type, ari);
+        default:
+            break;
+    }
+
+    if (cace_ari_is_undefined(ari))
+    {
+        return CACE_AMM_TYPE_MATCH_UNDEFINED;
+    }
+
+    switch (pc->op)
+    {
+        case CACE_AMM_TYPE_PROG_OP_BUILTIN:
+            if (pc->kernel)
+            {
+                return cace_amm_type_prog_kernel_match(pc, ari);
+            }
+            return pc->type->match(pc->type, ari);
+        case CACE_AMM_TYPE_PROG_OP_USE:
+        {
+            cace_amm_type_match_res_t got = cace_amm_type_prog_match_at(pc + 1, ari);
+            if (got == CACE_AMM_TYPE_MATCH_NEGATIVE)
+            {
+                return got;
+            }
+            return cace_amm_type_match_pos_neg(cace_amm_semtype_use_constraints(pc->type->as_semtype, ari));
+        }
+        case CACE_AMM_TYPE_PROG_OP_ULIST:
+            return cace_amm_type_prog_match_ulist(pc, ari);
+        case CACE_AMM_TYPE_PROG_OP_TBLT:
+            return cace_amm_type_prog_match_tblt(pc, ari);
+        case CACE_AMM_TYPE_PROG_OP_UNION:
+        {
+            const cace_amm_type_instr_t *choice_pc = pc + 1;
+            for (size_t ix = 0; ix < pc->nsub; ++ix, choice_pc += choice_pc->span)
+            {
+                if (cace_amm_type_prog_match_at(choice_pc, ari) == CACE_AMM_TYPE_MATCH_POSITIVE)
+                {
+                    return CACE_AMM_TYPE_MATCH_POSITIVE;
+                }
+            }
+            return CACE_AMM_TYPE_MATCH_NEGATIVE;
+        }
+        default:
+            return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+}
+
+cace_amm_type_match_res_t cace_amm_type_prog_match(const cace_amm_type_prog_t *prog, const cace_ari_t *ari)
+{
+    CHKRET(prog, CACE_AMM_TYPE_MATCH_NEGATIVE);
+    CHKRET(ari, CACE_AMM_TYPE_MATCH_NEGATIVE);
+    if (cace_amm_type_instr_array_empty_p(prog->instrs))
+    {
+        return CACE_AMM_TYPE_MATCH_NEGATIVE;
+    }
+
+    return cace_amm_type_prog_match_at(cace_amm_type_instr_array_cget(prog->instrs, 0), ari);
+}
+
+static int cace_amm_type_prog_convert_at(const cace_amm_type_instr_t *pc, cace_ari_t *out, const cace_ari_t *in);
+
+/// Convert every item of an AC using a single item sub-program
+static int cace_amm_type_prog_convert_ulist(const cace_amm_type_instr_t *pc, cace_ari_t *out, const cace_ari_t *in)
+{
+    const cace_amm_semtype_ulist_t *semtype = pc->type->as_semtype;
+
+    const struct cace_ari_ac_s *inval = cace_ari_cget_ac(in);
+    if (!inval)
+    {
+        return CACE_AMM_ERR_CONVERT_BADVALUE;
+    }
+
+    // overall size constraints
+    const size_t valsize = cace_ari_list_size(inval->items);
+    if ((semtype->size.has_min && (valsize < semtype->size.i_min))
+        || (semtype->size.has_max && (valsize > semtype->size.i_max)))
+    {
+        return CACE_AMM_ERR_CONVERT_BADVALUE;
+    }
+
+    cace_ari_ac_t *out_ac = cace_ari_set_ac(out, NULL);
+
+    int retval = 0;
+
+    cace_ari_list_it_t inval_it;
+    for (cace_ari_list_it(inval_it, inval->items); !cace_ari_list_end_p(inval_it); cace_ari_list_next(inval_it))
+    {
+        const cace_ari_t *in_item = cace_ari_list_cref(inval_it);
+
+        cace_ari_t out_item = CACE_ARI_INIT_UNDEFINED;
+        // actual conversion
+        int res = cace_amm_type_prog_convert_at(pc + 1, &out_item, in_item);
+        if (res)
+        {
+            retval = res;
+            cace_ari_deinit(&out_item);
+            break;
+        }
+
+        cace_ari_list_push_back_move(out_ac->items, &out_item);
+    }
+
+    return retval;
+}
+
+/// Convert every cell of a TBL using its column sub-program
+static int cace_amm_type_prog_convert_tblt(const cace_amm_type_instr_t *pc, cace_ari_t *out, const cace_ari_t *in)
+{
+    const struct cace_ari_tbl_s *inval = cace_ari_cget_tbl(in);
+    if (!inval)
+    {
+        return CACE_AMM_ERR_CONVERT_BADVALUE;
+    }
+    if (inval->ncols != pc->nsub)
+    {
+        return CACE_AMM_ERR_CONVERT_BADVALUE;
+    }
+
+    // special case for needs-to-be-empty
+    const size_t nrows = cace_ari_tbl_num_rows(inval);
+
+    cace_ari_tbl_t *outval = cace_ari_set_tbl(out, NULL);
+    cace_ari_tbl_reset(outval, inval->ncols, 0);
+    if (cace_ari_tbl_is_packed(inval))
+    {
+        // output keeps the same form as the input
+        cace_ari_tbl_pack(outval);
+    }
+
+    for (size_t row = 0; row < nrows; ++row)
+    {
+        const cace_amm_type_instr_t *col_pc = pc + 1;
+        for (size_t col = 0; col < pc->nsub; ++col, col_pc += col_pc->span)
+        {
+            cace_ari_t        buf;
+            const cace_ari_t *in_item  = cace_ari_tbl_cview(inval, row, col, &buf);
+            cace_ari_t        out_item = CACE_ARI_INIT_UNDEFINED;
+
+            int res = cace_amm_type_prog_convert_at(col_pc, &out_item, in_item);
+            if (res)
+            {
+                cace_ari_deinit(&out_item);
+                return res;
+            }
+
+            if (outval->cols)
+            {
+                cace_ari_tbl_cols_push_move(outval->cols, &out_item);
+            }
+            else
+            {
+                cace_ari_array_push_move(outval->items, &out_item);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/// Convert using the sub-program starting at a specific instruction
+static int cace_amm_type_prog_convert_at(const cace_amm_type_instr_t *pc, cace_ari_t *out, const cace_ari_t *in)
+{
+    switch (pc->op)
+    {
+        case CACE_AMM_TYPE_PROG_OP_REF:
+            return cace_amm_type_convert(pc->type, out, in);
+        case CACE_AMM_TYPE_PROG_OP_USE:
+        {
+            int res = cace_amm_type_prog_convert_at(pc + 1, out, in);
+            CHKERRVAL(res);
+
+            if (!cace_amm_semtype_use_constraints(pc->type->as_semtype, out))
+            {
+                return CACE_AMM_ERR_CONVERT_FAILED_CONSTRAINT;
+            }
+            return 0;
+        }
+        case CACE_AMM_TYPE_PROG_OP_ULIST:
+            return cace_amm_type_prog_convert_ulist(pc, out, in);
+        case CACE_AMM_TYPE_PROG_OP_TBLT:
+            return cace_amm_type_prog_convert_tblt(pc, out, in);
+        default:
+            // built-in and union conversion is not flattened
+            CHKRET(pc->type->convert, CACE_AMM_ERR_CONVERT_NULLFUNC);
+            return pc->type->convert(pc->type, out, in);
+    }
+}
+
+int cace_amm_type_prog_convert(const cace_amm_type_prog_t *prog, cace_ari_t *out, const cace_ari_t *in)
+{
+    CHKERR1(prog);
+    CHKERR1(out);
+    CHKERR1(in);
+    if (cace_amm_type_instr_array_empty_p(prog->instrs))
+    {
+        return CACE_AMM_ERR_CONVERT_NULLFUNC;
+    }
+
+    return cace_amm_type_prog_convert_at(cace_amm_type_instr_array_cget(prog->instrs, 0), out, in);
+}
+
+/// Compile each owned sub-type of a semantic type
+static int cace_amm_type_compile_children(cace_amm_type_t *type)
+{
+    int failcnt = 0;
+    switch (type->type_class)
+    {
+        case CACE_AMM_TYPE_ULIST:
+        {
+            cace_amm_semtype_ulist_t *semtype = type->as_semtype;
+            failcnt += cace_amm_type_compile(&(semtype->item_type)) ? 1 : 0;
+            break;
+        }
+        case CACE_AMM_TYPE_DLIST:
+        {
+            cace_amm_semtype_dlist_t *semtype = type->as_semtype;
+
+            cace_amm_type_array_it_t it;
+            for (cace_amm_type_array_it(it, semtype->types); !cace_amm_type_array_end_p(it);
+                 cace_amm_type_array_next(it))
+            {
+                failcnt += cace_amm_type_compile(cace_amm_type_array_ref(it)) ? 1 : 0;
+            }
+            break;
+        }
+        case CACE_AMM_TYPE_UMAP:
+        {
+            cace_amm_semtype_umap_t *semtype = type->as_semtype;
+            failcnt += cace_amm_type_compile(&(semtype->key_type)) ? 1 : 0;
+            failcnt += cace_amm_type_compile(&(semtype->val_type)) ? 1 : 0;
+            break;
+        }
+        case CACE_AMM_TYPE_TBLT:
+        {
+            cace_amm_semtype_tblt_t *semtype = type->as_semtype;
+
+            cace_amm_named_type_array_it_t it;
+            for (cace_amm_named_type_array_it(it, semtype->columns); !cace_amm_named_type_array_end_p(it);
+                 cace_amm_named_type_array_next(it))
+            {
+                failcnt += cace_amm_type_compile(&(cace_amm_named_type_array_ref(it)->typeobj)) ? 1 : 0;
+            }
+            break;
+        }
+        case CACE_AMM_TYPE_UNION:
+        {
+            cace_amm_semtype_union_t *semtype = type->as_semtype;
+
+            cace_amm_type_array_it_t it;
+            for (cace_amm_type_array_it(it, semtype->choices); !cace_amm_type_array_end_p(it);
+                 cace_amm_type_array_next(it))
+            {
+                failcnt += cace_amm_type_compile(cace_amm_type_array_ref(it)) ? 1 : 0;
+            }
+            break;
+        }
+        case CACE_AMM_TYPE_SEQ:
+        {
+            cace_amm_semtype_seq_t *semtype = type->as_semtype;
+            failcnt += cace_amm_type_compile(&(semtype->item_type)) ? 1 : 0;
+            break;
+        }
+        default:
+            break;
+    }
+    return failcnt;
+}
+
+int cace_amm_type_compile(cace_amm_type_t *type)
+{
+    CHKERR1(type);
+
+    switch (type->type_class)
+    {
+        case CACE_AMM_TYPE_INVALID:
+            return 2;
+        case CACE_AMM_TYPE_BUILTIN:
+            // already a direct match
+            return 0;
+        default:
+            break;
+    }
+
+    if (type->prog)
+    {
+        cace_amm_type_prog_deinit(type->prog);
+        CACE_FREE(type->prog);
+        type->prog = NULL;
+    }
+
+    int failcnt = cace_amm_type_compile_children(type);
+    if (type->type_class == CACE_AMM_TYPE_SEQ)
+    {
+        // only used from within a diverse list
+        return failcnt ? 3 : 0;
+    }
+
+    cace_amm_type_prog_t *prog = CACE_MALLOC(sizeof(cace_amm_type_prog_t));
+    if (!prog)
+    {
+        return 2;
+    }
+    cace_amm_type_prog_init(prog);
+
+    if (cace_amm_type_prog_build(prog, type))
+    {
+        cace_amm_type_prog_deinit(prog);
+        CACE_FREE(prog);
+        return 3;
+    }
+    type->prog = prog;
+
+    return failcnt ? 3 : 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_amm
+ * This file contains definitions for compiled matching programs of AMM
+ * types, which flatten the recursive semantic type structure.
+ */
+#ifndef CACE_AMM_TYPE_PROG_H_
+#define CACE_AMM_TYPE_PROG_H_
+
+#include "typing.h"
+
+#include <m-array.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Operations within a compiled type program
+typedef enum
+{
+    /// Match a built-in type, using an inline kernel if one is available
+    CACE_AMM_TYPE_PROG_OP_BUILTIN,
+    /// Match the single following sub-program then check use constraints
+    CACE_AMM_TYPE_PROG_OP_USE,
+    /// Dispatch to a separately-owned type object, using its own program if compiled
+    CACE_AMM_TYPE_PROG_OP_REF,
+    /// Match an AC with every item matching the single following sub-program
+    CACE_AMM_TYPE_PROG_OP_ULIST,
+    /// Match a TBL with each column matching one of the following sub-programs
+    CACE_AMM_TYPE_PROG_OP_TBLT,
+    /// Match any one of the following sub-programs
+    CACE_AMM_TYPE_PROG_OP_UNION,
+    /// Fall back to the match and convert functions of the type object
+    CACE_AMM_TYPE_PROG_OP_GENERIC,
+} cace_amm_type_prog_op_t;
+
+/// A single instruction of a compiled type program
+typedef struct
+{
+    /// The operation to perform
+    cace_amm_type_prog_op_t op;
+    /// The number of instructions in this sub-program, including this one
+    size_t span;
+    /// The number of direct sub-programs following this instruction
+    size_t nsub;
+    /** The type object this instruction was compiled from.
+     * This is always a reference to an externally-owned object.
+     */
+    const cace_amm_type_t *type;
+    /// Optional inline kernel for a ::CACE_AMM_TYPE_PROG_OP_BUILTIN
+    const cace_amm_type_kernel_t *kernel;
+} cace_amm_type_instr_t;
+
+/** @struct cace_amm_type_instr_array_t
+ * An array of type program instructions.
+ */
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(cace_amm_type_instr_array, cace_amm_type_instr_t, M_POD_OPLIST)
+/// @endcond
+
+/** A compiled type program.
+ * The instructions are stored in pre-order, so that each sub-program
+ * is a contiguous range of instructions.
+ */
+struct cace_amm_type_prog_s
+{
+    /// The instructions of this program, starting with the top-level type
+    cace_amm_type_instr_array_t instrs;
+};
+
+/// A typedef for compiled type programs
+typedef struct cace_amm_type_prog_s cace_amm_type_prog_t;
+
+void cace_amm_type_prog_init(cace_amm_type_prog_t *prog);
+
+void cace_amm_type_prog_deinit(cace_amm_type_prog_t *prog);
+
+/** Compile a program from a type object.
+ * Any type use must already be bound to its base type.
+ *
+ * @param[out] prog The program to reset and populate.
+ * @param[in] type The type to compile from.
+ * This object must outlive the program.
+ * @return Zero if successful.
+ */
+int cace_amm_type_prog_build(cace_amm_type_prog_t *prog, const cace_amm_type_t *type);
+
+/** Determine if a compiled program matches a specific value.
+ * This has the same result as cace_amm_type_match() for the source type.
+ *
+ * @param[in] prog The program to check against.
+ * @param[in] ari The value to check.
+ * @return The match result.
+ */
+cace_amm_type_match_res_t cace_amm_type_prog_match(const cace_amm_type_prog_t *prog, const cace_ari_t *ari);
+
+/** Convert a value using a compiled program.
+ * This has the same result as cace_amm_type_convert() for the source type.
+ *
+ * @param[in] prog The program to convert with.
+ * @param[out] out The converted value (valid if the return is zero).
+ * @param[in] in The value to convert.
+ * @return Zero if the conversion is successful.
+ */
+int cace_amm_type_prog_convert(const cace_amm_type_prog_t *prog, cace_ari_t *out, const cace_ari_t *in);
+
+/** Compile a type object and all of its owned sub-types, caching the
+ * program in cace_amm_type_s::prog.
+ * After this the cace_amm_type_match() and cace_amm_type_convert()
+ * functions use the program.
+ *
+ * @note Any type use must already be bound to its base type, and the
+ * type must be compiled again if it is modified afterward.
+ *
+ * @param[in,out] type The type to compile.
+ * @return Zero if successful.
+ */
+int cace_amm_type_compile(cace_amm_type_t *type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACE_AMM_TYPE_PROG_H_ */
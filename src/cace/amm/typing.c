@@ -19,6 +19,7 @@
 
 #include "lookup.h"
 #include "semtype.h"
+#include "type_prog.h"
 
 #include "cace/ari/algo.h"
 #include "cace/ari/text.h"
@@ -964,14 +965,154 @@ static cace_amm_type_t cace_amm_builtins[] = {
     },
 };
 
+/// Bit for a primitive type within a cace_amm_type_kernel_t mask
+#define CACE_AMM_PRIM_BIT(prim) (UINT32_C(1) << (prim))
+
+/// Association of a built-in type with its inline kernel
+typedef struct
+{
+    /// The ARI type of the built-in
+    cace_ari_type_t ari_type;
+    /// The kernel for that type
+    cace_amm_type_kernel_t kernel;
+} cace_amm_builtin_kernel_t;
+
+/** Kernels which agree with the match functions of ::cace_amm_builtins.
+ * Integer types defer floating point values to their match functions.
+ */
+static const cace_amm_builtin_kernel_t cace_amm_builtin_kernels[] = {
+    {
+        .ari_type         = CACE_ARI_TYPE_NULL,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_NULL),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_BOOL,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_BOOL),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_BYTE,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+        .kernel.has_range = true,
+        .kernel.uint_max  = UINT8_MAX,
+        .kernel.int_min   = 0,
+        .kernel.int_max   = UINT8_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_INT,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+        .kernel.has_range = true,
+        .kernel.uint_max  = INT32_MAX,
+        .kernel.int_min   = INT32_MIN,
+        .kernel.int_max   = INT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_UINT,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+        .kernel.has_range = true,
+        .kernel.uint_max  = UINT32_MAX,
+        .kernel.int_min   = 0,
+        .kernel.int_max   = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_VAST,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+        .kernel.has_range = true,
+        .kernel.uint_max  = INT64_MAX,
+        .kernel.int_min   = 0,
+        .kernel.int_max   = INT64_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_UVAST,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+        .kernel.has_range = true,
+        .kernel.uint_max  = UINT64_MAX,
+        .kernel.int_min   = 0,
+        .kernel.int_max   = INT64_MAX,
+    },
+    {
+        // all integers are within range of single precision
+        .ari_type         = CACE_ARI_TYPE_REAL32,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+        .kernel.call_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_REAL64,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_UINT64) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64)
+                          | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_FLOAT64),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_TEXTSTR,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_TSTR),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_BYTESTR,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_BSTR),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_TP,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_TD,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_LABEL,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_TSTR) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_CBOR,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_ARITYPE,
+        .kernel.prim_mask = CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_TSTR) | CACE_AMM_PRIM_BIT(CACE_ARI_PRIM_INT64),
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_AC,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_AM,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_TBL,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_EXECSET,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_RPTSET,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+    {
+        .ari_type         = CACE_ARI_TYPE_OBJPAT,
+        .kernel.prim_mask = UINT32_MAX,
+    },
+};
+
 #if ENABLE_LUT_CACHE
 
 M_DICT_DEF2(cace_amm_type_lookup, cace_ari_type_t, M_BASIC_OPLIST, const cace_amm_type_t *, M_PTR_OPLIST)
 
+M_DICT_DEF2(cace_amm_type_kernel_lookup, cace_ari_type_t, M_BASIC_OPLIST, const cace_amm_type_kernel_t *,
+            M_PTR_OPLIST)
+
 /// Cached type dictionary
 static cace_amm_type_lookup_t cace_amm_builtin_dict;
 
-/// Initializer for #cace_amm_builtin_dict
+/// Cached kernel dictionary
+static cace_amm_type_kernel_lookup_t cace_amm_builtin_kernel_dict;
+
+/// Initializer for #cace_amm_builtin_dict and #cace_amm_builtin_kernel_dict
 void cace_amm_builtin_dict_init(void)
 {
     const cace_amm_type_t *curs = cace_amm_builtins;
@@ -983,6 +1124,16 @@ void cace_amm_builtin_dict_init(void)
     {
         cace_amm_type_lookup_set_at(cace_amm_builtin_dict, curs->as_builtin.ari_type, curs);
     }
+
+    const cace_amm_builtin_kernel_t *kcurs = cace_amm_builtin_kernels;
+    const cace_amm_builtin_kernel_t *kend =
+        kcurs + sizeof(cace_amm_builtin_kernels) / sizeof(cace_amm_builtin_kernel_t);
+
+    cace_amm_type_kernel_lookup_init(cace_amm_builtin_kernel_dict);
+    for (; kcurs < kend; ++kcurs)
+    {
+        cace_amm_type_kernel_lookup_set_at(cace_amm_builtin_kernel_dict, kcurs->ari_type, &(kcurs->kernel));
+    }
 }
 
 /// Guard for cace_amm_builtin_dict_init()
@@ -999,6 +1150,14 @@ const cace_amm_type_t *cace_amm_type_get_builtin(cace_ari_type_t ari_type)
     return found ? *found : NULL;
 }
 
+const cace_amm_type_kernel_t *cace_amm_type_get_builtin_kernel(cace_ari_type_t ari_type)
+{
+    pthread_once(&cace_amm_builtin_dict_ctrl, cace_amm_builtin_dict_init);
+    const cace_amm_type_kernel_t **found = cace_amm_type_kernel_lookup_get(cace_amm_builtin_kernel_dict, ari_type);
+    // not all built-in types have a kernel
+    return found ? *found : NULL;
+}
+
 #else
 
 const cace_amm_type_t *cace_amm_type_get_builtin(cace_ari_type_t ari_type)
@@ -1014,6 +1173,20 @@ const cace_amm_type_t *cace_amm_type_get_builtin(cace_ari_type_t ari_type)
     return NULL;
 }
 
+const cace_amm_type_kernel_t *cace_amm_type_get_builtin_kernel(cace_ari_type_t ari_type)
+{
+    const cace_amm_builtin_kernel_t *end =
+        cace_amm_builtin_kernels + sizeof(cace_amm_builtin_kernels) / sizeof(cace_amm_builtin_kernel_t);
+    for (const cace_amm_builtin_kernel_t *curs = cace_amm_builtin_kernels; curs < end; ++curs)
+    {
+        if (curs->ari_type == ari_type)
+        {
+            return &(curs->kernel);
+        }
+    }
+    return NULL;
+}
+
 #endif /* ENABLE_LUT_CACHE */
 
 void cace_amm_type_init(cace_amm_type_t *type)
@@ -1026,6 +1199,13 @@ void cace_amm_type_deinit(cace_amm_type_t *type)
 {
     CHKVOID(type);
 
+    if (type->prog)
+    {
+        cace_amm_type_prog_deinit(type->prog);
+        CACE_FREE(type->prog);
+        type->prog = NULL;
+    }
+
     // clean up semtype state
     switch (type->type_class)
     {
@@ -1203,6 +1383,10 @@ cace_amm_type_match_res_t cace_amm_type_match(const cace_amm_type_t *type, const
 {
     CHKRET(type, CACE_AMM_TYPE_MATCH_NEGATIVE);
     CHKRET(ari, CACE_AMM_TYPE_MATCH_NEGATIVE);
+    if (type->prog)
+    {
+        return cace_amm_type_prog_match(type->prog, ari);
+    }
     if (!(type->match))
     {
         return CACE_AMM_TYPE_MATCH_NEGATIVE;
@@ -1217,6 +1401,10 @@ int cace_amm_type_convert(const cace_amm_type_t *type, cace_ari_t *out, const ca
     CHKERR1(out);
     CHKERR1(in);
 
+    if (type->prog)
+    {
+        return cace_amm_type_prog_convert(type->prog, out, in);
+    }
     CHKRET(type->convert, CACE_AMM_ERR_CONVERT_NULLFUNC);
 
     return type->convert(type, out, in);
@@ -42,6 +42,9 @@ struct cace_amm_type_s;
 /// A typedef representing an AMM semantic type.
 typedef struct cace_amm_type_s cace_amm_type_t;
 
+// Forward declaration of compiled type programs in type_prog.h
+struct cace_amm_type_prog_s;
+
 #define CACE_AMM_TYPE_INIT_INVALID                                          \
     (cace_amm_type_t)                                                       \
     {                                                                       \
@@ -179,6 +182,12 @@ struct cace_amm_type_s
 
     // De-initializing function for #as_semtype when it is valid
     cace_amm_semtype_deinit_f as_semtype_deinit;
+
+    /** Optional compiled program, see cace_amm_type_compile().
+     * When present it is owned by this type object and is used by
+     * cace_amm_type_match() and cace_amm_type_convert().
+     */
+    struct cace_amm_type_prog_s *prog;
 };
 
 /** Get a built-in type object.
@@ -189,6 +198,34 @@ struct cace_amm_type_s
  */
 const cace_amm_type_t *cace_amm_type_get_builtin(cace_ari_type_t ari_type);
 
+/** Inline matching parameters for a built-in literal type.
+ * These are used by compiled type programs to avoid a function call for
+ * the most common built-in types.
+ */
+typedef struct
+{
+    /// Set of accepted primitive types, each bit as (1 << ::cace_ari_prim_type_e)
+    uint32_t prim_mask;
+    /// Set of primitive types which need the full match function
+    uint32_t call_mask;
+    /// True if integer primitive values are range checked with the limits below
+    bool has_range;
+    /// Maximum for ::CACE_ARI_PRIM_UINT64 values
+    uint64_t uint_max;
+    /// Minimum for ::CACE_ARI_PRIM_INT64 values
+    int64_t int_min;
+    /// Maximum for ::CACE_ARI_PRIM_INT64 values
+    int64_t int_max;
+} cace_amm_type_kernel_t;
+
+/** Get an inline matching kernel for a built-in type.
+ *
+ * @param ari_type The associated literal type to lookup.
+ * @return A stable pointer to the kernel or a null pointer if the built-in
+ * type has no kernel and its match function must be used.
+ */
+const cace_amm_type_kernel_t *cace_amm_type_get_builtin_kernel(cace_ari_type_t ari_type);
+
 /** Determine if a type object is valid.
  *
  * @param[in] type The object to check.
@@ -228,23 +228,19 @@ int cace_amp_ion_bp_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta,
         }
     }
 
-    m_bstring_t msgbuf;
-    m_bstring_init(msgbuf);
+    // receive directly into the retained message
+    cace_data_t *msgbuf = &(meta->encoded);
     if (!retval)
     {
         cace_ari_set_tstr(&meta->src, dlv.bundleSourceEid, true);
         cace_get_system_time(&meta->timestamp);
 
         const vast adu_len = zco_source_data_length(sdr, dlv.adu);
-        if (adu_len)
+        if (adu_len && !cace_data_resize(msgbuf, adu_len))
         {
-            m_bstring_resize(msgbuf, adu_len);
-            uint8_t *msg_begin = m_bstring_acquire_access(msgbuf, 0, adu_len);
-
             ZcoReader reader;
             zco_start_receiving(dlv.adu, &reader);
-            vast got = zco_receive_source(sdr, &reader, adu_len, (char *)msg_begin);
-            m_bstring_release_access(msgbuf);
+            vast got = zco_receive_source(sdr, &reader, adu_len, (char *)msgbuf->ptr);
             if (got != adu_len)
             {
                 CACE_LOG_ERR("zco_receive_source() wanted %ll but got %ll", adu_len, got);
@@ -262,15 +258,12 @@ int cace_amp_ion_bp_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta,
 
     if (!retval)
     {
-        const size_t   msgbuf_len = m_bstring_size(msgbuf);
-        const uint8_t *msgbuf_ptr = m_bstring_view(msgbuf, 0, msgbuf_len);
-        if (cace_amp_msg_decode(data, msgbuf_ptr, msgbuf_len))
+        if (cace_amp_msg_decode_meta(data, meta, 0))
         {
             retval = 6;
         }
         CACE_LOG_DEBUG("decoded %d ARI items in the datagram", cace_ari_list_size(data));
     }
-    m_bstring_clear(msgbuf);
 
     bp_release_delivery(&dlv, 1);
 
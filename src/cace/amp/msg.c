@@ -18,6 +18,7 @@
 #include "msg.h"
 
 #include "cace/ari/cbor.h"
+#include "cace/ari/cbor_scan.h"
 #include "cace/ari/text.h"
 #include "cace/util/defs.h"
 #include "cace/util/logging.h"
@@ -63,6 +64,18 @@ int cace_amp_msg_encode(m_bstring_t msgbuf, const cace_ari_list_t items)
 }
 
 int cace_amp_msg_decode(cace_ari_list_t items, const uint8_t *msgbuf_ptr, size_t msgbuf_len)
+{
+    return cace_amp_msg_decode_spans(items, NULL, msgbuf_ptr, msgbuf_len);
+}
+
+/** Common decoding for all message forms.
+ *
+ * @param span_base The offset of @c msgbuf_ptr to add to each span.
+ * @param defer If true, items are only checked to be well-formed and are
+ * left undefined in the @c items list.
+ */
+static int cace_amp_msg_decode_items(cace_ari_list_t items, cace_amm_msg_if_span_list_t spans, size_t span_base,
+                                     const uint8_t *msgbuf_ptr, size_t msgbuf_len, bool defer)
 {
     int retval = 0;
 
@@ -115,7 +128,23 @@ int cace_amp_msg_decode(cace_ari_list_t items, const uint8_t *msgbuf_ptr, size_t
         size_t used;
         char  *errm = NULL;
 
-        res = cace_ari_cbor_decode(&item, &view, &used, &errm);
+        if (defer)
+        {
+            cace_ari_cbor_span_t span = { 0 };
+
+            res  = cace_ari_cbor_skip(&view, 0, &span);
+            used = span.len;
+            if (res)
+            {
+                m_string_t err;
+                m_string_init_printf(err, "not well-formed CBOR, error %d", res);
+                errm = m_string_clear_get_cstr(err);
+            }
+        }
+        else
+        {
+            res = cace_ari_cbor_decode(&item, &view, &used, &errm);
+        }
         cace_data_deinit(&view);
         if (used)
         {
@@ -133,7 +162,7 @@ int cace_amp_msg_decode(cace_ari_list_t items, const uint8_t *msgbuf_ptr, size_t
             break;
         }
 
-        if (cace_log_is_enabled_for(LOG_DEBUG))
+        if (!defer && cace_log_is_enabled_for(LOG_DEBUG))
         {
             m_string_t buf;
             m_string_init(buf);
@@ -142,8 +171,33 @@ int cace_amp_msg_decode(cace_ari_list_t items, const uint8_t *msgbuf_ptr, size_t
             m_string_clear(buf);
         }
 
+        if (spans)
+        {
+            const cace_amm_msg_if_span_t span = { .offset = span_base + offset - used, .len = used };
+            cace_amm_msg_if_span_list_push_back(spans, span);
+        }
         cace_ari_list_push_back_move(items, &item);
     }
 
     return retval;
 }
+
+int cace_amp_msg_decode_spans(cace_ari_list_t items, cace_amm_msg_if_span_list_t spans, const uint8_t *msgbuf_ptr,
+                              size_t msgbuf_len)
+{
+    return cace_amp_msg_decode_items(items, spans, 0, msgbuf_ptr, msgbuf_len, false);
+}
+
+int cace_amp_msg_decode_meta(cace_ari_list_t items, cace_amm_msg_if_metadata_t *meta, size_t offset)
+{
+    CHKERR1(meta);
+    if (offset > meta->encoded.len)
+    {
+        return 2;
+    }
+
+    cace_amm_msg_if_span_list_reset(meta->item_spans);
+    // decode in-place, the spans refer to the same buffer
+    return cace_amp_msg_decode_items(items, meta->item_spans, offset, meta->encoded.ptr + offset,
+                                     meta->encoded.len - offset, meta->defer_decode);
+}
@@ -22,6 +22,7 @@
 #ifndef CACE_AMP_MSG_H_
 #define CACE_AMP_MSG_H_
 
+#include "cace/amm/msg_if.h"
 #include "cace/ari/containers.h"
 
 #include <m-bstring.h>
@@ -49,6 +50,35 @@ int cace_amp_msg_encode(m_bstring_t msgbuf, const cace_ari_list_t items);
  */
 int cace_amp_msg_decode(cace_ari_list_t items, const uint8_t *msgbuf_ptr, size_t msgbuf_len);
 
+/** Decode a single AMP message and record where each item was encoded.
+ *
+ * @param[out] items The items list to decode into.
+ * This must be already initialized.
+ * @param[out] spans If non-null, the list to append the location of each
+ * decoded item into, in the same order as @c items.
+ * @param[in] msgbuf_ptr The message buffer to decode from.
+ * @param msgbuf_len The length of valid data at @c msgbuf_ptr.
+ * @return Zero if successful.
+ */
+int cace_amp_msg_decode_spans(cace_ari_list_t items, cace_amm_msg_if_span_list_t spans, const uint8_t *msgbuf_ptr,
+                              size_t msgbuf_len);
+
+/** Decode a single AMP message for a message interface reception.
+ * The message must already be received into
+ * cace_amm_msg_if_metadata_t::encoded, which is decoded in-place and
+ * retained along with the location of each decoded item.
+ * When cace_amm_msg_if_metadata_t::defer_decode is set, the items are only
+ * checked to be well-formed and are left undefined.
+ *
+ * @param[out] items The items list to decode into.
+ * This must be already initialized.
+ * @param[in,out] meta The reception metadata to update.
+ * @param offset The offset within the encoded message at which the AMP
+ * message starts, to skip over any transport header.
+ * @return Zero if successful.
+ */
+int cace_amp_msg_decode_meta(cace_ari_list_t items, cace_amm_msg_if_metadata_t *meta, size_t offset);
+
 #ifdef __cplusplus
 } // extern C
 #endif
@@ -279,8 +279,8 @@ int cace_amp_proxy_cli_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *me
 
     int result = 0;
 
-    m_bstring_t msgbuf;
-    m_bstring_init(msgbuf);
+    // receive directly into the retained message
+    cace_data_t *msgbuf = &(meta->encoded);
 
     while (true)
     {
@@ -338,13 +338,14 @@ int cace_amp_proxy_cli_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *me
         CACE_LOG_INFO("Peeked socket datagram with %zd octets", got);
 
         {
-            m_bstring_resize(msgbuf, got);
-            const size_t msg_size  = m_bstring_size(msgbuf);
-            uint8_t     *msg_begin = m_bstring_acquire_access(msgbuf, 0, msg_size);
+            if (cace_data_resize(msgbuf, got))
+            {
+                result = 2;
+                break;
+            }
 
             flags = 0;
-            got   = recv(sock_fd, msg_begin, msg_size, flags);
-            m_bstring_release_access(msgbuf);
+            got   = recv(sock_fd, msgbuf->ptr, msgbuf->len, flags);
             if (got <= 0)
             {
                 CACE_LOG_WARNING("ignoring failed recv() with errno %d", errno);
@@ -355,11 +356,10 @@ int cace_amp_proxy_cli_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *me
         CACE_LOG_INFO("Received socket datagram with %zd octets", got);
 
         // Decode the proxy header
-        const uint8_t *msg_begin = m_bstring_view(msgbuf, 0, got);
-        size_t         head_len;
+        size_t head_len;
         {
             cace_data_t view;
-            cace_data_init_view(&view, got, (uint8_t *)msg_begin);
+            cace_data_init_view(&view, got, msgbuf->ptr);
             cace_get_system_time(&meta->timestamp);
             int ret = cace_ari_cbor_decode(&meta->src, &view, &head_len, NULL);
             if (ret)
@@ -376,10 +376,8 @@ int cace_amp_proxy_cli_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *me
 
         if (!result)
         {
-            // view past the proxy header
-            const size_t   msgbuf_len = got - head_len;
-            const uint8_t *msgbuf_ptr = m_bstring_view(msgbuf, head_len, msgbuf_len);
-            if (cace_amp_msg_decode(data, msgbuf_ptr, msgbuf_len))
+            // decode past the proxy header
+            if (cace_amp_msg_decode_meta(data, meta, head_len))
             {
                 CACE_LOG_ERR("failed message decode");
                 result = 4;
@@ -398,6 +396,5 @@ int cace_amp_proxy_cli_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *me
         }
     }
 
-    m_bstring_clear(msgbuf);
     return result;
 }
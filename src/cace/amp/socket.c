@@ -243,8 +243,8 @@ int cace_amp_socket_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta,
 
     int retval = 0;
 
-    m_bstring_t msgbuf;
-    m_bstring_init(msgbuf);
+    // receive directly into the retained message
+    cace_data_t *msgbuf = &(meta->encoded);
     while (!retval)
     {
         // Wait up to 1 second
@@ -277,19 +277,19 @@ int cace_amp_socket_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta,
             }
             CACE_LOG_DEBUG("peeked datagram with %zd octets", got);
 
-            m_bstring_resize(msgbuf, got);
+            if (cace_data_resize(msgbuf, got))
+            {
+                retval = 4;
+                break;
+            }
 
             struct sockaddr_un saddr;
             saddr.sun_family = AF_UNIX;
 
-            const size_t msg_size  = m_bstring_size(msgbuf);
-            uint8_t     *msg_begin = m_bstring_acquire_access(msgbuf, 0, msg_size);
-
             socklen_t saddr_len = sizeof(saddr);
 
             flags = 0;
-            got   = recvfrom(poll_sock->fd, msg_begin, msg_size, flags, (struct sockaddr *)&saddr, &saddr_len);
-            m_bstring_release_access(msgbuf);
+            got   = recvfrom(poll_sock->fd, msgbuf->ptr, msgbuf->len, flags, (struct sockaddr *)&saddr, &saddr_len);
             if (got < 0)
             {
                 CACE_LOG_WARNING("ignoring failed recvfrom() with errno %d", errno);
@@ -317,15 +317,12 @@ int cace_amp_socket_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta,
 
     if (!retval)
     {
-        const size_t   msgbuf_len = m_bstring_size(msgbuf);
-        const uint8_t *msgbuf_ptr = m_bstring_view(msgbuf, 0, msgbuf_len);
-        if (cace_amp_msg_decode(data, msgbuf_ptr, msgbuf_len))
+        if (cace_amp_msg_decode_meta(data, meta, 0))
         {
             retval = 5;
         }
         CACE_LOG_DEBUG("decoded %d ARI items in the datagram", cace_ari_list_size(data));
     }
-    m_bstring_clear(msgbuf);
 
     return retval;
 }
@@ -654,6 +654,10 @@ struct cace_ari_ac_s *cace_ari_get_ac(cace_ari_t *ari)
     {
         return NULL;
     }
+    if (cace_ari_lit_unshare(&(ari->as_lit)))
+    {
+        return NULL;
+    }
     return ari->as_lit.value.as_ac;
 }
 
@@ -671,7 +675,7 @@ struct cace_ari_ac_s *cace_ari_set_ac(cace_ari_t *ari, struct cace_ari_ac_s *src
     CHKNULL(ari);
     cace_ari_deinit(ari);
 
-    cace_ari_ac_t *ctr = CACE_MALLOC(sizeof(cace_ari_ac_t));
+    cace_ari_ac_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_ac_t));
     cace_ari_ac_init(ctr);
     if (src)
     {
@@ -693,6 +697,10 @@ struct cace_ari_am_s *cace_ari_get_am(cace_ari_t *ari)
     {
         return NULL;
     }
+    if (cace_ari_lit_unshare(&(ari->as_lit)))
+    {
+        return NULL;
+    }
     return ari->as_lit.value.as_am;
 }
 
@@ -710,7 +718,7 @@ struct cace_ari_am_s *cace_ari_set_am(cace_ari_t *ari, struct cace_ari_am_s *src
     CHKNULL(ari);
     cace_ari_deinit(ari);
 
-    cace_ari_am_t *ctr = CACE_MALLOC(sizeof(cace_ari_am_t));
+    cace_ari_am_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_am_t));
     cace_ari_am_init(ctr);
     if (src)
     {
@@ -732,6 +740,12 @@ struct cace_ari_tbl_s *cace_ari_get_tbl(cace_ari_t *ari)
     {
         return NULL;
     }
+    if (cace_ari_lit_unshare(&(ari->as_lit)))
+    {
+        return NULL;
+    }
+    // modifications are made to the row-major form
+    cace_ari_tbl_unpack(ari->as_lit.value.as_tbl);
     return ari->as_lit.value.as_tbl;
 }
 
@@ -749,12 +763,14 @@ struct cace_ari_tbl_s *cace_ari_set_tbl(cace_ari_t *ari, struct cace_ari_tbl_s *
     CHKNULL(ari);
     cace_ari_deinit(ari);
 
-    cace_ari_tbl_t *ctr = CACE_MALLOC(sizeof(cace_ari_tbl_t));
+    cace_ari_tbl_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_tbl_t));
     cace_ari_tbl_init(ctr);
     if (src)
     {
         ctr->ncols = src->ncols;
         cace_ari_array_move(ctr->items, src->items);
+        ctr->cols = src->cols;
+        src->cols = NULL;
     }
 
     *cace_ari_init_lit(ari) = (cace_ari_lit_t) { .has_ari_type = true,
@@ -772,6 +788,10 @@ struct cace_ari_execset_s *cace_ari_get_execset(cace_ari_t *ari)
     {
         return NULL;
     }
+    if (cace_ari_lit_unshare(&(ari->as_lit)))
+    {
+        return NULL;
+    }
     return ari->as_lit.value.as_execset;
 }
 
@@ -789,7 +809,7 @@ struct cace_ari_execset_s *cace_ari_set_execset(cace_ari_t *ari)
     CHKNULL(ari);
     cace_ari_deinit(ari);
 
-    cace_ari_execset_t *ctr = CACE_MALLOC(sizeof(cace_ari_execset_t));
+    cace_ari_execset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_execset_t));
     cace_ari_execset_init(ctr);
 
     *cace_ari_init_lit(ari) = (cace_ari_lit_t) { .has_ari_type = true,
@@ -808,6 +828,10 @@ struct cace_ari_rptset_s *cace_ari_get_rptset(cace_ari_t *ari)
     {
         return NULL;
     }
+    if (cace_ari_lit_unshare(&(ari->as_lit)))
+    {
+        return NULL;
+    }
     return ari->as_lit.value.as_rptset;
 }
 
@@ -825,7 +849,7 @@ struct cace_ari_rptset_s *cace_ari_set_rptset(cace_ari_t *ari)
     CHKNULL(ari);
     cace_ari_deinit(ari);
 
-    cace_ari_rptset_t *ctr = CACE_MALLOC(sizeof(cace_ari_rptset_t));
+    cace_ari_rptset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_rptset_t));
     cace_ari_rptset_init(ctr);
 
     *cace_ari_init_lit(ari) = (cace_ari_lit_t) { .has_ari_type = true,
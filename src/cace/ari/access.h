@@ -281,6 +281,14 @@ struct cace_ari_am_s *cace_ari_get_am(cace_ari_t *ari);
 /// @overload
 const struct cace_ari_am_s *cace_ari_cget_am(const cace_ari_t *ari);
 
+/** Require a TBL value and extract a pointer to its struct.
+ * The mutable form is always unpacked to row-major values, while the
+ * const form may be in either form.
+ *
+ * @param[in] ari The ARI to read.
+ * @return Pointer to the contained TBL struct, if present, otherwise NULL.
+ * @sa cace_ari_tbl_cview()
+ */
 struct cace_ari_tbl_s *cace_ari_get_tbl(cace_ari_t *ari);
 /// @overload
 const struct cace_ari_tbl_s *cace_ari_cget_tbl(const cace_ari_t *ari);
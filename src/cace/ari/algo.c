@@ -19,6 +19,7 @@
 
 #include "containers.h"
 #include "objpat.h"
+#include "tbl_cols.h"
 #include "text.h"
 
 #include "cace/amm/numeric.h"
@@ -69,6 +70,24 @@ static int cace_ari_visit_tbl(cace_ari_tbl_t *obj, const cace_ari_visitor_t *vis
 {
     int retval;
 
+    if (obj->cols)
+    {
+        // packed values are visited as reconstructed copies
+        const size_t nrows = cace_ari_tbl_cols_num_rows(obj->cols);
+        for (size_t row = 0; row < nrows; ++row)
+        {
+            for (size_t col = 0; col < obj->ncols; ++col)
+            {
+                cace_ari_t  buf;
+                cace_ari_t *item = cace_ari_tbl_cols_view(obj->cols, row, col, &buf);
+
+                retval = cace_ari_visit_ari(item, visitor, ctx);
+                CHKERRVAL(retval);
+            }
+        }
+        return 0;
+    }
+
     cace_ari_array_it_t it;
     for (cace_ari_array_it(it, obj->items); !cace_ari_array_end_p(it); cace_ari_array_next(it))
     {
@@ -299,15 +318,25 @@ static int cace_ari_map_tbl(cace_ari_tbl_t *out, const cace_ari_tbl_t *in, const
 
     out->ncols = in->ncols;
 
-    cace_ari_array_it_t it;
-    for (cace_ari_array_it(it, in->items); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+    const size_t nrows = cace_ari_tbl_num_rows(in);
+    for (size_t row = 0; row < nrows; ++row)
     {
-        const cace_ari_t *in_item  = cace_ari_array_cref(it);
-        cace_ari_t        out_item = CACE_ARI_INIT_UNDEFINED;
+        for (size_t col = 0; col < in->ncols; ++col)
+        {
+            cace_ari_t        buf;
+            const cace_ari_t *in_item  = cace_ari_tbl_cview(in, row, col, &buf);
+            cace_ari_t        out_item = CACE_ARI_INIT_UNDEFINED;
 
-        retval = cace_ari_translate_ari(&out_item, in_item, translator, ctx);
-        cace_ari_array_push_move(out->items, &out_item);
-        CHKERRVAL(retval);
+            retval = cace_ari_translate_ari(&out_item, in_item, translator, ctx);
+            cace_ari_array_push_move(out->items, &out_item);
+            CHKERRVAL(retval);
+        }
+    }
+
+    if (in->cols)
+    {
+        // keep the same form as the input
+        cace_ari_tbl_pack(out);
     }
     return 0;
 }
@@ -587,6 +616,27 @@ size_t cace_ari_hash(const cace_ari_t *ari)
     return accum;
 }
 
+size_t cace_ari_params_hash(const cace_ari_params_t *params)
+{
+    CHKRET(params, 0);
+
+    M_HASH_DECL(accum);
+    M_HASH_UP(accum, M_HASH_DEFAULT(params->state));
+    switch (params->state)
+    {
+        case CACE_ARI_PARAMS_NONE:
+            break;
+        case CACE_ARI_PARAMS_AC:
+            M_HASH_UP(accum, cace_ari_list_hash(params->as_ac->items));
+            break;
+        case CACE_ARI_PARAMS_AM:
+            M_HASH_UP(accum, cace_ari_tree_hash(params->as_am->items));
+            break;
+    }
+    accum = M_HASH_FINAL(accum);
+    return accum;
+}
+
 static int cace_ari_params_cmp(const cace_ari_params_t *left, const cace_ari_params_t *right)
 {
     int part_cmp = M_CMP_DEFAULT(left->state, right->state);
@@ -608,8 +658,10 @@ static int cace_ari_params_cmp(const cace_ari_params_t *left, const cace_ari_par
     }
 }
 
-static bool cace_ari_params_equal(const cace_ari_params_t *left, const cace_ari_params_t *right)
+bool cace_ari_params_equal(const cace_ari_params_t *left, const cace_ari_params_t *right)
 {
+    CHKFALSE(left);
+    CHKFALSE(right);
     if (left->state != right->state)
     {
         return false;
@@ -216,6 +216,22 @@ int cace_ari_cmp(const cace_ari_t *left, const cace_ari_t *right);
  */
 bool cace_ari_equal(const cace_ari_t *left, const cace_ari_t *right);
 
+/** Hash just the given parameters of an object reference.
+ * This agrees with the parameter part of cace_ari_hash().
+ *
+ * @param[in] params The parameters to hash.
+ * @return The hash value.
+ */
+size_t cace_ari_params_hash(const cace_ari_params_t *params);
+
+/** Determine if two sets of given parameters have identical value.
+ *
+ * @param left One value to compare.
+ * @param right Other value to compare.
+ * @return True if the two are by-value equal.
+ */
+bool cace_ari_params_equal(const cace_ari_params_t *left, const cace_ari_params_t *right);
+
 /** An M*LIB compatible debug text output function.
  * This encodes to text with default options.
  */
@@ -26,6 +26,7 @@
 
 #include "access.h"
 #include "objpat.h"
+#include "tbl_cols.h"
 #include "text_util.h"
 
 #include "cace/util/defs.h"
@@ -207,7 +208,7 @@ static int cace_ari_cbor_encode_timespec(QCBOREncodeContext *enc, const struct t
     return 0;
 }
 
-static int cace_ari_cbor_decode_timespec(QCBORDecodeContext *dec, struct timespec *ts)
+int cace_ari_cbor_decode_timespec(QCBORDecodeContext *dec, struct timespec *ts)
 {
     QCBORItem decitem;
     QCBORDecode_VPeekNext(dec, &decitem);
@@ -447,14 +448,35 @@ static int cace_ari_cbor_encode_tbl(QCBOREncodeContext *enc, const cace_ari_tbl_
 
     QCBOREncode_AddUInt64(enc, obj->ncols);
 
-    cace_ari_array_it_t it;
-    for (cace_ari_array_it(it, obj->items); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+    if (obj->cols)
     {
-        const cace_ari_t *item = cace_ari_array_cref(it);
-        if (cace_ari_cbor_encode_stream(enc, item))
+        // encoding is identical to the row-major form
+        const size_t nrows = cace_ari_tbl_cols_num_rows(obj->cols);
+        for (size_t row = 0; (row < nrows) && !retval; ++row)
         {
-            retval = 2;
-            break;
+            for (size_t col = 0; col < obj->ncols; ++col)
+            {
+                cace_ari_t        buf;
+                const cace_ari_t *item = cace_ari_tbl_cols_cview(obj->cols, row, col, &buf);
+                if (cace_ari_cbor_encode_stream(enc, item))
+                {
+                    retval = 2;
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        cace_ari_array_it_t it;
+        for (cace_ari_array_it(it, obj->items); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+        {
+            const cace_ari_t *item = cace_ari_array_cref(it);
+            if (cace_ari_cbor_encode_stream(enc, item))
+            {
+                retval = 2;
+                break;
+            }
         }
     }
 
@@ -466,7 +488,8 @@ static int cace_ari_cbor_decode_tbl(QCBORDecodeContext *dec, cace_ari_tbl_t *obj
 {
     int retval = 0;
 
-    QCBORDecode_EnterArray(dec, NULL);
+    QCBORItem decitem;
+    QCBORDecode_EnterArray(dec, &decitem);
     if (QCBORDecode_GetError(dec))
     {
         return 2;
@@ -478,6 +501,21 @@ static int cace_ari_cbor_decode_tbl(QCBORDecodeContext *dec, cace_ari_tbl_t *obj
         return 2;
     }
 
+    // a definite-length array gives the row count before any values
+    const bool definite = (decitem.val.uCount != QCBOR_COUNT_INDICATES_INDEFINITE_LENGTH);
+    if (definite && obj->ncols && (decitem.val.uCount > 0)
+        && ((decitem.val.uCount - 1) / obj->ncols >= CACE_ARI_TBL_PACK_MIN_ROWS))
+    {
+        // decode large tables directly into columnar form
+        obj->cols = CACE_MALLOC(sizeof(cace_ari_tbl_cols_t));
+        if (!obj->cols)
+        {
+            return 2;
+        }
+        cace_ari_tbl_cols_init(obj->cols);
+        cace_ari_tbl_cols_reset(obj->cols, obj->ncols);
+    }
+
     while (true)
     {
         cace_ari_t ari       = CACE_ARI_INIT_UNDEFINED;
@@ -515,15 +553,22 @@ static int cace_ari_cbor_decode_tbl(QCBORDecodeContext *dec, cace_ari_tbl_t *obj
         }
 
         // push only after fully reading
-        cace_ari_array_push_move(obj->items, &ari);
+        if (obj->cols)
+        {
+            cace_ari_tbl_cols_push_move(obj->cols, &ari);
+        }
+        else
+        {
+            cace_ari_array_push_move(obj->items, &ari);
+        }
     }
-    CACE_LOG_DEBUG("  done with %zu", cace_ari_array_size(obj->items));
 
-    if (((obj->ncols == 0) && !cace_ari_array_empty_p(obj->items))
-        || ((obj->ncols != 0) && (cace_ari_array_size(obj->items) % obj->ncols != 0)))
+    const size_t nitems = obj->cols ? obj->cols->nitems : cace_ari_array_size(obj->items);
+    CACE_LOG_DEBUG("  done with %zu", nitems);
+
+    if (((obj->ncols == 0) && nitems) || ((obj->ncols != 0) && (nitems % obj->ncols != 0)))
     {
-        CACE_LOG_ERR("decoding TBL inconsistent; got %zu cols and %zu items", obj->ncols,
-                     cace_ari_array_size(obj->items));
+        CACE_LOG_ERR("decoding TBL inconsistent; got %zu cols and %zu items", obj->ncols, nitems);
         retval = 3; // Invalid ARI due to incomplete row data
     }
 
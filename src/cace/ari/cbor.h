@@ -84,6 +84,16 @@ int cace_ari_cbor_decode(cace_ari_t *ari, const cace_data_t *buf, size_t *used,
  */
 int cace_ari_cbor_decode_stream(QCBORDecodeContext *decoder, cace_ari_t *ari);
 
+/** Lower-level stream decoding of a bare time value which is not itself an
+ * ARI, as used for the reference time of an RPTSET and relative time of a
+ * report.
+ *
+ * @param[in] decoder The existing decoder to read with.
+ * @param[out] ts The decoded time.
+ * @return Zero upon success.
+ */
+int cace_ari_cbor_decode_timespec(QCBORDecodeContext *decoder, struct timespec *ts);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_ari
+ * This file contains the implementation of the structural CBOR scanner
+ * following the encoding rules of Section 3 of RFC 8949.
+ */
+#include "cbor_scan.h"
+#include "cbor.h"
+
+#include "cace/util/defs.h"
+
+#include <qcbor/qcbor_spiffy_decode.h>
+
+/// CBOR major type for unsigned integers
+#define CBOR_MAJOR_UINT 0
+/// CBOR major type for negative integers
+#define CBOR_MAJOR_NINT 1
+/// CBOR major type for byte strings
+#define CBOR_MAJOR_BSTR 2
+/// CBOR major type for text strings
+#define CBOR_MAJOR_TSTR 3
+/// CBOR major type for arrays
+#define CBOR_MAJOR_ARRAY 4
+/// CBOR major type for maps
+#define CBOR_MAJOR_MAP 5
+/// CBOR major type for tags
+#define CBOR_MAJOR_TAG 6
+/// CBOR major type for simple values and floats
+#define CBOR_MAJOR_SIMPLE 7
+/// Additional information for indefinite length
+#define CBOR_INFO_INDEFINITE 31
+/// Initial byte of an indefinite length break
+#define CBOR_BREAK 0xFF
+
+/** Read a single item head.
+ *
+ * @param[in] buf The buffer to read.
+ * @param[in,out] pos The offset of the head, which is advanced past it.
+ * @param[out] major The major type.
+ * @param[out] info The additional information.
+ * @param[out] arg The argument value, which is zero for indefinite length.
+ * @return Zero upon success, 2 if truncated, or 3 if not well-formed.
+ */
+static int cace_ari_cbor_scan_head(const cace_data_t *buf, size_t *pos, uint8_t *major, uint8_t *info, uint64_t *arg)
+{
+    if (*pos >= buf->len)
+    {
+        return 2;
+    }
+    const uint8_t first = buf->ptr[(*pos)++];
+    *major              = first >> 5;
+    *info               = first & 0x1F;
+
+    size_t extra;
+    if (*info < 24)
+    {
+        *arg = *info;
+        return 0;
+    }
+    else if (*info == CBOR_INFO_INDEFINITE)
+    {
+        *arg = 0;
+        return 0;
+    }
+    else if (*info > 27)
+    {
+        // reserved values
+        return 3;
+    }
+    extra = (size_t)1 << (*info - 24);
+
+    if (buf->len - *pos < extra)
+    {
+        return 2;
+    }
+    *arg = 0;
+    for (size_t ix = 0; ix < extra; ++ix)
+    {
+        *arg = (*arg << 8) | buf->ptr[(*pos)++];
+    }
+    return 0;
+}
+
+static int cace_ari_cbor_scan_item(const cace_data_t *buf, size_t *pos, unsigned int depth);
+
+/** Skip over the chunks of an indefinite length string.
+ */
+static int cace_ari_cbor_scan_chunks(const cace_data_t *buf, size_t *pos, uint8_t str_major)
+{
+    while (true)
+    {
+        if (*pos >= buf->len)
+        {
+            return 2;
+        }
+        if (buf->ptr[*pos] == CBOR_BREAK)
+        {
+            ++(*pos);
+            return 0;
+        }
+
+        uint8_t  major, info;
+        uint64_t arg;
+        int      res = cace_ari_cbor_scan_head(buf, pos, &major, &info, &arg);
+        if (res)
+        {
+            return res;
+        }
+        // chunks must be definite strings of the same type
+        if ((major != str_major) || (info == CBOR_INFO_INDEFINITE))
+        {
+            return 3;
+        }
+        if (arg > buf->len - *pos)
+        {
+            return 2;
+        }
+        *pos += arg;
+    }
+}
+
+/** Skip over a sequence of items within a container.
+ *
+ * @param count The number of items, if not indefinite.
+ */
+static int cace_ari_cbor_scan_items(const cace_data_t *buf, size_t *pos, unsigned int depth, uint64_t count,
+                                    bool indefinite)
+{
+    if (indefinite)
+    {
+        while (true)
+        {
+            if (*pos >= buf->len)
+            {
+                return 2;
+            }
+            if (buf->ptr[*pos] == CBOR_BREAK)
+            {
+                ++(*pos);
+                return 0;
+            }
+            int res = cace_ari_cbor_scan_item(buf, pos, depth);
+            if (res)
+            {
+                return res;
+            }
+        }
+    }
+
+    // each item takes at least one octet, so this avoids long loops on bad input
+    if (count > buf->len - *pos)
+    {
+        return 2;
+    }
+    for (uint64_t ix = 0; ix < count; ++ix)
+    {
+        int res = cace_ari_cbor_scan_item(buf, pos, depth);
+        if (res)
+        {
+            return res;
+        }
+    }
+    return 0;
+}
+
+/** Skip over a single item, recursing into containers.
+ */
+static int cace_ari_cbor_scan_item(const cace_data_t *buf, size_t *pos, unsigned int depth)
+{
+    if (depth > CACE_ARI_CBOR_SCAN_DEPTH_MAX)
+    {
+        return 3;
+    }
+
+    uint8_t  major, info;
+    uint64_t arg;
+    int      res = cace_ari_cbor_scan_head(buf, pos, &major, &info, &arg);
+    if (res)
+    {
+        return res;
+    }
+    const bool indefinite = (info == CBOR_INFO_INDEFINITE);
+
+    switch (major)
+    {
+        case CBOR_MAJOR_UINT:
+        case CBOR_MAJOR_NINT:
+            return indefinite ? 3 : 0;
+        case CBOR_MAJOR_BSTR:
+        case CBOR_MAJOR_TSTR:
+            if (indefinite)
+            {
+                return cace_ari_cbor_scan_chunks(buf, pos, major);
+            }
+            if (arg > buf->len - *pos)
+            {
+                return 2;
+            }
+            *pos += arg;
+            return 0;
+        case CBOR_MAJOR_ARRAY:
+            return cace_ari_cbor_scan_items(buf, pos, depth + 1, arg, indefinite);
+        case CBOR_MAJOR_MAP:
+            if (!indefinite && (arg > UINT64_MAX / 2))
+            {
+                return 2;
+            }
+            return cace_ari_cbor_scan_items(buf, pos, depth + 1, 2 * arg, indefinite);
+        case CBOR_MAJOR_TAG:
+            if (indefinite)
+            {
+                return 3;
+            }
+            // the tagged item
+            return cace_ari_cbor_scan_item(buf, pos, depth + 1);
+        case CBOR_MAJOR_SIMPLE:
+        default:
+            // a break outside of an indefinite container
+            return indefinite ? 3 : 0;
+    }
+}
+
+int cace_ari_cbor_skip(const cace_data_t *buf, size_t offset, cace_ari_cbor_span_t *span)
+{
+    CHKERR1(buf);
+    CHKERR1(span);
+
+    size_t pos = offset;
+    int    res = cace_ari_cbor_scan_item(buf, &pos, 0);
+    if (res)
+    {
+        return res;
+    }
+
+    span->offset = offset;
+    span->len    = pos - offset;
+    return 0;
+}
+
+int cace_ari_cbor_scan_enter(cace_ari_cbor_scan_t *scan, const cace_data_t *buf, size_t offset)
+{
+    CHKERR1(scan);
+    CHKERR1(buf);
+
+    size_t   pos = offset;
+    uint8_t  major, info;
+    uint64_t arg;
+    int      res = cace_ari_cbor_scan_head(buf, &pos, &major, &info, &arg);
+    if (res)
+    {
+        return res;
+    }
+
+    if (major == CBOR_MAJOR_ARRAY)
+    {
+        scan->remain = arg;
+    }
+    else if (major == CBOR_MAJOR_MAP)
+    {
+        if (arg > UINT64_MAX / 2)
+        {
+            return 3;
+        }
+        scan->remain = 2 * arg;
+    }
+    else
+    {
+        return 3;
+    }
+
+    scan->buf        = buf;
+    scan->pos        = pos;
+    scan->indefinite = (info == CBOR_INFO_INDEFINITE);
+    return 0;
+}
+
+int cace_ari_cbor_scan_next(cace_ari_cbor_scan_t *scan, cace_ari_cbor_span_t *span)
+{
+    CHKERR1(scan);
+    CHKERR1(span);
+
+    if (scan->indefinite)
+    {
+        if (scan->pos >= scan->buf->len)
+        {
+            return 2;
+        }
+        if (scan->buf->ptr[scan->pos] == CBOR_BREAK)
+        {
+            return -1;
+        }
+    }
+    else if (scan->remain == 0)
+    {
+        return -1;
+    }
+
+    int res = cace_ari_cbor_skip(scan->buf, scan->pos, span);
+    if (res)
+    {
+        return res;
+    }
+    scan->pos += span->len;
+    if (!scan->indefinite)
+    {
+        --(scan->remain);
+    }
+    return 0;
+}
+
+int cace_ari_cbor_index(cace_ari_cbor_index_t *idx, const cace_data_t *buf, size_t offset)
+{
+    CHKERR1(idx);
+    CHKERR1(buf);
+
+    *idx = (cace_ari_cbor_index_t) { 0 };
+
+    // checks well-formedness of the whole ARI
+    int res = cace_ari_cbor_skip(buf, offset, &(idx->whole));
+    if (res)
+    {
+        return res;
+    }
+
+    cace_ari_cbor_scan_t outer;
+    if (cace_ari_cbor_scan_enter(&outer, buf, offset))
+    {
+        // a primitive literal
+        return 0;
+    }
+    if (outer.indefinite || (outer.remain != 2))
+    {
+        // an object reference or not an ARI
+        return 0;
+    }
+
+    cace_ari_cbor_span_t type_span;
+    if (cace_ari_cbor_scan_next(&outer, &type_span) || cace_ari_cbor_scan_next(&outer, &(idx->value)))
+    {
+        return 3;
+    }
+
+    {
+        // the type must be a small integer
+        size_t   pos = type_span.offset;
+        uint8_t  major, info;
+        uint64_t arg;
+        if (cace_ari_cbor_scan_head(buf, &pos, &major, &info, &arg) || (info == CBOR_INFO_INDEFINITE)
+            || (arg > INT32_MAX))
+        {
+            return 3;
+        }
+        if (major == CBOR_MAJOR_UINT)
+        {
+            idx->ari_type = (cace_ari_type_t)arg;
+        }
+        else if (major == CBOR_MAJOR_NINT)
+        {
+            idx->ari_type = (cace_ari_type_t)(-1 - (int64_t)arg);
+        }
+        else
+        {
+            return 3;
+        }
+        idx->has_ari_type = true;
+    }
+
+    switch (idx->ari_type)
+    {
+        case CACE_ARI_TYPE_AC:
+        case CACE_ARI_TYPE_AM:
+        case CACE_ARI_TYPE_TBL:
+        case CACE_ARI_TYPE_EXECSET:
+        case CACE_ARI_TYPE_RPTSET:
+            break;
+        default:
+            // not a container
+            return 0;
+    }
+
+    cace_ari_cbor_scan_t inner;
+    if (cace_ari_cbor_scan_enter(&inner, buf, idx->value.offset))
+    {
+        return 3;
+    }
+    idx->is_container = true;
+
+    cace_ari_cbor_span_t span;
+    while (!(res = cace_ari_cbor_scan_next(&inner, &span)))
+    {
+        if (idx->count < CACE_ARI_CBOR_INDEX_SIZE)
+        {
+            idx->items[idx->count] = span;
+        }
+        ++(idx->count);
+    }
+    // negative result is the normal end of container
+    return (res > 0) ? res : 0;
+}
+
+int cace_ari_cbor_index_get(const cace_ari_cbor_index_t *idx, const cace_data_t *buf, size_t ix, cace_data_t *view)
+{
+    CHKERR1(idx);
+    CHKERR1(buf);
+    CHKERR1(view);
+
+    if (!idx->is_container || (ix >= idx->count) || (ix >= CACE_ARI_CBOR_INDEX_SIZE))
+    {
+        return 2;
+    }
+    const cace_ari_cbor_span_t *span = &(idx->items[ix]);
+    return cace_data_init_view(view, span->len, buf->ptr + span->offset);
+}
+
+int cace_ari_cbor_decode_span(cace_ari_t *ari, const cace_data_t *buf, cace_ari_cbor_span_t span)
+{
+    CHKERR1(ari);
+    CHKERR1(buf);
+    if (span.offset + span.len > buf->len)
+    {
+        return 2;
+    }
+
+    cace_data_t view;
+    cace_data_init_view(&view, span.len, buf->ptr + span.offset);
+    int res = cace_ari_cbor_decode(ari, &view, NULL, NULL);
+    cace_data_deinit(&view);
+    return res;
+}
+
+int cace_ari_cbor_decode_span_timespec(struct timespec *ts, const cace_data_t *buf, cace_ari_cbor_span_t span)
+{
+    CHKERR1(ts);
+    CHKERR1(buf);
+    if (span.offset + span.len > buf->len)
+    {
+        return 2;
+    }
+
+    QCBORDecodeContext dec;
+    UsefulBufC         indata = { .ptr = buf->ptr + span.offset, .len = span.len };
+    QCBORDecode_Init(&dec, indata, QCBOR_DECODE_MODE_NORMAL);
+
+    int res = cace_ari_cbor_decode_timespec(&dec, ts);
+    if (QCBORDecode_Finish(&dec) != QCBOR_SUCCESS)
+    {
+        res = 3;
+    }
+    return res;
+}
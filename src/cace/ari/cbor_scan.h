@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_ari
+ * This file contains definitions for a structural scanner of ARI binary
+ * form, which locates items without decoding or allocating them.
+ *
+ * The scanner only checks that input is well-formed CBOR, so any span
+ * which is later decoded can still fail to be a valid ARI.
+ */
+#ifndef CACE_ARI_CBOR_SCAN_H_
+#define CACE_ARI_CBOR_SCAN_H_
+
+#include "base.h"
+
+#include "cace/cace_data.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Largest nesting depth of CBOR containers handled by the scanner
+#define CACE_ARI_CBOR_SCAN_DEPTH_MAX 64
+/// Number of leading item spans kept in a ::cace_ari_cbor_index_t
+#define CACE_ARI_CBOR_INDEX_SIZE 8
+
+/** The location of a single encoded item within a buffer.
+ */
+typedef struct
+{
+    /// Offset from the start of the buffer
+    size_t offset;
+    /// Length of the encoded item
+    size_t len;
+} cace_ari_cbor_span_t;
+
+/** Skip over a single well-formed CBOR item.
+ *
+ * @param[in] buf The buffer to scan.
+ * @param offset The offset of the item within @c buf.
+ * @param[out] span The location of the whole item.
+ * @return Zero upon success, 2 if the item is truncated, or 3 if the item
+ * is not well-formed.
+ */
+int cace_ari_cbor_skip(const cace_data_t *buf, size_t offset, cace_ari_cbor_span_t *span);
+
+/** State for iterating over the items of a single CBOR array or map.
+ * Map keys and values are visited as separate items.
+ */
+typedef struct
+{
+    /// The buffer being scanned
+    const cace_data_t *buf;
+    /// Offset of the next item
+    size_t pos;
+    /// Number of items remaining, if not #indefinite
+    uint64_t remain;
+    /// True if the container has indefinite length
+    bool indefinite;
+} cace_ari_cbor_scan_t;
+
+/** Begin iterating over the items of a container.
+ *
+ * @param[out] scan The iterator state to initialize.
+ * @param[in] buf The buffer to scan, which must outlive the iterator.
+ * @param offset The offset of the array or map head within @c buf.
+ * @return Zero upon success, 2 if the head is truncated, or 3 if the item
+ * is not an array or map.
+ */
+int cace_ari_cbor_scan_enter(cace_ari_cbor_scan_t *scan, const cace_data_t *buf, size_t offset);
+
+/** Get the next item of a container.
+ *
+ * @param[in,out] scan The iterator state.
+ * @param[out] span The location of the next item.
+ * @return Zero upon success, a negative value at the end of the container,
+ * or a positive value upon failure as for cace_ari_cbor_skip().
+ */
+int cace_ari_cbor_scan_next(cace_ari_cbor_scan_t *scan, cace_ari_cbor_span_t *span);
+
+/** A shallow index of a single encoded ARI.
+ * For typed literal containers (AC, AM, TBL, EXECSET, RPTSET) this holds
+ * the location of the leading items of the literal value.
+ */
+typedef struct
+{
+    /// Location of the whole ARI
+    cace_ari_cbor_span_t whole;
+    /// True if the ARI is a typed literal
+    bool has_ari_type;
+    /// The literal type, valid only if #has_ari_type is true
+    cace_ari_type_t ari_type;
+    /// Location of the literal value, valid only if #has_ari_type is true
+    cace_ari_cbor_span_t value;
+    /// True if the literal value is a container and #items is meaningful
+    bool is_container;
+    /// Total number of items in the container, which may exceed the index size
+    size_t count;
+    /// Location of the first items in the container
+    cace_ari_cbor_span_t items[CACE_ARI_CBOR_INDEX_SIZE];
+} cace_ari_cbor_index_t;
+
+/** Scan an encoded ARI to produce a shallow index.
+ * The whole ARI is checked to be well-formed, but nothing is decoded
+ * except for the literal type.
+ *
+ * @param[out] idx The index to populate.
+ * @param[in] buf The buffer to scan.
+ * @param offset The offset of the ARI within @c buf.
+ * @return Zero upon success.
+ */
+int cace_ari_cbor_index(cace_ari_cbor_index_t *idx, const cace_data_t *buf, size_t offset);
+
+/** Get a view of an indexed item.
+ *
+ * @param[in] idx The index to read.
+ * @param[in] buf The buffer which was indexed.
+ * @param ix The item index, which must be less than ::CACE_ARI_CBOR_INDEX_SIZE.
+ * @param[out] view The uninitialized view to set.
+ * @return Zero upon success, or 2 if the item is not indexed.
+ */
+int cace_ari_cbor_index_get(const cace_ari_cbor_index_t *idx, const cace_data_t *buf, size_t ix, cace_data_t *view);
+
+/** Decode a single ARI at a specific location.
+ *
+ * @param[out] ari The ARI to decode into, which must already be initialized.
+ * @param[in] buf The buffer containing the item.
+ * @param span The location of the encoded ARI.
+ * @return Zero upon success.
+ */
+int cace_ari_cbor_decode_span(cace_ari_t *ari, const cace_data_t *buf, cace_ari_cbor_span_t span);
+
+/** Decode a bare time value at a specific location, as used for the
+ * reference time of an RPTSET and the relative time of a report.
+ *
+ * @param[out] ts The decoded time.
+ * @param[in] buf The buffer containing the item.
+ * @param span The location of the encoded time.
+ * @return Zero upon success.
+ */
+int cace_ari_cbor_decode_span_timespec(struct timespec *ts, const cace_data_t *buf, cace_ari_cbor_span_t span);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACE_ARI_CBOR_SCAN_H_ */
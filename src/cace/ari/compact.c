@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "compact.h"
+
+#include "cace/util/defs.h"
+
+#include <string.h>
+
+_Static_assert(sizeof(cace_ari_compact_t) == 16, "Compact ARI storage must stay at 16 bytes");
+
+void cace_ari_compact_init(cace_ari_compact_t *obj)
+{
+    CHKVOID(obj);
+    memset(obj, 0, sizeof(*obj));
+    obj->tag = CACE_ARI_COMPACT_UNDEFINED;
+}
+
+void cace_ari_compact_init_set(cace_ari_compact_t *obj, const cace_ari_compact_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    *obj = *src;
+    if (src->tag == CACE_ARI_COMPACT_BOX)
+    {
+        obj->as_box = CACE_MALLOC(sizeof(cace_ari_t));
+        cace_ari_init_copy(obj->as_box, src->as_box);
+    }
+}
+
+void cace_ari_compact_deinit(cace_ari_compact_t *obj)
+{
+    CHKVOID(obj);
+    if (obj->tag == CACE_ARI_COMPACT_BOX)
+    {
+        cace_ari_deinit(obj->as_box);
+        CACE_FREE(obj->as_box);
+    }
+    cace_ari_compact_init(obj);
+}
+
+void cace_ari_compact_set(cace_ari_compact_t *obj, const cace_ari_compact_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    if (obj == src)
+    {
+        return;
+    }
+    cace_ari_compact_deinit(obj);
+    cace_ari_compact_init_set(obj, src);
+}
+
+/** Attempt to store a value inline.
+ *
+ * @param[out] obj The value to overwrite.
+ * @param[in] src The value to store.
+ * @return True if the value is now inline in @c obj.
+ */
+static bool cace_ari_compact_set_inline(cace_ari_compact_t *obj, const cace_ari_t *src)
+{
+    if (src->is_ref)
+    {
+        return false;
+    }
+    const cace_ari_lit_t *lit = &(src->as_lit);
+
+    cace_ari_compact_t tmp;
+    cace_ari_compact_init(&tmp);
+    tmp.has_ari_type = lit->has_ari_type;
+    tmp.ari_type     = lit->ari_type;
+
+    switch (lit->prim_type)
+    {
+        case CACE_ARI_PRIM_UNDEFINED:
+            tmp.tag = CACE_ARI_COMPACT_UNDEFINED;
+            break;
+        case CACE_ARI_PRIM_NULL:
+            tmp.tag = CACE_ARI_COMPACT_NULL;
+            break;
+        case CACE_ARI_PRIM_BOOL:
+            tmp.tag     = CACE_ARI_COMPACT_BOOL;
+            tmp.as_bool = lit->value.as_bool;
+            break;
+        case CACE_ARI_PRIM_UINT64:
+            tmp.tag       = CACE_ARI_COMPACT_UINT64;
+            tmp.as_uint64 = lit->value.as_uint64;
+            break;
+        case CACE_ARI_PRIM_INT64:
+            tmp.tag      = CACE_ARI_COMPACT_INT64;
+            tmp.as_int64 = lit->value.as_int64;
+            break;
+        case CACE_ARI_PRIM_FLOAT64:
+            tmp.tag        = CACE_ARI_COMPACT_FLOAT64;
+            tmp.as_float64 = lit->value.as_float64;
+            break;
+        case CACE_ARI_PRIM_TSTR:
+        case CACE_ARI_PRIM_BSTR:
+        {
+            const cace_data_t *data = &(lit->value.as_data);
+            if (data->len > CACE_ARI_COMPACT_INLINE_MAX)
+            {
+                return false;
+            }
+            tmp.tag = (lit->prim_type == CACE_ARI_PRIM_TSTR) ? CACE_ARI_COMPACT_TSTR : CACE_ARI_COMPACT_BSTR;
+            tmp.len = (uint8_t)data->len;
+            if (data->len)
+            {
+                memcpy(tmp.as_str, data->ptr, data->len);
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    *obj = tmp;
+    return true;
+}
+
+int cace_ari_compact_set_ari(cace_ari_compact_t *obj, const cace_ari_t *src)
+{
+    CHKERR1(obj);
+    CHKERR1(src);
+
+    cace_ari_compact_deinit(obj);
+    if (cace_ari_compact_set_inline(obj, src))
+    {
+        return 0;
+    }
+
+    obj->tag    = CACE_ARI_COMPACT_BOX;
+    obj->as_box = CACE_MALLOC(sizeof(cace_ari_t));
+    if (!obj->as_box)
+    {
+        obj->tag = CACE_ARI_COMPACT_UNDEFINED;
+        return 2;
+    }
+    cace_ari_init_copy(obj->as_box, src);
+    return 0;
+}
+
+int cace_ari_compact_set_ari_move(cace_ari_compact_t *obj, cace_ari_t *src)
+{
+    CHKERR1(obj);
+    CHKERR1(src);
+
+    cace_ari_compact_deinit(obj);
+    if (cace_ari_compact_set_inline(obj, src))
+    {
+        cace_ari_set_undefined(src);
+        return 0;
+    }
+
+    obj->tag    = CACE_ARI_COMPACT_BOX;
+    obj->as_box = CACE_MALLOC(sizeof(cace_ari_t));
+    if (!obj->as_box)
+    {
+        obj->tag = CACE_ARI_COMPACT_UNDEFINED;
+        return 2;
+    }
+    cace_ari_init_move(obj->as_box, src);
+    return 0;
+}
+
+const cace_ari_t *cace_ari_compact_cview(const cace_ari_compact_t *obj, cace_ari_t *buf)
+{
+    CHKNULL(obj);
+    CHKNULL(buf);
+    if (obj->tag == CACE_ARI_COMPACT_BOX)
+    {
+        return obj->as_box;
+    }
+
+    *buf = CACE_ARI_INIT_UNDEFINED;
+
+    cace_ari_lit_t *lit = &(buf->as_lit);
+    lit->has_ari_type   = obj->has_ari_type;
+    lit->ari_type       = obj->ari_type;
+    switch (obj->tag)
+    {
+        case CACE_ARI_COMPACT_NULL:
+            lit->prim_type = CACE_ARI_PRIM_NULL;
+            break;
+        case CACE_ARI_COMPACT_BOOL:
+            lit->prim_type     = CACE_ARI_PRIM_BOOL;
+            lit->value.as_bool = obj->as_bool;
+            break;
+        case CACE_ARI_COMPACT_UINT64:
+            lit->prim_type       = CACE_ARI_PRIM_UINT64;
+            lit->value.as_uint64 = obj->as_uint64;
+            break;
+        case CACE_ARI_COMPACT_INT64:
+            lit->prim_type      = CACE_ARI_PRIM_INT64;
+            lit->value.as_int64 = obj->as_int64;
+            break;
+        case CACE_ARI_COMPACT_FLOAT64:
+            lit->prim_type        = CACE_ARI_PRIM_FLOAT64;
+            lit->value.as_float64 = obj->as_float64;
+            break;
+        case CACE_ARI_COMPACT_TSTR:
+        case CACE_ARI_COMPACT_BSTR:
+            lit->prim_type = (obj->tag == CACE_ARI_COMPACT_TSTR) ? CACE_ARI_PRIM_TSTR : CACE_ARI_PRIM_BSTR;
+            // view of the inline storage, which is never modified through the view
+            cace_data_init_view(&(lit->value.as_data), obj->len, (cace_data_ptr_t)obj->as_str);
+            break;
+        default:
+            lit->prim_type = CACE_ARI_PRIM_UNDEFINED;
+            break;
+    }
+    return buf;
+}
+
+int cace_ari_compact_get_ari(cace_ari_t *out, const cace_ari_compact_t *obj)
+{
+    CHKERR1(out);
+    CHKERR1(obj);
+
+    cace_ari_t        buf;
+    const cace_ari_t *view = cace_ari_compact_cview(obj, &buf);
+    cace_ari_set_copy(out, view);
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_ari
+ * This file contains a compact 16-byte storage form for ARI values.
+ *
+ * The general ::cace_ari_t must be able to hold an object reference with
+ * a full path and parameters, which makes every value as large as its
+ * largest form. A compact value holds small literals inline, those being
+ * undefined, null, booleans, integers, floating point, and short text or
+ * byte strings, with their optional ARI type.
+ * Any other value is boxed into a separately allocated ::cace_ari_t.
+ *
+ * This is a storage form only; values are converted to and from
+ * ::cace_ari_t for any other processing. It holds the generic columns of
+ * a TBL literal in columnar form, see tbl_cols.h.
+ */
+#ifndef CACE_ARI_COMPACT_H_
+#define CACE_ARI_COMPACT_H_
+
+#include "cace/ari.h"
+
+#include <m-array.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Storage classes of a compact value
+typedef enum
+{
+    /// An inline undefined value
+    CACE_ARI_COMPACT_UNDEFINED = 0,
+    /// An inline null value
+    CACE_ARI_COMPACT_NULL,
+    /// An inline value in cace_ari_compact_t::as_bool
+    CACE_ARI_COMPACT_BOOL,
+    /// An inline value in cace_ari_compact_t::as_uint64
+    CACE_ARI_COMPACT_UINT64,
+    /// An inline value in cace_ari_compact_t::as_int64
+    CACE_ARI_COMPACT_INT64,
+    /// An inline value in cace_ari_compact_t::as_float64
+    CACE_ARI_COMPACT_FLOAT64,
+    /// An inline null-terminated text string in cace_ari_compact_t::as_str
+    CACE_ARI_COMPACT_TSTR,
+    /// An inline byte string in cace_ari_compact_t::as_str
+    CACE_ARI_COMPACT_BSTR,
+    /// An allocated value in cace_ari_compact_t::as_box
+    CACE_ARI_COMPACT_BOX,
+} cace_ari_compact_tag_t;
+
+/// Largest string size held inline, including any text null terminator
+#define CACE_ARI_COMPACT_INLINE_MAX 8
+
+/** A compact value with inline storage for small literals.
+ */
+typedef struct
+{
+    /// One of the ::cace_ari_compact_tag_t values
+    uint8_t tag;
+    /// For an inline literal, true if #ari_type is valid
+    bool has_ari_type;
+    /// For an inline string, the number of bytes used in #as_str
+    uint8_t len;
+    /// For an inline literal, the explicit ARI type
+    cace_ari_type_t ari_type;
+    /// The value keyed by #tag
+    union
+    {
+        cace_ari_bool   as_bool;
+        uint64_t        as_uint64;
+        int64_t         as_int64;
+        cace_ari_real64 as_float64;
+        char            as_str[CACE_ARI_COMPACT_INLINE_MAX];
+        cace_ari_t     *as_box;
+    };
+} cace_ari_compact_t;
+
+void cace_ari_compact_init(cace_ari_compact_t *obj);
+void cace_ari_compact_init_set(cace_ari_compact_t *obj, const cace_ari_compact_t *src);
+void cace_ari_compact_deinit(cace_ari_compact_t *obj);
+void cace_ari_compact_set(cace_ari_compact_t *obj, const cace_ari_compact_t *src);
+
+/// M*LIB OPLIST for ::cace_ari_compact_t
+#define M_OPL_cace_ari_compact_t()                                                                                   \
+    (INIT(API_2(cace_ari_compact_init)), INIT_SET(API_6(cace_ari_compact_init_set)),                                 \
+     CLEAR(API_2(cace_ari_compact_deinit)), SET(API_6(cace_ari_compact_set)))
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(cace_ari_compact_array, cace_ari_compact_t)
+/// @endcond
+
+/** Determine if a compact value is held in a separate allocation.
+ *
+ * @param[in] obj The value to inspect.
+ * @return True if the value is boxed.
+ */
+static inline bool cace_ari_compact_is_boxed(const cace_ari_compact_t *obj)
+{
+    return obj && (obj->tag == CACE_ARI_COMPACT_BOX);
+}
+
+/** Set a compact value by copying from a full ARI.
+ *
+ * @param[in,out] obj The already-initialized value to set.
+ * @param[in] src The value to copy from.
+ * @return Zero if successful.
+ */
+int cace_ari_compact_set_ari(cace_ari_compact_t *obj, const cace_ari_t *src);
+
+/** Set a compact value by moving from a full ARI.
+ * A boxed value takes ownership of the source without copying.
+ *
+ * @param[in,out] obj The already-initialized value to set.
+ * @param[in,out] src The value to move from, which is left undefined.
+ * @return Zero if successful.
+ */
+int cace_ari_compact_set_ari_move(cace_ari_compact_t *obj, cace_ari_t *src);
+
+/** Get a read-only view of a compact value as a full ARI.
+ * An inline value is reconstructed into @c buf without any allocation,
+ * with any string data referencing the compact value storage, and a boxed
+ * value is referenced directly.
+ *
+ * @param[in] obj The value to view.
+ * @param[out] buf Storage for a reconstructed value, which does not need to
+ * be initialized and does not own any resources afterward.
+ * @return A pointer to the value, which is valid as long as @c obj is
+ * unmodified.
+ */
+const cace_ari_t *cace_ari_compact_cview(const cace_ari_compact_t *obj, cace_ari_t *buf);
+
+/** Copy a compact value out to a full ARI.
+ *
+ * @param[in,out] out The already-initialized value to set.
+ * @param[in] obj The value to copy from.
+ * @return Zero if successful.
+ */
+int cace_ari_compact_get_ari(cace_ari_t *out, const cace_ari_compact_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACE_ARI_COMPACT_H_ */
@@ -19,11 +19,14 @@
  * @ingroup group_ari
  */
 #include "containers.h"
+#include "tbl_cols.h"
 
 #include "cace/util/defs.h"
 #include "cace/util/logging.h"
 
 #include <inttypes.h>
+#include <stdatomic.h>
+#include <stddef.h>
 
 /// CMP operation not defined by M*LIB
 static int cace_ari_list_cmp(const cace_ari_list_t left, const cace_ari_list_t right)
@@ -167,11 +170,25 @@ void cace_ari_tbl_init(cace_ari_tbl_t *obj)
 {
     CHKVOID(obj);
     cace_ari_array_init(obj->items);
+    obj->cols = NULL;
+}
+
+/** Release any columnar form of a table.
+ */
+static void cace_ari_tbl_drop_cols(cace_ari_tbl_t *obj)
+{
+    if (obj->cols)
+    {
+        cace_ari_tbl_cols_deinit(obj->cols);
+        CACE_FREE(obj->cols);
+        obj->cols = NULL;
+    }
 }
 
 void cace_ari_tbl_deinit(cace_ari_tbl_t *obj)
 {
     CHKVOID(obj);
+    cace_ari_tbl_drop_cols(obj);
     cace_ari_array_clear(obj->items);
 }
 
@@ -184,6 +201,33 @@ int cace_ari_tbl_cmp(const cace_ari_tbl_t *left, const cace_ari_tbl_t *right)
         return part_cmp;
     }
 
+    if (left->cols || right->cols)
+    {
+        const size_t lt_rows = cace_ari_tbl_num_rows(left);
+        const size_t rt_rows = cace_ari_tbl_num_rows(right);
+
+        part_cmp = M_CMP_DEFAULT(lt_rows, rt_rows);
+        if (part_cmp)
+        {
+            return part_cmp;
+        }
+
+        for (size_t row = 0; row < lt_rows; ++row)
+        {
+            for (size_t col = 0; col < left->ncols; ++col)
+            {
+                cace_ari_t lt_buf, rt_buf;
+                part_cmp = cace_ari_cmp(cace_ari_tbl_cview(left, row, col, &lt_buf),
+                                        cace_ari_tbl_cview(right, row, col, &rt_buf));
+                if (part_cmp)
+                {
+                    return part_cmp;
+                }
+            }
+        }
+        return 0;
+    }
+
     const size_t lt_size = cace_ari_array_size(left->items);
     const size_t rt_size = cace_ari_array_size(right->items);
 
@@ -212,11 +256,38 @@ bool cace_ari_tbl_equal(const cace_ari_tbl_t *left, const cace_ari_tbl_t *right)
 {
     CHKFALSE(left);
     CHKFALSE(right);
-    return ((left->ncols == right->ncols) && cace_ari_array_equal_p(left->items, right->items));
+    if (left->ncols != right->ncols)
+    {
+        return false;
+    }
+    if (!left->cols && !right->cols)
+    {
+        return cace_ari_array_equal_p(left->items, right->items);
+    }
+
+    const size_t nrows = cace_ari_tbl_num_rows(left);
+    if (cace_ari_tbl_num_rows(right) != nrows)
+    {
+        return false;
+    }
+    for (size_t row = 0; row < nrows; ++row)
+    {
+        for (size_t col = 0; col < left->ncols; ++col)
+        {
+            cace_ari_t lt_buf, rt_buf;
+            if (!cace_ari_equal(cace_ari_tbl_cview(left, row, col, &lt_buf),
+                                cace_ari_tbl_cview(right, row, col, &rt_buf)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 void cace_ari_tbl_reset(cace_ari_tbl_t *obj, size_t ncols, size_t nrows)
 {
+    cace_ari_tbl_drop_cols(obj);
     cace_ari_array_reset(obj->items);
 
     obj->ncols = ncols;
@@ -228,10 +299,14 @@ void cace_ari_tbl_reset(cace_ari_tbl_t *obj, size_t ncols, size_t nrows)
 
 size_t cace_ari_tbl_num_rows(const cace_ari_tbl_t *obj)
 {
-    if (!obj)
+    if (!obj || !obj->ncols)
     {
         return 0;
     }
+    if (obj->cols)
+    {
+        return cace_ari_tbl_cols_num_rows(obj->cols);
+    }
 
     return cace_ari_array_size(obj->items) / obj->ncols;
 }
@@ -250,7 +325,14 @@ int cace_ari_tbl_move_row_ac(cace_ari_tbl_t *obj, cace_ari_ac_t *row)
         cace_ari_t item;
         cace_ari_init(&item);
         cace_ari_list_pop_front(&item, row->items);
-        cace_ari_array_push_move(obj->items, &item);
+        if (obj->cols)
+        {
+            cace_ari_tbl_cols_push_move(obj->cols, &item);
+        }
+        else
+        {
+            cace_ari_array_push_move(obj->items, &item);
+        }
         cace_ari_deinit(&item);
     }
     return 0;
@@ -265,12 +347,84 @@ int cace_ari_tbl_move_row_array(cace_ari_tbl_t *obj, cace_ari_array_t row)
         return 2;
     }
 
-    cace_ari_array_splice(obj->items, row);
+    if (obj->cols)
+    {
+        cace_ari_array_it_t it;
+        for (cace_ari_array_it(it, row); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+        {
+            cace_ari_tbl_cols_push_move(obj->cols, cace_ari_array_ref(it));
+        }
+    }
+    else
+    {
+        cace_ari_array_splice(obj->items, row);
+    }
     cace_ari_array_clear(row);
 
     return 0;
 }
 
+bool cace_ari_tbl_is_packed(const cace_ari_tbl_t *obj)
+{
+    CHKFALSE(obj);
+    return (obj->cols != NULL);
+}
+
+int cace_ari_tbl_pack(cace_ari_tbl_t *obj)
+{
+    CHKERR1(obj);
+    if (obj->cols)
+    {
+        return 0;
+    }
+
+    cace_ari_tbl_cols_t *cols = CACE_MALLOC(sizeof(cace_ari_tbl_cols_t));
+    CHKERR1(cols);
+    cace_ari_tbl_cols_init(cols);
+    if (cace_ari_tbl_cols_from_items(cols, obj->ncols, obj->items))
+    {
+        cace_ari_tbl_cols_deinit(cols);
+        CACE_FREE(cols);
+        return 2;
+    }
+
+    obj->cols = cols;
+    return 0;
+}
+
+int cace_ari_tbl_unpack(cace_ari_tbl_t *obj)
+{
+    CHKERR1(obj);
+    if (!obj->cols)
+    {
+        return 0;
+    }
+
+    cace_ari_tbl_cols_to_items(obj->items, obj->cols);
+    cace_ari_tbl_drop_cols(obj);
+    return 0;
+}
+
+const cace_ari_t *cace_ari_tbl_cview(const cace_ari_tbl_t *obj, size_t row, size_t col, cace_ari_t *buf)
+{
+    CHKNULL(obj);
+    if (obj->cols)
+    {
+        return cace_ari_tbl_cols_cview(obj->cols, row, col, buf);
+    }
+
+    if (col >= obj->ncols)
+    {
+        return NULL;
+    }
+    const size_t ix = (row * obj->ncols) + col;
+    if (ix >= cace_ari_array_size(obj->items))
+    {
+        return NULL;
+    }
+    return cace_ari_array_cget(obj->items, ix);
+}
+
 void cace_ari_execset_init(cace_ari_execset_t *obj)
 {
     cace_ari_init(&(obj->nonce));
@@ -408,6 +562,55 @@ bool cace_ari_rptset_equal(const cace_ari_rptset_t *left, const cace_ari_rptset_
             && cace_ari_report_list_equal_p(left->reports, right->reports));
 }
 
+/// Header placed in front of each container from cace_ari_ctr_alloc()
+typedef union
+{
+    /// Number of references to the container
+    atomic_size_t refs;
+    /// Keep the following container aligned
+    max_align_t align;
+} cace_ari_ctr_head_t;
+
+static cace_ari_ctr_head_t *cace_ari_ctr_head(const void *ptr)
+{
+    return (cace_ari_ctr_head_t *)((const uint8_t *)ptr - sizeof(cace_ari_ctr_head_t));
+}
+
+void *cace_ari_ctr_alloc(size_t size)
+{
+    cace_ari_ctr_head_t *head = CACE_MALLOC(sizeof(cace_ari_ctr_head_t) + size);
+    if (!head)
+    {
+        return NULL;
+    }
+    atomic_init(&(head->refs), 1);
+    return head + 1;
+}
+
+void cace_ari_ctr_retain(void *ptr)
+{
+    CHKVOID(ptr);
+    atomic_fetch_add_explicit(&(cace_ari_ctr_head(ptr)->refs), 1, memory_order_relaxed);
+}
+
+bool cace_ari_ctr_release(void *ptr)
+{
+    CHKFALSE(ptr);
+    return (atomic_fetch_sub_explicit(&(cace_ari_ctr_head(ptr)->refs), 1, memory_order_acq_rel) == 1);
+}
+
+void cace_ari_ctr_free(void *ptr)
+{
+    CHKVOID(ptr);
+    CACE_FREE(cace_ari_ctr_head(ptr));
+}
+
+bool cace_ari_ctr_is_shared(const void *ptr)
+{
+    CHKFALSE(ptr);
+    return (atomic_load_explicit(&(cace_ari_ctr_head(ptr)->refs), memory_order_acquire) > 1);
+}
+
 void cace_ari_lit_init_container(cace_ari_lit_t *lit, cace_ari_type_t ctype)
 {
     CHKVOID(lit);
@@ -419,35 +622,35 @@ void cace_ari_lit_init_container(cace_ari_lit_t *lit, cace_ari_type_t ctype)
     {
         case CACE_ARI_TYPE_AC:
         {
-            cace_ari_ac_t *ctr = CACE_MALLOC(sizeof(cace_ari_ac_t));
+            cace_ari_ac_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_ac_t));
             cace_ari_ac_init(ctr);
             lit->value.as_ac = ctr;
             break;
         }
         case CACE_ARI_TYPE_AM:
         {
-            cace_ari_am_t *ctr = CACE_MALLOC(sizeof(cace_ari_am_t));
+            cace_ari_am_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_am_t));
             cace_ari_am_init(ctr);
             lit->value.as_am = ctr;
             break;
         }
         case CACE_ARI_TYPE_TBL:
         {
-            cace_ari_tbl_t *ctr = CACE_MALLOC(sizeof(cace_ari_tbl_t));
+            cace_ari_tbl_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_tbl_t));
             cace_ari_tbl_init(ctr);
             lit->value.as_tbl = ctr;
             break;
         }
         case CACE_ARI_TYPE_EXECSET:
         {
-            cace_ari_execset_t *ctr = CACE_MALLOC(sizeof(cace_ari_execset_t));
+            cace_ari_execset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_execset_t));
             cace_ari_execset_init(ctr);
             lit->value.as_execset = ctr;
             break;
         }
         case CACE_ARI_TYPE_RPTSET:
         {
-            cace_ari_rptset_t *ctr = CACE_MALLOC(sizeof(cace_ari_rptset_t));
+            cace_ari_rptset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_rptset_t));
             cace_ari_rptset_init(ctr);
             lit->value.as_rptset = ctr;
             break;
@@ -103,16 +103,30 @@ void cace_ari_am_deinit(cace_ari_am_t *obj);
 int  cace_ari_am_cmp(const cace_ari_am_t *left, const cace_ari_am_t *right);
 bool cace_ari_am_equal(const cace_ari_am_t *left, const cace_ari_am_t *right);
 
+/** The minimum number of rows in a decoded or produced table for it to be
+ * held in columnar form.
+ * @sa cace_ari_tbl_pack()
+ */
+#ifndef CACE_ARI_TBL_PACK_MIN_ROWS
+#define CACE_ARI_TBL_PACK_MIN_ROWS 16
+#endif
+
+struct cace_ari_tbl_cols_s;
+
 /*
  * A Table (TBL) value is a two-dimensional array of ARI values with
  * a fixed column count and arbitrary row count.
+ * The values are held either in row-major #items or, after
+ * cace_ari_tbl_pack(), in columnar #cols.
  */
 typedef struct cace_ari_tbl_s
 {
     /// Number of columns in the table
     size_t ncols;
-    /// Row-major array of all values in the table
+    /// Row-major array of all values in the table, empty if #cols is set
     cace_ari_array_t items;
+    /// Optional columnar form of all values in the table
+    struct cace_ari_tbl_cols_s *cols;
 } cace_ari_tbl_t;
 
 void cace_ari_tbl_init(cace_ari_tbl_t *obj);
@@ -147,6 +161,40 @@ int cace_ari_tbl_move_row_ac(cace_ari_tbl_t *obj, cace_ari_ac_t *row);
 /// @overload
 int cace_ari_tbl_move_row_array(cace_ari_tbl_t *obj, cace_ari_array_t row);
 
+/** Determine if a table holds its values in columnar form.
+ *
+ * @param[in] obj The table to inspect.
+ * @return True if the values are in #cace_ari_tbl_t::cols.
+ */
+bool cace_ari_tbl_is_packed(const cace_ari_tbl_t *obj);
+
+/** Move the values of a table into columnar form.
+ * Columns with uniform primitive values are held as packed vectors.
+ *
+ * @param[in,out] obj The table to convert.
+ * @return Zero if successful, including if already packed.
+ * 2 if the table has an incomplete row.
+ */
+int cace_ari_tbl_pack(cace_ari_tbl_t *obj);
+
+/** Move the values of a table back into row-major form.
+ *
+ * @param[in,out] obj The table to convert.
+ * @return Zero if successful, including if not packed.
+ */
+int cace_ari_tbl_unpack(cace_ari_tbl_t *obj);
+
+/** Get a read-only view of a single value in a table of either form.
+ *
+ * @param[in] obj The table to read from.
+ * @param row The row index.
+ * @param col The column index.
+ * @param[out] buf Storage for a value reconstructed from a packed column,
+ * which does not need to be initialized and holds no resources afterward.
+ * @return A pointer to the value, or NULL if the indices are out of range.
+ */
+const cace_ari_t *cace_ari_tbl_cview(const cace_ari_tbl_t *obj, size_t row, size_t col, cace_ari_t *buf);
+
 /*
  * An Execution Set (EXECSET) value is an ordered collection of
  * execution target ARIs (literal macro or reference to CTRL or
@@ -235,6 +283,47 @@ int cace_ari_rptset_join_move(cace_ari_rptset_t *out, cace_ari_list_t *src);
  */
 int cace_ari_rptset_split_move(cace_ari_list_t *out, cace_ari_rptset_t *src);
 
+/** Allocate storage for a reference-counted container.
+ * The container values of AC, AM, TBL, EXECSET, and RPTSET literals and of
+ * reference parameters are allocated this way so that copying a literal
+ * ARI shares its container rather than copying the whole tree.
+ * A container which is shared must not be modified, which is enforced by
+ * the non-const accessors such as cace_ari_get_ac() using
+ * cace_ari_lit_unshare() before returning.
+ *
+ * @param size The size of the container struct.
+ * @return The uninitialized container storage with a single reference,
+ * or NULL if the allocation failed.
+ */
+void *cace_ari_ctr_alloc(size_t size);
+
+/** Add a reference to a container from cace_ari_ctr_alloc().
+ *
+ * @param[in] ptr The container to reference.
+ */
+void cace_ari_ctr_retain(void *ptr);
+
+/** Remove a reference to a container from cace_ari_ctr_alloc().
+ *
+ * @param[in] ptr The container to release.
+ * @return True if this was the last reference, in which case the caller
+ * must de-initialize the container and use cace_ari_ctr_free().
+ */
+bool cace_ari_ctr_release(void *ptr);
+
+/** Free storage from cace_ari_ctr_alloc() after its last reference.
+ *
+ * @param[in] ptr The container to free.
+ */
+void cace_ari_ctr_free(void *ptr);
+
+/** Determine if a container has more than one reference.
+ *
+ * @param[in] ptr The container to inspect.
+ * @return True if the container is shared.
+ */
+bool cace_ari_ctr_is_shared(const void *ptr);
+
 /** Helper to assign a new container to a literal ARI.
  *
  * @param[in,out] The literal value to modify.
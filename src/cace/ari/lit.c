@@ -22,6 +22,7 @@
 
 #include "containers.h"
 #include "objpat.h"
+#include "tbl_cols.h"
 
 #include "cace/util/defs.h"
 
@@ -53,28 +54,43 @@ int cace_ari_lit_deinit(cace_ari_lit_t *obj)
         {
             case CACE_ARI_TYPE_AC:
                 CHKERR1(obj->value.as_ac);
-                cace_ari_ac_deinit(obj->value.as_ac);
-                CACE_FREE(obj->value.as_ac);
+                if (cace_ari_ctr_release(obj->value.as_ac))
+                {
+                    cace_ari_ac_deinit(obj->value.as_ac);
+                    cace_ari_ctr_free(obj->value.as_ac);
+                }
                 break;
             case CACE_ARI_TYPE_AM:
                 CHKERR1(obj->value.as_am);
-                cace_ari_am_deinit(obj->value.as_am);
-                CACE_FREE(obj->value.as_am);
+                if (cace_ari_ctr_release(obj->value.as_am))
+                {
+                    cace_ari_am_deinit(obj->value.as_am);
+                    cace_ari_ctr_free(obj->value.as_am);
+                }
                 break;
             case CACE_ARI_TYPE_TBL:
                 CHKERR1(obj->value.as_tbl);
-                cace_ari_tbl_deinit(obj->value.as_tbl);
-                CACE_FREE(obj->value.as_tbl);
+                if (cace_ari_ctr_release(obj->value.as_tbl))
+                {
+                    cace_ari_tbl_deinit(obj->value.as_tbl);
+                    cace_ari_ctr_free(obj->value.as_tbl);
+                }
                 break;
             case CACE_ARI_TYPE_EXECSET:
                 CHKERR1(obj->value.as_execset);
-                cace_ari_execset_deinit(obj->value.as_execset);
-                CACE_FREE(obj->value.as_execset);
+                if (cace_ari_ctr_release(obj->value.as_execset))
+                {
+                    cace_ari_execset_deinit(obj->value.as_execset);
+                    cace_ari_ctr_free(obj->value.as_execset);
+                }
                 break;
             case CACE_ARI_TYPE_RPTSET:
                 CHKERR1(obj->value.as_rptset);
-                cace_ari_rptset_deinit(obj->value.as_rptset);
-                CACE_FREE(obj->value.as_rptset);
+                if (cace_ari_ctr_release(obj->value.as_rptset))
+                {
+                    cace_ari_rptset_deinit(obj->value.as_rptset);
+                    cace_ari_ctr_free(obj->value.as_rptset);
+                }
                 break;
             case CACE_ARI_TYPE_OBJPAT:
                 CHKERR1(obj->value.as_objpat);
@@ -122,49 +138,14 @@ int cace_ari_lit_copy(cace_ari_lit_t *lit, const cace_ari_lit_t *src)
                 lit->value = src->value;
                 break;
             case CACE_ARI_TYPE_AC:
-            {
-                cace_ari_ac_t *ctr = CACE_MALLOC(sizeof(cace_ari_ac_t));
-                cace_ari_ac_init(ctr);
-                cace_ari_list_set(ctr->items, src->value.as_ac->items);
-                lit->value.as_ac = ctr;
-                break;
-            }
             case CACE_ARI_TYPE_AM:
-            {
-                cace_ari_am_t *ctr = CACE_MALLOC(sizeof(cace_ari_am_t));
-                cace_ari_am_init(ctr);
-                cace_ari_tree_set(ctr->items, src->value.as_am->items);
-                lit->value.as_am = ctr;
-                break;
-            }
             case CACE_ARI_TYPE_TBL:
-            {
-                cace_ari_tbl_t *ctr = CACE_MALLOC(sizeof(cace_ari_tbl_t));
-                cace_ari_tbl_init(ctr);
-                cace_ari_tbl_reset(ctr, src->value.as_tbl->ncols, 0);
-                cace_ari_array_set(ctr->items, src->value.as_tbl->items);
-                lit->value.as_tbl = ctr;
-                break;
-            }
             case CACE_ARI_TYPE_EXECSET:
-            {
-                cace_ari_execset_t *ctr = CACE_MALLOC(sizeof(cace_ari_execset_t));
-                cace_ari_execset_init(ctr);
-                cace_ari_set_copy(&(ctr->nonce), &(src->value.as_execset->nonce));
-                cace_ari_list_set(ctr->targets, src->value.as_execset->targets);
-                lit->value.as_execset = ctr;
-                break;
-            }
             case CACE_ARI_TYPE_RPTSET:
-            {
-                cace_ari_rptset_t *ctr = CACE_MALLOC(sizeof(cace_ari_rptset_t));
-                cace_ari_rptset_init(ctr);
-                cace_ari_set_copy(&(ctr->nonce), &(src->value.as_rptset->nonce));
-                cace_ari_set_copy(&(ctr->reftime), &(src->value.as_rptset->reftime));
-                cace_ari_report_list_set(ctr->reports, src->value.as_rptset->reports);
-                lit->value.as_rptset = ctr;
+                // all container pointers share storage in the union
+                cace_ari_ctr_retain(src->value.as_ac);
+                lit->value = src->value;
                 break;
-            }
             case CACE_ARI_TYPE_OBJPAT:
             {
                 cace_ari_objpat_t *pat = CACE_MALLOC(sizeof(cace_ari_objpat_t));
@@ -179,3 +160,115 @@ int cace_ari_lit_copy(cace_ari_lit_t *lit, const cace_ari_lit_t *src)
 
     return 0;
 }
+
+/** Get the container of a literal, if it has one.
+ */
+static void *cace_ari_lit_ctr_ptr(const cace_ari_lit_t *obj)
+{
+    if (!obj->has_ari_type)
+    {
+        return NULL;
+    }
+    switch (obj->ari_type)
+    {
+        case CACE_ARI_TYPE_AC:
+            return obj->value.as_ac;
+        case CACE_ARI_TYPE_AM:
+            return obj->value.as_am;
+        case CACE_ARI_TYPE_TBL:
+            return obj->value.as_tbl;
+        case CACE_ARI_TYPE_EXECSET:
+            return obj->value.as_execset;
+        case CACE_ARI_TYPE_RPTSET:
+            return obj->value.as_rptset;
+        default:
+            return NULL;
+    }
+}
+
+/** Copy the top level of a container into a new container.
+ */
+static int cace_ari_lit_ctr_copy(cace_ari_lit_t *lit, const cace_ari_lit_t *src)
+{
+    switch (src->ari_type)
+    {
+        case CACE_ARI_TYPE_AC:
+        {
+            cace_ari_ac_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_ac_t));
+            CHKERR1(ctr);
+            cace_ari_ac_init(ctr);
+            cace_ari_list_set(ctr->items, src->value.as_ac->items);
+            lit->value.as_ac = ctr;
+            break;
+        }
+        case CACE_ARI_TYPE_AM:
+        {
+            cace_ari_am_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_am_t));
+            CHKERR1(ctr);
+            cace_ari_am_init(ctr);
+            cace_ari_tree_set(ctr->items, src->value.as_am->items);
+            lit->value.as_am = ctr;
+            break;
+        }
+        case CACE_ARI_TYPE_TBL:
+        {
+            cace_ari_tbl_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_tbl_t));
+            CHKERR1(ctr);
+            cace_ari_tbl_init(ctr);
+            cace_ari_tbl_reset(ctr, src->value.as_tbl->ncols, 0);
+            cace_ari_array_set(ctr->items, src->value.as_tbl->items);
+            if (src->value.as_tbl->cols)
+            {
+                ctr->cols = CACE_MALLOC(sizeof(cace_ari_tbl_cols_t));
+                CHKERR1(ctr->cols);
+                cace_ari_tbl_cols_init_set(ctr->cols, src->value.as_tbl->cols);
+            }
+            lit->value.as_tbl = ctr;
+            break;
+        }
+        case CACE_ARI_TYPE_EXECSET:
+        {
+            cace_ari_execset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_execset_t));
+            CHKERR1(ctr);
+            cace_ari_execset_init(ctr);
+            cace_ari_set_copy(&(ctr->nonce), &(src->value.as_execset->nonce));
+            cace_ari_list_set(ctr->targets, src->value.as_execset->targets);
+            lit->value.as_execset = ctr;
+            break;
+        }
+        case CACE_ARI_TYPE_RPTSET:
+        {
+            cace_ari_rptset_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_rptset_t));
+            CHKERR1(ctr);
+            cace_ari_rptset_init(ctr);
+            cace_ari_set_copy(&(ctr->nonce), &(src->value.as_rptset->nonce));
+            cace_ari_set_copy(&(ctr->reftime), &(src->value.as_rptset->reftime));
+            cace_ari_report_list_set(ctr->reports, src->value.as_rptset->reports);
+            lit->value.as_rptset = ctr;
+            break;
+        }
+        default:
+            return 2;
+    }
+    return 0;
+}
+
+int cace_ari_lit_unshare(cace_ari_lit_t *obj)
+{
+    CHKERR1(obj);
+    void *ctr = cace_ari_lit_ctr_ptr(obj);
+    if (!ctr || !cace_ari_ctr_is_shared(ctr))
+    {
+        return 0;
+    }
+
+    const cace_ari_lit_t orig = *obj;
+    if (cace_ari_lit_ctr_copy(obj, &orig))
+    {
+        return 2;
+    }
+    // other holders may have released concurrently
+    cace_ari_lit_t tmp = orig;
+    cace_ari_lit_deinit(&tmp);
+    return 0;
+}
@@ -179,6 +179,7 @@ typedef struct
 int cace_ari_lit_deinit(cace_ari_lit_t *obj);
 
 /** Copy a literal struct by-value.
+ * Containers are shared with the source rather than being copied.
  *
  * @param[in,out] obj The object to affect.
  * @param[in] src The source to copy from, recursively if necessary.
@@ -186,6 +187,15 @@ int cace_ari_lit_deinit(cace_ari_lit_t *obj);
  */
 int cace_ari_lit_copy(cace_ari_lit_t *obj, const cace_ari_lit_t *src);
 
+/** Ensure that any container of a literal is not shared with any other
+ * value, copying the top level of the container if necessary.
+ * This must be done before modifying a container in-place.
+ *
+ * @param[in,out] obj The object to affect.
+ * @return Zero if successful.
+ */
+int cace_ari_lit_unshare(cace_ari_lit_t *obj);
+
 #ifdef __cplusplus
 }
 #endif
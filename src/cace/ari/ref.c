@@ -332,13 +332,19 @@ int cace_ari_params_deinit(cace_ari_params_t *obj)
             break;
         case CACE_ARI_PARAMS_AC:
             CHKERR1(obj->as_ac);
-            cace_ari_ac_deinit(obj->as_ac);
-            CACE_FREE(obj->as_ac);
+            if (cace_ari_ctr_release(obj->as_ac))
+            {
+                cace_ari_ac_deinit(obj->as_ac);
+                cace_ari_ctr_free(obj->as_ac);
+            }
             break;
         case CACE_ARI_PARAMS_AM:
             CHKERR1(obj->as_am);
-            cace_ari_am_deinit(obj->as_am);
-            CACE_FREE(obj->as_am);
+            if (cace_ari_ctr_release(obj->as_am))
+            {
+                cace_ari_am_deinit(obj->as_am);
+                cace_ari_ctr_free(obj->as_am);
+            }
             break;
     }
     obj->state = CACE_ARI_PARAMS_NONE;
@@ -358,7 +364,7 @@ int cace_ari_params_copy(cace_ari_params_t *obj, const cace_ari_params_t *src)
             break;
         case CACE_ARI_PARAMS_AC:
         {
-            cace_ari_ac_t *ctr = CACE_MALLOC(sizeof(cace_ari_ac_t));
+            cace_ari_ac_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_ac_t));
             if (ctr)
             {
                 cace_ari_ac_init(ctr);
@@ -374,7 +380,7 @@ int cace_ari_params_copy(cace_ari_params_t *obj, const cace_ari_params_t *src)
         break;
         case CACE_ARI_PARAMS_AM:
         {
-            cace_ari_am_t *ctr = CACE_MALLOC(sizeof(cace_ari_am_t));
+            cace_ari_am_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_am_t));
             if (ctr)
             {
                 cace_ari_am_init(ctr);
@@ -398,7 +404,7 @@ cace_ari_ac_t *cace_ari_params_set_ac(cace_ari_params_t *obj, struct cace_ari_li
     CHKNULL(obj);
     cace_ari_params_deinit(obj);
 
-    cace_ari_ac_t *ctr = CACE_MALLOC(sizeof(cace_ari_ac_t));
+    cace_ari_ac_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_ac_t));
     if (ctr)
     {
         obj->state = CACE_ARI_PARAMS_AC;
@@ -420,7 +426,7 @@ cace_ari_am_t *cace_ari_params_set_am(cace_ari_params_t *obj, struct cace_ari_tr
     CHKNULL(obj);
     cace_ari_params_deinit(obj);
 
-    cace_ari_am_t *ctr = CACE_MALLOC(sizeof(cace_ari_am_t));
+    cace_ari_am_t *ctr = cace_ari_ctr_alloc(sizeof(cace_ari_am_t));
     if (ctr)
     {
         obj->state = CACE_ARI_PARAMS_AM;
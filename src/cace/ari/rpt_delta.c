@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "rpt_delta.h"
+
+#include "cace/util/defs.h"
+
+#include <string.h>
+
+void cace_ari_rpt_delta_base_init(cace_ari_rpt_delta_base_t *obj)
+{
+    CHKVOID(obj);
+    obj->valid     = false;
+    obj->seq.epoch = 0;
+    obj->seq.seq   = 0;
+    cace_ari_list_init(obj->items);
+}
+
+void cace_ari_rpt_delta_base_init_set(cace_ari_rpt_delta_base_t *obj, const cace_ari_rpt_delta_base_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->valid = src->valid;
+    obj->seq   = src->seq;
+    cace_ari_list_init_set(obj->items, src->items);
+}
+
+void cace_ari_rpt_delta_base_deinit(cace_ari_rpt_delta_base_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_list_clear(obj->items);
+    obj->valid = false;
+}
+
+void cace_ari_rpt_delta_base_set(cace_ari_rpt_delta_base_t *obj, const cace_ari_rpt_delta_base_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->valid = src->valid;
+    obj->seq   = src->seq;
+    cace_ari_list_set(obj->items, src->items);
+}
+
+void cace_ari_rpt_delta_set_marker(cace_ari_t *ari)
+{
+    CHKVOID(ari);
+    cace_ari_set_objref_path_intid(ari, CACE_ARI_RPT_DELTA_MARKER_ORG_ENUM, CACE_ARI_RPT_DELTA_MARKER_MODEL_ENUM,
+                                   CACE_ARI_TYPE_IDENT, CACE_ARI_RPT_DELTA_MARKER_OBJ_ENUM);
+}
+
+void cace_ari_rpt_delta_set_resync(cace_ari_t *ari)
+{
+    CHKVOID(ari);
+    cace_ari_set_objref_path_intid(ari, CACE_ARI_RPT_DELTA_MARKER_ORG_ENUM, CACE_ARI_RPT_DELTA_MARKER_MODEL_ENUM,
+                                   CACE_ARI_TYPE_CTRL, CACE_ARI_RPT_DELTA_RESYNC_OBJ_ENUM);
+}
+
+bool cace_ari_rpt_delta_is_marker(const cace_ari_t *item)
+{
+    if (!item || !cace_ari_cget_ref_objpath(item))
+    {
+        return false;
+    }
+
+    cace_ari_t marker = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_rpt_delta_set_marker(&marker);
+    const bool match = cace_ari_equal(item, &marker);
+    cace_ari_deinit(&marker);
+    return match;
+}
+
+bool cace_ari_rpt_delta_is_encoded(const cace_ari_list_t items)
+{
+    if (cace_ari_list_empty_p(items))
+    {
+        return false;
+    }
+    return cace_ari_rpt_delta_is_marker(cace_ari_list_front(items));
+}
+
+int cace_ari_rpt_delta_encode(cace_ari_list_t out, size_t *changed, const cace_ari_rpt_delta_seq_t *seq,
+                              const cace_ari_list_t prev, const cace_ari_list_t cur)
+{
+    CHKERR1(changed);
+    CHKERR1(seq);
+
+    const size_t count   = cace_ari_list_size(cur);
+    const bool   is_full = (cace_ari_list_size(prev) != count);
+
+    cace_data_t mask;
+    cace_data_init(&mask);
+    if (cace_data_resize(&mask, (count + 7) / 8))
+    {
+        cace_data_deinit(&mask);
+        return 2;
+    }
+    if (mask.len)
+    {
+        memset(mask.ptr, 0, mask.len);
+    }
+
+    cace_ari_list_t present;
+    cace_ari_list_init(present);
+
+    cace_ari_list_it_t prev_it;
+    cace_ari_list_it(prev_it, prev);
+
+    size_t             ix = 0;
+    cace_ari_list_it_t cur_it;
+    for (cace_ari_list_it(cur_it, cur); !cace_ari_list_end_p(cur_it); cace_ari_list_next(cur_it), ++ix)
+    {
+        const cace_ari_t *item = cace_ari_list_cref(cur_it);
+        if (is_full || !cace_ari_equal(item, cace_ari_list_cref(prev_it)))
+        {
+            mask.ptr[ix / 8] |= (uint8_t)(1 << (ix % 8));
+            cace_ari_list_push_back(present, *item);
+        }
+        if (!is_full)
+        {
+            cace_ari_list_next(prev_it);
+        }
+    }
+    *changed = cace_ari_list_size(present);
+
+    cace_ari_list_reset(out);
+    cace_ari_rpt_delta_set_marker(cace_ari_list_push_back_new(out));
+    cace_ari_set_uvast(cace_ari_list_push_back_new(out), seq->epoch);
+    cace_ari_set_uvast(cace_ari_list_push_back_new(out), seq->seq);
+    cace_ari_set_uvast(cace_ari_list_push_back_new(out), count);
+    cace_ari_set_bstr(cace_ari_list_push_back_new(out), &mask, false);
+    while (!cace_ari_list_empty_p(present))
+    {
+        cace_ari_t item;
+        cace_ari_init(&item);
+        cace_ari_list_pop_front(&item, present);
+        cace_ari_list_push_back_move(out, &item);
+        cace_ari_deinit(&item);
+    }
+
+    cace_ari_list_clear(present);
+    cace_data_deinit(&mask);
+    return 0;
+}
+
+int cace_ari_rpt_delta_decode(cace_ari_list_t items, cace_ari_rpt_delta_base_t *base)
+{
+    CHKERR1(base);
+    if (cace_ari_list_size(items) < CACE_ARI_RPT_DELTA_HEAD_COUNT)
+    {
+        return 2;
+    }
+
+    cace_ari_list_it_t it;
+    cace_ari_list_it(it, items);
+    if (!cace_ari_rpt_delta_is_marker(cace_ari_list_cref(it)))
+    {
+        return 2;
+    }
+    cace_ari_list_next(it);
+
+    cace_ari_rpt_delta_seq_t seq;
+    if (cace_ari_get_uvast(cace_ari_list_cref(it), &(seq.epoch)))
+    {
+        return 2;
+    }
+    cace_ari_list_next(it);
+    if (cace_ari_get_uvast(cace_ari_list_cref(it), &(seq.seq)))
+    {
+        return 2;
+    }
+    cace_ari_list_next(it);
+
+    cace_ari_uvast count;
+    if (cace_ari_get_uvast(cace_ari_list_cref(it), &count))
+    {
+        return 2;
+    }
+    cace_ari_list_next(it);
+
+    const cace_data_t *mask = cace_ari_cget_bstr(cace_ari_list_cref(it));
+    if (!mask || (mask->len != (count + 7) / 8))
+    {
+        return 2;
+    }
+    cace_ari_list_next(it);
+
+    size_t present = 0;
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        if (mask->ptr[ix / 8] & (1 << (ix % 8)))
+        {
+            ++present;
+        }
+    }
+    if (cace_ari_list_size(items) != CACE_ARI_RPT_DELTA_HEAD_COUNT + present)
+    {
+        return 2;
+    }
+
+    const bool is_full = (present == count);
+    if (!is_full)
+    {
+        // only the immediately preceding report of the same epoch is usable
+        if (!base->valid || (base->seq.epoch != seq.epoch) || (base->seq.seq + 1 != seq.seq)
+            || (cace_ari_list_size(base->items) != count))
+        {
+            return 3;
+        }
+    }
+
+    cace_ari_list_t full;
+    cace_ari_list_init(full);
+
+    cace_ari_list_it_t prev_it;
+    cace_ari_list_it(prev_it, base->items);
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        cace_ari_t *item = cace_ari_list_push_back_new(full);
+        if (mask->ptr[ix / 8] & (1 << (ix % 8)))
+        {
+            cace_ari_set_move(item, cace_ari_list_ref(it));
+            cace_ari_list_next(it);
+        }
+        else
+        {
+            cace_ari_set_copy(item, cace_ari_list_cref(prev_it));
+        }
+        if (!is_full)
+        {
+            cace_ari_list_next(prev_it);
+        }
+    }
+
+    cace_ari_list_move(items, full);
+
+    base->valid = true;
+    base->seq   = seq;
+    cace_ari_list_set(base->items, items);
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_ari
+ * This file contains the encoding used for report-by-exception, where a
+ * report carries only the items which changed since the previous report
+ * from the same source to the same manager.
+ *
+ * A delta-encoded report has the items:
+ *  1. The object reference from cace_ari_rpt_delta_set_marker() as a
+ *     marker, which is an IDENT in the agent-private model
+ *     `//dtnma-tools/refda-instr` and is never a valid report item.
+ *  2. A UVAST epoch which identifies the sequence of reports.
+ *     An agent uses a new epoch whenever its state is reset, including
+ *     on restart.
+ *  3. A UVAST sequence number which increments for each report sent
+ *     within an epoch.
+ *  4. A UVAST count of items in the full report.
+ *  5. A BYTESTR mask with one bit per full report item, where the
+ *     least-significant bit of the first byte is the first item.
+ *     A set bit indicates the item is present in this report.
+ *  6. Each present item in order.
+ *
+ * A report with all mask bits set is a complete report and is used as the
+ * base for reassembling later reports.
+ * A report with any missing items can only be reassembled from the
+ * complete items of the immediately preceding report of the same epoch.
+ * A manager which cannot reassemble a report requests complete reports
+ * by executing the CTRL from cace_ari_rpt_delta_set_resync().
+ */
+#ifndef CACE_ARI_RPT_DELTA_H_
+#define CACE_ARI_RPT_DELTA_H_
+
+#include "cace/ari.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Organization enumeration of the marker object
+#define CACE_ARI_RPT_DELTA_MARKER_ORG_ENUM -1
+/// Model enumeration of the marker object
+#define CACE_ARI_RPT_DELTA_MARKER_MODEL_ENUM 1
+/// IDENT enumeration of the marker object
+#define CACE_ARI_RPT_DELTA_MARKER_OBJ_ENUM 0
+/// CTRL enumeration of the resync object, in the same model as the marker
+#define CACE_ARI_RPT_DELTA_RESYNC_OBJ_ENUM 0
+/// Number of header items in a delta-encoded report
+#define CACE_ARI_RPT_DELTA_HEAD_COUNT 5
+
+/** Position of a single report within a sequence of delta-encoded reports.
+ */
+typedef struct
+{
+    /// Identifier of the whole sequence
+    cace_ari_uvast epoch;
+    /// Position within the sequence
+    cace_ari_uvast seq;
+} cace_ari_rpt_delta_seq_t;
+
+/** The state needed to reassemble delta-encoded reports from one source.
+ */
+typedef struct
+{
+    /// True if #seq and #items are from a previous report
+    bool valid;
+    /// Position of the previous report
+    cace_ari_rpt_delta_seq_t seq;
+    /// Complete items of the previous report
+    cace_ari_list_t items;
+} cace_ari_rpt_delta_base_t;
+
+void cace_ari_rpt_delta_base_init(cace_ari_rpt_delta_base_t *obj);
+
+void cace_ari_rpt_delta_base_init_set(cace_ari_rpt_delta_base_t *obj, const cace_ari_rpt_delta_base_t *src);
+
+void cace_ari_rpt_delta_base_deinit(cace_ari_rpt_delta_base_t *obj);
+
+void cace_ari_rpt_delta_base_set(cace_ari_rpt_delta_base_t *obj, const cace_ari_rpt_delta_base_t *src);
+
+/// M*LIB OPLIST for cace_ari_rpt_delta_base_t
+#define M_OPL_cace_ari_rpt_delta_base_t()                                                          \
+    (INIT(API_2(cace_ari_rpt_delta_base_init)), INIT_SET(API_6(cace_ari_rpt_delta_base_init_set)), \
+     CLEAR(API_2(cace_ari_rpt_delta_base_deinit)), SET(API_6(cace_ari_rpt_delta_base_set)))
+
+/** Set an ARI to the marker which begins a delta-encoded report.
+ *
+ * @param[out] ari The value to set.
+ */
+void cace_ari_rpt_delta_set_marker(cace_ari_t *ari);
+
+/** Set an ARI to a reference to the CTRL which causes an agent to send
+ * complete reports to the executing manager.
+ *
+ * @param[out] ari The value to set.
+ */
+void cace_ari_rpt_delta_set_resync(cace_ari_t *ari);
+
+/** Determine if an item is the marker which begins a delta-encoded report.
+ *
+ * @param[in] item The first item of a report.
+ * @return True if this is the marker value.
+ */
+bool cace_ari_rpt_delta_is_marker(const cace_ari_t *item);
+
+/** Determine if a report item list is delta-encoded.
+ *
+ * @param[in] items The report items.
+ * @return True if the first item is the marker value.
+ */
+bool cace_ari_rpt_delta_is_encoded(const cace_ari_list_t items);
+
+/** Encode report items relative to the previous report items.
+ * If the item count differs from @c prev the result is a complete report,
+ * so an empty @c prev list forces a complete report.
+ *
+ * @param[out] out The list to reset and populate with delta-encoded items.
+ * @param[out] changed The number of items which are present in @c out,
+ * which is zero if nothing changed.
+ * @param[in] seq The position of this report.
+ * @param[in] prev The items of the previous report, or an empty list.
+ * @param[in] cur The items of the current report.
+ * @return Zero if successful.
+ */
+int cace_ari_rpt_delta_encode(cace_ari_list_t out, size_t *changed, const cace_ari_rpt_delta_seq_t *seq,
+                              const cace_ari_list_t prev, const cace_ari_list_t cur);
+
+/** Reassemble complete report items in-place from delta-encoded items.
+ * When successful the @c base is updated to this report, so that it can
+ * be used for the next report from the same source.
+ *
+ * @param[in,out] items The delta-encoded items to replace.
+ * @param[in,out] base The state from the previous report, which is only
+ * needed if some items are not present in @c items.
+ * @return Zero if successful.
+ * 2 if the items are not validly delta-encoded.
+ * 3 if the @c base is needed but is not valid, is from a different epoch,
+ * is not the immediately preceding report, or does not match the count.
+ * The caller should request complete reports in this case.
+ */
+int cace_ari_rpt_delta_decode(cace_ari_list_t items, cace_ari_rpt_delta_base_t *base);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACE_ARI_RPT_DELTA_H_ */
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tbl_cols.h"
+
+#include "cace/util/defs.h"
+
+void cace_ari_tbl_col_init(cace_ari_tbl_col_t *obj)
+{
+    CHKVOID(obj);
+    obj->packed       = true;
+    obj->has_ari_type = false;
+    obj->ari_type     = 0;
+    obj->prim_type    = CACE_ARI_PRIM_UNDEFINED;
+    cace_ari_tbl_word_array_init(obj->words);
+    cace_ari_compact_array_init(obj->items);
+}
+
+void cace_ari_tbl_col_init_set(cace_ari_tbl_col_t *obj, const cace_ari_tbl_col_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->packed       = src->packed;
+    obj->has_ari_type = src->has_ari_type;
+    obj->ari_type     = src->ari_type;
+    obj->prim_type    = src->prim_type;
+    cace_ari_tbl_word_array_init_set(obj->words, src->words);
+    cace_ari_compact_array_init_set(obj->items, src->items);
+}
+
+void cace_ari_tbl_col_deinit(cace_ari_tbl_col_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_compact_array_clear(obj->items);
+    cace_ari_tbl_word_array_clear(obj->words);
+}
+
+void cace_ari_tbl_col_set(cace_ari_tbl_col_t *obj, const cace_ari_tbl_col_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->packed       = src->packed;
+    obj->has_ari_type = src->has_ari_type;
+    obj->ari_type     = src->ari_type;
+    obj->prim_type    = src->prim_type;
+    cace_ari_tbl_word_array_set(obj->words, src->words);
+    cace_ari_compact_array_set(obj->items, src->items);
+}
+
+size_t cace_ari_tbl_col_size(const cace_ari_tbl_col_t *obj)
+{
+    if (!obj)
+    {
+        return 0;
+    }
+    return obj->packed ? cace_ari_tbl_word_array_size(obj->words) : cace_ari_compact_array_size(obj->items);
+}
+
+/** Determine if a value can be held in a packed column at all.
+ */
+static bool cace_ari_tbl_col_packable(const cace_ari_t *item)
+{
+    if (item->is_ref)
+    {
+        return false;
+    }
+    switch (item->as_lit.prim_type)
+    {
+        case CACE_ARI_PRIM_BOOL:
+        case CACE_ARI_PRIM_UINT64:
+        case CACE_ARI_PRIM_INT64:
+        case CACE_ARI_PRIM_FLOAT64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Determine if a value has the same literal form as a packed column.
+ */
+static bool cace_ari_tbl_col_fits(const cace_ari_tbl_col_t *obj, const cace_ari_t *item)
+{
+    if (item->is_ref)
+    {
+        return false;
+    }
+    const cace_ari_lit_t *lit = &(item->as_lit);
+    if (lit->has_ari_type != obj->has_ari_type)
+    {
+        return false;
+    }
+    if (lit->has_ari_type && (lit->ari_type != obj->ari_type))
+    {
+        return false;
+    }
+    return (lit->prim_type == obj->prim_type);
+}
+
+/** Reconstruct a literal value from a packed word without allocation.
+ */
+static void cace_ari_tbl_col_view(cace_ari_t *out, const cace_ari_tbl_col_t *obj, const cace_ari_tbl_word_t *word)
+{
+    *out = CACE_ARI_INIT_UNDEFINED;
+
+    cace_ari_lit_t *lit = &(out->as_lit);
+    lit->has_ari_type   = obj->has_ari_type;
+    lit->ari_type       = obj->ari_type;
+    lit->prim_type      = obj->prim_type;
+    switch (obj->prim_type)
+    {
+        case CACE_ARI_PRIM_BOOL:
+            lit->value.as_bool = word->as_bool;
+            break;
+        case CACE_ARI_PRIM_UINT64:
+            lit->value.as_uint64 = word->as_uint64;
+            break;
+        case CACE_ARI_PRIM_INT64:
+            lit->value.as_int64 = word->as_int64;
+            break;
+        case CACE_ARI_PRIM_FLOAT64:
+            lit->value.as_float64 = word->as_float64;
+            break;
+        default:
+            break;
+    }
+}
+
+/** Move all packed values into generic form.
+ */
+static void cace_ari_tbl_col_unpack(cace_ari_tbl_col_t *obj)
+{
+    cace_ari_compact_array_reset(obj->items);
+    cace_ari_compact_array_reserve(obj->items, cace_ari_tbl_word_array_size(obj->words));
+
+    cace_ari_tbl_word_array_it_t it;
+    for (cace_ari_tbl_word_array_it(it, obj->words); !cace_ari_tbl_word_array_end_p(it);
+         cace_ari_tbl_word_array_next(it))
+    {
+        cace_ari_t item;
+        cace_ari_tbl_col_view(&item, obj, cace_ari_tbl_word_array_cref(it));
+        cace_ari_compact_set_ari_move(cace_ari_compact_array_push_new(obj->items), &item);
+    }
+
+    cace_ari_tbl_word_array_reset(obj->words);
+    obj->packed = false;
+}
+
+static void cace_ari_tbl_col_push_move(cace_ari_tbl_col_t *obj, cace_ari_t *item)
+{
+    if (obj->packed)
+    {
+        if (cace_ari_tbl_word_array_empty_p(obj->words) && cace_ari_tbl_col_packable(item))
+        {
+            // first value decides the form of the column
+            obj->has_ari_type = item->as_lit.has_ari_type;
+            obj->ari_type     = item->as_lit.ari_type;
+            obj->prim_type    = item->as_lit.prim_type;
+        }
+
+        if (cace_ari_tbl_col_packable(item) && cace_ari_tbl_col_fits(obj, item))
+        {
+            const union cace_ari_prim_val_u *val  = &(item->as_lit.value);
+            cace_ari_tbl_word_t             *word = cace_ari_tbl_word_array_push_new(obj->words);
+            switch (obj->prim_type)
+            {
+                case CACE_ARI_PRIM_BOOL:
+                    word->as_bool = val->as_bool;
+                    break;
+                case CACE_ARI_PRIM_UINT64:
+                    word->as_uint64 = val->as_uint64;
+                    break;
+                case CACE_ARI_PRIM_INT64:
+                    word->as_int64 = val->as_int64;
+                    break;
+                case CACE_ARI_PRIM_FLOAT64:
+                    word->as_float64 = val->as_float64;
+                    break;
+                default:
+                    break;
+            }
+            // primitive values hold no other resources
+            cace_ari_deinit(item);
+            return;
+        }
+
+        cace_ari_tbl_col_unpack(obj);
+    }
+
+    cace_ari_compact_set_ari_move(cace_ari_compact_array_push_new(obj->items), item);
+}
+
+void cace_ari_tbl_cols_init(cace_ari_tbl_cols_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_tbl_col_array_init(obj->cols);
+    obj->nitems = 0;
+}
+
+void cace_ari_tbl_cols_init_set(cace_ari_tbl_cols_t *obj, const cace_ari_tbl_cols_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_tbl_col_array_init_set(obj->cols, src->cols);
+    obj->nitems = src->nitems;
+}
+
+void cace_ari_tbl_cols_deinit(cace_ari_tbl_cols_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_tbl_col_array_clear(obj->cols);
+}
+
+void cace_ari_tbl_cols_reset(cace_ari_tbl_cols_t *obj, size_t ncols)
+{
+    CHKVOID(obj);
+    cace_ari_tbl_col_array_reset(obj->cols);
+    cace_ari_tbl_col_array_resize(obj->cols, ncols);
+    obj->nitems = 0;
+}
+
+size_t cace_ari_tbl_cols_num_cols(const cace_ari_tbl_cols_t *obj)
+{
+    if (!obj)
+    {
+        return 0;
+    }
+    return cace_ari_tbl_col_array_size(obj->cols);
+}
+
+size_t cace_ari_tbl_cols_num_rows(const cace_ari_tbl_cols_t *obj)
+{
+    const size_t ncols = cace_ari_tbl_cols_num_cols(obj);
+    if (!ncols)
+    {
+        return 0;
+    }
+    return obj->nitems / ncols;
+}
+
+int cace_ari_tbl_cols_push_move(cace_ari_tbl_cols_t *obj, cace_ari_t *item)
+{
+    CHKERR1(obj);
+    CHKERR1(item);
+
+    const size_t ncols = cace_ari_tbl_col_array_size(obj->cols);
+    if (!ncols)
+    {
+        return 2;
+    }
+
+    cace_ari_tbl_col_push_move(cace_ari_tbl_col_array_get(obj->cols, obj->nitems % ncols), item);
+    ++(obj->nitems);
+    return 0;
+}
+
+cace_ari_t *cace_ari_tbl_cols_view(cace_ari_tbl_cols_t *obj, size_t row, size_t col, cace_ari_t *buf)
+{
+    CHKNULL(obj);
+    CHKNULL(buf);
+    if (col >= cace_ari_tbl_col_array_size(obj->cols))
+    {
+        return NULL;
+    }
+
+    cace_ari_tbl_col_t *column = cace_ari_tbl_col_array_get(obj->cols, col);
+    if (row >= cace_ari_tbl_col_size(column))
+    {
+        return NULL;
+    }
+
+    if (column->packed)
+    {
+        cace_ari_tbl_col_view(buf, column, cace_ari_tbl_word_array_cget(column->words, row));
+        return buf;
+    }
+
+    cace_ari_compact_t *cval = cace_ari_compact_array_get(column->items, row);
+    if (cace_ari_compact_is_boxed(cval))
+    {
+        return cval->as_box;
+    }
+    // an inline view is never modified through the table
+    return (cace_ari_t *)cace_ari_compact_cview(cval, buf);
+}
+
+const cace_ari_t *cace_ari_tbl_cols_cview(const cace_ari_tbl_cols_t *obj, size_t row, size_t col, cace_ari_t *buf)
+{
+    // the mutable view does not modify the table itself
+    return cace_ari_tbl_cols_view((cace_ari_tbl_cols_t *)obj, row, col, buf);
+}
+
+int cace_ari_tbl_cols_get(cace_ari_t *out, const cace_ari_tbl_cols_t *obj, size_t row, size_t col)
+{
+    CHKERR1(out);
+    CHKERR1(obj);
+
+    cace_ari_t        buf;
+    const cace_ari_t *item = cace_ari_tbl_cols_cview(obj, row, col, &buf);
+    if (!item)
+    {
+        return 2;
+    }
+    cace_ari_set_copy(out, item);
+    return 0;
+}
+
+int cace_ari_tbl_cols_from_items(cace_ari_tbl_cols_t *obj, size_t ncols, cace_ari_array_t items)
+{
+    CHKERR1(obj);
+
+    const size_t nitems = cace_ari_array_size(items);
+    if (((ncols == 0) && nitems) || ((ncols != 0) && (nitems % ncols != 0)))
+    {
+        return 2;
+    }
+
+    cace_ari_tbl_cols_reset(obj, ncols);
+    if (ncols)
+    {
+        const size_t nrows = nitems / ncols;
+        for (size_t col = 0; col < ncols; ++col)
+        {
+            cace_ari_tbl_col_t *column = cace_ari_tbl_col_array_get(obj->cols, col);
+            cace_ari_tbl_word_array_reserve(column->words, nrows);
+        }
+    }
+
+    cace_ari_array_it_t it;
+    for (cace_ari_array_it(it, items); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+    {
+        cace_ari_tbl_cols_push_move(obj, cace_ari_array_ref(it));
+    }
+    // all items are moved-from
+    cace_ari_array_reset(items);
+    return 0;
+}
+
+int cace_ari_tbl_cols_to_items(cace_ari_array_t items, cace_ari_tbl_cols_t *obj)
+{
+    CHKERR1(items);
+    CHKERR1(obj);
+
+    const size_t ncols = cace_ari_tbl_cols_num_cols(obj);
+    const size_t nrows = cace_ari_tbl_cols_num_rows(obj);
+    cace_ari_array_reset(items);
+    cace_ari_array_resize(items, ncols * nrows);
+
+    for (size_t col = 0; col < ncols; ++col)
+    {
+        for (size_t row = 0; row < nrows; ++row)
+        {
+            cace_ari_t  buf;
+            cace_ari_t *item = cace_ari_tbl_cols_view(obj, row, col, &buf);
+            cace_ari_t *out  = cace_ari_array_get(items, row * ncols + col);
+            if (item == &buf)
+            {
+                // reconstructed values may reference inline storage
+                cace_ari_set_copy(out, item);
+            }
+            else
+            {
+                cace_ari_set_move(out, item);
+            }
+        }
+    }
+
+    cace_ari_tbl_cols_reset(obj, ncols);
+    return 0;
+}
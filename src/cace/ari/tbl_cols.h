@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_ari
+ * This file contains a columnar representation of TBL values.
+ *
+ * Each column of a table is stored separately. A column whose values all
+ * share the same literal form (explicit ARI type and primitive type) of a
+ * BOOL, UINT64, INT64, or FLOAT64 primitive is packed as a vector of plain
+ * words. Any other column is a generic column holding a compact ARI for
+ * each value, see compact.h. A packed column is converted to a generic one as soon as a value
+ * which does not fit its form is appended.
+ *
+ * A TBL literal holds its values in this form after cace_ari_tbl_pack(),
+ * which is done for large tables when they are decoded or produced.
+ */
+#ifndef CACE_ARI_TBL_COLS_H_
+#define CACE_ARI_TBL_COLS_H_
+
+#include "compact.h"
+
+#include "cace/ari.h"
+
+#include <m-array.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A single packed value of a column
+typedef union
+{
+    /// Used when cace_ari_tbl_col_t::prim_type is ::CACE_ARI_PRIM_BOOL
+    cace_ari_bool as_bool;
+    /// Used when cace_ari_tbl_col_t::prim_type is ::CACE_ARI_PRIM_UINT64
+    uint64_t as_uint64;
+    /// Used when cace_ari_tbl_col_t::prim_type is ::CACE_ARI_PRIM_INT64
+    int64_t as_int64;
+    /// Used when cace_ari_tbl_col_t::prim_type is ::CACE_ARI_PRIM_FLOAT64
+    cace_ari_real64 as_float64;
+} cace_ari_tbl_word_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(cace_ari_tbl_word_array, cace_ari_tbl_word_t, M_POD_OPLIST)
+/// @endcond
+
+/** A single column of a columnar table.
+ */
+typedef struct
+{
+    /// True if values are held in #words, otherwise they are in #items
+    bool packed;
+    /// For a packed column, true if #ari_type is valid
+    bool has_ari_type;
+    /// For a packed column, the ARI type shared by all values
+    cace_ari_type_t ari_type;
+    /// For a packed column, the primitive type shared by all values
+    enum cace_ari_prim_type_e prim_type;
+    /// Values of a packed column
+    cace_ari_tbl_word_array_t words;
+    /// Values of a generic column
+    cace_ari_compact_array_t items;
+} cace_ari_tbl_col_t;
+
+void cace_ari_tbl_col_init(cace_ari_tbl_col_t *obj);
+void cace_ari_tbl_col_init_set(cace_ari_tbl_col_t *obj, const cace_ari_tbl_col_t *src);
+void cace_ari_tbl_col_deinit(cace_ari_tbl_col_t *obj);
+void cace_ari_tbl_col_set(cace_ari_tbl_col_t *obj, const cace_ari_tbl_col_t *src);
+
+/** Get the number of values in a column.
+ *
+ * @param[in] obj The column to inspect.
+ * @return The value count.
+ */
+size_t cace_ari_tbl_col_size(const cace_ari_tbl_col_t *obj);
+
+/// M*LIB OPLIST for ::cace_ari_tbl_col_t
+#define M_OPL_cace_ari_tbl_col_t()                                                                                   \
+    (INIT(API_2(cace_ari_tbl_col_init)), INIT_SET(API_6(cace_ari_tbl_col_init_set)),                                 \
+     CLEAR(API_2(cace_ari_tbl_col_deinit)), SET(API_6(cace_ari_tbl_col_set)))
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(cace_ari_tbl_col_array, cace_ari_tbl_col_t)
+/// @endcond
+
+/** A columnar table with a fixed column count and arbitrary row count.
+ */
+typedef struct cace_ari_tbl_cols_s
+{
+    /// Ordered columns of the table, which also determines the column count
+    cace_ari_tbl_col_array_t cols;
+    /// Total number of values appended, including any partial row
+    size_t nitems;
+} cace_ari_tbl_cols_t;
+
+void cace_ari_tbl_cols_init(cace_ari_tbl_cols_t *obj);
+void cace_ari_tbl_cols_init_set(cace_ari_tbl_cols_t *obj, const cace_ari_tbl_cols_t *src);
+void cace_ari_tbl_cols_deinit(cace_ari_tbl_cols_t *obj);
+
+/** Reset a table to a specific column count with no rows.
+ *
+ * @param[in,out] obj The table to reset.
+ * @param ncols The number of columns.
+ */
+void cace_ari_tbl_cols_reset(cace_ari_tbl_cols_t *obj, size_t ncols);
+
+/** Get the number of columns in a table.
+ *
+ * @param[in] obj The table to inspect.
+ * @return The column count.
+ */
+size_t cace_ari_tbl_cols_num_cols(const cace_ari_tbl_cols_t *obj);
+
+/** Get the number of complete rows in a table.
+ *
+ * @param[in] obj The table to inspect.
+ * @return The row count.
+ */
+size_t cace_ari_tbl_cols_num_rows(const cace_ari_tbl_cols_t *obj);
+
+/** Append a value to a table in row-major order, moving data from the
+ * source.
+ *
+ * @param[in,out] obj The table to append to.
+ * @param[in,out] item The value to move from.
+ * @return Zero if successful.
+ * 2 if the table has no columns.
+ */
+int cace_ari_tbl_cols_push_move(cace_ari_tbl_cols_t *obj, cace_ari_t *item);
+
+/** Get a read-only view of a single value in a table.
+ * For a packed column or an inline compact value the value is
+ * reconstructed into @c buf without any allocation, and for a boxed compact
+ * value the stored value is referenced.
+ *
+ * @param[in] obj The table to read from.
+ * @param row The row index.
+ * @param col The column index.
+ * @param[out] buf Storage for a reconstructed value, which does not need to
+ * be initialized and holds no resources afterward.
+ * @return A pointer to the value, or NULL if the indices are out of range.
+ */
+const cace_ari_t *cace_ari_tbl_cols_cview(const cace_ari_tbl_cols_t *obj, size_t row, size_t col, cace_ari_t *buf);
+
+/** Get a view of a single value in a table which may be modified.
+ * For a packed column or an inline compact value the value is
+ * reconstructed into @c buf and any change to it is not stored, for a boxed
+ * compact value the stored value is referenced.
+ *
+ * @param[in] obj The table to read from.
+ * @param row The row index.
+ * @param col The column index.
+ * @param[out] buf Storage for a reconstructed value, which does not need to
+ * be initialized.
+ * @return A pointer to the value, or NULL if the indices are out of range.
+ */
+cace_ari_t *cace_ari_tbl_cols_view(cace_ari_tbl_cols_t *obj, size_t row, size_t col, cace_ari_t *buf);
+
+/** Copy a single value out of a table.
+ *
+ * @param[out] out The already-initialized value to set.
+ * @param[in] obj The table to read from.
+ * @param row The row index.
+ * @param col The column index.
+ * @return Zero if successful.
+ * 2 if the indices are out of range.
+ */
+int cace_ari_tbl_cols_get(cace_ari_t *out, const cace_ari_tbl_cols_t *obj, size_t row, size_t col);
+
+/** Populate a columnar table from the row-major values of a table.
+ *
+ * @param[out] obj The table to reset and populate.
+ * @param ncols The number of columns.
+ * @param[in,out] items The row-major values to move from, which are left
+ * empty.
+ * @return Zero if successful.
+ * 2 if there is an incomplete row.
+ */
+int cace_ari_tbl_cols_from_items(cace_ari_tbl_cols_t *obj, size_t ncols, cace_ari_array_t items);
+
+/** Move all complete rows of a columnar table into row-major values.
+ *
+ * @param[out] items The row-major values to reset and populate.
+ * @param[in,out] obj The columnar table to move values from, which is left
+ * without any rows.
+ * @return Zero if successful.
+ */
+int cace_ari_tbl_cols_to_items(cace_ari_array_t items, cace_ari_tbl_cols_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CACE_ARI_TBL_COLS_H_ */
@@ -161,12 +161,10 @@ static int cace_ari_text_encode_tbl(cace_ari_text_enc_state_t *state, const cace
     }
 
     ++(state->depth);
-    const size_t nrows = cace_ari_array_size(ctr->items) / ctr->ncols;
+    const size_t nrows = cace_ari_tbl_num_rows(ctr);
 
     int retval = 0;
 
-    cace_ari_array_it_t item_it;
-    cace_ari_array_it(item_it, ctr->items);
     for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
     {
         m_string_push_back(state->out, '(');
@@ -174,7 +172,8 @@ static int cace_ari_text_encode_tbl(cace_ari_text_enc_state_t *state, const cace
         bool sep = false;
         for (size_t col_ix = 0; col_ix < ctr->ncols; ++col_ix)
         {
-            const cace_ari_t *item = cace_ari_array_cref(item_it);
+            cace_ari_t        buf;
+            const cace_ari_t *item = cace_ari_tbl_cview(ctr, row_ix, col_ix, &buf);
 
             if (sep)
             {
@@ -188,8 +187,6 @@ static int cace_ari_text_encode_tbl(cace_ari_text_enc_state_t *state, const cace
                 retval = 2;
                 break;
             }
-
-            cace_ari_array_next(item_it);
         }
 
         m_string_push_back(state->out, ')');
@@ -25,8 +25,109 @@
 #include <m-core.h>
 #include <m-string.h>
 
+#include <pthread.h>
 #include <string.h>
 
+/// A free small block, linked through the block storage itself
+typedef struct cace_data_small_free_s
+{
+    /// The next free block or NULL
+    struct cace_data_small_free_s *next;
+} cace_data_small_free_t;
+
+/// Thread-specific cache of free small blocks
+typedef struct
+{
+    /// The first free block or NULL
+    cace_data_small_free_t *head;
+    /// Number of blocks in the list
+    size_t count;
+} cace_data_small_cache_t;
+
+/// Initialize ::small_key once
+static pthread_once_t small_once = PTHREAD_ONCE_INIT;
+/// Thread-specific ::cace_data_small_cache_t
+static pthread_key_t small_key;
+/// True if ::small_key is valid
+static bool small_valid = false;
+
+static void cace_data_small_release(void *arg)
+{
+    cace_data_small_cache_t *cache = arg;
+    while (cache->head)
+    {
+        cace_data_small_free_t *blk = cache->head;
+        cache->head                 = blk->next;
+        CACE_FREE(blk);
+    }
+    CACE_FREE(cache);
+}
+
+static void cace_data_small_key_init(void)
+{
+    small_valid = (pthread_key_create(&small_key, cace_data_small_release) == 0);
+}
+
+static cace_data_small_cache_t *cace_data_small_cache(bool create)
+{
+    pthread_once(&small_once, cace_data_small_key_init);
+    if (!small_valid)
+    {
+        return NULL;
+    }
+
+    cace_data_small_cache_t *cache = pthread_getspecific(small_key);
+    if (!cache && create)
+    {
+        cache = CACE_MALLOC(sizeof(cace_data_small_cache_t));
+        if (!cache)
+        {
+            return NULL;
+        }
+        cache->head  = NULL;
+        cache->count = 0;
+        if (pthread_setspecific(small_key, cache))
+        {
+            CACE_FREE(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+/** Allocate a block of ::CACE_DATA_SMALL_MAX size, preferring the
+ * thread-specific cache.
+ */
+static cace_data_ptr_t cace_data_small_alloc(void)
+{
+    cace_data_small_cache_t *cache = cace_data_small_cache(false);
+    if (cache && cache->head)
+    {
+        cace_data_small_free_t *blk = cache->head;
+        cache->head                 = blk->next;
+        --(cache->count);
+        return (cace_data_ptr_t)blk;
+    }
+    return CACE_MALLOC(CACE_DATA_SMALL_MAX);
+}
+
+/** Release a block of at least ::CACE_DATA_SMALL_MAX size, keeping it
+ * in the thread-specific cache if there is room.
+ */
+static void cace_data_small_free(cace_data_ptr_t ptr)
+{
+    cace_data_small_cache_t *cache = cace_data_small_cache(true);
+    if (cache && (cache->count < CACE_DATA_SMALL_CACHE))
+    {
+        cace_data_small_free_t *blk = (cace_data_small_free_t *)ptr;
+        blk->next                   = cache->head;
+        cache->head                 = blk;
+        ++(cache->count);
+        return;
+    }
+    CACE_FREE(ptr);
+}
+
 static void cace_data_int_reset(cace_data_t *data)
 {
     data->owned = false;
@@ -38,7 +139,15 @@ static void cace_data_int_free(cace_data_t *data)
 {
     if (data->owned && data->ptr)
     {
-        CACE_FREE(data->ptr);
+        // every owned block has at least the small size
+        if (data->len <= CACE_DATA_SMALL_MAX)
+        {
+            cace_data_small_free(data->ptr);
+        }
+        else
+        {
+            CACE_FREE(data->ptr);
+        }
     }
 }
 
@@ -217,13 +326,33 @@ int cace_data_resize(cace_data_t *data, size_t len)
         return 0;
     }
 
+    cace_data_ptr_t got;
     if (!data->owned)
     {
-        data->ptr = NULL;
+        // new owned storage with the viewed data
+        got = (len <= CACE_DATA_SMALL_MAX) ? cace_data_small_alloc() : CACE_MALLOC(len);
+        if (UNLIKELY(!got))
+        {
+            cace_data_int_reset(data);
+            return 2;
+        }
+        if (data->ptr)
+        {
+            memcpy(got, data->ptr, (len < data->len) ? len : data->len);
+        }
+    }
+    else if (len <= CACE_DATA_SMALL_MAX)
+    {
+        // trim a large block down to the small size
+        got = (data->len > CACE_DATA_SMALL_MAX) ? CACE_REALLOC(data->ptr, CACE_DATA_SMALL_MAX) : data->ptr;
+    }
+    else
+    {
+        got = CACE_REALLOC(data->ptr, len);
     }
-    cace_data_ptr_t got = CACE_REALLOC(data->ptr, len);
     if (UNLIKELY(!got))
     {
+        cace_data_int_free(data);
         cace_data_int_reset(data);
         return 2;
     }
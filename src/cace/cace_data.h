@@ -41,6 +41,16 @@ extern "C" {
 /// Data pointer for cace_data_t
 typedef uint8_t *cace_data_ptr_t;
 
+/** Size of the smallest owned data allocation.
+ * Owned data of up to this size can be resized without reallocating, and
+ * freed blocks of this size are kept in a per-thread cache of up to
+ * ::CACE_DATA_SMALL_CACHE blocks for reuse.
+ */
+#define CACE_DATA_SMALL_MAX 24
+
+/// Number of free small blocks cached by each thread
+#define CACE_DATA_SMALL_CACHE 256
+
 /** Heap data for TSTR and BSTR types.
  */
 typedef struct cace_data_s
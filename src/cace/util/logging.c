@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_cace_util
+ * Severity handling shared by all logging backends.
+ */
+#include "defs.h"
+#include "logging.h"
+
+#include <m-atomic.h>
+
+#include <stddef.h>
+#include <strings.h>
+
+// NOLINTBEGIN
+static const char *sev_names[] = {
+    NULL,      // LOG_EMERG
+    NULL,      // LOG_ALERT
+    "CRIT",    // LOG_CRIT
+    "ERROR",   // LOG_ERR
+    "WARNING", // LOG_WARNING
+    NULL,      // LOG_NOTICE
+    "INFO",    // LOG_INFO
+    "DEBUG",   // LOG_DEBUG
+};
+// NOLINTEND
+
+/// The least severity enabled for logging
+static atomic_int cace_log_limit = ATOMIC_VAR_INIT(LOG_DEBUG);
+
+const char *cace_log_severity_name(int severity)
+{
+    if ((severity < 0) || (severity > LOG_DEBUG))
+    {
+        return NULL;
+    }
+    return sev_names[severity];
+}
+
+int cace_log_get_severity(int *severity, const char *name)
+{
+    CHKERR1(severity)
+    CHKERR1(name)
+
+    for (size_t ix = 0; ix < sizeof(sev_names) / sizeof(const char *); ++ix)
+    {
+        if (!sev_names[ix])
+        {
+            continue;
+        }
+        if (strcasecmp(sev_names[ix], name) == 0)
+        {
+            *severity = (int)ix;
+            return 0;
+        }
+    }
+    return 2;
+}
+
+void cace_log_set_least_severity(int severity)
+{
+    if ((severity < 0) || (severity > LOG_DEBUG))
+    {
+        return;
+    }
+
+    atomic_store(&cace_log_limit, severity);
+}
+
+int cace_log_get_least_severity(void)
+{
+    return atomic_load_explicit(&cace_log_limit, memory_order_relaxed);
+}
+
+bool cace_log_is_enabled_for(int severity)
+{
+    if ((severity < 0) || (severity > LOG_DEBUG))
+    {
+        return false;
+    }
+
+    const int limit = atomic_load(&cace_log_limit);
+    // lower severity has higher define value
+    const bool enabled = (limit >= severity);
+    return enabled;
+}
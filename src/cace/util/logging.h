@@ -36,10 +36,22 @@
  *  * @c LOG_WARNING warning conditions, logged by ::CACE_LOG_WARNING
  *  * @c LOG_INFO informational message, logged by ::CACE_LOG_INFO
  *  * @c LOG_DEBUG debug-level message, logged by ::CACE_LOG_DEBUG
+ *
+ * The macros check the least severity before the call, so a suppressed
+ * event costs only a severity lookup and none of its format values are
+ * evaluated.
+ *
+ * The backend is chosen by the @c LOGGING_BATCHED build option.
+ * When enabled, each thread writes fixed-size records into its own ring
+ * without any allocation or locking, and messages longer than the record
+ * size are truncated.
+ * Otherwise, each event is allocated and queued to the writer thread.
  */
 #ifndef CACE_LOGGING_H_
 #define CACE_LOGGING_H_
 
+#include <m-atomic.h>
+
 #include <stdbool.h>
 #include <syslog.h>
 
@@ -69,6 +81,13 @@ void cace_closelog(void);
  */
 int cace_log_get_severity(int *severity, const char *name);
 
+/** Get the text name of a severity level.
+ *
+ * @param severity The severity from a subset of the POSIX syslog values.
+ * @return The upper-case name, or NULL if not a valid severity.
+ */
+const char *cace_log_severity_name(int severity);
+
 /** Set the least severity enabled for logging.
  * Other events will be dropped by the logging facility.
  * This function is multi-thread safe.
@@ -87,6 +106,21 @@ void cace_log_set_least_severity(int severity);
  */
 bool cace_log_is_enabled_for(int severity);
 
+/** Get the least severity enabled for logging.
+ * This function is multi-thread safe.
+ *
+ * @return The severity from a subset of the POSIX syslog values.
+ * @sa cace_log_set_least_severity
+ */
+int cace_log_get_least_severity(void);
+
+/** Check of whether a constant severity is being logged.
+ * Unlike cace_log_is_enabled_for() the severity is not validated.
+ *
+ * @param severity The severity from a subset of the POSIX syslog values.
+ */
+#define CACE_LOG_ENABLED_FOR(severity) (cace_log_get_least_severity() >= (severity))
+
 /** Log an event.
  *
  * @param severity The severity from a subset of the POSIX syslog values.
@@ -95,22 +129,32 @@ bool cace_log_is_enabled_for(int severity);
  * @param[in] funcname The originating function name.
  * @param[in] format The log message format string.
  * @param ... Values for the format string.
+ * @note The @c filename and @c funcname must have static storage duration,
+ * as the values from the logging macros do, because a backend may defer
+ * formatting them until after this function returns.
  */
 void cace_log(int severity, const char *filename, int lineno, const char *funcname, const char *format, ...);
 
+/** Log an event only if its severity is enabled.
+ * This avoids the function call, and evaluating any of the format values,
+ * for a suppressed event.
+ */
+#define CACE_LOG_SEV(severity, ...) \
+    (CACE_LOG_ENABLED_FOR(severity) ? cace_log((severity), __FILE__, __LINE__, __func__, __VA_ARGS__) : (void)0)
+
 /** Perform LOG_CRIT level logging with auto-filled parameters.
  * The arguments to this macro are passed to cace_log() as the @c format and
  * its parameter values.
  */
-#define CACE_LOG_CRIT(...) cace_log(LOG_CRIT, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define CACE_LOG_CRIT(...) CACE_LOG_SEV(LOG_CRIT, __VA_ARGS__)
 /// @overload
-#define CACE_LOG_ERR(...) cace_log(LOG_ERR, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define CACE_LOG_ERR(...) CACE_LOG_SEV(LOG_ERR, __VA_ARGS__)
 /// @overload
-#define CACE_LOG_WARNING(...) cace_log(LOG_WARNING, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define CACE_LOG_WARNING(...) CACE_LOG_SEV(LOG_WARNING, __VA_ARGS__)
 /// @overload
-#define CACE_LOG_INFO(...) cace_log(LOG_INFO, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define CACE_LOG_INFO(...) CACE_LOG_SEV(LOG_INFO, __VA_ARGS__)
 /// @overload
-#define CACE_LOG_DEBUG(...) cace_log(LOG_DEBUG, __FILE__, __LINE__, __func__, __VA_ARGS__)
+#define CACE_LOG_DEBUG(...) CACE_LOG_SEV(LOG_DEBUG, __VA_ARGS__)
 
 #ifdef __cplusplus
 } // extern C
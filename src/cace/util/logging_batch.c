@@ -0,0 +1,651 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_cace_util
+ * Logging backend which avoids any per-event allocation or locking.
+ *
+ * Each source thread owns a ring of fixed-size records, which is allocated
+ * once upon the first event from that thread.
+ * Only the message itself is formatted on the source thread, and all other
+ * formatting is deferred to the single sink thread.
+ * Each record is stamped with a process-wide sequence number, and the sink
+ * thread merges all rings by that number so that output keeps the order
+ * in which events were logged.
+ * The sink thread drains all rings in batches, caches the formatted time
+ * to the second, and writes each batch to stderr with a single writev().
+ *
+ * Rings are freed only after their source thread has exited, so closing
+ * the log never invalidates a ring which a running thread may still use.
+ * Events logged while the log is closed are written directly.
+ */
+#include "defs.h"
+#include "logging.h"
+
+#include "cace/config.h"
+
+#include <m-atomic.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+/// Number of records in each thread ring, which must be a power of two
+#define CACE_LOG_RING_SIZE 128
+/// Largest message size including the trailing null
+#define CACE_LOG_MESSAGE_MAX 1000
+/// Largest number of records written at once
+#define CACE_LOG_BATCH_MAX 64
+/// Largest formatted line prefix size
+#define CACE_LOG_PREFIX_MAX 256
+
+/// Marker for a truncated message
+static const char trunc_mark[] = "...";
+/// Line terminator after each message
+static char newline[] = "\n";
+
+/// A single event for the log
+typedef struct
+{
+    /// Process-wide event sequence number
+    uint64_t seq;
+    /// Source event timestamp
+    struct timespec timestamp;
+    /// Event severity enumeration
+    int severity;
+    /// Originating file name, with static storage duration
+    const char *filename;
+    /// Originating line number
+    int lineno;
+    /// Originating function name, with static storage duration
+    const char *funcname;
+    /// Length of the #message text
+    size_t message_len;
+    /// Formatted message text
+    char message[CACE_LOG_MESSAGE_MAX];
+} cace_log_record_t;
+
+/// Records from a single source thread
+typedef struct cace_log_ring_s
+{
+    /// Next ring in the registry, protected by ::ring_mutex
+    struct cace_log_ring_s *next;
+    /// Formatted source thread ID
+    char thread_text[2 * sizeof(pthread_t) + 1];
+    /// Index of the next record to write, only changed by the source thread
+    atomic_size_t head;
+    /// Index of the next record to read, only changed by the sink thread
+    atomic_size_t tail;
+    /// Set when the source thread has exited
+    atomic_bool orphan;
+    /// Next record to merge, used only by the sink
+    size_t sink_pos;
+    /// End of records to merge, used only by the sink
+    size_t sink_end;
+    /// Record storage
+    cace_log_record_t records[CACE_LOG_RING_SIZE];
+} cace_log_ring_t;
+
+/// Cached time formatting state
+typedef struct
+{
+    /// The cached time to the second
+    time_t sec;
+    /// The formatted date and time of #sec
+    char text[24];
+    /// Length of #text
+    size_t text_len;
+} cace_log_time_cache_t;
+
+/// Thread-specific ring for each source thread, which is never deleted
+static pthread_key_t ring_key;
+/// Create ::ring_key once per process
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+/// True if ::ring_key was created
+static atomic_bool ring_key_valid = ATOMIC_VAR_INIT(false);
+/// Next event sequence number
+static atomic_uint_fast64_t next_seq = ATOMIC_VAR_INIT(0);
+/// Mutex for ::ring_list
+static pthread_mutex_t ring_mutex = PTHREAD_MUTEX_INITIALIZER;
+/// All registered rings
+static cace_log_ring_t *ring_list = NULL;
+
+/// Sink thread ID
+static pthread_t thr_sink;
+/// True if ::thr_sink is valid
+static atomic_bool thr_valid = ATOMIC_VAR_INIT(false);
+/// Set to cause the sink to exit once all rings are empty
+static atomic_bool sink_stop = ATOMIC_VAR_INIT(false);
+/// Set while the sink is waiting on ::sink_sem
+static atomic_bool sink_idle = ATOMIC_VAR_INIT(false);
+/// Wake the sink when it is idle
+static sem_t sink_sem;
+/// Log internal error once
+static atomic_bool did_crit = ATOMIC_VAR_INIT(false);
+/// Line prefix storage used only by the sink thread
+static char sink_prefixes[CACE_LOG_BATCH_MAX][CACE_LOG_PREFIX_MAX];
+
+static void format_thread(char *out, pthread_t thread)
+{
+    static const char hexdigits[] = "0123456789ABCDEF";
+
+    const uint8_t *data = (const void *)&thread;
+    for (size_t ix = 0; ix < sizeof(pthread_t); ++ix)
+    {
+        *out++ = hexdigits[data[ix] >> 4];
+        *out++ = hexdigits[data[ix] & 0xF];
+    }
+    *out = '\0';
+}
+
+/** Format the line prefix for a single record.
+ *
+ * @return The length of the prefix.
+ */
+static size_t format_prefix(char *out, cace_log_time_cache_t *cache, const cace_log_record_t *rec,
+                            const char *thread_text)
+{
+    if ((cache->text_len == 0) || (rec->timestamp.tv_sec != cache->sec))
+    {
+        struct tm nowtm;
+        gmtime_r(&(rec->timestamp.tv_sec), &nowtm);
+        cache->sec      = rec->timestamp.tv_sec;
+        cache->text_len = strftime(cache->text, sizeof(cache->text), "%Y-%m-%dT%H:%M:%S", &nowtm);
+    }
+
+    char *curs = out;
+    memcpy(curs, cache->text, cache->text_len);
+    curs += cache->text_len;
+
+    // fixed six digits of microseconds
+    *curs++   = '.';
+    long usec = rec->timestamp.tv_nsec / 1000;
+    for (int ix = 5; ix >= 0; --ix)
+    {
+        curs[ix] = (char)('0' + (usec % 10));
+        usec /= 10;
+    }
+    curs += 6;
+    *curs++ = 'Z';
+
+    const size_t remain   = CACE_LOG_PREFIX_MAX - (size_t)(curs - out);
+    const char  *sev_name = cace_log_severity_name(rec->severity);
+    int          len;
+    if (rec->filename)
+    {
+        const char *basename = strrchr(rec->filename, '/');
+        basename             = basename ? basename + 1 : rec->filename;
+
+        len = snprintf(curs, remain, " T:%s <%s> [%s:%d:%s] ", thread_text, sev_name, basename, rec->lineno,
+                       rec->funcname ? rec->funcname : "");
+    }
+    else
+    {
+        len = snprintf(curs, remain, " T:%s <%s> [] ", thread_text, sev_name);
+    }
+    if (len < 0)
+    {
+        len = 0;
+    }
+    else if ((size_t)len >= remain)
+    {
+        len = (int)(remain - 1);
+    }
+    return (size_t)(curs - out) + (size_t)len;
+}
+
+/** Write all of a vector to stderr, retrying after any partial write.
+ */
+static void write_all(struct iovec *iov, int iovcnt)
+{
+    while (iovcnt > 0)
+    {
+        ssize_t got = writev(STDERR_FILENO, iov, iovcnt);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // nowhere else to report this
+            return;
+        }
+
+        // skip over fully written parts
+        while ((iovcnt > 0) && ((size_t)got >= iov->iov_len))
+        {
+            got -= iov->iov_len;
+            ++iov;
+            --iovcnt;
+        }
+        if (iovcnt > 0)
+        {
+            iov->iov_base = (char *)iov->iov_base + got;
+            iov->iov_len -= got;
+        }
+    }
+}
+
+/** Write a batch of records.
+ *
+ * @param[in,out] prefixes Storage for each formatted line prefix, with
+ * at least @c count items.
+ * @param[in] threads The formatted source thread of each record.
+ */
+static void write_batch(char prefixes[][CACE_LOG_PREFIX_MAX], cace_log_time_cache_t *cache,
+                        const cace_log_record_t **recs, const char **threads, size_t count)
+{
+    struct iovec iov[3 * CACE_LOG_BATCH_MAX];
+
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        const cace_log_record_t *rec = recs[ix];
+
+        iov[3 * ix].iov_base     = prefixes[ix];
+        iov[3 * ix].iov_len      = format_prefix(prefixes[ix], cache, rec, threads[ix]);
+        iov[3 * ix + 1].iov_base = (void *)rec->message;
+        iov[3 * ix + 1].iov_len  = rec->message_len;
+        iov[3 * ix + 2].iov_base = newline;
+        iov[3 * ix + 2].iov_len  = 1;
+    }
+    write_all(iov, (int)(3 * count));
+}
+
+/** Unsynchronized write of a single record directly from the source thread.
+ */
+static void write_direct(const cace_log_record_t *rec)
+{
+    // serialize with other direct writes
+    static pthread_mutex_t direct_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    char thread_text[2 * sizeof(pthread_t) + 1];
+    format_thread(thread_text, pthread_self());
+    const char *thread_ptr = thread_text;
+
+    char                  prefix[1][CACE_LOG_PREFIX_MAX];
+    cace_log_time_cache_t cache = { 0 };
+
+    pthread_mutex_lock(&direct_mutex);
+    write_batch(prefix, &cache, &rec, &thread_ptr, 1);
+    pthread_mutex_unlock(&direct_mutex);
+}
+
+/** Find the ring whose next record to merge has the least sequence number.
+ * @pre The ::ring_mutex is held.
+ *
+ * @return The ring, or NULL if there are no more records to merge.
+ */
+static cace_log_ring_t *merge_next(void)
+{
+    cace_log_ring_t *found = NULL;
+    uint64_t         least = 0;
+    for (cace_log_ring_t *ring = ring_list; ring; ring = ring->next)
+    {
+        if (ring->sink_pos == ring->sink_end)
+        {
+            continue;
+        }
+        const uint64_t seq = ring->records[ring->sink_pos & (CACE_LOG_RING_SIZE - 1)].seq;
+        if (!found || (seq < least))
+        {
+            found = ring;
+            least = seq;
+        }
+    }
+    return found;
+}
+
+/** Drain all rings, merged in sequence order, and free any orphaned rings
+ * which are then empty.
+ * @pre Only one thread drains at a time.
+ *
+ * @param[in,out] prefixes Storage for each formatted line prefix.
+ * @return The number of records written.
+ */
+static size_t drain_all(char prefixes[][CACE_LOG_PREFIX_MAX], cace_log_time_cache_t *cache)
+{
+    size_t total = 0;
+
+    pthread_mutex_lock(&ring_mutex);
+    // snapshot each ring, so no record is pushed to an orphan after this
+    bool any = false;
+    for (cace_log_ring_t *ring = ring_list; ring; ring = ring->next)
+    {
+        ring->sink_pos = atomic_load_explicit(&(ring->tail), memory_order_relaxed);
+        ring->sink_end = atomic_load_explicit(&(ring->head), memory_order_acquire);
+        any            = any || (ring->sink_pos != ring->sink_end);
+    }
+
+    const cace_log_record_t *recs[CACE_LOG_BATCH_MAX];
+    const char              *threads[CACE_LOG_BATCH_MAX];
+    while (any)
+    {
+        size_t count = 0;
+        while (count < CACE_LOG_BATCH_MAX)
+        {
+            cace_log_ring_t *ring = merge_next();
+            if (!ring)
+            {
+                any = false;
+                break;
+            }
+            recs[count]    = &(ring->records[ring->sink_pos & (CACE_LOG_RING_SIZE - 1)]);
+            threads[count] = ring->thread_text;
+            ++count;
+            ring->sink_pos++;
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        write_batch(prefixes, cache, recs, threads, count);
+        total += count;
+
+        // release records back to each source thread
+        for (cace_log_ring_t *ring = ring_list; ring; ring = ring->next)
+        {
+            atomic_store_explicit(&(ring->tail), ring->sink_pos, memory_order_release);
+        }
+    }
+
+    cace_log_ring_t **link = &ring_list;
+    while (*link)
+    {
+        cace_log_ring_t *ring = *link;
+        // the orphan flag is set after the last record is pushed
+        if (atomic_load(&(ring->orphan))
+            && (atomic_load(&(ring->head)) == atomic_load_explicit(&(ring->tail), memory_order_relaxed)))
+        {
+            *link = ring->next;
+            CACE_FREE(ring);
+        }
+        else
+        {
+            link = &(ring->next);
+        }
+    }
+    pthread_mutex_unlock(&ring_mutex);
+
+    return total;
+}
+
+/// Determine if any ring has unread records
+static bool any_pending(void)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&ring_mutex);
+    for (cace_log_ring_t *ring = ring_list; !found && ring; ring = ring->next)
+    {
+        found = (atomic_load(&(ring->head)) != atomic_load(&(ring->tail)));
+    }
+    pthread_mutex_unlock(&ring_mutex);
+
+    return found;
+}
+
+static void wake_sink(void)
+{
+    if (atomic_exchange(&sink_idle, false))
+    {
+        sem_post(&sink_sem);
+    }
+}
+
+static void *work_sink(void *arg _U_)
+{
+    // only used by this thread
+    cace_log_time_cache_t cache = { 0 };
+
+    while (true)
+    {
+        if (drain_all(sink_prefixes, &cache))
+        {
+            continue;
+        }
+        if (atomic_load(&sink_stop))
+        {
+            break;
+        }
+
+        // publish idle state before the final check
+        atomic_store(&sink_idle, true);
+        if (!any_pending() && !atomic_load(&sink_stop))
+        {
+            sem_wait(&sink_sem);
+        }
+        atomic_store(&sink_idle, false);
+    }
+    return NULL;
+}
+
+/// Thread-specific destructor for ::ring_key
+static void ring_release(void *ptr)
+{
+    cace_log_ring_t *ring = ptr;
+    atomic_store(&(ring->orphan), true);
+    wake_sink();
+}
+
+/// Create the ring key for the process
+static void ring_key_init(void)
+{
+    if (!pthread_key_create(&ring_key, ring_release))
+    {
+        atomic_store(&ring_key_valid, true);
+    }
+}
+
+/** Get the ring for the current thread, creating it if necessary.
+ *
+ * @return The ring or NULL if it could not be allocated.
+ */
+static cace_log_ring_t *get_ring(void)
+{
+    cace_log_ring_t *ring = pthread_getspecific(ring_key);
+    if (LIKELY(ring))
+    {
+        return ring;
+    }
+
+    ring = CACE_MALLOC(sizeof(cace_log_ring_t));
+    if (!ring)
+    {
+        return NULL;
+    }
+    format_thread(ring->thread_text, pthread_self());
+    atomic_init(&(ring->head), 0);
+    atomic_init(&(ring->tail), 0);
+    atomic_init(&(ring->orphan), false);
+    ring->sink_pos = 0;
+    ring->sink_end = 0;
+
+    pthread_mutex_lock(&ring_mutex);
+    ring->next = ring_list;
+    ring_list  = ring;
+    pthread_mutex_unlock(&ring_mutex);
+
+    pthread_setspecific(ring_key, ring);
+    return ring;
+}
+
+/** Write an internal failure message directly.
+ */
+static void write_crit(const char *message)
+{
+    cace_log_record_t manual = {
+        .severity = LOG_CRIT,
+    };
+    (void)clock_gettime(CLOCK_REALTIME, &manual.timestamp);
+    manual.message_len = strlen(message);
+    memcpy(manual.message, message, manual.message_len);
+    write_direct(&manual);
+}
+
+void cace_openlog(void)
+{
+    pthread_once(&ring_key_once, ring_key_init);
+    if (!atomic_load(&ring_key_valid))
+    {
+        write_crit("cace_openlog() failed");
+        return;
+    }
+    sem_init(&sink_sem, 0, 0);
+    atomic_store(&sink_stop, false);
+    atomic_store(&sink_idle, false);
+
+    if (pthread_create(&thr_sink, NULL, work_sink, NULL))
+    {
+        write_crit("cace_openlog() failed");
+        sem_destroy(&sink_sem);
+    }
+    else
+    {
+        atomic_store(&thr_valid, true);
+    }
+}
+
+void cace_closelog(void)
+{
+    if (!atomic_exchange(&thr_valid, false))
+    {
+        return;
+    }
+    // new events are now written directly
+
+    atomic_store(&sink_stop, true);
+    sem_post(&sink_sem);
+
+    int res = pthread_join(thr_sink, NULL);
+    if (res)
+    {
+        write_crit("cace_closelog() failed");
+        return;
+    }
+
+    // flush any records pushed while the sink was stopping, the rings of
+    // running threads are kept for their own later use
+    cace_log_time_cache_t cache = { 0 };
+    drain_all(sink_prefixes, &cache);
+    sem_destroy(&sink_sem);
+}
+
+/** Format the message portion of a record.
+ *
+ * @return True if the message is non-empty.
+ */
+static bool format_message(cace_log_record_t *rec, const char *format, va_list val)
+{
+    int len = vsnprintf(rec->message, sizeof(rec->message), format, val);
+    if (len <= 0)
+    {
+        return false;
+    }
+    if ((size_t)len >= sizeof(rec->message))
+    {
+        // mark the truncation in place of the final characters
+        len = (int)sizeof(rec->message) - 1;
+        memcpy(rec->message + len - (sizeof(trunc_mark) - 1), trunc_mark, sizeof(trunc_mark) - 1);
+    }
+    rec->message_len = (size_t)len;
+    return true;
+}
+
+void cace_log(int severity, const char *filename, int lineno, const char *funcname, const char *format, ...)
+{
+    if (!cace_log_is_enabled_for(severity))
+    {
+        return;
+    }
+
+    cace_log_ring_t *ring = atomic_load(&thr_valid) ? get_ring() : NULL;
+    size_t           head = 0;
+    if (ring)
+    {
+        head = atomic_load_explicit(&(ring->head), memory_order_relaxed);
+        // wait for the sink to make room, rather than dropping the event
+        while ((head - atomic_load_explicit(&(ring->tail), memory_order_acquire)) >= CACE_LOG_RING_SIZE)
+        {
+            if (!atomic_load(&thr_valid))
+            {
+                // no sink to make room
+                ring = NULL;
+                break;
+            }
+            wake_sink();
+            sched_yield();
+        }
+    }
+
+    if (!ring)
+    {
+        if (!atomic_load(&did_crit))
+        {
+            write_crit("cace_log() called while the log is not open");
+            atomic_store(&did_crit, true);
+        }
+
+        cace_log_record_t manual = {
+            .severity = severity,
+            .filename = filename,
+            .lineno   = lineno,
+            .funcname = funcname,
+        };
+        (void)clock_gettime(CLOCK_REALTIME, &manual.timestamp);
+
+        va_list val;
+        va_start(val, format);
+        const bool valid = format_message(&manual, format, val);
+        va_end(val);
+        if (valid)
+        {
+            write_direct(&manual);
+        }
+        return;
+    }
+
+    cace_log_record_t *rec = &(ring->records[head & (CACE_LOG_RING_SIZE - 1)]);
+    rec->seq               = atomic_fetch_add_explicit(&next_seq, 1, memory_order_relaxed);
+    (void)clock_gettime(CLOCK_REALTIME, &(rec->timestamp));
+    rec->severity = severity;
+    rec->filename = filename;
+    rec->lineno   = lineno;
+    rec->funcname = funcname;
+
+    va_list val;
+    va_start(val, format);
+    const bool valid = format_message(rec, format, val);
+    va_end(val);
+    // ignore empty messages
+    if (!valid)
+    {
+        return;
+    }
+
+    // sequentially consistent to order with the sink idle state
+    atomic_store(&(ring->head), head + 1);
+    wake_sink();
+}
@@ -15,6 +15,11 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+/** @file
+ * @ingroup group_cace_util
+ * Logging backend which formats each event on its source thread and queues
+ * it to a single thread for writing to stderr.
+ */
 #include "defs.h"
 #include "logging.h"
 
@@ -28,26 +33,12 @@
 #include <pthread.h>
 #include <stdarg.h>
 #include <stdio.h>
-#include <strings.h>
 #include <sys/time.h>
 #include <time.h>
 
 /// Number of events to buffer to I/O thread
 #define CACE_LOG_QUEUE_SIZE 100
 
-// NOLINTBEGIN
-static const char *sev_names[] = {
-    NULL,      // LOG_EMERG
-    NULL,      // LOG_ALERT
-    "CRIT",    // LOG_CRIT
-    "ERROR",   // LOG_ERR
-    "WARNING", // LOG_WARNING
-    NULL,      // LOG_NOTICE
-    "INFO",    // LOG_INFO
-    "DEBUG",   // LOG_DEBUG
-};
-// NOLINTEND
-
 /// A single event for the log
 typedef struct
 {
@@ -90,9 +81,6 @@ M_BUFFER_DEF(cace_log_queue, cace_log_event_ptr_t *, CACE_LOG_QUEUE_SIZE, M_BUFF
 // GCOV_EXCL_STOP
 /// @endcond
 
-/// Shared least severity
-static atomic_int least_severity = LOG_DEBUG;
-
 /// Shared safe queue
 static cace_log_queue_t event_queue;
 /// Sink thread ID
@@ -106,7 +94,7 @@ static void write_log(const cace_log_event_t *event)
 {
     CHKVOID(event);
     // already domain validated
-    const char *severity_name = sev_names[event->severity];
+    const char *severity_name = cace_log_severity_name(event->severity);
 
     char tmbuf[32]; // NOLINT
     {
@@ -206,49 +194,6 @@ void cace_closelog(void)
     cace_log_queue_clear(event_queue);
 }
 
-int cace_log_get_severity(int *severity, const char *name)
-{
-    CHKERR1(severity)
-    CHKERR1(name)
-
-    for (size_t ix = 0; ix < sizeof(sev_names) / sizeof(const char *); ++ix)
-    {
-        if (!sev_names[ix])
-        {
-            continue;
-        }
-        if (strcasecmp(sev_names[ix], name) == 0)
-        {
-            *severity = (int)ix;
-            return 0;
-        }
-    }
-    return 2;
-}
-
-void cace_log_set_least_severity(int severity)
-{
-    if ((severity < 0) || (severity > LOG_DEBUG))
-    {
-        return;
-    }
-
-    atomic_store(&least_severity, severity);
-}
-
-bool cace_log_is_enabled_for(int severity)
-{
-    if ((severity < 0) || (severity > LOG_DEBUG))
-    {
-        return false;
-    }
-
-    const int limit = atomic_load(&least_severity);
-    // lower severity has higher define value
-    const bool enabled = (limit >= severity);
-    return enabled;
-}
-
 void cace_log(int severity, const char *filename, int lineno, const char *funcname, const char *format, ...)
 {
     if (!cace_log_is_enabled_for(severity))
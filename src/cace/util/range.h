@@ -227,6 +227,12 @@ extern "C" {
 /** @struct cace_util_range_size_t
  * A range of size_t values.
  */
+/** @struct cace_util_range_intvl_uint64_t
+ * An interval of uint64_t values.
+ */
+/** @struct cace_util_range_uint64_t
+ * A range of uint64_t values.
+ */
 /** @struct cace_util_range_intvl_int64_t
  * An interval of int64_t values.
  */
@@ -235,6 +241,7 @@ extern "C" {
  */
 /// @cond Doxygen_Suppress
 CACE_UTIL_RANGE_DEF(cace_util_range_size, cace_util_range_intvl_size, size_t)
+CACE_UTIL_RANGE_DEF(cace_util_range_uint64, cace_util_range_intvl_uint64, uint64_t)
 CACE_UTIL_RANGE_DEF(cace_util_range_int64, cace_util_range_intvl_int64, int64_t)
 #define M_OPL_cace_util_range_int64_t() CACE_UTIL_RANGE_OPLIST(cace_util_range_int64, int64_t)
 /// @endcond
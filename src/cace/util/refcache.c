@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "refcache.h"
+#include "defs.h"
+
+/// Drop one reference while holding the mutex, returning the entry to free if it was the last
+static cace_util_refcache_entry_t *cace_util_refcache_unref(cace_util_refcache_entry_t *entry)
+{
+    if (--(entry->refcnt) > 0)
+    {
+        return NULL;
+    }
+    return entry;
+}
+
+/// Evict the least recently used object other than @c keep while holding the mutex
+static cace_util_refcache_entry_t *cace_util_refcache_evict(cace_util_refcache_t *obj,
+                                                            const cace_util_refcache_entry_t *keep)
+{
+    const cace_util_refcache_dict_itref_t *oldest = NULL;
+
+    cace_util_refcache_dict_it_t it;
+    for (cace_util_refcache_dict_it(it, obj->dict); !cace_util_refcache_dict_end_p(it);
+         cace_util_refcache_dict_next(it))
+    {
+        const cace_util_refcache_dict_itref_t *pair = cace_util_refcache_dict_cref(it);
+        if (pair->value == keep)
+        {
+            continue;
+        }
+        if (!oldest || (pair->value->last_use < oldest->value->last_use))
+        {
+            oldest = pair;
+        }
+    }
+    if (!oldest)
+    {
+        return NULL;
+    }
+
+    cace_util_refcache_entry_t *entry = oldest->value;
+    cace_data_t                 key;
+    cace_data_init_set(&key, &(oldest->key));
+    cace_util_refcache_dict_erase(obj->dict, key);
+    cace_data_deinit(&key);
+
+    return cace_util_refcache_unref(entry);
+}
+
+void cace_util_refcache_init(cace_util_refcache_t *obj, size_t max_size, cace_util_refcache_free_f free_entry)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    cace_util_refcache_dict_init(obj->dict);
+    obj->clock      = 0;
+    obj->max_size   = max_size;
+    obj->free_entry = free_entry;
+}
+
+void cace_util_refcache_deinit(cace_util_refcache_t *obj)
+{
+    CHKVOID(obj);
+    cace_util_refcache_clear(obj);
+    cace_util_refcache_dict_clear(obj->dict);
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+cace_util_refcache_entry_t *cace_util_refcache_get(cace_util_refcache_t *obj, const cace_data_t *key)
+{
+    CHKNULL(obj);
+    CHKNULL(key);
+
+    pthread_mutex_lock(&(obj->mutex));
+    cace_util_refcache_entry_t  *entry = NULL;
+    cace_util_refcache_entry_t **found = cace_util_refcache_dict_get(obj->dict, *key);
+    if (found)
+    {
+        entry = *found;
+        ++(entry->refcnt);
+        entry->last_use = ++(obj->clock);
+    }
+    pthread_mutex_unlock(&(obj->mutex));
+
+    return entry;
+}
+
+cace_util_refcache_entry_t *cace_util_refcache_put(cace_util_refcache_t *obj, const cace_data_t *key,
+                                                   cace_util_refcache_entry_t *entry)
+{
+    CHKNULL(obj);
+    CHKNULL(key);
+    CHKNULL(entry);
+
+    cace_util_refcache_entry_t *evicted = NULL;
+
+    pthread_mutex_lock(&(obj->mutex));
+    // another thread may have added the same object
+    cace_util_refcache_entry_t **found = cace_util_refcache_dict_get(obj->dict, *key);
+    if (found)
+    {
+        evicted = entry;
+        entry   = *found;
+        ++(entry->refcnt);
+    }
+    else
+    {
+        // one reference for the cache and one for the caller
+        entry->refcnt = 2;
+        cace_util_refcache_dict_set_at(obj->dict, *key, entry);
+        if (cace_util_refcache_dict_size(obj->dict) > obj->max_size)
+        {
+            evicted = cace_util_refcache_evict(obj, entry);
+        }
+    }
+    entry->last_use = ++(obj->clock);
+    pthread_mutex_unlock(&(obj->mutex));
+
+    // free without holding the lock
+    if (evicted)
+    {
+        (obj->free_entry)(evicted);
+    }
+    return entry;
+}
+
+void cace_util_refcache_release(cace_util_refcache_t *obj, cace_util_refcache_entry_t *entry)
+{
+    CHKVOID(obj);
+    if (!entry)
+    {
+        return;
+    }
+    pthread_mutex_lock(&(obj->mutex));
+    cace_util_refcache_entry_t *last = cace_util_refcache_unref(entry);
+    pthread_mutex_unlock(&(obj->mutex));
+
+    if (last)
+    {
+        (obj->free_entry)(last);
+    }
+}
+
+void cace_util_refcache_clear(cace_util_refcache_t *obj)
+{
+    CHKVOID(obj);
+
+    pthread_mutex_lock(&(obj->mutex));
+    cace_util_refcache_dict_it_t it;
+    for (cace_util_refcache_dict_it(it, obj->dict); !cace_util_refcache_dict_end_p(it);
+         cace_util_refcache_dict_next(it))
+    {
+        // still referenced by the cache, so the object remains valid
+        cace_util_refcache_entry_t *last = cace_util_refcache_unref(cace_util_refcache_dict_cref(it)->value);
+        if (last)
+        {
+            (obj->free_entry)(last);
+        }
+    }
+    cace_util_refcache_dict_reset(obj->dict);
+    pthread_mutex_unlock(&(obj->mutex));
+}
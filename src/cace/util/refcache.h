@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_cace_util
+ * A thread-safe cache of bounded size holding reference counted objects
+ * keyed by their binary source form.
+ * When the cache is full the least recently used object is removed, and
+ * objects removed from the cache remain valid until all users release them.
+ */
+#ifndef CACE_UTIL_REFCACHE_H_
+#define CACE_UTIL_REFCACHE_H_
+
+#include "cace/cace_data.h"
+
+#include <m-dict.h>
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** State for a single cached object, which must be the first member of the
+ * object's own structure.
+ */
+typedef struct cace_util_refcache_entry_s
+{
+    /// Number of references, including one held by the cache
+    size_t refcnt;
+    /// Value of cace_util_refcache_t::clock at last use, for eviction
+    uint64_t last_use;
+} cace_util_refcache_entry_t;
+
+/** Callback to free an object after its last reference is released.
+ *
+ * @param[in] entry The state embedded in the object to free.
+ */
+typedef void (*cace_util_refcache_free_f)(cace_util_refcache_entry_t *entry);
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(cace_util_refcache_dict, cace_data_t, M_OPL_cace_data_t(), cace_util_refcache_entry_t *, M_PTR_OPLIST)
+/// @endcond
+
+/** A cache of bounded size.
+ */
+typedef struct
+{
+    /// Guard for all cache state and reference counts
+    pthread_mutex_t mutex;
+    /// Objects in the cache, keyed by their source form
+    cace_util_refcache_dict_t dict;
+    /// Counter incremented on each cache use
+    uint64_t clock;
+    /// Maximum number of objects held by the cache
+    size_t max_size;
+    /// Function to free each object
+    cace_util_refcache_free_f free_entry;
+} cace_util_refcache_t;
+
+/** Initialize an empty cache.
+ *
+ * @param[out] obj The cache to initialize.
+ * @param max_size The maximum number of objects to hold.
+ * @param free_entry The function to free objects with.
+ */
+void cace_util_refcache_init(cace_util_refcache_t *obj, size_t max_size, cace_util_refcache_free_f free_entry);
+
+/** Remove all objects and release cache resources.
+ *
+ * @param[in,out] obj The cache to deinitialize.
+ */
+void cace_util_refcache_deinit(cace_util_refcache_t *obj);
+
+/** Get a new reference to a cached object.
+ *
+ * @param[in,out] obj The cache to search.
+ * @param[in] key The source form of the object.
+ * @return The cached object, which must be released with
+ * cace_util_refcache_release(), or NULL if not present.
+ */
+cace_util_refcache_entry_t *cace_util_refcache_get(cace_util_refcache_t *obj, const cace_data_t *key);
+
+/** Add a newly created object to the cache.
+ * If another thread added an object with the same key since
+ * cace_util_refcache_get() was called, the new object is freed and the
+ * existing one is used instead.
+ *
+ * @param[in,out] obj The cache to add to.
+ * @param[in] key The source form of the object, which is copied.
+ * @param[in] entry The state embedded in the new object, which is taken
+ * by this function.
+ * @return A new reference to the cached object, which must be released
+ * with cace_util_refcache_release().
+ */
+cace_util_refcache_entry_t *cace_util_refcache_put(cace_util_refcache_t *obj, const cace_data_t *key,
+                                                   cace_util_refcache_entry_t *entry);
+
+/** Release a reference from cace_util_refcache_get() or
+ * cace_util_refcache_put().
+ *
+ * @param[in,out] obj The cache which the object came from.
+ * @param[in] entry The state embedded in the object, which may be NULL.
+ */
+void cace_util_refcache_release(cace_util_refcache_t *obj, cace_util_refcache_entry_t *entry);
+
+/** Remove all objects from the cache.
+ * Objects still referenced by a user remain valid until they are released.
+ *
+ * @param[in,out] obj The cache to clear.
+ */
+void cace_util_refcache_clear(cace_util_refcache_t *obj);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* CACE_UTIL_REFCACHE_H_ */
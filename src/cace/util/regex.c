@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "regex.h"
+#include "defs.h"
+#include "logging.h"
+#include "refcache.h"
+#include <pcre2.h>
+#include <pthread.h>
+
+/// Size of the initial thread-specific JIT stack
+#define CACE_UTIL_REGEX_JIT_STACK_START (32 * 1024)
+/// Maximum size of the thread-specific JIT stack
+#define CACE_UTIL_REGEX_JIT_STACK_MAX (512 * 1024)
+
+struct cace_util_regex_s
+{
+    /// Cache state, which must be first
+    cace_util_refcache_entry_t entry;
+    /// The compiled pattern
+    pcre2_code *code;
+};
+
+/// Initialize ::cache once
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+/// Patterns in the cache, keyed by pattern text
+static cace_util_refcache_t cache;
+
+/// Thread-specific state for matching
+typedef struct
+{
+    /// Match data with a single offset pair, enough to test for any match
+    pcre2_match_data *md;
+    /// Context referencing #jstack
+    pcre2_match_context *mctx;
+    /// Stack for JIT-compiled patterns, which may be NULL
+    pcre2_jit_stack *jstack;
+} cace_util_regex_tls_t;
+
+/// Initialize ::tls_key once
+static pthread_once_t tls_once = PTHREAD_ONCE_INIT;
+/// Thread-specific ::cace_util_regex_tls_t
+static pthread_key_t tls_key;
+/// True if ::tls_key is valid
+static bool tls_valid = false;
+
+static void cace_util_regex_free(cace_util_refcache_entry_t *entry)
+{
+    cace_util_regex_t *obj = (cace_util_regex_t *)entry;
+    pcre2_code_free(obj->code);
+    CACE_FREE(obj);
+}
+
+static void cace_util_regex_cache_init(void)
+{
+    cace_util_refcache_init(&cache, CACE_UTIL_REGEX_CACHE_SIZE, cace_util_regex_free);
+}
+
+static void cace_util_regex_tls_release(void *arg)
+{
+    cace_util_regex_tls_t *tls = arg;
+    pcre2_match_data_free(tls->md);
+    pcre2_match_context_free(tls->mctx);
+    pcre2_jit_stack_free(tls->jstack);
+    CACE_FREE(tls);
+}
+
+static void cace_util_regex_tls_key_init(void)
+{
+    tls_valid = (pthread_key_create(&tls_key, cace_util_regex_tls_release) == 0);
+}
+
+static cace_util_regex_tls_t *cace_util_regex_tls(void)
+{
+    pthread_once(&tls_once, cace_util_regex_tls_key_init);
+    if (!tls_valid)
+    {
+        return NULL;
+    }
+
+    cace_util_regex_tls_t *tls = pthread_getspecific(tls_key);
+    if (tls)
+    {
+        return tls;
+    }
+
+    tls = CACE_MALLOC(sizeof(cace_util_regex_tls_t));
+    if (!tls)
+    {
+        return NULL;
+    }
+    tls->md     = pcre2_match_data_create(1, NULL);
+    tls->mctx   = pcre2_match_context_create(NULL);
+    tls->jstack = pcre2_jit_stack_create(CACE_UTIL_REGEX_JIT_STACK_START, CACE_UTIL_REGEX_JIT_STACK_MAX, NULL);
+    if (!tls->md || !tls->mctx)
+    {
+        cace_util_regex_tls_release(tls);
+        return NULL;
+    }
+    if (tls->jstack)
+    {
+        pcre2_jit_stack_assign(tls->mctx, NULL, tls->jstack);
+    }
+
+    if (pthread_setspecific(tls_key, tls))
+    {
+        cace_util_regex_tls_release(tls);
+        return NULL;
+    }
+    return tls;
+}
+
+static pcre2_code *cace_util_regex_compile(const char *pat, size_t patlen)
+{
+    const int   opts        = PCRE2_ANCHORED | PCRE2_ENDANCHORED;
+    int         errorcode   = 0;
+    PCRE2_SIZE  erroroffset = 0;
+    pcre2_code *code        = pcre2_compile((PCRE2_SPTR8)pat, patlen, opts, &errorcode, &erroroffset, NULL);
+    if (!code)
+    {
+        CACE_LOG_ERR("Failed to compile regex pattern (error %d at %zu): %.*s", errorcode, erroroffset, (int)patlen,
+                     pat);
+        return NULL;
+    }
+
+    // the interpreter is still used if JIT is not available
+    int res = pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+    if (res)
+    {
+        CACE_LOG_DEBUG("Regex pattern not JIT compiled (error %d): %.*s", res, (int)patlen, pat);
+    }
+    return code;
+}
+
+cace_util_regex_t *cace_util_regex_acquire(const char *pat, size_t patlen)
+{
+    CHKNULL(pat);
+    pthread_once(&cache_once, cace_util_regex_cache_init);
+
+    cace_data_t key;
+    cace_data_init_view(&key, patlen, (cace_data_ptr_t)pat);
+
+    cace_util_regex_t *obj = (cace_util_regex_t *)cace_util_refcache_get(&cache, &key);
+    if (obj)
+    {
+        cace_data_deinit(&key);
+        return obj;
+    }
+
+    // compile without holding the lock
+    pcre2_code *code = cace_util_regex_compile(pat, patlen);
+    if (code)
+    {
+        obj = CACE_MALLOC(sizeof(cace_util_regex_t));
+        if (obj)
+        {
+            obj->code = code;
+            obj       = (cace_util_regex_t *)cace_util_refcache_put(&cache, &key, &(obj->entry));
+        }
+        else
+        {
+            pcre2_code_free(code);
+        }
+    }
+
+    cace_data_deinit(&key);
+    return obj;
+}
+
+void cace_util_regex_release(cace_util_regex_t *obj)
+{
+    if (!obj)
+    {
+        return;
+    }
+    cace_util_refcache_release(&cache, &(obj->entry));
+}
+
+bool cace_util_regex_match(const cace_util_regex_t *obj, const char *text, size_t len)
+{
+    CHKFALSE(obj);
+    CHKFALSE(text);
+
+    cace_util_regex_tls_t *tls = cace_util_regex_tls();
+    if (!tls)
+    {
+        return false;
+    }
+
+    const int opts = 0;
+    // a zero result indicates a match with more groups than the match data
+    int res = pcre2_match(obj->code, (PCRE2_SPTR8)text, len, 0, opts, tls->md, tls->mctx);
+    if ((res < 0) && (res != PCRE2_ERROR_NOMATCH) && cace_log_is_enabled_for(LOG_DEBUG))
+    {
+        PCRE2_UCHAR8 buf[128];
+        pcre2_get_error_message(res, buf, sizeof(buf));
+        CACE_LOG_DEBUG("Match regex result %d (%s) for: %.*s", res, buf, (int)len, text);
+    }
+    return (res >= 0);
+}
+
+void cace_util_regex_cache_clear(void)
+{
+    pthread_once(&cache_once, cace_util_regex_cache_init);
+    cace_util_refcache_clear(&cache);
+}
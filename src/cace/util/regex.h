@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_cace_util
+ * Shared compiled regular expressions for text pattern matching.
+ * Patterns are compiled once, JIT-compiled where the PCRE2 library
+ * supports it, and kept in a process-wide cache of bounded size.
+ * Match state is kept per-thread so that matching does not allocate.
+ */
+#ifndef CACE_UTIL_REGEX_H_
+#define CACE_UTIL_REGEX_H_
+
+#include "cace/config.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CACE_UTIL_REGEX_CACHE_SIZE
+/** Maximum number of patterns held by the process-wide cache.
+ * Patterns evicted from the cache remain valid until they are released.
+ */
+#define CACE_UTIL_REGEX_CACHE_SIZE 64
+#endif /* CACE_UTIL_REGEX_CACHE_SIZE */
+
+/// An opaque compiled pattern, shared by all users of the same pattern text
+typedef struct cace_util_regex_s cace_util_regex_t;
+
+/** Get a compiled pattern from the cache, compiling it if necessary.
+ * The pattern is anchored at both the start and end of matched text.
+ *
+ * @param[in] pat The pattern text, which need not be null-terminated.
+ * @param patlen The length of the pattern text.
+ * @return A new reference to the compiled pattern, which must be released
+ * with cace_util_regex_release(), or NULL if the pattern is not valid.
+ */
+cace_util_regex_t *cace_util_regex_acquire(const char *pat, size_t patlen);
+
+/** Release a reference from cace_util_regex_acquire().
+ *
+ * @param[in] obj The pattern to release, which may be NULL.
+ */
+void cace_util_regex_release(cace_util_regex_t *obj);
+
+/** Determine if a text fully matches a pattern.
+ * This uses match state specific to the calling thread.
+ *
+ * @param[in] obj The pattern to match with.
+ * @param[in] text The text to match, which need not be null-terminated.
+ * @param len The length of the text to match.
+ * @return True if the text matches.
+ */
+bool cace_util_regex_match(const cace_util_regex_t *obj, const char *text, size_t len);
+
+/** Remove all patterns from the cache.
+ * Patterns still referenced by a user remain valid until they are released.
+ */
+void cace_util_regex_cache_clear(void);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* CACE_UTIL_REGEX_H_ */
@@ -45,7 +45,9 @@ static void daemon_signal_handler(int signum)
 
 static void show_usage(const char *argv0)
 {
-    fprintf(stderr, "Usage: %s {-h} {-l <log-level>} {-s <startup-file>} -a <listen-EID> {-m <hello-EID>}\n", argv0);
+    fprintf(stderr,
+            "Usage: %s {-h} {-l <log-level>} {-s <startup-file>} {-d <delta-mode>} -a <listen-EID> {-m <hello-EID>}\n",
+            argv0);
 }
 
 int main(int argc, char *argv[])
@@ -68,7 +70,7 @@ int main(int argc, char *argv[])
     {
         {
             int opt;
-            while ((opt = getopt(argc, argv, ":hl:s:a:m:")) != -1)
+            while ((opt = getopt(argc, argv, ":hl:s:a:m:d:")) != -1)
             {
                 switch (opt)
                 {
@@ -102,6 +104,20 @@ int main(int argc, char *argv[])
                         m_string_set_cstr(*argstr, optarg);
                         break;
                     }
+                    case 'd':
+                    {
+                        refda_rpt_delta_mode_t mode;
+                        if (refda_rpt_delta_mode_from_text(&mode, optarg))
+                        {
+                            show_usage(argv[0]);
+                            retval = 1;
+                        }
+                        else
+                        {
+                            refda_rpt_delta_set_mode(&agent.rpt_delta, NULL, mode);
+                        }
+                        break;
+                    }
                     case 'h':
                     default:
                         show_usage(argv[0]);
@@ -244,7 +244,7 @@ static int stdin_recv(cace_ari_list_t data, cace_amm_msg_if_metadata_t *meta, ca
 
 static void show_usage(const char *argv0)
 {
-    fprintf(stderr, "Usage: %s {-h} {-l <log-level>} {-s <startup-file>} -a <agent EID>\n", argv0);
+    fprintf(stderr, "Usage: %s {-h} {-l <log-level>} {-s <startup-file>} {-d <delta-mode>} -a <agent EID>\n", argv0);
 }
 
 int main(int argc, char *argv[])
@@ -263,7 +263,7 @@ int main(int argc, char *argv[])
     {
         {
             int opt;
-            while ((opt = getopt(argc, argv, ":hl:s:a:")) != -1)
+            while ((opt = getopt(argc, argv, ":hl:s:a:d:")) != -1)
             {
                 switch (opt)
                 {
@@ -289,6 +289,20 @@ int main(int argc, char *argv[])
                         }
                         m_string_set_cstr(agent.agent_eid, optarg);
                         break;
+                    case 'd':
+                    {
+                        refda_rpt_delta_mode_t mode;
+                        if (refda_rpt_delta_mode_from_text(&mode, optarg))
+                        {
+                            show_usage(argv[0]);
+                            retval = 1;
+                        }
+                        else
+                        {
+                            refda_rpt_delta_set_mode(&agent.rpt_delta, NULL, mode);
+                        }
+                        break;
+                    }
                     case 'h':
                     default:
                         show_usage(argv[0]);
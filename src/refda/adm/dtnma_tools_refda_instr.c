@@ -0,0 +1,810 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*  START GENERATED SOURCE HERE */
+/** @file
+ * This is the compilation unit for the implementation of the
+ * ADM module "dtnma-tools-refda-instr" for the C-language reference DA.
+ * This contains definitions of every AMM object instance in the ADM and
+ * file-local callback functions for all EDDs, CTRLs, and OPERs.
+ */
+
+#include "dtnma_tools_refda_instr.h"
+
+#include "refda/agent.h"
+#include "refda/ctrl_exec_ctx.h"
+#include "refda/edd_prod_ctx.h"
+#include "refda/oper_eval_ctx.h"
+#include "refda/register.h"
+
+#include "cace/amm/semtype.h"
+#include "cace/ari/text.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+#include "cace/util/mutex.h"
+
+/*   START CUSTOM INCLUDES HERE */
+#include "refda/trace.h"
+#include "cace/ari/rpt_delta.h"
+/*   STOP CUSTOM INCLUDES HERE  */
+
+/*   START CUSTOM FUNCTIONS HERE */
+_Static_assert((CACE_ARI_RPT_DELTA_MARKER_ORG_ENUM == REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ORG_ENUM)
+                   && (CACE_ARI_RPT_DELTA_MARKER_MODEL_ENUM == REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_ENUM)
+                   && (CACE_ARI_RPT_DELTA_MARKER_OBJ_ENUM
+                       == REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_IDENT_RPT_DELTA)
+                   && (CACE_ARI_RPT_DELTA_RESYNC_OBJ_ENUM
+                       == REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_CTRL_RPT_DELTA_RESYNC),
+               "Delta report marker and resync must be objects of this model");
+
+/** Produce a latency summary table, which is empty when not recorded.
+ */
+static void refda_adm_dtnma_tools_refda_instr_latency_table(refda_edd_prod_ctx_t *ctx, refda_latency_cat_t cat)
+{
+    cace_ari_t      result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_tbl_t *table  = cace_ari_set_tbl(&result, NULL);
+#if AGENT_LATENCY
+    refda_agent_t *agent = ctx->prodctx->runctx->agent;
+    if (!refda_latency_get_table(&(agent->instr.latency), cat, table))
+    {
+        refda_edd_prod_ctx_set_result_move(ctx, &result);
+    }
+#else
+    (void)cat;
+    cace_ari_tbl_reset(table, 8, 0);
+    refda_edd_prod_ctx_set_result_move(ctx, &result);
+#endif /* AGENT_LATENCY */
+    cace_ari_deinit(&result);
+}
+/*   STOP CUSTOM FUNCTIONS HERE  */
+
+/*   START CALLBACK FUNCTIONS HERE */
+/* Name: ctrl-latency-list
+ * Description:
+ *   A table of latency statistics for the execution of each CTRL, from the
+ *   start of execution until it is finished, including any time spent
+ *   waiting.
+ *   Each row summarizes a single object and all time values are derived from
+ *   a histogram with a bounded relative error.
+ *   This table is always empty when the Agent is built without latency
+ *   recording.
+ *
+ * Parameters: none
+ *
+ * Produced type: TBLT with 8 columns:
+ *   - Index 0, name "obj", type use of ari:/ARITYPE/CTRL
+ *   - Index 1, name "count", type use of ari:/ARITYPE/UVAST
+ *   - Index 2, name "min", type use of ari:/ARITYPE/TD
+ *   - Index 3, name "mean", type use of ari:/ARITYPE/TD
+ *   - Index 4, name "p50", type use of ari:/ARITYPE/TD
+ *   - Index 5, name "p90", type use of ari:/ARITYPE/TD
+ *   - Index 6, name "p99", type use of ari:/ARITYPE/TD
+ *   - Index 7, name "max", type use of ari:/ARITYPE/TD
+ */
+static void refda_adm_dtnma_tools_refda_instr_edd_ctrl_latency_list(refda_edd_prod_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_ctrl_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+    refda_adm_dtnma_tools_refda_instr_latency_table(ctx, REFDA_LATENCY_CTRL);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_ctrl_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/* Name: edd-latency-list
+ * Description:
+ *   A table of latency statistics for the production of each EDD value.
+ *   Each row summarizes a single object and all time values are derived from
+ *   a histogram with a bounded relative error.
+ *   This table is always empty when the Agent is built without latency
+ *   recording.
+ *
+ * Parameters: none
+ *
+ * Produced type: TBLT with 8 columns:
+ *   - Index 0, name "obj", type use of ari:/ARITYPE/EDD
+ *   - Index 1, name "count", type use of ari:/ARITYPE/UVAST
+ *   - Index 2, name "min", type use of ari:/ARITYPE/TD
+ *   - Index 3, name "mean", type use of ari:/ARITYPE/TD
+ *   - Index 4, name "p50", type use of ari:/ARITYPE/TD
+ *   - Index 5, name "p90", type use of ari:/ARITYPE/TD
+ *   - Index 6, name "p99", type use of ari:/ARITYPE/TD
+ *   - Index 7, name "max", type use of ari:/ARITYPE/TD
+ */
+static void refda_adm_dtnma_tools_refda_instr_edd_edd_latency_list(refda_edd_prod_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_edd_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+    refda_adm_dtnma_tools_refda_instr_latency_table(ctx, REFDA_LATENCY_EDD);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_edd_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/* Name: oper-latency-list
+ * Description:
+ *   A table of latency statistics for the evaluation of each OPER.
+ *   Each row summarizes a single object and all time values are derived from
+ *   a histogram with a bounded relative error.
+ *   This table is always empty when the Agent is built without latency
+ *   recording.
+ *
+ * Parameters: none
+ *
+ * Produced type: TBLT with 8 columns:
+ *   - Index 0, name "obj", type use of ari:/ARITYPE/OPER
+ *   - Index 1, name "count", type use of ari:/ARITYPE/UVAST
+ *   - Index 2, name "min", type use of ari:/ARITYPE/TD
+ *   - Index 3, name "mean", type use of ari:/ARITYPE/TD
+ *   - Index 4, name "p50", type use of ari:/ARITYPE/TD
+ *   - Index 5, name "p90", type use of ari:/ARITYPE/TD
+ *   - Index 6, name "p99", type use of ari:/ARITYPE/TD
+ *   - Index 7, name "max", type use of ari:/ARITYPE/TD
+ */
+static void refda_adm_dtnma_tools_refda_instr_edd_oper_latency_list(refda_edd_prod_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_oper_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+    refda_adm_dtnma_tools_refda_instr_latency_table(ctx, REFDA_LATENCY_OPER);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_oper_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/* Name: rptt-latency-list
+ * Description:
+ *   A table of latency statistics for the production of each value-object
+ *   item within report templates.
+ *   Each row summarizes a single object and all time values are derived from
+ *   a histogram with a bounded relative error.
+ *   This table is always empty when the Agent is built without latency
+ *   recording.
+ *
+ * Parameters: none
+ *
+ * Produced type: TBLT with 8 columns:
+ *   - Index 0, name "obj", type use of ari://ietf/amm-base/TYPEDEF/value-obj
+ *   - Index 1, name "count", type use of ari:/ARITYPE/UVAST
+ *   - Index 2, name "min", type use of ari:/ARITYPE/TD
+ *   - Index 3, name "mean", type use of ari:/ARITYPE/TD
+ *   - Index 4, name "p50", type use of ari:/ARITYPE/TD
+ *   - Index 5, name "p90", type use of ari:/ARITYPE/TD
+ *   - Index 6, name "p99", type use of ari:/ARITYPE/TD
+ *   - Index 7, name "max", type use of ari:/ARITYPE/TD
+ */
+static void refda_adm_dtnma_tools_refda_instr_edd_rptt_latency_list(refda_edd_prod_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_rptt_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+    refda_adm_dtnma_tools_refda_instr_latency_table(ctx, REFDA_LATENCY_RPTT);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_rptt_latency_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/* Name: exec-trace-list
+ * Description:
+ *   A table of recent EXECSET pipeline trace records, oldest first. Each row
+ *   is a single stage of handling an EXECSET with a non-null nonce, with
+ *   stage names "recv", "dequeue", "expand", "ctrl-start", "ctrl-finish",
+ *   "rpt-queue", and "send". This table is always empty when the Agent is
+ *   built without tracing.
+ *
+ * Parameters: none
+ *
+ * Produced type: TBLT with 4 columns:
+ *   - Index 0, name "nonce", type use of ari://ietf/amm-base/TYPEDEF/any
+ *   - Index 1, name "stage", type use of ari:/ARITYPE/TEXTSTR
+ *   - Index 2, name "time", type use of ari:/ARITYPE/TP
+ *   - Index 3, name "target", type use of ari://ietf/amm-base/TYPEDEF/any
+ */
+static void refda_adm_dtnma_tools_refda_instr_edd_exec_trace_list(refda_edd_prod_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_exec_trace_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+    cace_ari_t      result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_tbl_t *table  = cace_ari_set_tbl(&result, NULL);
+#if AGENT_EXEC_TRACE
+    refda_agent_t *agent = ctx->prodctx->runctx->agent;
+    if (!refda_trace_get_table(&(agent->instr.trace), table))
+    {
+        refda_edd_prod_ctx_set_result_move(ctx, &result);
+    }
+#else
+    cace_ari_tbl_reset(table, 4, 0);
+    refda_edd_prod_ctx_set_result_move(ctx, &result);
+#endif /* AGENT_EXEC_TRACE */
+    cace_ari_deinit(&result);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_edd_exec_trace_list BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/* Name: rpt-delta-resync
+ * Description:
+ *   Discard the report-by-exception state for all report sources to the
+ *   manager executing this control, so that the next report from each
+ *   source is complete and begins a new epoch. This is used by a manager
+ *   which is unable to reassemble a delta-encoded report.
+ *
+ * Parameters: none
+ *
+ * Result: none
+ */
+static void refda_adm_dtnma_tools_refda_instr_ctrl_rpt_delta_resync(refda_ctrl_exec_ctx_t *ctx)
+{
+    /*
+     * +-------------------------------------------------------------------------+
+     * |START CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_ctrl_rpt_delta_resync BODY
+     * +-------------------------------------------------------------------------+
+     */
+    refda_agent_t *agent = ctx->runctx->agent;
+    refda_rpt_delta_resync(&(agent->rpt_delta), &(ctx->runctx->mgr_ident));
+    refda_ctrl_exec_ctx_set_result_null(ctx);
+    /*
+     * +-------------------------------------------------------------------------+
+     * |STOP CUSTOM FUNCTION refda_adm_dtnma_tools_refda_instr_ctrl_rpt_delta_resync BODY
+     * +-------------------------------------------------------------------------+
+     */
+}
+
+/*   STOP CALLBACK FUNCTIONS HERE  */
+
+int refda_adm_dtnma_tools_refda_instr_init(refda_agent_t *agent)
+{
+    CHKERR1(agent);
+    CACE_LOG_DEBUG("Registering ADM: "
+                   "dtnma-tools-refda-instr");
+    CACE_MUTEX_LOCK(&agent->objs_mutex);
+
+    /*   START CUSTOM PRE-INIT HERE */
+    /*   STOP CUSTOM PRE-INIT HERE  */
+
+    cace_amm_obj_ns_t *adm = cace_amm_obj_store_add_ns(
+        &(agent->objs),
+        cace_amm_idseg_ref_withenum(REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ORG_NAME,
+                                    REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ORG_ENUM),
+        cace_amm_idseg_ref_withenum(REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_NAME,
+                                    REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_ENUM),
+        REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_REVISION);
+    if (adm)
+    {
+        cace_amm_obj_desc_t *obj;
+        (void)obj;
+
+        /**
+         * Register IDENT objects
+         */
+        { // For ./IDENT/rpt-delta
+            refda_amm_ident_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_ident_desc_t));
+            refda_amm_ident_desc_init(objdata);
+            objdata->abstract = false;
+            // no IDENT bases
+
+            obj = refda_register_ident(
+                adm,
+                cace_amm_idseg_ref_withenum("rpt-delta", REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_IDENT_RPT_DELTA),
+                objdata);
+            // no parameters
+        }
+
+        /**
+         * Register EDD objects
+         */
+        { // For ./EDD/ctrl-latency-list
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            // produced type
+            {
+                // table template
+                cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&(objdata->prod_type), 8);
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+                    m_string_set_cstr(col->name, "obj");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/CTRL
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_CTRL);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+                    m_string_set_cstr(col->name, "count");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/UVAST
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_UVAST);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 2);
+                    m_string_set_cstr(col->name, "min");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 3);
+                    m_string_set_cstr(col->name, "mean");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 4);
+                    m_string_set_cstr(col->name, "p50");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 5);
+                    m_string_set_cstr(col->name, "p90");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 6);
+                    m_string_set_cstr(col->name, "p99");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 7);
+                    m_string_set_cstr(col->name, "max");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+            }
+            // callback:
+            objdata->produce = refda_adm_dtnma_tools_refda_instr_edd_ctrl_latency_list;
+
+            obj = refda_register_edd(
+                adm,
+                cace_amm_idseg_ref_withenum("ctrl-latency-list",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_CTRL_LATENCY_LIST),
+                objdata);
+            // no parameters
+        }
+        { // For ./EDD/edd-latency-list
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            // produced type
+            {
+                // table template
+                cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&(objdata->prod_type), 8);
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+                    m_string_set_cstr(col->name, "obj");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/EDD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_EDD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+                    m_string_set_cstr(col->name, "count");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/UVAST
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_UVAST);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 2);
+                    m_string_set_cstr(col->name, "min");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 3);
+                    m_string_set_cstr(col->name, "mean");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 4);
+                    m_string_set_cstr(col->name, "p50");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 5);
+                    m_string_set_cstr(col->name, "p90");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 6);
+                    m_string_set_cstr(col->name, "p99");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 7);
+                    m_string_set_cstr(col->name, "max");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+            }
+            // callback:
+            objdata->produce = refda_adm_dtnma_tools_refda_instr_edd_edd_latency_list;
+
+            obj = refda_register_edd(
+                adm,
+                cace_amm_idseg_ref_withenum("edd-latency-list",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_EDD_LATENCY_LIST),
+                objdata);
+            // no parameters
+        }
+        { // For ./EDD/oper-latency-list
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            // produced type
+            {
+                // table template
+                cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&(objdata->prod_type), 8);
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+                    m_string_set_cstr(col->name, "obj");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/OPER
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_OPER);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+                    m_string_set_cstr(col->name, "count");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/UVAST
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_UVAST);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 2);
+                    m_string_set_cstr(col->name, "min");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 3);
+                    m_string_set_cstr(col->name, "mean");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 4);
+                    m_string_set_cstr(col->name, "p50");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 5);
+                    m_string_set_cstr(col->name, "p90");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 6);
+                    m_string_set_cstr(col->name, "p99");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 7);
+                    m_string_set_cstr(col->name, "max");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+            }
+            // callback:
+            objdata->produce = refda_adm_dtnma_tools_refda_instr_edd_oper_latency_list;
+
+            obj = refda_register_edd(
+                adm,
+                cace_amm_idseg_ref_withenum("oper-latency-list",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_OPER_LATENCY_LIST),
+                objdata);
+            // no parameters
+        }
+        { // For ./EDD/rptt-latency-list
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            // produced type
+            {
+                // table template
+                cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&(objdata->prod_type), 8);
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+                    m_string_set_cstr(col->name, "obj");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // reference to ari://ietf/amm-base/TYPEDEF/value-obj
+                        cace_ari_set_objref_path_intid(&typeref, 1, 25, CACE_ARI_TYPE_TYPEDEF, 9);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+                    m_string_set_cstr(col->name, "count");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/UVAST
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_UVAST);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 2);
+                    m_string_set_cstr(col->name, "min");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 3);
+                    m_string_set_cstr(col->name, "mean");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 4);
+                    m_string_set_cstr(col->name, "p50");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 5);
+                    m_string_set_cstr(col->name, "p90");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 6);
+                    m_string_set_cstr(col->name, "p99");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 7);
+                    m_string_set_cstr(col->name, "max");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TD
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TD);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+            }
+            // callback:
+            objdata->produce = refda_adm_dtnma_tools_refda_instr_edd_rptt_latency_list;
+
+            obj = refda_register_edd(
+                adm,
+                cace_amm_idseg_ref_withenum("rptt-latency-list",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_RPTT_LATENCY_LIST),
+                objdata);
+            // no parameters
+        }
+        { // For ./EDD/exec-trace-list
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            // produced type
+            {
+                // table template
+                cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&(objdata->prod_type), 4);
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+                    m_string_set_cstr(col->name, "nonce");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // reference to ari://ietf/amm-base/TYPEDEF/any
+                        cace_ari_set_objref_path_intid(&typeref, 1, 25, CACE_ARI_TYPE_TYPEDEF, 8);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+                    m_string_set_cstr(col->name, "stage");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TEXTSTR
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TEXTSTR);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 2);
+                    m_string_set_cstr(col->name, "time");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // use of ari:/ARITYPE/TP
+                        cace_ari_set_aritype(&typeref, CACE_ARI_TYPE_TP);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+                {
+                    cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 3);
+                    m_string_set_cstr(col->name, "target");
+                    {
+                        cace_ari_t typeref = CACE_ARI_INIT_UNDEFINED;
+                        // reference to ari://ietf/amm-base/TYPEDEF/any
+                        cace_ari_set_objref_path_intid(&typeref, 1, 25, CACE_ARI_TYPE_TYPEDEF, 8);
+                        cace_amm_type_set_use_ref_move(&(col->typeobj), &typeref);
+                    }
+                }
+            }
+            // callback:
+            objdata->produce = refda_adm_dtnma_tools_refda_instr_edd_exec_trace_list;
+
+            obj = refda_register_edd(
+                adm,
+                cace_amm_idseg_ref_withenum("exec-trace-list",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_EXEC_TRACE_LIST),
+                objdata);
+            // no parameters
+        }
+
+        /**
+         * Register CTRL objects
+         */
+        { // For ./CTRL/rpt-delta-resync
+            refda_amm_ctrl_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_ctrl_desc_t));
+            refda_amm_ctrl_desc_init(objdata);
+            // no result type
+            // callback:
+            objdata->execute = refda_adm_dtnma_tools_refda_instr_ctrl_rpt_delta_resync;
+
+            obj = refda_register_ctrl(
+                adm,
+                cace_amm_idseg_ref_withenum("rpt-delta-resync",
+                                            REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_CTRL_RPT_DELTA_RESYNC),
+                objdata);
+            // no parameters
+        }
+    }
+
+    /*   START CUSTOM POST-INIT HERE */
+    /*   STOP CUSTOM POST-INIT HERE  */
+
+    CACE_MUTEX_UNLOCK(&agent->objs_mutex);
+    return 0;
+}
+/*  STOP GENERATED SOURCE HERE */
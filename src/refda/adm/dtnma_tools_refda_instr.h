@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*  START GENERATED SOURCE HERE */
+/** @file
+ * This is the header for the implementation of the
+ * ADM module "dtnma-tools-refda-instr" for the C-language reference DA.
+ * This contains defines for each enumeration in the ADM and
+ * declarations of module-level initialization functions.
+ */
+
+#ifndef REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_H_
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_H_
+
+#include "refda/agent.h"
+
+#include "cace/util/defs.h"
+
+/*   START CUSTOM INCLUDES HERE */
+/*             TODO              */
+/*   STOP CUSTOM INCLUDES HERE  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Defines for the ADM itself
+ */
+/// Text name of the organization
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ORG_NAME "dtnma-tools"
+/// Enumeration of the organization
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ORG_ENUM -1
+/// Text name of the model
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_NAME "refda-instr"
+/// Enumeration of the model
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_ENUM 1
+/// Revision date for the model
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_REVISION "2026-10-19"
+
+/*
+ * Enumerations for IDENT objects
+ */
+/// For ./IDENT/rpt-delta
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_IDENT_RPT_DELTA 0
+
+/*
+ * Enumerations for EDD objects
+ */
+/// For ./EDD/ctrl-latency-list
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_CTRL_LATENCY_LIST 0
+/// For ./EDD/edd-latency-list
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_EDD_LATENCY_LIST 1
+/// For ./EDD/oper-latency-list
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_OPER_LATENCY_LIST 2
+/// For ./EDD/rptt-latency-list
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_RPTT_LATENCY_LIST 3
+/// For ./EDD/exec-trace-list
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_EXEC_TRACE_LIST 4
+
+/*
+ * Enumerations for CTRL objects
+ */
+/// For ./CTRL/rpt-delta-resync
+#define REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_CTRL_RPT_DELTA_RESYNC 0
+
+/** Initializer for the ADM module dtnma-tools-refda-instr.
+ * @param[in,out] agent The agent to register this namespace and its
+ * objects within.
+ * @return Zero upon success.
+ */
+int refda_adm_dtnma_tools_refda_instr_init(refda_agent_t *agent);
+
+#ifdef __cplusplus
+} /* extern C */
+#endif
+
+#endif /* REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_H_ */
+/*  STOP GENERATED SOURCE HERE */
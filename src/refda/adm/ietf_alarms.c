@@ -397,18 +397,15 @@ static void refda_adm_ietf_alarms_ctrl_ensure_shelf(refda_ctrl_exec_ctx_t *ctx)
     refda_agent_t *agent = ctx->runctx->agent;
     CACE_MUTEX_UNLOCK(&agent->alarms.shelf_mutex);
 
-    cace_ari_array_it_t tbl_it;
-    cace_ari_array_it(tbl_it, tbl->items);
-    while (!cace_ari_array_end_p(tbl_it))
+    const size_t nrows = cace_ari_tbl_num_rows(tbl);
+    for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
     {
         refda_alarms_shelf_entry_t trial;
         refda_alarms_shelf_entry_init(&trial);
 
-        cace_amm_objpat_set_from_value(&trial.resources, cace_ari_array_cref(tbl_it));
-        cace_ari_array_next(tbl_it);
-
-        cace_amm_objpat_set_from_value(&trial.categories, cace_ari_array_cref(tbl_it));
-        cace_ari_array_next(tbl_it);
+        cace_ari_t buf;
+        cace_amm_objpat_set_from_value(&trial.resources, cace_ari_tbl_cview(tbl, row_ix, 0, &buf));
+        cace_amm_objpat_set_from_value(&trial.categories, cace_ari_tbl_cview(tbl, row_ix, 1, &buf));
 
         // present or not
         if (!refda_alarms_shelf_entry_set_get(agent->alarms.shelf_list, trial))
@@ -471,18 +468,15 @@ static void refda_adm_ietf_alarms_ctrl_discard_shelf(refda_ctrl_exec_ctx_t *ctx)
     refda_agent_t *agent = ctx->runctx->agent;
     CACE_MUTEX_LOCK(&(agent->alarms.shelf_mutex));
 
-    cace_ari_array_it_t tbl_it;
-    cace_ari_array_it(tbl_it, tbl->items);
-    while (!cace_ari_array_end_p(tbl_it))
+    const size_t nrows = cace_ari_tbl_num_rows(tbl);
+    for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
     {
         refda_alarms_shelf_entry_t trial;
         refda_alarms_shelf_entry_init(&trial);
 
-        cace_amm_objpat_set_from_value(&trial.resources, cace_ari_array_cref(tbl_it));
-        cace_ari_array_next(tbl_it);
-
-        cace_amm_objpat_set_from_value(&trial.categories, cace_ari_array_cref(tbl_it));
-        cace_ari_array_next(tbl_it);
+        cace_ari_t buf;
+        cace_amm_objpat_set_from_value(&trial.resources, cace_ari_tbl_cview(tbl, row_ix, 0, &buf));
+        cace_amm_objpat_set_from_value(&trial.categories, cace_ari_tbl_cview(tbl, row_ix, 1, &buf));
 
         // present or not
         if (!refda_alarms_shelf_entry_set_pop_at(NULL, agent->alarms.shelf_list, trial))
@@ -39,11 +39,29 @@
 #include "cace/util/mutex.h"
 
 /*   START CUSTOM INCLUDES HERE */
-/*             TODO              */
+#include "refda/eid_pattern.h"
 /*   STOP CUSTOM INCLUDES HERE  */
 
 /*   START CUSTOM FUNCTIONS HERE */
-/*             TODO              */
+/** Get the encoded EID parameter from an ./IDENT/bp-endpoint reference.
+ *
+ * @param[in] value The reference value.
+ * @return The encoded EID or NULL if not present.
+ */
+static const cace_data_t *refda_adm_ietf_bp_base_endpoint_eid(const cace_ari_t *value)
+{
+    const cace_ari_ref_t *ref = cace_ari_cget_ref(value);
+    if (!ref || (ref->params.state != CACE_ARI_PARAMS_AC))
+    {
+        return NULL;
+    }
+    const cace_ari_ac_t *ac = ref->params.as_ac;
+    if (cace_ari_list_size(ac->items) != 1)
+    {
+        return NULL;
+    }
+    return cace_ari_cget_bstr(cace_ari_list_front(ac->items));
+}
 /*   STOP CUSTOM FUNCTIONS HERE  */
 
 /*   START CALLBACK FUNCTIONS HERE */
@@ -71,6 +89,43 @@ static void refda_adm_ietf_bp_base_oper_match_eid_pattern(refda_oper_eval_ctx_t
      * |START CUSTOM FUNCTION refda_adm_ietf_bp_base_oper_match_eid_pattern BODY
      * +-------------------------------------------------------------------------+
      */
+    if (refda_oper_eval_ctx_has_aparam_undefined(ctx))
+    {
+        CACE_LOG_ERR("Invalid parameter, unable to continue");
+        return;
+    }
+    const cace_ari_t  *pattern      = refda_oper_eval_ctx_get_aparam_index(ctx, 0);
+    const cace_data_t *pattern_data = cace_ari_cget_bstr(pattern);
+
+    // compiled patterns are cached between evaluations
+    refda_eid_pattern_t *pat = pattern_data ? refda_eid_pattern_acquire(pattern_data) : NULL;
+    if (!pat)
+    {
+        CACE_LOG_ERR("Invalid EID pattern, unable to continue");
+        return;
+    }
+
+    const cace_ari_t *value      = refda_oper_eval_ctx_get_operand_index(ctx, 0);
+    const char       *value_text = cace_ari_cget_tstr_cstr(value);
+
+    bool is_match = false;
+    if (value_text)
+    {
+        is_match = refda_eid_pattern_match_text(pat, value_text, cace_ari_cget_tstr_strlen(value));
+    }
+    else
+    {
+        const cace_data_t *value_eid = refda_adm_ietf_bp_base_endpoint_eid(value);
+        if (value_eid)
+        {
+            is_match = refda_eid_pattern_match_cbor(pat, value_eid);
+        }
+    }
+    refda_eid_pattern_release(pat);
+
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_bool(&result, is_match);
+    refda_oper_eval_ctx_set_result_move(ctx, &result);
     /*
      * +-------------------------------------------------------------------------+
      * |STOP CUSTOM FUNCTION refda_adm_ietf_bp_base_oper_match_eid_pattern BODY
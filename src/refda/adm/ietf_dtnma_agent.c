@@ -48,6 +48,7 @@
 #include "cace/amm/numeric.h"
 #include "cace/amm/promote.h"
 #include "cace/ari/text_util.h"
+#include "cace/util/regex.h"
 
 #include <timespec.h>
 
@@ -114,17 +115,44 @@ static void refda_adm_ietf_dtnma_agent_ctrl_wait_cond_check(refda_ctrl_exec_ctx_
     CHKVOID(cond);
     CHKVOID(min_intvl);
 
-    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
-
-    int res = refda_eval_target(ctx->runctx, &result, cond);
-    if (res)
+    refda_amm_modval_watch_t *watch = ctx->item->user_data.ptr;
+    const bool                is_first = !watch;
+    if (is_first)
     {
-        CACE_LOG_ERR("failed to evaluate condition, error %d", res);
-        cace_ari_set_bool(&result, false);
+        // inputs are determined once on the first check
+        watch = CACE_MALLOC(sizeof(refda_amm_modval_watch_t));
+        refda_amm_modval_watch_init(watch);
+        // the deinit will occur when the execution item is finished
+        cace_amm_user_data_set_from(&ctx->item->user_data, watch, true,
+                                    (cace_amm_user_data_deinit_f)refda_amm_modval_watch_deinit);
+
+        refda_agent_t *agent = ctx->runctx->agent;
+        CACE_MUTEX_LOCK(&agent->objs_mutex);
+        refda_eval_watch_target(agent, watch, cond);
+        CACE_MUTEX_UNLOCK(&agent->objs_mutex);
     }
 
-    const bool truthy = cace_amm_ari_is_truthy(&result);
-    cace_ari_deinit(&result);
+    bool truthy = false;
+    if (is_first || refda_amm_modval_watch_changed(watch))
+    {
+        refda_amm_modval_watch_mark(watch);
+
+        cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+
+        int res = refda_eval_target(ctx->runctx, &result, cond);
+        if (res)
+        {
+            CACE_LOG_ERR("failed to evaluate condition, error %d", res);
+            cace_ari_set_bool(&result, false);
+        }
+
+        truthy = cace_amm_ari_is_truthy(&result);
+        cace_ari_deinit(&result);
+    }
+    else
+    {
+        CACE_LOG_DEBUG("condition inputs unchanged");
+    }
     CACE_LOG_DEBUG("condition result truthy=%d", truthy);
     if (truthy)
     {
@@ -178,20 +206,18 @@ static void refda_adm_ietf_dtnma_agent_read_fparams(cace_amm_obj_desc_t *obj, co
 
     const cace_ari_tbl_t *fparams_tbl = cace_ari_cget_tbl(ari_fparams);
     // actual parameter has been validated to correct shape
-    cace_ari_array_it_t tbl_it;
-    cace_ari_array_it(tbl_it, fparams_tbl->items);
-
-    size_t fparam_ix = 0;
-    while (!cace_ari_array_end_p(tbl_it))
+    const size_t nrows = cace_ari_tbl_num_rows(fparams_tbl);
+    for (size_t fparam_ix = 0; fparam_ix < nrows; ++fparam_ix)
     {
         cace_amm_formal_param_t *fparam = cace_amm_formal_param_list_push_back_new(obj->fparams);
-        fparam->index                   = fparam_ix++;
+        fparam->index                   = fparam_ix;
 
-        const cace_ari_t *fp_name = cace_ari_array_cref(tbl_it);
+        cace_ari_t        name_buf;
+        const cace_ari_t *fp_name = cace_ari_tbl_cview(fparams_tbl, fparam_ix, 0, &name_buf);
         m_string_set_cstr(fparam->name, cace_ari_cget_tstr_cstr(fp_name));
-        cace_ari_array_next(tbl_it);
 
-        const cace_ari_t *fp_type = cace_ari_array_cref(tbl_it);
+        cace_ari_t        type_buf;
+        const cace_ari_t *fp_type = cace_ari_tbl_cview(fparams_tbl, fparam_ix, 1, &type_buf);
         // read now, bind later
         if (cace_amm_type_set_name(&(fparam->typeobj), fp_type, store))
         {
@@ -203,11 +229,10 @@ static void refda_adm_ietf_dtnma_agent_read_fparams(cace_amm_obj_desc_t *obj, co
                              m_string_get_cstr(buf));
             m_string_clear(buf);
         }
-        cace_ari_array_next(tbl_it);
 
-        const cace_ari_t *fp_default = cace_ari_array_cref(tbl_it);
+        cace_ari_t        default_buf;
+        const cace_ari_t *fp_default = cace_ari_tbl_cview(fparams_tbl, fparam_ix, 2, &default_buf);
         cace_ari_set_copy(&(fparam->defval), fp_default);
-        cace_ari_array_next(tbl_it);
     }
 }
 
@@ -1159,9 +1184,9 @@ static cace_ari_translate_result_t tbl_filter_sub_label(cace_ari_t *out, const c
             return CACE_ARI_TRANSLATE_FAILURE;
         }
 
-        const size_t array_index = (row_index * tbl_data->ncols) + col_index;
         // Get data value from table
-        const cace_ari_t *tbl_data_item = cace_ari_array_cget(tbl_data->items, array_index);
+        cace_ari_t        buf;
+        const cace_ari_t *tbl_data_item = cace_ari_tbl_cview(tbl_data, row_index, col_index, &buf);
 
         // Replace label with table data
         refda_eval_label_subst(out, tbl_data_item, ctx);
@@ -1171,6 +1196,343 @@ static cace_ari_translate_result_t tbl_filter_sub_label(cace_ari_t *out, const c
     return CACE_ARI_TRANSLATE_DEFAULT;
 }
 
+/// Kinds of instruction in a compiled row filter
+typedef enum
+{
+    /// Push the value of a table column
+    TBL_FILTER_OP_COLUMN,
+    /// Push a literal value
+    TBL_FILTER_OP_LITERAL,
+    /// Compare two column or literal values into a row mask
+    TBL_FILTER_OP_COMPARE,
+    /// Invert a row mask
+    TBL_FILTER_OP_BOOL_NOT,
+    /// Combine two row masks
+    TBL_FILTER_OP_BOOL_AND,
+    /// Combine two row masks
+    TBL_FILTER_OP_BOOL_OR,
+    /// Combine two row masks
+    TBL_FILTER_OP_BOOL_XOR,
+} tbl_filter_op_kind_t;
+
+/// A single instruction in a compiled row filter
+typedef struct
+{
+    /// The kind of instruction
+    tbl_filter_op_kind_t kind;
+    /// Column index for ::TBL_FILTER_OP_COLUMN
+    size_t col;
+    /// Borrowed value for ::TBL_FILTER_OP_LITERAL
+    const cace_ari_t *literal;
+    /// Comparison for ::TBL_FILTER_OP_COMPARE
+    const cace_numeric_compare_desc_t *cmp;
+} tbl_filter_op_t;
+
+/// A single stack slot while evaluating a compiled row filter
+typedef struct
+{
+    /// Column or literal operand, or null for a #mask
+    const tbl_filter_op_t *operand;
+    /// Owned per-row results of a kernel
+    bool *mask;
+} tbl_filter_slot_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(tbl_filter_prog, tbl_filter_op_t, M_POD_OPLIST)
+M_ARRAY_DEF(tbl_filter_sel, size_t, M_POD_OPLIST)
+M_ARRAY_DEF(tbl_filter_kinds, bool, M_POD_OPLIST)
+/// @endcond
+
+/** Determine which supported OPER, if any, an expression item references.
+ *
+ * @param[out] op The instruction to set.
+ * @param[in] deref The dereferenced OPER.
+ * @return True if the OPER is supported by a column kernel.
+ */
+static bool tbl_filter_compile_oper(tbl_filter_op_t *op, const cace_amm_lookup_t *deref)
+{
+    if ((deref->obj_type != CACE_ARI_TYPE_OPER) || !deref->obj->obj_id.has_intenum
+        || !cace_amm_obj_ns_is_match(deref->ns, REFDA_ADM_IETF_DTNMA_AGENT_ORG_ENUM,
+                                     REFDA_ADM_IETF_DTNMA_AGENT_MODEL_ENUM))
+    {
+        return false;
+    }
+
+    op->kind = TBL_FILTER_OP_COMPARE;
+    switch (deref->obj->obj_id.intenum)
+    {
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_EQ:
+            op->cmp = &oper_loose_eq_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_NE:
+            op->cmp = &oper_loose_ne_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_GT:
+            op->cmp = &oper_loose_gt_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_GE:
+            op->cmp = &oper_loose_ge_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_LT:
+            op->cmp = &oper_loose_lt_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_COMPARE_LE:
+            op->cmp = &oper_loose_le_desc;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_BOOL_NOT:
+            op->kind = TBL_FILTER_OP_BOOL_NOT;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_BOOL_AND:
+            op->kind = TBL_FILTER_OP_BOOL_AND;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_BOOL_OR:
+            op->kind = TBL_FILTER_OP_BOOL_OR;
+            break;
+        case REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_OPER_BOOL_XOR:
+            op->kind = TBL_FILTER_OP_BOOL_XOR;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/** Compile a row filter EXPR once into a program of column kernels.
+ * Only filters made of column LABELs, primitive literals, comparisons, and
+ * boolean logic are supported, anything else needs per-row evaluation.
+ *
+ * @param[out] prog The program to populate.
+ * @param[in] agent The agent containing all referenced objects.
+ * @param[in] expr The row filter EXPR, whose literals are borrowed by @c prog.
+ * @param ncols The number of columns in the filtered table.
+ * @return True if the whole filter is supported.
+ */
+static bool tbl_filter_compile(tbl_filter_prog_t prog, refda_agent_t *agent, const cace_ari_t *expr, size_t ncols)
+{
+    const cace_ari_ac_t *ac = cace_ari_cget_ac(expr);
+    if (!ac)
+    {
+        return false;
+    }
+
+    // stack of kinds, true for a row mask and false for a column or literal
+    tbl_filter_kinds_t kinds;
+    tbl_filter_kinds_init(kinds);
+    bool valid = true;
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+
+    cace_ari_list_it_t it;
+    for (cace_ari_list_it(it, ac->items); valid && !cace_ari_list_end_p(it); cace_ari_list_next(it))
+    {
+        const cace_ari_t *item  = cace_ari_list_cref(it);
+        tbl_filter_op_t   op    = { 0 };
+        const size_t      depth = tbl_filter_kinds_size(kinds);
+
+        if (cace_ari_is_lit_typed(item, CACE_ARI_TYPE_LABEL))
+        {
+            cace_ari_int col = -1;
+            valid            = !cace_ari_get_int(item, &col) && (col >= 0) && ((size_t)col < ncols);
+            op.kind = TBL_FILTER_OP_COLUMN;
+            op.col  = col;
+        }
+        else if (!item->is_ref)
+        {
+            // containers could hold LABELs to substitute
+            valid      = (item->as_lit.prim_type != CACE_ARI_PRIM_OTHER);
+            op.kind    = TBL_FILTER_OP_LITERAL;
+            op.literal = item;
+        }
+        else
+        {
+            CACE_MUTEX_LOCK(&(agent->objs_mutex));
+            valid = !cace_amm_lookup_deref(&deref, &(agent->objs), item)
+                    && cace_amm_formal_param_list_empty_p(deref.obj->fparams) && tbl_filter_compile_oper(&op, &deref);
+            CACE_MUTEX_UNLOCK(&(agent->objs_mutex));
+        }
+        if (!valid)
+        {
+            break;
+        }
+
+        switch (op.kind)
+        {
+            case TBL_FILTER_OP_COLUMN:
+            case TBL_FILTER_OP_LITERAL:
+                tbl_filter_kinds_push_back(kinds, false);
+                break;
+            case TBL_FILTER_OP_COMPARE:
+                valid = (depth >= 2) && !*tbl_filter_kinds_cget(kinds, depth - 2)
+                        && !*tbl_filter_kinds_cget(kinds, depth - 1);
+                if (valid)
+                {
+                    tbl_filter_kinds_resize(kinds, depth - 1);
+                    *tbl_filter_kinds_get(kinds, depth - 2) = true;
+                }
+                break;
+            case TBL_FILTER_OP_BOOL_NOT:
+                valid = (depth >= 1) && *tbl_filter_kinds_cget(kinds, depth - 1);
+                break;
+            default:
+                valid = (depth >= 2) && *tbl_filter_kinds_cget(kinds, depth - 2)
+                        && *tbl_filter_kinds_cget(kinds, depth - 1);
+                if (valid)
+                {
+                    tbl_filter_kinds_resize(kinds, depth - 1);
+                }
+                break;
+        }
+        tbl_filter_prog_push_back(prog, op);
+    }
+
+    // result must be a single row mask
+    valid = valid && (tbl_filter_kinds_size(kinds) == 1) && *tbl_filter_kinds_cget(kinds, 0);
+
+    cace_amm_lookup_deinit(&deref);
+    tbl_filter_kinds_clear(kinds);
+    return valid;
+}
+
+/** Get a column or literal operand value for one row.
+ * A value from a packed column is reconstructed into @c buf.
+ */
+static const cace_ari_t *tbl_filter_operand(const tbl_filter_op_t *op, const cace_ari_tbl_t *tbl, size_t row_ix,
+                                            cace_ari_t *buf)
+{
+    if (op->kind == TBL_FILTER_OP_COLUMN)
+    {
+        return cace_ari_tbl_cview(tbl, row_ix, op->col, buf);
+    }
+    return op->literal;
+}
+
+/** Batch kernel to compare two operands across all rows.
+ *
+ * @return Zero if successful, or non-zero if any row does not have a
+ * defined boolean result.
+ */
+static int tbl_filter_kernel_compare(bool *mask, const tbl_filter_op_t *lt, const tbl_filter_op_t *rt,
+                                     const cace_numeric_compare_desc_t *cmp, const cace_ari_tbl_t *tbl,
+                                     size_t num_rows)
+{
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+    int        retval = 0;
+    for (size_t row_ix = 0; (row_ix < num_rows) && !retval; ++row_ix)
+    {
+        cace_ari_t        lt_buf, rt_buf;
+        const cace_ari_t *lt_val = tbl_filter_operand(lt, tbl, row_ix, &lt_buf);
+        const cace_ari_t *rt_val = tbl_filter_operand(rt, tbl, row_ix, &rt_buf);
+
+        cace_ari_bool val;
+        if (lt_val->is_ref || rt_val->is_ref || cace_ari_is_undefined(lt_val) || cace_ari_is_undefined(rt_val)
+            || cace_numeric_compare_operator(&result, lt_val, rt_val, cmp) || cace_ari_get_bool(&result, &val))
+        {
+            retval = 1;
+        }
+        else
+        {
+            mask[row_ix] = val;
+        }
+    }
+    cace_ari_deinit(&result);
+    return retval;
+}
+
+/** Evaluate a compiled row filter across all rows of a table in one pass.
+ *
+ * @param[out] sel The indices of rows which match the filter.
+ * @param[in] prog The program from tbl_filter_compile().
+ * @param[in] tbl The table to filter.
+ * @return Zero if successful, or non-zero if any row needs the full
+ * evaluation procedure to determine its result.
+ */
+static int tbl_filter_select_vector(tbl_filter_sel_t sel, const tbl_filter_prog_t prog, const cace_ari_tbl_t *tbl)
+{
+    const size_t num_rows = cace_ari_tbl_num_rows(tbl);
+    if (num_rows == 0)
+    {
+        return 0;
+    }
+
+    tbl_filter_slot_t *stack  = CACE_MALLOC(tbl_filter_prog_size(prog) * sizeof(tbl_filter_slot_t));
+    size_t             depth  = 0;
+    int                retval = 0;
+
+    tbl_filter_prog_it_t it;
+    for (tbl_filter_prog_it(it, prog); !retval && !tbl_filter_prog_end_p(it); tbl_filter_prog_next(it))
+    {
+        const tbl_filter_op_t *op = tbl_filter_prog_cref(it);
+        switch (op->kind)
+        {
+            case TBL_FILTER_OP_COLUMN:
+            case TBL_FILTER_OP_LITERAL:
+                stack[depth++] = (tbl_filter_slot_t) { .operand = op, .mask = NULL };
+                break;
+            case TBL_FILTER_OP_COMPARE:
+            {
+                bool *mask = CACE_MALLOC(num_rows * sizeof(bool));
+                retval = tbl_filter_kernel_compare(mask, stack[depth - 2].operand, stack[depth - 1].operand, op->cmp,
+                                                   tbl, num_rows);
+                depth -= 2;
+                stack[depth++] = (tbl_filter_slot_t) { .operand = NULL, .mask = mask };
+                break;
+            }
+            case TBL_FILTER_OP_BOOL_NOT:
+            {
+                bool *mask = stack[depth - 1].mask;
+                for (size_t row_ix = 0; row_ix < num_rows; ++row_ix)
+                {
+                    mask[row_ix] = !mask[row_ix];
+                }
+                break;
+            }
+            default:
+            {
+                // combine into the left mask
+                bool       *lt = stack[depth - 2].mask;
+                const bool *rt = stack[depth - 1].mask;
+                for (size_t row_ix = 0; row_ix < num_rows; ++row_ix)
+                {
+                    switch (op->kind)
+                    {
+                        case TBL_FILTER_OP_BOOL_AND:
+                            lt[row_ix] = lt[row_ix] && rt[row_ix];
+                            break;
+                        case TBL_FILTER_OP_BOOL_OR:
+                            lt[row_ix] = lt[row_ix] || rt[row_ix];
+                            break;
+                        default:
+                            lt[row_ix] = lt[row_ix] != rt[row_ix];
+                            break;
+                    }
+                }
+                CACE_FREE(stack[--depth].mask);
+                break;
+            }
+        }
+    }
+
+    if (!retval)
+    {
+        const bool *mask = stack[0].mask;
+        for (size_t row_ix = 0; row_ix < num_rows; ++row_ix)
+        {
+            if (mask[row_ix])
+            {
+                tbl_filter_sel_push_back(sel, row_ix);
+            }
+        }
+    }
+
+    while (depth > 0)
+    {
+        CACE_FREE(stack[--depth].mask);
+    }
+    CACE_FREE(stack);
+    return retval;
+}
+
 /** Helper for building tables of IDENT objects.
  */
 void refda_adm_ietf_dtnma_agent_append_derived_ident(cace_ari_tbl_t *table, const cace_amm_lookup_t *deref,
@@ -1270,6 +1632,115 @@ static int refda_odm_object_exists(cace_amm_obj_desc_t **obj, cace_amm_obj_ns_t
     return 2;
 }
 
+/// Group indices for EDDs produced from the agent instrumentation
+enum refda_adm_ietf_dtnma_agent_instr_group_e
+{
+    INSTR_GROUP_NUM_MSG_RX = 0,
+    INSTR_GROUP_NUM_MSG_RX_FAILED,
+    INSTR_GROUP_NUM_MSG_TX,
+    INSTR_GROUP_NUM_MSG_TX_FAILED,
+    INSTR_GROUP_LAST_MSG_RX_TIME,
+    INSTR_GROUP_NUM_EXEC_STARTED,
+    INSTR_GROUP_NUM_EXEC_SUCCEEDED,
+    INSTR_GROUP_NUM_EXEC_FAILED,
+};
+
+static void refda_adm_ietf_dtnma_agent_instr_group_set_uvast(refda_edd_group_prod_ctx_t *ctx, size_t index,
+                                                             atomic_ullong *counter)
+{
+    if (refda_edd_group_prod_ctx_is_requested(ctx, index))
+    {
+        cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_uvast(&result, atomic_load(counter));
+        refda_edd_group_prod_ctx_set_result_move(ctx, index, &result);
+    }
+}
+
+/** Produce any of the instrumentation EDDs together.
+ * All counters are read while holding the instrumentation mutex, so that
+ * they are sampled together with the last receive time.
+ */
+static void refda_adm_ietf_dtnma_agent_instr_group_produce(refda_edd_group_prod_ctx_t *ctx)
+{
+    refda_instr_t *instr = &(ctx->runctx->agent->instr);
+
+    CACE_MUTEX_LOCK(&(instr->mutex));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_MSG_RX, &(instr->num_execset_recv));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_MSG_RX_FAILED,
+                                                     &(instr->num_execset_recv_failure));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_MSG_TX, &(instr->num_rptset_sent));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_MSG_TX_FAILED,
+                                                     &(instr->num_rptset_sent_failure));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_EXEC_STARTED, &(instr->num_ctrls_run));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_EXEC_SUCCEEDED,
+                                                     &(instr->num_ctrls_succeeded));
+    refda_adm_ietf_dtnma_agent_instr_group_set_uvast(ctx, INSTR_GROUP_NUM_EXEC_FAILED, &(instr->num_ctrls_failed));
+    if (refda_edd_group_prod_ctx_is_requested(ctx, INSTR_GROUP_LAST_MSG_RX_TIME))
+    {
+        cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_copy(&result, &(instr->last_time_recv));
+        refda_edd_group_prod_ctx_set_result_move(ctx, INSTR_GROUP_LAST_MSG_RX_TIME, &result);
+    }
+    CACE_MUTEX_UNLOCK(&(instr->mutex));
+}
+
+static const refda_amm_edd_group_t refda_adm_ietf_dtnma_agent_instr_group = {
+    .produce = refda_adm_ietf_dtnma_agent_instr_group_produce,
+};
+
+/** Attach a registered EDD to the instrumentation group.
+ */
+static void refda_adm_ietf_dtnma_agent_instr_group_add(cace_amm_obj_ns_t *adm, cace_ari_int_id_t intenum,
+                                                       size_t index)
+{
+    cace_amm_obj_desc_t *obj = cace_amm_obj_ns_find_obj_enum(adm, CACE_ARI_TYPE_EDD, intenum);
+    if (!obj)
+    {
+        CACE_LOG_ERR("missing instrumentation EDD %" PRId64, intenum);
+        return;
+    }
+    refda_amm_edd_desc_t *edd = obj->app_data.ptr;
+    edd->group                = &refda_adm_ietf_dtnma_agent_instr_group;
+    edd->group_index          = index;
+}
+
+/** Mark an EDD which never changes its produced value as change-notifying,
+ * so that conditions using it do not need to be polled.
+ */
+static void refda_adm_ietf_dtnma_agent_fixed_edd_add(cace_amm_obj_ns_t *adm, cace_ari_int_id_t intenum)
+{
+    cace_amm_obj_desc_t *obj = cace_amm_obj_ns_find_obj_enum(adm, CACE_ARI_TYPE_EDD, intenum);
+    if (!obj)
+    {
+        CACE_LOG_ERR("missing fixed EDD %" PRId64, intenum);
+        return;
+    }
+    refda_amm_edd_desc_t *edd = obj->app_data.ptr;
+    edd->change_notify        = true;
+}
+
+/** Mark every EDD in this ADM as cacheable, since none of them depend on
+ * the run context of their production.
+ */
+static void refda_adm_ietf_dtnma_agent_cacheable_edds(cace_amm_obj_ns_t *adm)
+{
+    cace_amm_obj_ns_ctr_ptr_t **ctr_ptr = cace_amm_obj_ns_ctr_dict_get(adm->object_types, CACE_ARI_TYPE_EDD);
+    if (!ctr_ptr)
+    {
+        return;
+    }
+    cace_amm_obj_ns_ctr_t *obj_ctr = cace_amm_obj_ns_ctr_ptr_ref(*ctr_ptr);
+
+    cace_amm_obj_desc_list_it_t obj_it;
+    for (cace_amm_obj_desc_list_it(obj_it, obj_ctr->obj_list); !cace_amm_obj_desc_list_end_p(obj_it);
+         cace_amm_obj_desc_list_next(obj_it))
+    {
+        cace_amm_obj_desc_t  *obj = cace_amm_obj_desc_ptr_ref(*cace_amm_obj_desc_list_ref(obj_it));
+        refda_amm_edd_desc_t *edd = obj->app_data.ptr;
+        edd->cacheable            = true;
+    }
+}
+
 /*   STOP CUSTOM FUNCTIONS HERE  */
 
 /*   START CALLBACK FUNCTIONS HERE */
@@ -3110,6 +3581,7 @@ static void refda_adm_ietf_dtnma_agent_ctrl_obsolete_odm(refda_ctrl_exec_ctx_t *
     {
         CACE_LOG_INFO("ODM found, marking as obsolete");
         odm->status = CACE_AMM_STATUS_OBSOLETE;
+        refda_rpt_plan_cache_invalidate(&(agent->rpt_plans));
 
         // Indicate successful result
         refda_ctrl_exec_ctx_set_result_null(ctx);
@@ -3184,6 +3656,7 @@ static void refda_adm_ietf_dtnma_agent_ctrl_var_reset(refda_ctrl_exec_ctx_t *ctx
                 m_string_clear(buf);
             }
             cace_ari_set_copy(&(var->value), &(var->init_val));
+            refda_amm_modval_state_inc(&(var->val_state));
             refda_ctrl_exec_ctx_set_result_null(ctx);
         }
     }
@@ -3257,6 +3730,7 @@ static void refda_adm_ietf_dtnma_agent_ctrl_var_store(refda_ctrl_exec_ctx_t *ctx
                 m_string_clear(buf);
             }
             cace_ari_set_copy(&(var->value), value);
+            refda_amm_modval_state_inc(&(var->val_state));
             refda_ctrl_exec_ctx_set_result_null(ctx);
         }
     }
@@ -3605,6 +4079,8 @@ static void refda_adm_ietf_dtnma_agent_ctrl_ensure_const(refda_ctrl_exec_ctx_t *
 
         obj = refda_register_const(odm, cace_amm_idseg_ref_withenum(m_string_get_cstr(*cnst_name), obj_id), objdata);
         refda_adm_ietf_dtnma_agent_read_fparams(obj, ari_fparams, &agent->objs);
+        // references to this object can now be resolved
+        refda_rpt_plan_cache_invalidate(&(agent->rpt_plans));
     }
 
     bool is_valid = true;
@@ -3727,6 +4203,7 @@ static void refda_adm_ietf_dtnma_agent_ctrl_obsolete_const(refda_ctrl_exec_ctx_t
         {
             CACE_LOG_DEBUG("Marking CONST as obsolete");
             deref.obj->status = CACE_AMM_STATUS_OBSOLETE;
+            refda_rpt_plan_cache_invalidate(&(agent->rpt_plans));
             refda_ctrl_exec_ctx_set_result_null(ctx);
         }
     }
@@ -3848,6 +4325,8 @@ static void refda_adm_ietf_dtnma_agent_ctrl_ensure_var(refda_ctrl_exec_ctx_t *ct
 
         obj = refda_register_var(odm, cace_amm_idseg_ref_withenum(m_string_get_cstr(*cnst_name), obj_id), objdata);
         refda_adm_ietf_dtnma_agent_read_fparams(obj, ari_fparams, &agent->objs);
+        // references to this object can now be resolved
+        refda_rpt_plan_cache_invalidate(&(agent->rpt_plans));
     }
 
     bool is_valid = true;
@@ -3899,6 +4378,8 @@ static void refda_adm_ietf_dtnma_agent_ctrl_ensure_var(refda_ctrl_exec_ctx_t *ct
         // init value and state value
         cace_ari_set_copy(&(objdata->init_val), ari_init);
         cace_ari_set_copy(&(objdata->value), ari_init);
+        // an existing obsolete VAR may already be watched
+        refda_amm_modval_state_inc(&(objdata->val_state));
 
         refda_binding_ctx_t bind_ctx = {
             .store = &(agent->objs),
@@ -3972,6 +4453,11 @@ static void refda_adm_ietf_dtnma_agent_ctrl_obsolete_var(refda_ctrl_exec_ctx_t *
         {
             CACE_LOG_DEBUG("Marking VAR as obsolete");
             deref.obj->status = CACE_AMM_STATUS_OBSOLETE;
+            refda_rpt_plan_cache_invalidate(&(agent->rpt_plans));
+
+            // any evaluation using this VAR is now different
+            refda_amm_var_desc_t *var = deref.obj->app_data.ptr;
+            refda_amm_modval_state_inc(&(var->val_state));
             refda_ctrl_exec_ctx_set_result_null(ctx);
         }
     }
@@ -5765,28 +6251,13 @@ static void refda_adm_ietf_dtnma_agent_oper_match_regexp(refda_oper_eval_ctx_t *
     if (regexp_text && value_text)
     {
 #if PCRE_FOUND
-        const int   opts        = PCRE2_ANCHORED | PCRE2_ENDANCHORED;
-        int         errorcode   = 0;
-        PCRE2_SIZE  erroroffset = 0;
-        pcre2_code *cfg = pcre2_compile((PCRE2_SPTR8)regexp_text, regexp_strlen, opts, &errorcode, &erroroffset, NULL);
-        if (!cfg)
+        // compiled patterns are cached between evaluations
+        cace_util_regex_t *cfg = cace_util_regex_acquire(regexp_text, regexp_strlen);
+        if (cfg)
         {
-            CACE_LOG_ERR("Failed to compile regex pattern (error %d at %z): %s", errorcode, erroroffset, regexp_text);
-        }
-        else
-        {
-            pcre2_match_data *md   = pcre2_match_data_create_from_pattern(cfg, NULL);
-            const int         opts = 0;
-            // ignore terminating null
-            int res = pcre2_match(cfg, (PCRE2_SPTR8)value_text, value_strlen, 0, opts, md, NULL);
-            CACE_LOG_DEBUG("Matching pattern %s with value %s, result %d", regexp_text, value_text, res);
-            if (res > 0)
-            {
-                is_match = true;
-            }
-            pcre2_match_data_free(md);
-
-            pcre2_code_free(cfg);
+            is_match = cace_util_regex_match(cfg, value_text, value_strlen);
+            CACE_LOG_DEBUG("Matching pattern %s with value %s, result %d", regexp_text, value_text, is_match);
+            cace_util_regex_release(cfg);
         }
 #else  /* PCRE_FOUND */
         CACE_LOG_CRIT("Cannot evaluate oper match-regexp without PCRE");
@@ -6871,74 +7342,113 @@ static void refda_adm_ietf_dtnma_agent_oper_tbl_filter(refda_oper_eval_ctx_t *ct
         return;
     }
 
+    // Selection of matching row indices
+    tbl_filter_sel_t sel;
+    tbl_filter_sel_init(sel);
+
+    // Evaluate across all rows at once when the filter supports it
+    tbl_filter_prog_t prog;
+    tbl_filter_prog_init(prog);
+    bool vectorized = tbl_filter_compile(prog, ctx->evalctx->runctx->agent, row_match, tbl_data->ncols)
+                      && !tbl_filter_select_vector(sel, prog, tbl_data);
+    tbl_filter_prog_clear(prog);
+
+    if (vectorized)
+    {
+        atomic_fetch_add(&(ctx->evalctx->runctx->agent->instr.num_tbl_filter_vector), 1);
+    }
+    else
+    {
+        CACE_LOG_DEBUG("Filtering table by evaluating each row");
+        tbl_filter_sel_reset(sel);
+
+        const cace_ari_translator_t translator = { .map_ari = tbl_filter_sub_label };
+
+        // for each row of the table
+        for (cace_ari_int row_ix = 0; row_ix < (cace_ari_int)num_rows; row_ix++)
+        {
+            // Substitute row values for LABEL items within row filter EXPR
+            cace_ari_t eval_result = CACE_ARI_INIT_UNDEFINED;
+            // label substitution
+            _tbl_row_pair_t table_data = { tbl_data, row_ix };
+            // sub operand value for label
+            int res =
+                refda_eval_filter(ctx->evalctx->runctx, &eval_result, row_match, &translator, (void *)&table_data);
+            if (res)
+            {
+                cace_ari_deinit(&eval_result);
+                tbl_filter_sel_clear(sel);
+                // treat as a failure, not row omission
+                return;
+            }
+
+            // True result indicates row not filtered
+            if (cace_amm_ari_is_truthy(&eval_result))
+            {
+                tbl_filter_sel_push_back(sel, row_ix);
+            }
+            cace_ari_deinit(&eval_result);
+        }
+    }
+
     // Local variables for result
     cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
     // manipulate result as a table
     cace_ari_tbl_t *result_tbl = cace_ari_set_tbl(&result, NULL);
     cace_ari_tbl_reset(result_tbl, num_filter_cols, 0);
+    if (cace_ari_tbl_is_packed(tbl_data))
+    {
+        // result keeps the same form as the input
+        cace_ari_tbl_pack(result_tbl);
+    }
 
-    const cace_ari_translator_t translator = { .map_ari = tbl_filter_sub_label };
-
-    // for each row of the table
-    for (cace_ari_int row_ix = 0; row_ix < (cace_ari_int)num_rows; row_ix++)
+    // add data values from 'columns' of each selected row to result
+    tbl_filter_sel_it_t sel_it;
+    for (tbl_filter_sel_it(sel_it, sel); !tbl_filter_sel_end_p(sel_it); tbl_filter_sel_next(sel_it))
     {
-        // Substitute row values for LABEL items within row filter EXPR
-        cace_ari_t eval_result = CACE_ARI_INIT_UNDEFINED;
-        // label substitution
-        _tbl_row_pair_t table_data = { tbl_data, row_ix };
-        // sub operand value for label
-        int res = refda_eval_filter(ctx->evalctx->runctx, &eval_result, row_match, &translator, (void *)&table_data);
-        if (res)
-        {
-            cace_ari_deinit(&eval_result);
-            // treat as a failure, not row omission
-            return;
-        }
+        const size_t row_ix = *tbl_filter_sel_cref(sel_it);
+
+        // Copy current row into result set
+        cace_ari_array_t row;
+        cace_ari_array_init(row);
+        cace_ari_array_reserve(row, num_filter_cols);
 
-        // True result indicates row not filtered, add data values from 'columns' to result
-        bool is_match = cace_amm_ari_is_truthy(&eval_result);
-        cace_ari_deinit(&eval_result);
-        if (is_match)
+        cace_ari_list_it_t col_filter_it;
+        for (cace_ari_list_it(col_filter_it, columns_ac->items); !cace_ari_list_end_p(col_filter_it);
+             cace_ari_list_next(col_filter_it))
         {
-            // Copy current row into result set
-            cace_ari_array_t row;
-            cace_ari_array_init(row);
-            cace_ari_array_reserve(row, num_filter_cols);
+            const cace_ari_t *col_filter_item = cace_ari_list_cref(col_filter_it);
 
-            cace_ari_list_it_t col_filter_it;
-            for (cace_ari_list_it(col_filter_it, columns_ac->items); !cace_ari_list_end_p(col_filter_it);
-                 cace_ari_list_next(col_filter_it))
+            cace_ari_uvast col_filter_index;
+            int            res = cace_ari_get_uvast(col_filter_item, &col_filter_index);
+            if (res)
             {
-                const cace_ari_t *col_filter_item = cace_ari_list_cref(col_filter_it);
-
-                cace_ari_uvast col_filter_index;
-                res = cace_ari_get_uvast(col_filter_item, &col_filter_index);
-                if (res)
-                {
-                    CACE_LOG_WARNING("Column filter value is not an integer");
-                    cace_ari_deinit(&result);
-                    cace_ari_array_clear(row);
-                    return;
-                }
+                CACE_LOG_WARNING("Column filter value is not an integer");
+                cace_ari_deinit(&result);
+                cace_ari_array_clear(row);
+                tbl_filter_sel_clear(sel);
+                return;
+            }
 
-                if (col_filter_index >= tbl_data->ncols)
-                {
-                    CACE_LOG_WARNING("Invalid colum index %d, skipping", col_filter_index);
-                    cace_ari_deinit(&result);
-                    cace_ari_array_clear(row);
-                    return;
-                }
+            if (col_filter_index >= tbl_data->ncols)
+            {
+                CACE_LOG_WARNING("Invalid colum index %d, skipping", col_filter_index);
+                cace_ari_deinit(&result);
+                cace_ari_array_clear(row);
+                tbl_filter_sel_clear(sel);
+                return;
+            }
 
-                const size_t array_index = (row_ix * tbl_data->ncols) + col_filter_index;
-                // Get data from input TBL for the current column
-                const cace_ari_t *tbl_data_item = cace_ari_array_cget(tbl_data->items, array_index);
+            // Get data from input TBL for the current column
+            cace_ari_t        buf;
+            const cace_ari_t *tbl_data_item = cace_ari_tbl_cview(tbl_data, row_ix, col_filter_index, &buf);
 
-                // Copy data from input TBL to output TBL row
-                cace_ari_array_push_back(row, *tbl_data_item);
-            }
-            cace_ari_tbl_move_row_array(result_tbl, row);
+            // Copy data from input TBL to output TBL row
+            cace_ari_array_push_back(row, *tbl_data_item);
         }
+        cace_ari_tbl_move_row_array(result_tbl, row);
     }
+    tbl_filter_sel_clear(sel);
 
     refda_oper_eval_ctx_set_result_move(ctx, &result);
     /*
@@ -7010,8 +7520,9 @@ static void refda_adm_ietf_dtnma_agent_oper_tbl_get(refda_oper_eval_ctx_t *ctx)
         return;
     }
 
-    // cast is workaround for M*LIB interface type issue https://github.com/P-p-H-d/mlib/issues/151
-    const cace_ari_t *item = cace_ari_array_cget(in_tbl->items, row_uint * in_tbl->ncols + col_uint);
+    // a packed value is reconstructed without copying the table
+    cace_ari_t        buf;
+    const cace_ari_t *item = cace_ari_tbl_cview(in_tbl, row_uint, col_uint, &buf);
     refda_oper_eval_ctx_set_result_copy(ctx, item);
     /*
      * +-------------------------------------------------------------------------+
@@ -8381,6 +8892,8 @@ int refda_adm_ietf_dtnma_agent_init(refda_agent_t *agent)
             // no result type
             // callback:
             objdata->execute = refda_adm_ietf_dtnma_agent_ctrl_report_on;
+            // reports only read state
+            objdata->state_preserving = true;
 
             obj = refda_register_ctrl(
                 adm, cace_amm_idseg_ref_withenum("report-on", REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_CTRL_REPORT_ON),
@@ -11151,6 +11664,29 @@ int refda_adm_ietf_dtnma_agent_init(refda_agent_t *agent)
     }
 
     /*   START CUSTOM POST-INIT HERE */
+    if (adm)
+    {
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_MSG_RX,
+                                                   INSTR_GROUP_NUM_MSG_RX);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_MSG_RX_FAILED,
+                                                   INSTR_GROUP_NUM_MSG_RX_FAILED);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_MSG_TX,
+                                                   INSTR_GROUP_NUM_MSG_TX);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_MSG_TX_FAILED,
+                                                   INSTR_GROUP_NUM_MSG_TX_FAILED);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_LAST_MSG_RX_TIME,
+                                                   INSTR_GROUP_LAST_MSG_RX_TIME);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_EXEC_STARTED,
+                                                   INSTR_GROUP_NUM_EXEC_STARTED);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_EXEC_SUCCEEDED,
+                                                   INSTR_GROUP_NUM_EXEC_SUCCEEDED);
+        refda_adm_ietf_dtnma_agent_instr_group_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_EXEC_FAILED,
+                                                   INSTR_GROUP_NUM_EXEC_FAILED);
+
+        refda_adm_ietf_dtnma_agent_fixed_edd_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_SW_VENDOR);
+        refda_adm_ietf_dtnma_agent_fixed_edd_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_SW_VERSION);
+        refda_adm_ietf_dtnma_agent_cacheable_edds(adm);
+    }
     /*   STOP CUSTOM POST-INIT HERE  */
 
     CACE_MUTEX_UNLOCK(&agent->objs_mutex);
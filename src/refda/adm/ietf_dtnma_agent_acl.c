@@ -70,6 +70,36 @@ static void refda_acl_post_add_access(refda_acl_t *acl, refda_acl_access_t *acce
         refda_acl_access_ptr_set_push(*set, access);
     }
 }
+
+/** Mark an EDD which is produced only from the ACL state as being
+ * cacheable and having its changes signaled by
+ * refda_adm_ietf_dtnma_agent_acl_edd_changed().
+ */
+static void refda_adm_ietf_dtnma_agent_acl_state_edd_add(cace_amm_obj_ns_t *adm, cace_ari_int_id_t intenum)
+{
+    cace_amm_obj_desc_t *obj = cace_amm_obj_ns_find_obj_enum(adm, CACE_ARI_TYPE_EDD, intenum);
+    if (!obj)
+    {
+        CACE_LOG_ERR("missing ACL EDD %" PRId64, intenum);
+        return;
+    }
+    refda_amm_edd_desc_t *edd = obj->app_data.ptr;
+    edd->change_notify        = true;
+    edd->cacheable            = true;
+}
+
+/** Signal a change to the produced value of an EDD in this ADM from one
+ * of the CTRLs in this ADM.
+ */
+static void refda_adm_ietf_dtnma_agent_acl_edd_changed(refda_ctrl_exec_ctx_t *ctx, cace_ari_int_id_t intenum)
+{
+    cace_amm_obj_desc_t *obj = cace_amm_obj_ns_find_obj_enum(ctx->item->deref.ns, CACE_ARI_TYPE_EDD, intenum);
+    if (obj)
+    {
+        refda_amm_edd_desc_t *edd = obj->app_data.ptr;
+        refda_amm_modval_state_inc(&(edd->val_state));
+    }
+}
 /*   STOP CUSTOM FUNCTIONS HERE  */
 
 /*   START CALLBACK FUNCTIONS HERE */
@@ -364,6 +394,7 @@ static void refda_adm_ietf_dtnma_agent_acl_ctrl_ensure_access(refda_ctrl_exec_ct
     // still add it, just fail the execution
     refda_acl_post_add_access(&agent->acl, found);
     cace_get_system_time(&found->updated_at);
+    refda_adm_ietf_dtnma_agent_acl_edd_changed(ctx, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_ACCESS_LIST);
 
     if (!failure)
     {
@@ -430,6 +461,7 @@ static void refda_adm_ietf_dtnma_agent_acl_ctrl_discard_access(refda_ctrl_exec_c
         refda_acl_pre_remove_access(&agent->acl, found);
 
         refda_acl_access_list_remove(agent->acl.access, found_it);
+        refda_adm_ietf_dtnma_agent_acl_edd_changed(ctx, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_ACCESS_LIST);
     }
     refda_ctrl_exec_ctx_set_result_null(ctx);
 
@@ -536,6 +568,7 @@ static void refda_adm_ietf_dtnma_agent_acl_ctrl_ensure_group(refda_ctrl_exec_ctx
         success = true;
     }
     cace_get_system_time(&found_id->updated_at);
+    refda_adm_ietf_dtnma_agent_acl_edd_changed(ctx, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_GROUP_LIST);
 
     AGENT_ACL_UNLOCK(agent);
     if (success)
@@ -608,6 +641,7 @@ static void refda_adm_ietf_dtnma_agent_acl_ctrl_ensure_group_members(refda_ctrl_
         cace_ari_set_copy(&found_id->member_filter, p_memb);
 
         cace_get_system_time(&found_id->updated_at);
+        refda_adm_ietf_dtnma_agent_acl_edd_changed(ctx, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_GROUP_LIST);
         refda_ctrl_exec_ctx_set_result_null(ctx);
     }
 
@@ -671,6 +705,7 @@ static void refda_adm_ietf_dtnma_agent_acl_ctrl_discard_group(refda_ctrl_exec_ct
 
         // This group is no more
         refda_acl_access_by_group_erase(agent->acl.access_by_group, gid);
+        refda_adm_ietf_dtnma_agent_acl_edd_changed(ctx, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_GROUP_LIST);
     }
     refda_ctrl_exec_ctx_set_result_null(ctx);
 
@@ -1354,6 +1389,11 @@ int refda_adm_ietf_dtnma_agent_acl_init(refda_agent_t *agent)
     }
 
     /*   START CUSTOM POST-INIT HERE */
+    if (adm)
+    {
+        refda_adm_ietf_dtnma_agent_acl_state_edd_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_ACCESS_LIST);
+        refda_adm_ietf_dtnma_agent_acl_state_edd_add(adm, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_GROUP_LIST);
+    }
     /*   STOP CUSTOM POST-INIT HERE  */
 
     CACE_MUTEX_UNLOCK(&agent->objs_mutex);
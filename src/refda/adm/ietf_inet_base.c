@@ -39,11 +39,34 @@
 #include "cace/util/mutex.h"
 
 /*   START CUSTOM INCLUDES HERE */
-/*             TODO              */
+#include "refda/ip_vlsm.h"
 /*   STOP CUSTOM INCLUDES HERE  */
 
 /*   START CUSTOM FUNCTIONS HERE */
-/*             TODO              */
+/** Get the address from an ip-address value or from the first parameter
+ * of an ./IDENT/ip-endpoint or ./IDENT/ip-transport reference.
+ *
+ * @param[in] value The operand value.
+ * @return The address or NULL if not present.
+ */
+static const cace_data_t *refda_adm_ietf_inet_base_value_address(const cace_ari_t *value)
+{
+    const cace_ari_ref_t *ref = cace_ari_cget_ref(value);
+    if (!ref)
+    {
+        return cace_ari_cget_bstr(value);
+    }
+    if (ref->params.state != CACE_ARI_PARAMS_AC)
+    {
+        return NULL;
+    }
+    const cace_ari_ac_t *ac = ref->params.as_ac;
+    if (cace_ari_list_empty_p(ac->items))
+    {
+        return NULL;
+    }
+    return cace_ari_cget_bstr(cace_ari_list_front(ac->items));
+}
 /*   STOP CUSTOM FUNCTIONS HERE  */
 
 /*   START CALLBACK FUNCTIONS HERE */
@@ -77,6 +100,34 @@ static void refda_adm_ietf_inet_base_oper_match_ip_vlsm(refda_oper_eval_ctx_t *c
      * |START CUSTOM FUNCTION refda_adm_ietf_inet_base_oper_match_ip_vlsm BODY
      * +-------------------------------------------------------------------------+
      */
+    if (refda_oper_eval_ctx_has_aparam_undefined(ctx))
+    {
+        CACE_LOG_ERR("Invalid parameter, unable to continue");
+        return;
+    }
+    const cace_data_t *base = cace_ari_cget_bstr(refda_oper_eval_ctx_get_aparam_index(ctx, 0));
+    cace_ari_uint      prefix;
+    if (cace_ari_get_uint(refda_oper_eval_ctx_get_aparam_index(ctx, 1), &prefix))
+    {
+        CACE_LOG_ERR("Invalid prefix parameter, unable to continue");
+        return;
+    }
+
+    refda_ip_vlsm_t vlsm;
+    if (!base || refda_ip_vlsm_set(&vlsm, base, prefix))
+    {
+        CACE_LOG_ERR("Invalid VLSM parameters, unable to continue");
+        return;
+    }
+
+    const cace_ari_t  *value = refda_oper_eval_ctx_get_operand_index(ctx, 0);
+    const cace_data_t *addr  = refda_adm_ietf_inet_base_value_address(value);
+
+    bool is_match = addr && refda_ip_vlsm_match(&vlsm, addr);
+
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_bool(&result, is_match);
+    refda_oper_eval_ctx_set_result_move(ctx, &result);
     /*
      * +-------------------------------------------------------------------------+
      * |STOP CUSTOM FUNCTION refda_adm_ietf_inet_base_oper_match_ip_vlsm BODY
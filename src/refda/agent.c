@@ -69,6 +69,18 @@ void refda_agent_init(refda_agent_t *agent)
     pthread_mutex_init(&(agent->exec_state_mutex), NULL);
     refda_timeline_init(agent->exec_timeline);
     atomic_store(&agent->exec_end, false);
+    atomic_store(&agent->modval_changed, false);
+    agent->modval_notifier = (refda_amm_modval_notifier_t) {
+        .notify    = refda_agent_modval_notify,
+        .user_data = agent,
+    };
+    refda_sbr_ptr_list_init(agent->sbr_idle);
+    refda_prodcache_init(&(agent->prod_cache));
+    refda_rpt_delta_init(&(agent->rpt_delta));
+    refda_rpt_plan_cache_init(&(agent->rpt_plans));
+    refda_reporting_pending_list_init(agent->rpt_pending);
+    atomic_store(&agent->rpt_pending_changed, false);
+    agent->rpt_pending_timeout = (struct timespec) { .tv_sec = 1 };
 
     refda_msgdata_queue_init(agent->rptgs, AGENT_QUEUE_SIZE);
     sem_init(&(agent->rptgs_sem), 0, 0);
@@ -79,6 +91,21 @@ void refda_agent_deinit(refda_agent_t *agent)
     sem_destroy(&(agent->rptgs_sem));
     refda_msgdata_queue_clear(agent->rptgs);
 
+    {
+        refda_reporting_pending_list_it_t it;
+        for (refda_reporting_pending_list_it(it, agent->rpt_pending); !refda_reporting_pending_list_end_p(it);
+             refda_reporting_pending_list_next(it))
+        {
+            refda_reporting_pending_t *rpt = *refda_reporting_pending_list_ref(it);
+            refda_reporting_pending_deinit(rpt);
+            CACE_FREE(rpt);
+        }
+        refda_reporting_pending_list_clear(agent->rpt_pending);
+    }
+    refda_rpt_plan_cache_deinit(&(agent->rpt_plans));
+    refda_rpt_delta_deinit(&(agent->rpt_delta));
+    refda_prodcache_deinit(&(agent->prod_cache));
+    refda_sbr_ptr_list_clear(agent->sbr_idle);
     refda_timeline_clear(agent->exec_timeline);
     pthread_mutex_destroy(&(agent->exec_state_mutex));
     refda_exec_seq_list_clear(agent->exec_state);
@@ -103,6 +130,18 @@ void refda_agent_deinit(refda_agent_t *agent)
     m_string_clear(agent->agent_eid);
 }
 
+void refda_agent_modval_notify(refda_amm_modval_state_t *obj _U_, void *user_data)
+{
+    refda_agent_t *agent = user_data;
+    CHKVOID(agent);
+
+    // only wake the worker on the first change since it last checked
+    if (!atomic_exchange(&agent->modval_changed, true))
+    {
+        sem_post(&(agent->execs_sem));
+    }
+}
+
 /// Time of the DTN epoch (2000-01-01T00:00:00Z) in the POSIX clock
 #define DTN_EPOCH_IN_POSIX 946702800
 
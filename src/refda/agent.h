@@ -21,10 +21,15 @@
 
 #include "acl.h"
 #include "alarms.h"
+#include "amm/sbr.h"
 #include "exec_seq.h"
 #include "instr.h"
 #include "msgdata.h"
+#include "prodcache.h"
+#include "reporting_ctx.h"
 #include "rpt_agg.h"
+#include "rpt_delta.h"
+#include "rpt_plan.h"
 #include "timeline.h"
 
 #include "cace/amm/msg_if.h"
@@ -33,6 +38,7 @@
 #include "cace/util/daemon_run.h"
 #include "cace/util/threadset.h"
 
+#include <m-array.h>
 #include <m-buffer.h>
 #include <m-deque.h>
 
@@ -53,6 +59,13 @@ extern "C" {
 M_DEQUE_DEF(string_list, m_string_t, M_STRING_OPLIST)
 /// @endcond
 
+/** @struct refda_sbr_ptr_list_t
+ * Unordered list of non-owning SBR descriptor pointers.
+ */
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_sbr_ptr_list, refda_amm_sbr_desc_t *, M_PTR_OPLIST)
+/// @endcond
+
 /** State of a DTNMA Agent.
  */
 typedef struct refda_agent_s
@@ -115,6 +128,37 @@ typedef struct refda_agent_s
      * This is owned by the refda_exec_worker() thread.
      */
     atomic_bool exec_end;
+    /** Set by any change notification from a VAR or EDD which is an input
+     * to a rule condition, and cleared by the refda_exec_worker() thread.
+     */
+    atomic_bool modval_changed;
+    /** Notification target bound to every VAR or EDD state which is an
+     * input to a rule condition, using refda_agent_modval_notify().
+     */
+    refda_amm_modval_notifier_t modval_notifier;
+    /** Enabled SBRs waiting on a change of their condition inputs.
+     * This is owned by the refda_exec_worker() thread.
+     */
+    refda_sbr_ptr_list_t sbr_idle;
+    /** Production cache for each iteration of the exec worker.
+     * This is owned by the refda_exec_worker() thread.
+     */
+    refda_prodcache_t prod_cache;
+
+    /// Report-by-exception state for RPTT reporting
+    refda_rpt_delta_t rpt_delta;
+    /// Cache of compiled RPTT report plans
+    refda_rpt_plan_cache_t rpt_plans;
+    /** Reports waiting on deferred EDD productions.
+     * This is owned by the refda_exec_worker() thread.
+     */
+    refda_reporting_pending_list_t rpt_pending;
+    /** Set by the completion of any deferred EDD production, and cleared
+     * by the refda_exec_worker() thread.
+     */
+    atomic_bool rpt_pending_changed;
+    /// Longest time any report waits on its deferred EDD productions
+    struct timespec rpt_pending_timeout;
 
     /// Egress RPTSET queue
     refda_msgdata_queue_t rptgs;
@@ -129,6 +173,15 @@ void refda_agent_init(refda_agent_t *agent);
 
 void refda_agent_deinit(refda_agent_t *agent);
 
+/** Callback for refda_amm_modval_notifier_t::notify to indicate to the
+ * exec worker that a rule condition input has changed.
+ * This is safe to call from any thread.
+ *
+ * @param[in] obj The state which changed.
+ * @param[in] user_data The ::refda_agent_t being notified.
+ */
+void refda_agent_modval_notify(refda_amm_modval_state_t *obj, void *user_data);
+
 /** Store the current timestamp in an ARI.
  *
  * @param[in] agent The agent context.
@@ -20,7 +20,8 @@
 void refda_amm_ctrl_desc_init(refda_amm_ctrl_desc_t *obj)
 {
     cace_amm_type_init(&(obj->res_type));
-    obj->execute = NULL;
+    obj->execute          = NULL;
+    obj->state_preserving = false;
 }
 
 void refda_amm_ctrl_desc_deinit(refda_amm_ctrl_desc_t *obj)
@@ -46,6 +46,13 @@ typedef struct
      * @return Zero upon success, or any other value for failure.
      */
     void (*execute)(refda_ctrl_exec_ctx_t *ctx);
+
+    /** True if execution of this CTRL does not alter any state observable
+     * through EDD production.
+     * Otherwise, any EDD values cached during the current exec worker
+     * iteration are discarded after the execution.
+     */
+    bool state_preserving;
 } refda_amm_ctrl_desc_t;
 
 void refda_amm_ctrl_desc_init(refda_amm_ctrl_desc_t *obj);
@@ -20,11 +20,17 @@
 void refda_amm_edd_desc_init(refda_amm_edd_desc_t *obj)
 {
     cace_amm_type_init(&(obj->prod_type));
-    obj->produce = NULL;
+    obj->produce       = NULL;
+    obj->change_notify = false;
+    obj->cacheable     = false;
+    refda_amm_modval_state_init(&(obj->val_state));
+    obj->group       = NULL;
+    obj->group_index = 0;
 }
 
 void refda_amm_edd_desc_deinit(refda_amm_edd_desc_t *obj)
 {
+    refda_amm_modval_state_deinit(&(obj->val_state));
     obj->produce = NULL;
     cace_amm_type_deinit(&(obj->prod_type));
     // not necessary but helpful
@@ -18,6 +18,8 @@
 #ifndef REFDA_AMM_EDD_H_
 #define REFDA_AMM_EDD_H_
 
+#include "modval.h"
+
 #include "cace/amm/typing.h"
 
 #ifdef __cplusplus
@@ -27,6 +29,26 @@ extern "C" {
 // forward declaration for callback reference
 struct refda_edd_prod_ctx_s;
 typedef struct refda_edd_prod_ctx_s refda_edd_prod_ctx_t;
+struct refda_edd_group_prod_ctx_s;
+typedef struct refda_edd_group_prod_ctx_s refda_edd_group_prod_ctx_t;
+
+/// Largest number of members in a single EDD group
+#define REFDA_AMM_EDD_GROUP_MAX 16
+
+/** A group of EDDs which can be produced together from one consistent
+ * snapshot of their common source state.
+ * Members of a group must not have formal parameters.
+ */
+typedef struct
+{
+    /** Group production callback.
+     * This is called once for any number of requested members, and must set
+     * the result of each requested member.
+     *
+     * @param[in,out] ctx The group production context, including result storage.
+     */
+    void (*produce)(refda_edd_group_prod_ctx_t *ctx);
+} refda_amm_edd_group_t;
 
 /** An Externally Defined Data (EDD) descriptor.
  * This defines the properties of an EDD in an Agent and includes common
@@ -49,6 +71,33 @@ typedef struct
      */
     void (*produce)(refda_edd_prod_ctx_t *ctx);
 
+    /** True if the producer signals every change of its produced value
+     * by incrementing #val_state.
+     * When false, any evaluation using this EDD must be polled.
+     */
+    bool change_notify;
+
+    /** Change state of the produced value, used only if #change_notify is set.
+     */
+    refda_amm_modval_state_t val_state;
+
+    /** True if the produced value depends only on the agent state and the
+     * actual parameters, and not on the run context of the production.
+     * Only such values are reused from the production cache across
+     * different executions within a single exec worker iteration.
+     */
+    bool cacheable;
+
+    /** Optional group which can produce this EDD together with others.
+     * The #produce callback is still required for individual production.
+     */
+    const refda_amm_edd_group_t *group;
+
+    /** Index of this EDD within its #group, which is less than
+     * ::REFDA_AMM_EDD_GROUP_MAX.
+     */
+    size_t group_index;
+
 } refda_amm_edd_desc_t;
 
 void refda_amm_edd_desc_init(refda_amm_edd_desc_t *obj);
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "modval.h"
+#include <string.h>
+
+void refda_amm_modval_state_init(refda_amm_modval_state_t *obj)
+{
+    atomic_init(&(obj->_ctr), 0);
+    atomic_init(&(obj->_notifier), 0);
+}
+
+void refda_amm_modval_state_deinit(refda_amm_modval_state_t *obj)
+{
+    // no real cleanup
+    memset(obj, 0, sizeof(*obj));
+}
+
+void refda_amm_modval_state_set_notifier(refda_amm_modval_state_t *obj, const refda_amm_modval_notifier_t *notifier)
+{
+    atomic_store(&(obj->_notifier), (uintptr_t)notifier);
+}
+
+void refda_amm_modval_state_inc(refda_amm_modval_state_t *obj)
+{
+    atomic_fetch_add(&(obj->_ctr), 1);
+
+    const refda_amm_modval_notifier_t *notifier = (const refda_amm_modval_notifier_t *)atomic_load(&(obj->_notifier));
+    if (notifier && notifier->notify)
+    {
+        (notifier->notify)(obj, notifier->user_data);
+    }
+}
+
+uint64_t refda_amm_modval_state_get(const refda_amm_modval_state_t *obj)
+{
+    return atomic_load(&(obj->_ctr));
+}
+
+void refda_amm_modval_watch_init(refda_amm_modval_watch_t *obj)
+{
+    refda_amm_modval_seen_list_init(obj->items);
+    obj->must_poll = false;
+}
+
+void refda_amm_modval_watch_deinit(refda_amm_modval_watch_t *obj)
+{
+    refda_amm_modval_seen_list_clear(obj->items);
+}
+
+void refda_amm_modval_watch_reset(refda_amm_modval_watch_t *obj)
+{
+    refda_amm_modval_seen_list_reset(obj->items);
+    obj->must_poll = false;
+}
+
+void refda_amm_modval_watch_add(refda_amm_modval_watch_t *obj, refda_amm_modval_state_t *state)
+{
+    refda_amm_modval_seen_list_it_t it;
+    for (refda_amm_modval_seen_list_it(it, obj->items); !refda_amm_modval_seen_list_end_p(it);
+         refda_amm_modval_seen_list_next(it))
+    {
+        if (refda_amm_modval_seen_list_cref(it)->state == state)
+        {
+            return;
+        }
+    }
+
+    refda_amm_modval_seen_t item = {
+        .state = state,
+        .seen  = refda_amm_modval_state_get(state),
+    };
+    refda_amm_modval_seen_list_push_back(obj->items, item);
+}
+
+void refda_amm_modval_watch_mark(refda_amm_modval_watch_t *obj)
+{
+    refda_amm_modval_seen_list_it_t it;
+    for (refda_amm_modval_seen_list_it(it, obj->items); !refda_amm_modval_seen_list_end_p(it);
+         refda_amm_modval_seen_list_next(it))
+    {
+        refda_amm_modval_seen_t *item = refda_amm_modval_seen_list_ref(it);
+
+        item->seen = refda_amm_modval_state_get(item->state);
+    }
+}
+
+bool refda_amm_modval_watch_changed(const refda_amm_modval_watch_t *obj)
+{
+    if (obj->must_poll)
+    {
+        return true;
+    }
+
+    refda_amm_modval_seen_list_it_t it;
+    for (refda_amm_modval_seen_list_it(it, obj->items); !refda_amm_modval_seen_list_end_p(it);
+         refda_amm_modval_seen_list_next(it))
+    {
+        const refda_amm_modval_seen_t *item = refda_amm_modval_seen_list_cref(it);
+        if (refda_amm_modval_state_get(item->state) != item->seen)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef REFDA_AMM_MODVAL_H_
+#define REFDA_AMM_MODVAL_H_
+
+#include <m-array.h>
+#include <m-atomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct refda_amm_modval_state_s;
+
+/** A target of change notifications from any number of state counters.
+ * This must outlive all states which are bound to it.
+ */
+typedef struct
+{
+    /** A callback used when a bound state counter is incremented.
+     *
+     * @param obj The specific counter which changed.
+     * @param user_data A copy of the #user_data pointer.
+     */
+    void (*notify)(struct refda_amm_modval_state_s *obj, void *user_data);
+    /// Optional context data for the #notify callback
+    void *user_data;
+} refda_amm_modval_notifier_t;
+
+/** Modifiable value state counter.
+ * This is used by EDD and VAR objects.
+ */
+typedef struct refda_amm_modval_state_s
+{
+    /// The internal counter
+    atomic_ullong _ctr;
+
+    /** The bound ::refda_amm_modval_notifier_t pointer, or zero if none.
+     * This is accessed atomically so that binding can happen concurrently
+     * with increments from other threads.
+     */
+    atomic_uintptr_t _notifier;
+
+} refda_amm_modval_state_t;
+
+void refda_amm_modval_state_init(refda_amm_modval_state_t *obj);
+
+void refda_amm_modval_state_deinit(refda_amm_modval_state_t *obj);
+
+/** Bind a notification target to a state counter.
+ * This is safe to call from any thread.
+ *
+ * @param[in,out] obj The state to bind.
+ * @param[in] notifier The target to bind, or NULL to unbind.
+ */
+void refda_amm_modval_state_set_notifier(refda_amm_modval_state_t *obj, const refda_amm_modval_notifier_t *notifier);
+
+/** Increment the counter to the next value and signal to a bound notifier.
+ * This is safe to call from any thread.
+ */
+void refda_amm_modval_state_inc(refda_amm_modval_state_t *obj);
+
+/** Get the current counter value.
+ * This is safe to call from any thread.
+ */
+uint64_t refda_amm_modval_state_get(const refda_amm_modval_state_t *obj);
+
+/// A single watched state and the counter value last seen
+typedef struct
+{
+    /// The non-null watched state
+    refda_amm_modval_state_t *state;
+    /// Counter value as of the last refda_amm_modval_watch_mark()
+    uint64_t seen;
+} refda_amm_modval_seen_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_amm_modval_seen_list, refda_amm_modval_seen_t, M_POD_OPLIST)
+/// @endcond
+
+/** A set of modifiable value states which are all inputs to the same
+ * evaluation, used to determine if the evaluation needs to be repeated.
+ */
+typedef struct
+{
+    /// All unique watched states
+    refda_amm_modval_seen_list_t items;
+    /** True if the evaluation has some input which is not observable
+     * through a state counter, so the evaluation must be periodically polled.
+     */
+    bool must_poll;
+} refda_amm_modval_watch_t;
+
+void refda_amm_modval_watch_init(refda_amm_modval_watch_t *obj);
+
+void refda_amm_modval_watch_deinit(refda_amm_modval_watch_t *obj);
+
+/** Clear all watched states and the polling flag.
+ */
+void refda_amm_modval_watch_reset(refda_amm_modval_watch_t *obj);
+
+/** Add a state to the watch set, ignoring duplicates.
+ *
+ * @param[in,out] obj The watch set to add to.
+ * @param[in] state The state to watch, which must outlive the watch set.
+ */
+void refda_amm_modval_watch_add(refda_amm_modval_watch_t *obj, refda_amm_modval_state_t *state);
+
+/** Snapshot all current counter values as being seen.
+ */
+void refda_amm_modval_watch_mark(refda_amm_modval_watch_t *obj);
+
+/** Determine if any watched state has changed since the last
+ * refda_amm_modval_watch_mark().
+ *
+ * @return True if the watch requires polling or any counter has changed.
+ */
+bool refda_amm_modval_watch_changed(const refda_amm_modval_watch_t *obj);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_AMM_MODVAL_H_ */
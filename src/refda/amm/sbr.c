@@ -32,10 +32,15 @@ void refda_amm_sbr_desc_init(refda_amm_sbr_desc_t *obj)
     obj->init_enabled   = true;
     obj->enabled        = false;
     obj->exec_count     = 0;
+
+    refda_amm_modval_watch_init(&(obj->watch));
+    obj->idle      = false;
+    obj->next_eval = (struct timespec) { 0 };
 }
 
 void refda_amm_sbr_desc_deinit(refda_amm_sbr_desc_t *obj)
 {
+    refda_amm_modval_watch_deinit(&(obj->watch));
     cace_ari_deinit(&(obj->action));
     cace_ari_deinit(&(obj->condition));
     cace_ari_deinit(&(obj->min_interval));
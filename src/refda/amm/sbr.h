@@ -18,6 +18,8 @@
 #ifndef REFDA_AMM_SBR_H_
 #define REFDA_AMM_SBR_H_
 
+#include "modval.h"
+
 #include "cace/amm/typing.h"
 #include "cace/ari.h"
 #include "cace/util/defs.h"
@@ -68,6 +70,21 @@ typedef struct
      */
     cace_ari_uvast exec_count;
 
+    /** Inputs to the #condition which can signal their changes.
+     * This is compiled when the rule is enabled and is owned by the
+     * exec worker thread.
+     */
+    refda_amm_modval_watch_t watch;
+
+    /** True if the rule is not scheduled on the timeline and is instead
+     * waiting for a change of its #watch inputs.
+     */
+    bool idle;
+
+    /** Earliest time at which the rule is allowed to be evaluated again.
+     */
+    struct timespec next_eval;
+
 } refda_amm_sbr_desc_t;
 
 void refda_amm_sbr_desc_init(refda_amm_sbr_desc_t *obj);
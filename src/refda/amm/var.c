@@ -22,10 +22,12 @@ void refda_amm_var_desc_init(refda_amm_var_desc_t *obj)
     cace_amm_type_init(&(obj->val_type));
     obj->value    = CACE_ARI_INIT_UNDEFINED;
     obj->init_val = CACE_ARI_INIT_UNDEFINED;
+    refda_amm_modval_state_init(&(obj->val_state));
 }
 
 void refda_amm_var_desc_deinit(refda_amm_var_desc_t *obj)
 {
+    refda_amm_modval_state_deinit(&(obj->val_state));
     cace_ari_deinit(&(obj->init_val));
     cace_ari_deinit(&(obj->value));
     cace_amm_type_deinit(&(obj->val_type));
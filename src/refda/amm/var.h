@@ -18,6 +18,8 @@
 #ifndef REFDA_AMM_VAR_H_
 #define REFDA_AMM_VAR_H_
 
+#include "modval.h"
+
 #include "cace/amm/typing.h"
 #include "cace/ari.h"
 
@@ -50,6 +52,11 @@ typedef struct
      */
     cace_ari_t init_val;
 
+    /** Change state of #value.
+     * This is incremented whenever the value is stored or reset.
+     */
+    refda_amm_modval_state_t val_state;
+
 } refda_amm_var_desc_t;
 
 void refda_amm_var_desc_init(refda_amm_var_desc_t *obj);
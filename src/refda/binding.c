@@ -30,6 +30,7 @@
 #include "cace/amm/lookup.h"
 #include "cace/amm/parameters.h"
 #include "cace/amm/semtype.h"
+#include "cace/amm/type_prog.h"
 #include "cace/ari.h"
 #include "cace/ari/text.h"
 #include "cace/util/defs.h"
@@ -110,6 +111,8 @@ const cace_amm_type_t *refda_binding_type_from_name(const cace_ari_t *name, cons
     return found;
 }
 
+static int refda_binding_typeobj_tree(const refda_binding_ctx_t *ctx, cace_amm_type_t *typeobj);
+
 static int refda_binding_semtype_use(const refda_binding_ctx_t *ctx, cace_amm_semtype_use_t *semtype)
 {
     // do not rebind
@@ -125,7 +128,7 @@ static int refda_binding_semtype_use(const refda_binding_ctx_t *ctx, cace_amm_se
 
 static int refda_binding_semtype_ulist(const refda_binding_ctx_t *ctx, cace_amm_semtype_ulist_t *semtype)
 {
-    return refda_binding_typeobj(ctx, &(semtype->item_type));
+    return refda_binding_typeobj_tree(ctx, &(semtype->item_type));
 }
 
 static int refda_binding_semtype_dlist(const refda_binding_ctx_t *ctx, cace_amm_semtype_dlist_t *semtype)
@@ -137,7 +140,7 @@ static int refda_binding_semtype_dlist(const refda_binding_ctx_t *ctx, cace_amm_
     {
         cace_amm_type_t *typeobj = cace_amm_type_array_ref(it);
 
-        failcnt += refda_binding_typeobj(ctx, typeobj);
+        failcnt += refda_binding_typeobj_tree(ctx, typeobj);
     }
     return failcnt;
 }
@@ -145,8 +148,8 @@ static int refda_binding_semtype_dlist(const refda_binding_ctx_t *ctx, cace_amm_
 static int refda_binding_semtype_umap(const refda_binding_ctx_t *ctx, cace_amm_semtype_umap_t *semtype)
 {
     int failcnt = 0;
-    failcnt += refda_binding_typeobj(ctx, &(semtype->key_type));
-    failcnt += refda_binding_typeobj(ctx, &(semtype->val_type));
+    failcnt += refda_binding_typeobj_tree(ctx, &(semtype->key_type));
+    failcnt += refda_binding_typeobj_tree(ctx, &(semtype->val_type));
     return failcnt;
 }
 
@@ -160,7 +163,7 @@ static int refda_binding_semtype_tblt(const refda_binding_ctx_t *ctx, cace_amm_s
     {
         cace_amm_named_type_t *col = cace_amm_named_type_array_ref(it);
 
-        failcnt += refda_binding_typeobj(ctx, &(col->typeobj));
+        failcnt += refda_binding_typeobj_tree(ctx, &(col->typeobj));
     }
     return failcnt;
 }
@@ -174,17 +177,18 @@ static int refda_binding_semtype_union(const refda_binding_ctx_t *ctx, cace_amm_
     {
         cace_amm_type_t *choice = cace_amm_type_array_ref(it);
 
-        failcnt += refda_binding_typeobj(ctx, choice);
+        failcnt += refda_binding_typeobj_tree(ctx, choice);
     }
     return failcnt;
 }
 
 static int refda_binding_semtype_seq(const refda_binding_ctx_t *ctx, cace_amm_semtype_seq_t *semtype)
 {
-    return refda_binding_typeobj(ctx, &(semtype->item_type));
+    return refda_binding_typeobj_tree(ctx, &(semtype->item_type));
 }
 
-int refda_binding_typeobj(const refda_binding_ctx_t *ctx, cace_amm_type_t *typeobj)
+/// Bind a type object and all of its owned sub-types
+static int refda_binding_typeobj_tree(const refda_binding_ctx_t *ctx, cace_amm_type_t *typeobj)
 {
     switch (typeobj->type_class)
     {
@@ -211,12 +215,26 @@ int refda_binding_typeobj(const refda_binding_ctx_t *ctx, cace_amm_type_t *typeo
     }
 }
 
-static int refda_binding_fparams(const refda_binding_ctx_t *ctx, cace_amm_formal_param_list_t fparams)
+int refda_binding_typeobj(const refda_binding_ctx_t *ctx, cace_amm_type_t *typeobj)
+{
+    int failcnt = refda_binding_typeobj_tree(ctx, typeobj);
+    if (!failcnt)
+    {
+        // type is now stable, so cache its compiled matcher
+        if (cace_amm_type_compile(typeobj))
+        {
+            CACE_LOG_WARNING("Failed to compile bound type, using dynamic matching");
+        }
+    }
+    return failcnt;
+}
+
+static int refda_binding_fparams(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj)
 {
     int failcnt = 0;
 
     cace_amm_formal_param_list_it_t fit;
-    for (cace_amm_formal_param_list_it(fit, fparams); !cace_amm_formal_param_list_end_p(fit);
+    for (cace_amm_formal_param_list_it(fit, obj->fparams); !cace_amm_formal_param_list_end_p(fit);
          cace_amm_formal_param_list_next(fit))
     {
         cace_amm_formal_param_t *fparam = cace_amm_formal_param_list_ref(fit);
@@ -224,6 +242,9 @@ static int refda_binding_fparams(const refda_binding_ctx_t *ctx, cace_amm_formal
         failcnt += refda_binding_typeobj(ctx, &(fparam->typeobj));
     }
 
+    // any earlier normalized parameters used the unbound types
+    cace_amm_actual_param_cache_reset(&(obj->aparam_cache));
+
     return failcnt;
 }
 
@@ -304,7 +325,7 @@ int refda_binding_ident(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj
     CHKERR1(desc);
 
     int failcnt = 0;
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     failcnt += refda_binding_ident_bases(ctx, obj, desc);
     return failcnt;
 }
@@ -329,7 +350,7 @@ int refda_binding_const(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj
     CHKERR1(desc);
 
     int failcnt = 0;
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     return failcnt;
 }
 
@@ -342,7 +363,7 @@ int refda_binding_var(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj)
 
     int failcnt = 0;
     failcnt += refda_binding_typeobj(ctx, &(desc->val_type));
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     return failcnt;
 }
 
@@ -355,7 +376,7 @@ int refda_binding_edd(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj)
 
     int failcnt = 0;
     failcnt += refda_binding_typeobj(ctx, &(desc->prod_type));
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     return failcnt;
 }
 
@@ -372,7 +393,7 @@ int refda_binding_ctrl(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj)
         // optional
         failcnt += refda_binding_typeobj(ctx, &(desc->res_type));
     }
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     return failcnt;
 }
 
@@ -394,7 +415,7 @@ int refda_binding_oper(const refda_binding_ctx_t *ctx, cace_amm_obj_desc_t *obj)
         failcnt += refda_binding_typeobj(ctx, &(operand->typeobj));
     }
     failcnt += refda_binding_typeobj(ctx, &(desc->res_type));
-    failcnt += refda_binding_fparams(ctx, obj->fparams);
+    failcnt += refda_binding_fparams(ctx, obj);
     return failcnt;
 }
 
@@ -44,6 +44,8 @@ typedef struct
 } refda_binding_ctx_t;
 
 /** Perform a type binding on a semantic type object.
+ * After a successful binding the type is also compiled with
+ * cace_amm_type_compile().
  *
  * @param[in] ctx The context for the object.
  * @param[in,out] typeobj The object to bind.
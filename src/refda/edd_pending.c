@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "edd_pending.h"
+
+#include "cace/util/defs.h"
+#include "cace/util/mutex.h"
+
+void refda_edd_pending_init(refda_edd_pending_t *obj)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    obj->agent = NULL;
+    obj->edd   = NULL;
+    obj->done  = false;
+    cace_ari_init(&(obj->value));
+}
+
+void refda_edd_pending_deinit(refda_edd_pending_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_deinit(&(obj->value));
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+bool refda_edd_pending_is_done(refda_edd_pending_t *obj)
+{
+    CHKFALSE(obj);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    const bool done = obj->done;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return done;
+}
+
+bool refda_edd_pending_take(refda_edd_pending_t *obj, cace_ari_t *value)
+{
+    CHKFALSE(obj);
+    CHKFALSE(value);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    const bool done = obj->done;
+    if (done)
+    {
+        cace_ari_set_move(value, &(obj->value));
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return done;
+}
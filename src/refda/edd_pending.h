@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Shared state for an EDD production which completes after its producer
+ * callback has returned.
+ */
+#ifndef REFDA_EDD_PENDING_H_
+#define REFDA_EDD_PENDING_H_
+
+#include "amm/edd.h"
+
+#include "cace/ari.h"
+
+#include <m-shared-ptr.h>
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// forward declaration for the agent to wake
+struct refda_agent_s;
+
+/** A deferred EDD production, shared between the producer which will
+ * complete it and the consumer which will use its result.
+ * All state other than the mutex is accessed only while it is locked.
+ */
+typedef struct
+{
+    /// Mutex for the state of this production
+    pthread_mutex_t mutex;
+    /// Agent which is woken upon completion
+    struct refda_agent_s *agent;
+    /// The EDD being produced, used to check the result type
+    const refda_amm_edd_desc_t *edd;
+    /// True after the producer has completed the production
+    bool done;
+    /// The produced value, which is undefined if production failed
+    cace_ari_t value;
+} refda_edd_pending_t;
+
+void refda_edd_pending_init(refda_edd_pending_t *obj);
+
+void refda_edd_pending_deinit(refda_edd_pending_t *obj);
+
+/** Determine if the production has been completed.
+ *
+ * @param[in] obj The production to check.
+ * @return True if completed, successfully or not.
+ */
+bool refda_edd_pending_is_done(refda_edd_pending_t *obj);
+
+/** Move the produced value out of a completed production.
+ *
+ * @param[in,out] obj The production to take from.
+ * @param[out] value The value to move into, which is left unchanged if
+ * the production has not been completed.
+ * @return True if the production was completed.
+ */
+bool refda_edd_pending_take(refda_edd_pending_t *obj, cace_ari_t *value);
+
+/// M*LIB OPLIST for refda_edd_pending_t
+#define M_OPL_refda_edd_pending_t() \
+    (INIT(API_2(refda_edd_pending_init)), INIT_SET(0), CLEAR(API_2(refda_edd_pending_deinit)), SET(0))
+
+/** @struct refda_edd_pending_ptr_t
+ * Thread-safe shared pointer to a deferred production.
+ */
+/// @cond Doxygen_Suppress
+M_SHARED_PTR_DEF(refda_edd_pending_ptr, refda_edd_pending_t)
+/// @endcond
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_EDD_PENDING_H_ */
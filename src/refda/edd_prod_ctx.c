@@ -20,6 +20,7 @@
 #include "cace/ari/text.h"
 #include "cace/util/defs.h"
 #include "cace/util/logging.h"
+#include "cace/util/mutex.h"
 
 void refda_edd_prod_ctx_init(refda_edd_prod_ctx_t *obj, const refda_amm_edd_desc_t *edd, refda_valprod_ctx_t *prodctx)
 {
@@ -77,6 +78,13 @@ static int refda_edd_prod_check_result(refda_edd_prod_ctx_t *ctx)
         m_string_clear(buf);
     }
 
+    const cace_ari_tbl_t *tbl = cace_ari_cget_tbl(&(ctx->prodctx->value));
+    if (tbl && !cace_ari_tbl_is_packed(tbl) && (cace_ari_tbl_num_rows(tbl) >= CACE_ARI_TBL_PACK_MIN_ROWS))
+    {
+        // large tables are matched and reported from columnar form
+        cace_ari_tbl_pack(cace_ari_get_tbl(&(ctx->prodctx->value)));
+    }
+
     bool valid = (CACE_AMM_TYPE_MATCH_POSITIVE == cace_amm_type_match(&(ctx->edd->prod_type), &(ctx->prodctx->value)));
     if (!valid)
     {
@@ -109,3 +117,115 @@ int refda_edd_prod_ctx_set_result_copy(refda_edd_prod_ctx_t *ctx, const cace_ari
     cace_ari_set_copy(&(ctx->prodctx->value), value);
     return refda_edd_prod_check_result(ctx);
 }
+
+refda_edd_pending_ptr_t *refda_edd_prod_ctx_defer(refda_edd_prod_ctx_t *ctx)
+{
+    CHKNULL(ctx);
+    refda_valprod_ctx_t *prodctx = ctx->prodctx;
+    if (!prodctx->allow_defer || prodctx->pending)
+    {
+        return NULL;
+    }
+
+    prodctx->pending             = refda_edd_pending_ptr_new();
+    refda_edd_pending_t *pending = refda_edd_pending_ptr_ref(prodctx->pending);
+    pending->agent               = prodctx->runctx->agent;
+    pending->edd                 = ctx->edd;
+
+    return refda_edd_pending_ptr_acquire(prodctx->pending);
+}
+
+int refda_edd_prod_ctx_complete_move(refda_edd_pending_ptr_t *pending, cace_ari_t *value)
+{
+    CHKERR1(pending);
+    refda_edd_pending_t *obj = refda_edd_pending_ptr_ref(pending);
+
+    int retval = 0;
+    if (value && (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(&(obj->edd->prod_type), value)))
+    {
+        CACE_LOG_ERR("EDD deferred production type failed to match the value");
+        retval = REFDA_EDD_PROD_RESULT_TYPE_NOMATCH;
+    }
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (value && !retval)
+    {
+        cace_ari_set_move(&(obj->value), value);
+    }
+    obj->done = true;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    refda_agent_t *agent = obj->agent;
+    refda_edd_pending_ptr_clear(pending);
+
+    atomic_store(&(agent->rpt_pending_changed), true);
+    sem_post(&(agent->execs_sem));
+
+    return retval;
+}
+
+void refda_edd_group_prod_ctx_init(refda_edd_group_prod_ctx_t *obj, const refda_amm_edd_group_t *group,
+                                   refda_runctx_t *runctx)
+{
+    CHKVOID(obj);
+
+    obj->runctx = runctx;
+    obj->group  = group;
+    for (size_t ix = 0; ix < REFDA_AMM_EDD_GROUP_MAX; ++ix)
+    {
+        obj->members[ix] = NULL;
+        cace_ari_init(&(obj->values[ix]));
+    }
+}
+
+void refda_edd_group_prod_ctx_deinit(refda_edd_group_prod_ctx_t *obj)
+{
+    CHKVOID(obj);
+    for (size_t ix = 0; ix < REFDA_AMM_EDD_GROUP_MAX; ++ix)
+    {
+        cace_ari_deinit(&(obj->values[ix]));
+    }
+    memset(obj, 0, sizeof(refda_edd_group_prod_ctx_t));
+}
+
+int refda_edd_group_prod_ctx_request(refda_edd_group_prod_ctx_t *obj, const refda_amm_edd_desc_t *edd)
+{
+    CHKERR1(obj);
+    CHKERR1(edd);
+    CHKERR1(edd->group == obj->group);
+    CHKERR1(edd->group_index < REFDA_AMM_EDD_GROUP_MAX);
+
+    obj->members[edd->group_index] = edd;
+    return 0;
+}
+
+bool refda_edd_group_prod_ctx_is_requested(const refda_edd_group_prod_ctx_t *ctx, size_t index)
+{
+    CHKFALSE(ctx);
+    CHKFALSE(index < REFDA_AMM_EDD_GROUP_MAX);
+    return ctx->members[index] != NULL;
+}
+
+int refda_edd_group_prod_ctx_set_result_move(refda_edd_group_prod_ctx_t *ctx, size_t index, cace_ari_t *value)
+{
+    CHKERR1(ctx);
+    CHKERR1(value);
+    CHKERR1(index < REFDA_AMM_EDD_GROUP_MAX);
+
+    const refda_amm_edd_desc_t *edd = ctx->members[index];
+    if (!edd)
+    {
+        // not requested
+        return 0;
+    }
+
+    if (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(&(edd->prod_type), value))
+    {
+        CACE_LOG_ERR("EDD group member %zu produced type failed to match its value", index);
+        cace_ari_set_undefined(&(ctx->values[index]));
+        return REFDA_EDD_PROD_RESULT_TYPE_NOMATCH;
+    }
+
+    cace_ari_set_move(&(ctx->values[index]), value);
+    return 0;
+}
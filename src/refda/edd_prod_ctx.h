@@ -89,6 +89,89 @@ int refda_edd_prod_ctx_set_result_copy(refda_edd_prod_ctx_t *ctx, const cace_ari
 /// @overload
 int refda_edd_prod_ctx_set_result_move(refda_edd_prod_ctx_t *ctx, cace_ari_t *value);
 
+/** Defer the result of this production until after the producer callback
+ * returns, so that a slow producer does not block the agent.
+ * The result must later be given by refda_edd_prod_ctx_complete_move()
+ * from any thread, and before the agent is deinitialized.
+ *
+ * @param[in,out] ctx The context to defer.
+ * @return A new shared pointer owned by the producer, or NULL if the
+ * consumer of this production needs an immediate result, in which case the
+ * producer must set its result before returning.
+ */
+refda_edd_pending_ptr_t *refda_edd_prod_ctx_defer(refda_edd_prod_ctx_t *ctx);
+
+/** Complete a deferred production and wake the agent to use its result.
+ *
+ * @param[in] pending The pointer from refda_edd_prod_ctx_defer(), which is
+ * released by this function.
+ * @param[in,out] value The value to move from as the production result,
+ * or NULL to indicate a failed production.
+ * @return Zero if successful and the value has a matching type.
+ * Otherwise REFDA_EDD_PROD_RESULT_TYPE_NOMATCH.
+ */
+int refda_edd_prod_ctx_complete_move(refda_edd_pending_ptr_t *pending, cace_ari_t *value);
+
+/** Context for producing several members of an EDD group together.
+ */
+typedef struct refda_edd_group_prod_ctx_s
+{
+    /** Parent running context.
+     * This will never be null.
+     */
+    refda_runctx_t *runctx;
+
+    /** The group being produced from.
+     * This will never be null.
+     */
+    const refda_amm_edd_group_t *group;
+
+    /// Requested member descriptors by group index, null for members not requested
+    const refda_amm_edd_desc_t *members[REFDA_AMM_EDD_GROUP_MAX];
+
+    /// Storage for produced values by group index, left undefined for failed productions
+    cace_ari_t values[REFDA_AMM_EDD_GROUP_MAX];
+
+} refda_edd_group_prod_ctx_t;
+
+/** Initialize a group context with no members requested.
+ *
+ * @param[out] obj The context to initialize.
+ * @param[in] group The group to produce from.
+ * @param[in] runctx The parent running context.
+ */
+void refda_edd_group_prod_ctx_init(refda_edd_group_prod_ctx_t *obj, const refda_amm_edd_group_t *group,
+                                   refda_runctx_t *runctx);
+
+void refda_edd_group_prod_ctx_deinit(refda_edd_group_prod_ctx_t *obj);
+
+/** Request production of one member of the group.
+ *
+ * @param[in,out] obj The context to update.
+ * @param[in] edd The member EDD descriptor.
+ * @return Zero if successful and the EDD is a member of this group.
+ */
+int refda_edd_group_prod_ctx_request(refda_edd_group_prod_ctx_t *obj, const refda_amm_edd_desc_t *edd);
+
+/** Determine if a member of the group was requested.
+ *
+ * @param[in] ctx The production context.
+ * @param[in] index The group index of the member.
+ * @return True if the member needs a result.
+ */
+bool refda_edd_group_prod_ctx_is_requested(const refda_edd_group_prod_ctx_t *ctx, size_t index);
+
+/** Set the result for one member of a group production.
+ * Results for members which were not requested are ignored.
+ *
+ * @param[in,out] ctx The context to update.
+ * @param[in] index The group index of the member.
+ * @param[in,out] value The value to move from as the member result.
+ * @return Zero if successful and the value has a matching type.
+ * Otherwise REFDA_EDD_PROD_RESULT_TYPE_NOMATCH.
+ */
+int refda_edd_group_prod_ctx_set_result_move(refda_edd_group_prod_ctx_t *ctx, size_t index, cace_ari_t *value);
+
 #ifdef __cplusplus
 } // extern C
 #endif
@@ -46,6 +46,16 @@ void *refda_egress_worker(void *arg)
             cace_ari_list_t data;
             cace_ari_list_init(data);
 
+#if AGENT_EXEC_TRACE
+            // value is moved before sending
+            cace_ari_t nonce = CACE_ARI_INIT_UNDEFINED;
+            const cace_ari_rptset_t *rptset = cace_ari_cget_rptset(&(item.value));
+            if (rptset)
+            {
+                cace_ari_set_copy(&nonce, &(rptset->nonce));
+            }
+#endif /* AGENT_EXEC_TRACE */
+
             cace_amm_msg_if_metadata_t meta;
             cace_amm_msg_if_metadata_init(&meta);
             cace_ari_set_move(&meta.dest, &item.ident);
@@ -57,6 +67,13 @@ void *refda_egress_worker(void *arg)
                 CACE_LOG_WARNING("Got mif.send result=%d", send_res);
                 atomic_fetch_add(&agent->instr.num_rptset_sent_failure, 1);
             }
+#if AGENT_EXEC_TRACE
+            else
+            {
+                REFDA_TRACE_MARK(agent, &nonce, REFDA_TRACE_SEND, NULL);
+            }
+            cace_ari_deinit(&nonce);
+#endif /* AGENT_EXEC_TRACE */
 
             cace_ari_list_clear(data);
             cace_amm_msg_if_metadata_deinit(&meta);
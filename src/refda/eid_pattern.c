@@ -0,0 +1,749 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "eid_pattern.h"
+
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+
+#include <m-string.h>
+#include <qcbor/qcbor_spiffy_decode.h>
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+/// Mask for the node number within a fully-qualified node number
+#define REFDA_EID_IPN_NODE_MASK UINT64_C(0xFFFFFFFF)
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_eid_pattern_intvl_list, cace_util_range_intvl_uint64_t, M_POD_OPLIST)
+/// @endcond
+
+/// Initialize ::cache once
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+/// Patterns in the cache, keyed by encoded pattern
+static cace_util_refcache_t cache;
+
+/** An EID decoded from either CBOR or text form, referencing the
+ * original encoded data.
+ */
+typedef struct
+{
+    /// The scheme number
+    uint64_t scheme;
+    /// For "ipn" EIDs, true if the allocator is separate from the node number
+    bool ipn_has_alloc;
+    /// For "ipn" EIDs, the allocator (if present), node, and service numbers
+    uint64_t ipn[3];
+    /// For "dtn" EIDs, true if this is the null endpoint
+    bool dtn_none;
+    /// For "dtn" EIDs, the SSP text
+    const char *dtn_ssp;
+    /// Length of #dtn_ssp
+    size_t dtn_len;
+} refda_eid_pattern_eid_t;
+
+static void refda_eid_pattern_ipn_part_init(refda_eid_pattern_ipn_part_t *obj)
+{
+    obj->any = false;
+    cace_util_range_uint64_init(obj->values);
+}
+
+static void refda_eid_pattern_ipn_part_deinit(refda_eid_pattern_ipn_part_t *obj)
+{
+    cace_util_range_uint64_clear(obj->values);
+}
+
+static bool refda_eid_pattern_ipn_part_match(const refda_eid_pattern_ipn_part_t *obj, uint64_t val)
+{
+    return obj->any || cace_util_range_uint64_contains(obj->values, val);
+}
+
+void refda_eid_pattern_item_init(refda_eid_pattern_item_t *obj)
+{
+    CHKVOID(obj);
+    obj->scheme        = 0;
+    obj->any_ssp       = false;
+    obj->ipn_has_alloc = false;
+    for (size_t ix = 0; ix < 3; ++ix)
+    {
+        refda_eid_pattern_ipn_part_init(&(obj->ipn_parts[ix]));
+    }
+    obj->dtn_none = false;
+#if PCRE_FOUND
+    obj->dtn_glob = NULL;
+#endif /* PCRE_FOUND */
+}
+
+void refda_eid_pattern_item_deinit(refda_eid_pattern_item_t *obj)
+{
+    CHKVOID(obj);
+#if PCRE_FOUND
+    cace_util_regex_release(obj->dtn_glob);
+    obj->dtn_glob = NULL;
+#endif /* PCRE_FOUND */
+    for (size_t ix = 0; ix < 3; ++ix)
+    {
+        refda_eid_pattern_ipn_part_deinit(&(obj->ipn_parts[ix]));
+    }
+}
+
+void refda_eid_pattern_init(refda_eid_pattern_t *obj)
+{
+    CHKVOID(obj);
+    obj->any = false;
+    refda_eid_pattern_item_list_init(obj->items);
+    obj->entry = (cace_util_refcache_entry_t) { 0 };
+}
+
+void refda_eid_pattern_deinit(refda_eid_pattern_t *obj)
+{
+    CHKVOID(obj);
+    refda_eid_pattern_item_list_clear(obj->items);
+    obj->any = false;
+}
+
+/** Peek at the next item within an entered array.
+ *
+ * @return Zero if an item is present, 1 if at the end of the array,
+ * or 2 if the CBOR is not well-formed.
+ */
+static int refda_eid_pattern_peek(QCBORDecodeContext *dec, QCBORItem *item)
+{
+    QCBORDecode_VPeekNext(dec, item);
+    int dec_res = QCBORDecode_GetError(dec);
+    if (dec_res == QCBOR_ERR_NO_MORE_ITEMS)
+    {
+        QCBORDecode_GetAndResetError(dec);
+        return 1;
+    }
+    return dec_res ? 2 : 0;
+}
+
+static int refda_eid_pattern_intvl_cmp(const void *lt, const void *rt)
+{
+    const cace_util_range_intvl_uint64_t *lt_intvl = lt;
+    const cace_util_range_intvl_uint64_t *rt_intvl = rt;
+    return M_CMP_DEFAULT(lt_intvl->i_min, rt_intvl->i_min);
+}
+
+/** Merge overlapping and adjacent intervals so that the range lookup
+ * needs to examine only one interval.
+ */
+static void refda_eid_pattern_ipn_part_set(refda_eid_pattern_ipn_part_t *part, refda_eid_pattern_intvl_list_t intvls)
+{
+    const size_t count = refda_eid_pattern_intvl_list_size(intvls);
+    qsort(refda_eid_pattern_intvl_list_get(intvls, 0), count, sizeof(cace_util_range_intvl_uint64_t),
+          refda_eid_pattern_intvl_cmp);
+
+    cace_util_range_intvl_uint64_t cur = *refda_eid_pattern_intvl_list_cget(intvls, 0);
+    for (size_t ix = 1; ix < count; ++ix)
+    {
+        const cace_util_range_intvl_uint64_t *next = refda_eid_pattern_intvl_list_cget(intvls, ix);
+        if ((cur.i_max == UINT64_MAX) || (next->i_min <= cur.i_max + 1))
+        {
+            cur.i_max = M_MAX(cur.i_max, next->i_max);
+        }
+        else
+        {
+            cace_util_range_uint64_push(part->values, cur);
+            cur = *next;
+        }
+    }
+    cace_util_range_uint64_push(part->values, cur);
+}
+
+static int refda_eid_pattern_decode_ipn_part(QCBORDecodeContext *dec, refda_eid_pattern_ipn_part_t *part)
+{
+    QCBORItem item;
+    if (refda_eid_pattern_peek(dec, &item))
+    {
+        return 2;
+    }
+    if (item.uDataType == QCBOR_TYPE_TRUE)
+    {
+        QCBORDecode_VGetNext(dec, &item);
+        part->any = true;
+        return 0;
+    }
+    if (item.uDataType != QCBOR_TYPE_ARRAY)
+    {
+        return 3;
+    }
+
+    refda_eid_pattern_intvl_list_t intvls;
+    refda_eid_pattern_intvl_list_init(intvls);
+
+    int retval = 0;
+    QCBORDecode_EnterArray(dec, NULL);
+    while (!retval)
+    {
+        int peek_res = refda_eid_pattern_peek(dec, &item);
+        if (peek_res == 1)
+        {
+            break;
+        }
+        else if (peek_res)
+        {
+            retval = 2;
+            break;
+        }
+
+        cace_util_range_intvl_uint64_t intvl;
+        uint64_t                       first = 0;
+        uint64_t                       last  = 0;
+        if (item.uDataType == QCBOR_TYPE_ARRAY)
+        {
+            QCBORDecode_EnterArray(dec, NULL);
+            QCBORDecode_GetUInt64(dec, &first);
+            QCBORDecode_GetUInt64(dec, &last);
+            QCBORDecode_ExitArray(dec);
+        }
+        else
+        {
+            QCBORDecode_GetUInt64(dec, &first);
+            last = first;
+        }
+        if (QCBORDecode_GetError(dec))
+        {
+            retval = 2;
+        }
+        else if (first > last)
+        {
+            retval = 3;
+        }
+        else
+        {
+            cace_util_range_intvl_uint64_set_finite(&intvl, first, last);
+            refda_eid_pattern_intvl_list_push_back(intvls, intvl);
+        }
+    }
+    QCBORDecode_ExitArray(dec);
+
+    if (!retval)
+    {
+        if (refda_eid_pattern_intvl_list_empty_p(intvls))
+        {
+            // nothing would match
+            retval = 3;
+        }
+        else
+        {
+            refda_eid_pattern_ipn_part_set(part, intvls);
+        }
+    }
+    refda_eid_pattern_intvl_list_clear(intvls);
+    return retval;
+}
+
+static int refda_eid_pattern_decode_ipn(QCBORDecodeContext *dec, refda_eid_pattern_item_t *obj)
+{
+    QCBORItem arr;
+    QCBORDecode_EnterArray(dec, &arr);
+    if (QCBORDecode_GetError(dec))
+    {
+        return 2;
+    }
+
+    int retval = 0;
+    switch (arr.val.uCount)
+    {
+        case 2:
+            obj->ipn_has_alloc    = false;
+            obj->ipn_parts[0].any = true;
+            retval                = refda_eid_pattern_decode_ipn_part(dec, &(obj->ipn_parts[1]));
+            break;
+        case 3:
+            obj->ipn_has_alloc = true;
+            retval             = refda_eid_pattern_decode_ipn_part(dec, &(obj->ipn_parts[0]));
+            if (!retval)
+            {
+                retval = refda_eid_pattern_decode_ipn_part(dec, &(obj->ipn_parts[1]));
+            }
+            break;
+        default:
+            retval = 3;
+            break;
+    }
+    if (!retval)
+    {
+        retval = refda_eid_pattern_decode_ipn_part(dec, &(obj->ipn_parts[2]));
+    }
+    QCBORDecode_ExitArray(dec);
+    return retval;
+}
+
+#if PCRE_FOUND
+/** Translate a glob into an anchored regular expression.
+ */
+static void refda_eid_pattern_glob_regex(m_string_t out, const char *glob, size_t len)
+{
+    m_string_reset(out);
+    for (size_t ix = 0; ix < len; ++ix)
+    {
+        const char chr = glob[ix];
+        if (chr == '*')
+        {
+            if ((ix + 1 < len) && (glob[ix + 1] == '*'))
+            {
+                m_string_cat_cstr(out, ".*");
+                ++ix;
+            }
+            else
+            {
+                m_string_cat_cstr(out, "[^/]*");
+            }
+            continue;
+        }
+        if (chr && strchr(".^$|()[]{}+?\\", chr))
+        {
+            m_string_push_back(out, '\\');
+        }
+        m_string_push_back(out, chr);
+    }
+}
+#endif /* PCRE_FOUND */
+
+static int refda_eid_pattern_decode_dtn(QCBORDecodeContext *dec, refda_eid_pattern_item_t *obj)
+{
+    QCBORItem item;
+    QCBORDecode_VGetNext(dec, &item);
+    if (QCBORDecode_GetError(dec))
+    {
+        return 2;
+    }
+
+    if ((item.uDataType == QCBOR_TYPE_INT64) && (item.val.int64 == 0))
+    {
+        obj->dtn_none = true;
+        return 0;
+    }
+    if (item.uDataType != QCBOR_TYPE_TEXT_STRING)
+    {
+        return 3;
+    }
+#if PCRE_FOUND
+    m_string_t regex;
+    m_string_init(regex);
+    refda_eid_pattern_glob_regex(regex, item.val.string.ptr, item.val.string.len);
+    obj->dtn_glob = cace_util_regex_acquire(m_string_get_cstr(regex), m_string_size(regex));
+    m_string_clear(regex);
+    return obj->dtn_glob ? 0 : 3;
+#else  /* PCRE_FOUND */
+    CACE_LOG_ERR("Cannot compile dtn EID pattern without PCRE");
+    return 4;
+#endif /* PCRE_FOUND */
+}
+
+static int refda_eid_pattern_decode_item(QCBORDecodeContext *dec, refda_eid_pattern_item_t *obj)
+{
+    QCBORDecode_EnterArray(dec, NULL);
+    QCBORDecode_GetUInt64(dec, &(obj->scheme));
+
+    QCBORItem item;
+    if (refda_eid_pattern_peek(dec, &item))
+    {
+        return 2;
+    }
+
+    int retval = 0;
+    if (item.uDataType == QCBOR_TYPE_TRUE)
+    {
+        QCBORDecode_VGetNext(dec, &item);
+        obj->any_ssp = true;
+    }
+    else
+    {
+        switch (obj->scheme)
+        {
+            case REFDA_EID_SCHEME_IPN:
+                retval = refda_eid_pattern_decode_ipn(dec, obj);
+                break;
+            case REFDA_EID_SCHEME_DTN:
+                retval = refda_eid_pattern_decode_dtn(dec, obj);
+                break;
+            default:
+                CACE_LOG_WARNING("EID pattern for scheme %" PRIu64 " is not supported", obj->scheme);
+                retval = 4;
+                break;
+        }
+    }
+    QCBORDecode_ExitArray(dec);
+    if (!retval && QCBORDecode_GetError(dec))
+    {
+        retval = 2;
+    }
+    return retval;
+}
+
+int refda_eid_pattern_decode(refda_eid_pattern_t *obj, const cace_data_t *buf)
+{
+    CHKERR1(obj);
+    CHKERR1(buf);
+    refda_eid_pattern_item_list_reset(obj->items);
+    obj->any = false;
+
+    QCBORDecodeContext dec;
+    QCBORDecode_Init(&dec, (UsefulBufC) { buf->ptr, buf->len }, QCBOR_DECODE_MODE_NORMAL);
+
+    QCBORItem item;
+    QCBORDecode_VPeekNext(&dec, &item);
+    if (QCBORDecode_GetError(&dec))
+    {
+        return 2;
+    }
+
+    int retval = 0;
+    if (item.uDataType == QCBOR_TYPE_TRUE)
+    {
+        QCBORDecode_VGetNext(&dec, &item);
+        obj->any = true;
+    }
+    else if (item.uDataType == QCBOR_TYPE_ARRAY)
+    {
+        QCBORDecode_EnterArray(&dec, NULL);
+        while (!retval)
+        {
+            int peek_res = refda_eid_pattern_peek(&dec, &item);
+            if (peek_res == 1)
+            {
+                break;
+            }
+            else if (peek_res)
+            {
+                retval = 2;
+                break;
+            }
+
+            refda_eid_pattern_item_t *pitem = refda_eid_pattern_item_list_push_new(obj->items);
+            retval                          = refda_eid_pattern_decode_item(&dec, pitem);
+        }
+        QCBORDecode_ExitArray(&dec);
+    }
+    else
+    {
+        retval = 3;
+    }
+
+    if (!retval && (QCBORDecode_Finish(&dec) != QCBOR_SUCCESS))
+    {
+        retval = 2;
+    }
+    if (retval)
+    {
+        refda_eid_pattern_item_list_reset(obj->items);
+        obj->any = false;
+    }
+    return retval;
+}
+
+static bool refda_eid_pattern_match_item(const refda_eid_pattern_item_t *item, const refda_eid_pattern_eid_t *eid)
+{
+    if (item->scheme != eid->scheme)
+    {
+        return false;
+    }
+    if (item->any_ssp)
+    {
+        return true;
+    }
+
+    switch (eid->scheme)
+    {
+        case REFDA_EID_SCHEME_IPN:
+        {
+            uint64_t node;
+            if (item->ipn_has_alloc)
+            {
+                uint64_t alloc = eid->ipn_has_alloc ? eid->ipn[0] : (eid->ipn[1] >> 32);
+                node           = eid->ipn_has_alloc ? eid->ipn[1] : (eid->ipn[1] & REFDA_EID_IPN_NODE_MASK);
+                if (!refda_eid_pattern_ipn_part_match(&(item->ipn_parts[0]), alloc))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                // fully-qualified node number
+                node = eid->ipn_has_alloc ? ((eid->ipn[0] << 32) | eid->ipn[1]) : eid->ipn[1];
+            }
+            return refda_eid_pattern_ipn_part_match(&(item->ipn_parts[1]), node)
+                   && refda_eid_pattern_ipn_part_match(&(item->ipn_parts[2]), eid->ipn[2]);
+        }
+        case REFDA_EID_SCHEME_DTN:
+            if (item->dtn_none || eid->dtn_none)
+            {
+                return item->dtn_none && eid->dtn_none;
+            }
+#if PCRE_FOUND
+            return cace_util_regex_match(item->dtn_glob, eid->dtn_ssp, eid->dtn_len);
+#else  /* PCRE_FOUND */
+            return false;
+#endif /* PCRE_FOUND */
+        default:
+            return false;
+    }
+}
+
+static bool refda_eid_pattern_match_eid(const refda_eid_pattern_t *obj, const refda_eid_pattern_eid_t *eid)
+{
+    if ((eid->scheme == REFDA_EID_SCHEME_IPN) && eid->ipn_has_alloc
+        && ((eid->ipn[0] > REFDA_EID_IPN_NODE_MASK) || (eid->ipn[1] > REFDA_EID_IPN_NODE_MASK)))
+    {
+        // three-element form has 32-bit allocator and node numbers, larger values would alias other nodes
+        return false;
+    }
+
+    refda_eid_pattern_item_list_it_t it;
+    for (refda_eid_pattern_item_list_it(it, obj->items); !refda_eid_pattern_item_list_end_p(it);
+         refda_eid_pattern_item_list_next(it))
+    {
+        if (refda_eid_pattern_match_item(refda_eid_pattern_item_list_cref(it), eid))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool refda_eid_pattern_match_cbor(const refda_eid_pattern_t *obj, const cace_data_t *eid)
+{
+    CHKFALSE(obj);
+    CHKFALSE(eid);
+    if (obj->any)
+    {
+        return true;
+    }
+
+    QCBORDecodeContext dec;
+    QCBORDecode_Init(&dec, (UsefulBufC) { eid->ptr, eid->len }, QCBOR_DECODE_MODE_NORMAL);
+
+    refda_eid_pattern_eid_t val = { 0 };
+    QCBORDecode_EnterArray(&dec, NULL);
+    QCBORDecode_GetUInt64(&dec, &(val.scheme));
+    switch (val.scheme)
+    {
+        case REFDA_EID_SCHEME_IPN:
+        {
+            QCBORItem arr;
+            QCBORDecode_EnterArray(&dec, &arr);
+            if (QCBORDecode_GetError(&dec) || (arr.val.uCount < 2) || (arr.val.uCount > 3))
+            {
+                return false;
+            }
+            if (arr.val.uCount == 3)
+            {
+                val.ipn_has_alloc = true;
+                QCBORDecode_GetUInt64(&dec, &(val.ipn[0]));
+            }
+            QCBORDecode_GetUInt64(&dec, &(val.ipn[1]));
+            QCBORDecode_GetUInt64(&dec, &(val.ipn[2]));
+            QCBORDecode_ExitArray(&dec);
+            break;
+        }
+        case REFDA_EID_SCHEME_DTN:
+        {
+            QCBORItem item;
+            QCBORDecode_VGetNext(&dec, &item);
+            if (item.uDataType == QCBOR_TYPE_TEXT_STRING)
+            {
+                val.dtn_ssp = item.val.string.ptr;
+                val.dtn_len = item.val.string.len;
+            }
+            else if ((item.uDataType == QCBOR_TYPE_INT64) && (item.val.int64 == 0))
+            {
+                val.dtn_none = true;
+            }
+            else
+            {
+                return false;
+            }
+            break;
+        }
+        default:
+        {
+            // any SSP is allowed
+            QCBORItem item;
+            QCBORDecode_VGetNextConsume(&dec, &item);
+            break;
+        }
+    }
+    QCBORDecode_ExitArray(&dec);
+    if (QCBORDecode_Finish(&dec) != QCBOR_SUCCESS)
+    {
+        return false;
+    }
+
+    return refda_eid_pattern_match_eid(obj, &val);
+}
+
+/** Parse a decimal number within text.
+ *
+ * @param[in,out] curs The start of the number, updated to just past it.
+ * @param end The end of the text.
+ * @param[out] val The number.
+ * @return True if a number was present without overflow.
+ */
+static bool refda_eid_pattern_parse_uint(const char **curs, const char *end, uint64_t *val)
+{
+    const char *start = *curs;
+    uint64_t    accum = 0;
+    while ((*curs < end) && (**curs >= '0') && (**curs <= '9'))
+    {
+        const uint64_t digit = (uint64_t)(**curs - '0');
+        if (accum > (UINT64_MAX - digit) / 10)
+        {
+            return false;
+        }
+        accum = accum * 10 + digit;
+        ++(*curs);
+    }
+    *val = accum;
+    return *curs > start;
+}
+
+bool refda_eid_pattern_match_text(const refda_eid_pattern_t *obj, const char *eid, size_t len)
+{
+    CHKFALSE(obj);
+    CHKFALSE(eid);
+    if (obj->any)
+    {
+        return true;
+    }
+
+    refda_eid_pattern_eid_t val = { 0 };
+    const char             *end = eid + len;
+    if ((len > 4) && (strncasecmp(eid, "ipn:", 4) == 0))
+    {
+        val.scheme = REFDA_EID_SCHEME_IPN;
+
+        uint64_t    nums[3];
+        size_t      count = 0;
+        const char *curs  = eid + 4;
+        while (true)
+        {
+            if ((count == 3) || !refda_eid_pattern_parse_uint(&curs, end, &(nums[count])))
+            {
+                return false;
+            }
+            ++count;
+            if (curs == end)
+            {
+                break;
+            }
+            if (*curs != '.')
+            {
+                return false;
+            }
+            ++curs;
+        }
+        switch (count)
+        {
+            case 2:
+                val.ipn[1] = nums[0];
+                val.ipn[2] = nums[1];
+                break;
+            case 3:
+                val.ipn_has_alloc = true;
+                val.ipn[0]        = nums[0];
+                val.ipn[1]        = nums[1];
+                val.ipn[2]        = nums[2];
+                break;
+            default:
+                return false;
+        }
+    }
+    else if ((len > 4) && (strncasecmp(eid, "dtn:", 4) == 0))
+    {
+        val.scheme = REFDA_EID_SCHEME_DTN;
+        if ((len == 8) && (strncasecmp(eid + 4, "none", 4) == 0))
+        {
+            val.dtn_none = true;
+        }
+        else
+        {
+            val.dtn_ssp = eid + 4;
+            val.dtn_len = len - 4;
+        }
+    }
+    else
+    {
+        // unknown scheme names can only be matched by any-EID
+        return false;
+    }
+
+    return refda_eid_pattern_match_eid(obj, &val);
+}
+
+static void refda_eid_pattern_free(cace_util_refcache_entry_t *entry)
+{
+    refda_eid_pattern_t *obj = (refda_eid_pattern_t *)entry;
+    refda_eid_pattern_deinit(obj);
+    CACE_FREE(obj);
+}
+
+static void refda_eid_pattern_cache_init(void)
+{
+    cace_util_refcache_init(&cache, REFDA_EID_PATTERN_CACHE_SIZE, refda_eid_pattern_free);
+}
+
+refda_eid_pattern_t *refda_eid_pattern_acquire(const cace_data_t *buf)
+{
+    CHKNULL(buf);
+    pthread_once(&cache_once, refda_eid_pattern_cache_init);
+
+    refda_eid_pattern_t *obj = (refda_eid_pattern_t *)cace_util_refcache_get(&cache, buf);
+    if (obj)
+    {
+        return obj;
+    }
+
+    // compile without holding the lock
+    obj = CACE_MALLOC(sizeof(refda_eid_pattern_t));
+    if (!obj)
+    {
+        return NULL;
+    }
+    refda_eid_pattern_init(obj);
+    int res = refda_eid_pattern_decode(obj, buf);
+    if (res)
+    {
+        CACE_LOG_ERR("Failed to decode EID pattern, error %d", res);
+        refda_eid_pattern_free(&(obj->entry));
+        return NULL;
+    }
+
+    return (refda_eid_pattern_t *)cace_util_refcache_put(&cache, buf, &(obj->entry));
+}
+
+void refda_eid_pattern_release(refda_eid_pattern_t *obj)
+{
+    if (!obj)
+    {
+        return;
+    }
+    cace_util_refcache_release(&cache, &(obj->entry));
+}
+
+void refda_eid_pattern_cache_clear(void)
+{
+    pthread_once(&cache_once, refda_eid_pattern_cache_init);
+    cace_util_refcache_clear(&cache);
+}
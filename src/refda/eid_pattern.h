@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Compiled Bundle Protocol endpoint ID (EID) patterns.
+ *
+ * A pattern is decoded from its CBOR form once into per-scheme items,
+ * where each part of an "ipn" EID is matched against an ordered set of
+ * intervals and "dtn" EIDs are matched against a compiled expression.
+ * The CBOR form of a pattern follows the EID pattern draft and is:
+ * @verbatim
+eid-pattern = any-eid / [* scheme-pattern]
+any-eid = true
+scheme-pattern = [scheme: uint, ssp: any-ssp / ipn-ssp / dtn-ssp]
+any-ssp = true
+ipn-ssp = [node: ipn-part, service: ipn-part] /
+          [allocator: ipn-part, node: ipn-part, service: ipn-part]
+ipn-part = true / [+ (single: uint / [first: uint, last: uint])]
+dtn-ssp = 0 / glob: tstr
+@endverbatim
+ * A two-part "ipn" pattern matches the fully-qualified node number, which
+ * combines the allocator and node numbers of a three-part EID.
+ * A "dtn" glob matches the whole SSP, where "*" matches within a single
+ * path segment and "**" matches across segments.
+ */
+#ifndef REFDA_EID_PATTERN_H_
+#define REFDA_EID_PATTERN_H_
+
+#include "cace/cace_data.h"
+#include "cace/config.h"
+#include "cace/util/range.h"
+#include "cace/util/refcache.h"
+#if PCRE_FOUND
+#include "cace/util/regex.h"
+#endif /* PCRE_FOUND */
+
+#include <m-array.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Scheme number for "dtn" EIDs
+#define REFDA_EID_SCHEME_DTN 1
+/// Scheme number for "ipn" EIDs
+#define REFDA_EID_SCHEME_IPN 2
+
+#ifndef REFDA_EID_PATTERN_CACHE_SIZE
+/** Maximum number of patterns held by the process-wide cache.
+ * Patterns evicted from the cache remain valid until they are released.
+ */
+#define REFDA_EID_PATTERN_CACHE_SIZE 64
+#endif /* REFDA_EID_PATTERN_CACHE_SIZE */
+
+/** Pattern for one numeric part of an "ipn" EID.
+ */
+typedef struct
+{
+    /// True if any value matches, in which case #values is empty
+    bool any;
+    /// Ordered and non-overlapping intervals of matching values
+    cace_util_range_uint64_t values;
+} refda_eid_pattern_ipn_part_t;
+
+/** Pattern for all EIDs of a single scheme.
+ */
+typedef struct
+{
+    /// The scheme number of matching EIDs
+    uint64_t scheme;
+    /// True if any SSP of this scheme matches
+    bool any_ssp;
+    /// For "ipn" patterns, true if an allocator part is present
+    bool ipn_has_alloc;
+    /// For "ipn" patterns, the allocator, node, and service parts in that order
+    refda_eid_pattern_ipn_part_t ipn_parts[3];
+    /// For "dtn" patterns, true if the pattern is for the null endpoint
+    bool dtn_none;
+#if PCRE_FOUND
+    /// For "dtn" patterns, the compiled glob if not #dtn_none
+    cace_util_regex_t *dtn_glob;
+#endif /* PCRE_FOUND */
+} refda_eid_pattern_item_t;
+
+void refda_eid_pattern_item_init(refda_eid_pattern_item_t *obj);
+
+void refda_eid_pattern_item_deinit(refda_eid_pattern_item_t *obj);
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_eid_pattern_item_list, refda_eid_pattern_item_t,
+            (INIT(API_2(refda_eid_pattern_item_init)), CLEAR(API_2(refda_eid_pattern_item_deinit)), INIT_SET(0),
+             SET(0)))
+/// @endcond
+
+/** A compiled EID pattern.
+ */
+typedef struct refda_eid_pattern_s
+{
+    /// Cache state, which must be first
+    cace_util_refcache_entry_t entry;
+    /// True if any EID matches, in which case #items is empty
+    bool any;
+    /// Items for specific schemes, where any one matching is sufficient
+    refda_eid_pattern_item_list_t items;
+} refda_eid_pattern_t;
+
+void refda_eid_pattern_init(refda_eid_pattern_t *obj);
+
+void refda_eid_pattern_deinit(refda_eid_pattern_t *obj);
+
+/** Decode and compile a pattern from its CBOR form.
+ *
+ * @param[out] obj The pattern to replace.
+ * @param[in] buf The encoded pattern.
+ * @return Zero if successful.
+ * Non-zero values indicate a decoding failure (2), an invalid pattern (3),
+ * or a scheme-specific pattern which is not supported (4).
+ */
+int refda_eid_pattern_decode(refda_eid_pattern_t *obj, const cace_data_t *buf);
+
+/** Determine if an EID in its CBOR form matches a pattern.
+ *
+ * @param[in] obj The pattern to match with.
+ * @param[in] eid The encoded EID.
+ * @return True if the EID is well-formed and it matches.
+ */
+bool refda_eid_pattern_match_cbor(const refda_eid_pattern_t *obj, const cace_data_t *eid);
+
+/** Determine if an EID in its text URI form matches a pattern.
+ *
+ * @param[in] obj The pattern to match with.
+ * @param[in] eid The EID text, which need not be null-terminated.
+ * @param len The length of the EID text.
+ * @return True if the EID is well-formed and it matches.
+ */
+bool refda_eid_pattern_match_text(const refda_eid_pattern_t *obj, const char *eid, size_t len);
+
+/** Get a compiled pattern from the process-wide cache, compiling it
+ * if necessary.
+ *
+ * @param[in] buf The encoded pattern.
+ * @return A new reference to the compiled pattern, which must be released
+ * with refda_eid_pattern_release(), or NULL if the pattern is not valid.
+ */
+refda_eid_pattern_t *refda_eid_pattern_acquire(const cace_data_t *buf);
+
+/** Release a reference from refda_eid_pattern_acquire().
+ *
+ * @param[in] obj The pattern to release, which may be NULL.
+ */
+void refda_eid_pattern_release(refda_eid_pattern_t *obj);
+
+/** Remove all patterns from the cache.
+ * Patterns still referenced by a user remain valid until they are released.
+ */
+void refda_eid_pattern_cache_clear(void);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_EID_PATTERN_H_ */
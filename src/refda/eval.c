@@ -19,7 +19,9 @@
 
 #include "adm/ietf.h"
 #include "adm/ietf_dtnma_agent.h"
+#include "amm/edd.h"
 #include "amm/oper.h"
+#include "amm/var.h"
 #include "oper_eval_ctx.h"
 #include "valprod.h"
 
@@ -31,6 +33,28 @@
 
 /** Expand a reference to a literal value matching SIMPLE or EXPR typedef
  */
+/** Expand a single value-producing object reference by producing its value.
+ */
+static int refda_eval_expand_prod(refda_runctx_t *runctx, refda_eval_item_t out, const cace_ari_t *in,
+                                  const cace_amm_lookup_t *deref)
+{
+    refda_valprod_ctx_t prodctx;
+    refda_valprod_ctx_init(&prodctx, runctx, in, deref);
+    int retval = refda_valprod_run(&prodctx);
+    if (!retval)
+    {
+        // push the produced value as a target
+        refda_eval_item_move_value(out, prodctx.value);
+        cace_ari_init(&prodctx.value);
+    }
+    else
+    {
+        retval = REFDA_EVAL_ERR_PROD_FAILED;
+    }
+    refda_valprod_ctx_deinit(&prodctx);
+    return retval;
+}
+
 static int refda_eval_expand_item(refda_runctx_t *runctx, refda_eval_item_t out, const cace_ari_t *in)
 {
     int retval = 0;
@@ -53,24 +77,9 @@ static int refda_eval_expand_item(refda_runctx_t *runctx, refda_eval_item_t out,
                 case CACE_ARI_TYPE_CONST:
                 case CACE_ARI_TYPE_VAR:
                 case CACE_ARI_TYPE_EDD:
-                {
-                    refda_valprod_ctx_t prodctx;
-                    refda_valprod_ctx_init(&prodctx, runctx, in, &deref);
-                    retval = refda_valprod_run(&prodctx);
-                    if (!retval)
-                    {
-                        // push the produced value as a target
-                        refda_eval_item_move_value(out, prodctx.value);
-                        cace_ari_init(&prodctx.value);
-                    }
-                    else
-                    {
-                        retval = REFDA_EVAL_ERR_PROD_FAILED;
-                    }
-                    refda_valprod_ctx_deinit(&prodctx);
+                    retval = refda_eval_expand_prod(runctx, out, in, &deref);
                     cace_amm_lookup_deinit(&deref);
                     break;
-                }
                 case CACE_ARI_TYPE_OPER:
                     // leave these references in place
                     refda_eval_item_move_deref(out, deref);
@@ -117,7 +126,10 @@ int refda_eval_oper(refda_eval_ctx_t *ctx, const cace_amm_lookup_t *deref)
                        cace_ari_array_size(operctx.operands.ordered), m_string_get_cstr(buf));
         m_string_clear(buf);
     }
+    struct timespec start;
+    REFDA_LATENCY_START(&start);
     (desc->evaluate)(&operctx);
+    REFDA_LATENCY_RECORD(ctx->runctx->agent, REFDA_LATENCY_OPER, deref, &start);
     if (cace_log_is_enabled_for(LOG_DEBUG))
     {
         m_string_t buf;
@@ -192,6 +204,90 @@ int refda_eval_expand_expr(refda_eval_ctx_t *ctx, const cace_ari_t *expr)
     return retval;
 }
 
+int refda_eval_compile_expr(refda_eval_program_t prog, refda_agent_t *agent, const cace_ari_t *expr)
+{
+    CHKERR1(agent);
+    CHKERR1(expr);
+
+    const cace_ari_ac_t *ac = cace_ari_cget_ac(expr);
+    if (!ac)
+    {
+        CACE_LOG_WARNING("compiling given non-AC value");
+        return REFDA_EVAL_ERR_BAD_TYPE;
+    }
+
+    refda_eval_program_reset(prog);
+    refda_eval_program_reserve(prog, cace_ari_list_size(ac->items));
+
+    cace_ari_list_it_t it;
+    for (cace_ari_list_it(it, ac->items); !cace_ari_list_end_p(it); cace_ari_list_next(it))
+    {
+        const cace_ari_t  *in_item = cace_ari_list_cref(it);
+        refda_eval_term_t *term    = refda_eval_program_push_new(prog);
+        cace_ari_set_copy(&(term->item), in_item);
+        if (!in_item->is_ref)
+        {
+            continue;
+        }
+
+        int res = cace_amm_lookup_deref(&(term->deref), &(agent->objs), in_item);
+        if (res)
+        {
+            CACE_LOG_DEBUG("Lookup result %d", res);
+            return REFDA_EVAL_ERR_DEREF_FAILED;
+        }
+        switch (term->deref.obj_type)
+        {
+            case CACE_ARI_TYPE_CONST:
+            case CACE_ARI_TYPE_VAR:
+            case CACE_ARI_TYPE_EDD:
+            case CACE_ARI_TYPE_OPER:
+                break;
+            default:
+                return REFDA_EVAL_ERR_BAD_TYPE;
+        }
+    }
+    return 0;
+}
+
+int refda_eval_expand_program(refda_eval_ctx_t *ctx, const refda_eval_program_t prog)
+{
+    CHKERR1(ctx);
+
+    int retval = 0;
+
+    refda_eval_program_it_t it;
+    for (refda_eval_program_it(it, prog); !refda_eval_program_end_p(it) && !retval; refda_eval_program_next(it))
+    {
+        const refda_eval_term_t *term     = refda_eval_program_cref(it);
+        refda_eval_item_t       *exp_item = refda_eval_list_push_back_new(ctx->input);
+
+        if (!term->deref.obj)
+        {
+            // any literal is used directly
+            refda_eval_item_set_value(*exp_item, term->item);
+            continue;
+        }
+
+        switch (term->deref.obj_type)
+        {
+            case CACE_ARI_TYPE_CONST:
+            case CACE_ARI_TYPE_VAR:
+            case CACE_ARI_TYPE_EDD:
+                retval = refda_eval_expand_prod(ctx->runctx, *exp_item, &(term->item), &(term->deref));
+                break;
+            case CACE_ARI_TYPE_OPER:
+                refda_eval_item_set_deref(*exp_item, term->deref);
+                break;
+            default:
+                retval = REFDA_EVAL_ERR_BAD_TYPE;
+                break;
+        }
+    }
+    CACE_LOG_DEBUG("evaluation expansion results in %zu items", refda_eval_list_size(ctx->input));
+    return retval;
+}
+
 int refda_eval_reduce(refda_eval_ctx_t *ctx, cace_ari_t *result)
 {
     int retval = 0;
@@ -294,6 +390,94 @@ int refda_eval_expand_target(refda_eval_ctx_t *ctx, const cace_ari_t *target)
     return retval;
 }
 
+/** Add a single expression item to a watch set.
+ */
+static void refda_eval_watch_item(refda_agent_t *agent, refda_amm_modval_watch_t *watch, const cace_ari_t *in)
+{
+    if (!in->is_ref)
+    {
+        // literals never change
+        return;
+    }
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+
+    refda_amm_modval_state_t *state = NULL;
+
+    int res = cace_amm_lookup_deref(&deref, &(agent->objs), in);
+    if (res)
+    {
+        // the object may be defined later
+        watch->must_poll = true;
+    }
+    else
+    {
+        switch (deref.obj_type)
+        {
+            case CACE_ARI_TYPE_CONST:
+            case CACE_ARI_TYPE_OPER:
+                // values are fixed or derived from other items
+                break;
+            case CACE_ARI_TYPE_VAR:
+            {
+                refda_amm_var_desc_t *desc = deref.obj->app_data.ptr;
+                state                      = &(desc->val_state);
+                break;
+            }
+            case CACE_ARI_TYPE_EDD:
+            {
+                refda_amm_edd_desc_t *desc = deref.obj->app_data.ptr;
+                if (desc->change_notify)
+                {
+                    state = &(desc->val_state);
+                }
+                else
+                {
+                    watch->must_poll = true;
+                }
+                break;
+            }
+            default:
+                watch->must_poll = true;
+                break;
+        }
+    }
+    cace_amm_lookup_deinit(&deref);
+
+    if (state)
+    {
+        refda_amm_modval_state_set_notifier(state, &(agent->modval_notifier));
+        refda_amm_modval_watch_add(watch, state);
+    }
+}
+
+int refda_eval_watch_target(refda_agent_t *agent, refda_amm_modval_watch_t *watch, const cace_ari_t *target)
+{
+    CHKERR1(agent);
+    CHKERR1(watch);
+    CHKERR1(target);
+
+    refda_amm_modval_watch_reset(watch);
+
+    const cace_ari_ac_t *ac = cace_ari_cget_ac(target);
+    if (!ac)
+    {
+        // produced expressions are not inspected
+        watch->must_poll = true;
+        return 0;
+    }
+
+    cace_ari_list_it_t it;
+    for (cace_ari_list_it(it, ac->items); !cace_ari_list_end_p(it); cace_ari_list_next(it))
+    {
+        refda_eval_watch_item(agent, watch, cace_ari_list_cref(it));
+    }
+    CACE_LOG_DEBUG("condition watches %zu values, polling %d", refda_amm_modval_seen_list_size(watch->items),
+                   watch->must_poll);
+    return 0;
+}
+
 int refda_eval_target(refda_runctx_t *runctx, cace_ari_t *result, const cace_ari_t *target)
 {
     refda_eval_ctx_t ctx;
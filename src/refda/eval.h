@@ -59,6 +59,29 @@ int refda_eval_expand_target(refda_eval_ctx_t *ctx, const cace_ari_t *target);
  */
 int refda_eval_expand_expr(refda_eval_ctx_t *ctx, const cace_ari_t *expr);
 
+/** Resolve all object references of a literal value expression once, so
+ * that the expression can be expanded repeatedly with
+ * refda_eval_expand_program().
+ *
+ * @pre The @c refda_agent_s::objs_mutex must already be locked.
+ * @param[out] prog The program to reset and populate.
+ * @param[in] agent The agent containing all referenced objects.
+ * @param[in] expr The literal-value EXPR to compile.
+ * @return Zero if successful.
+ */
+int refda_eval_compile_expr(refda_eval_program_t prog, refda_agent_t *agent, const cace_ari_t *expr);
+
+/** Perform the expansion portion of the evaluation procedure from
+ * a program compiled by refda_eval_compile_expr().
+ * The referenced objects must not have changed since compiling.
+ *
+ * @pre The @c refda_agent_s::objs_mutex must already be locked.
+ * @param[in] ctx The evaluation context, which must already be initialized.
+ * @param[in] prog The compiled EXPR to evaluate.
+ * @return Zero if successful.
+ */
+int refda_eval_expand_program(refda_eval_ctx_t *ctx, const refda_eval_program_t prog);
+
 /** Implement the reduction portion of the evaluation procedure.
  *
  * @param[in] ctx The evaluation context, which must already be expanded into.
@@ -69,6 +92,23 @@ int refda_eval_expand_expr(refda_eval_ctx_t *ctx, const cace_ari_t *expr);
  */
 int refda_eval_reduce(refda_eval_ctx_t *ctx, cace_ari_t *result);
 
+/** Determine the set of modifiable values which are inputs to an
+ * expression, so that a repeated evaluation can be avoided when none of
+ * them have changed.
+ * VAR inputs are always watched, EDD inputs are watched if they are
+ * marked as refda_amm_edd_desc_t::change_notify and otherwise cause the
+ * watch to require polling.
+ * Each watched state is set to notify the agent of changes.
+ *
+ * @pre The @c refda_agent_s::objs_mutex must already be locked.
+ * @param[in] agent The agent containing all referenced objects.
+ * @param[in,out] watch The watch set to reset and populate.
+ * @param[in] target The literal-value EXPR to inspect.
+ * Any reference-value target will require polling.
+ * @return Zero if successful.
+ */
+int refda_eval_watch_target(refda_agent_t *agent, refda_amm_modval_watch_t *watch, const cace_ari_t *target);
+
 /** A shortcut to fully evaluate an expression.
  * This function performs selective @c refda_agent_s::objs_mutex locking.
  *
@@ -19,6 +19,36 @@
 
 #include "cace/util/defs.h"
 
+void refda_eval_term_init(refda_eval_term_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_init(&(obj->item));
+    cace_amm_lookup_init(&(obj->deref));
+}
+
+void refda_eval_term_init_set(refda_eval_term_t *obj, const refda_eval_term_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_init_copy(&(obj->item), &(src->item));
+    cace_amm_lookup_init_set(&(obj->deref), &(src->deref));
+}
+
+void refda_eval_term_deinit(refda_eval_term_t *obj)
+{
+    CHKVOID(obj);
+    cace_amm_lookup_deinit(&(obj->deref));
+    cace_ari_deinit(&(obj->item));
+}
+
+void refda_eval_term_set(refda_eval_term_t *obj, const refda_eval_term_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_set_copy(&(obj->item), &(src->item));
+    cace_amm_lookup_set(&(obj->deref), &(src->deref));
+}
+
 void refda_eval_ctx_init(refda_eval_ctx_t *obj, refda_runctx_t *parent)
 {
     CHKVOID(obj);
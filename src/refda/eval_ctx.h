@@ -24,6 +24,7 @@
 #include "cace/amm/lookup.h"
 #include "cace/ari.h"
 
+#include <m-array.h>
 #include <m-variant.h>
 
 #ifdef __cplusplus
@@ -38,6 +39,36 @@ M_VARIANT_DEF2(refda_eval_item, (value, cace_ari_t), (deref, cace_amm_lookup_t))
 M_DEQUE_DEF(refda_eval_list, refda_eval_item_t)
 /// @endcond
 
+/** A single pre-resolved item of an EXPR, which can be expanded
+ * repeatedly without looking up its object each time.
+ */
+typedef struct
+{
+    /// Copy of the original EXPR item
+    cace_ari_t item;
+    /** Dereference result if #item is an object reference, with the
+     * object set to null for a literal item.
+     */
+    cace_amm_lookup_t deref;
+} refda_eval_term_t;
+
+void refda_eval_term_init(refda_eval_term_t *obj);
+
+void refda_eval_term_init_set(refda_eval_term_t *obj, const refda_eval_term_t *src);
+
+void refda_eval_term_deinit(refda_eval_term_t *obj);
+
+void refda_eval_term_set(refda_eval_term_t *obj, const refda_eval_term_t *src);
+
+/// M*LIB OPLIST for refda_eval_term_t
+#define M_OPL_refda_eval_term_t()                                                  \
+    (INIT(API_2(refda_eval_term_init)), INIT_SET(API_6(refda_eval_term_init_set)), \
+     CLEAR(API_2(refda_eval_term_deinit)), SET(API_6(refda_eval_term_set)))
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_eval_program, refda_eval_term_t)
+/// @endcond
+
 /** Context for evaluation activities, including for OPER objects.
  */
 typedef struct
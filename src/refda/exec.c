@@ -21,6 +21,7 @@
 #include "ctrl_exec_ctx.h"
 #include "eval.h"
 #include "exec_proc.h"
+#include "reporting.h"
 #include "valprod.h"
 
 #include "cace/amm/lookup.h"
@@ -88,6 +89,7 @@ static int refda_exec_add_execset(refda_agent_t *agent, const refda_msgdata_t *m
     CHKERR1(msg);
 
     cace_ari_list_t *targets = &(msg->value.as_lit.value.as_execset->targets);
+    REFDA_TRACE_MARK(agent, &(msg->value.as_lit.value.as_execset->nonce), REFDA_TRACE_DEQUEUE, NULL);
 
     cace_ari_list_it_t tgtit;
     for (cace_ari_list_it(tgtit, *targets); !cace_ari_list_end_p(tgtit); cace_ari_list_next(tgtit))
@@ -102,6 +104,7 @@ static int refda_exec_add_execset(refda_agent_t *agent, const refda_msgdata_t *m
 
         refda_runctx_ptr_release(ctxptr); // Clean up extra reference
     }
+    REFDA_TRACE_MARK(agent, &(msg->value.as_lit.value.as_execset->nonce), REFDA_TRACE_EXPAND, NULL);
 
     return 0;
 }
@@ -177,6 +180,9 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
 {
     refda_msgdata_t item;
 
+    // share EDD productions among everything in this iteration
+    refda_prodcache_begin(&(agent->prod_cache));
+
     refda_timeline_it_t tl_it;
     refda_timeline_it(tl_it, agent->exec_timeline);
     if (!refda_timeline_end_p(tl_it))
@@ -247,6 +253,11 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
                     (next->tbr.callback)(next->tbr.agent, next->tbr.tbr);
                     break;
                 }
+                case REFDA_TIMELINE_RPT:
+                {
+                    (next->rpt.callback)(next->rpt.agent);
+                    break;
+                }
                 default:
                     CACE_LOG_ERR("Unknown type of deferred callback %d", next->purpose);
                     break;
@@ -261,6 +272,15 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
         sem_wait(&(agent->execs_sem));
     }
 
+    if (atomic_exchange(&agent->modval_changed, false))
+    {
+        refda_exec_sbr_wake(agent);
+    }
+    if (atomic_exchange(&agent->rpt_pending_changed, false))
+    {
+        refda_reporting_pending_check(agent);
+    }
+
     // execs queue may still be empty if deferred callbacks were run
     if (atomic_load(&agent->execs_enable) && refda_msgdata_queue_pop_move(&item, agent->execs))
     {
@@ -277,7 +297,8 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
             for (refda_timeline_it(tl_it, agent->exec_timeline); !refda_timeline_end_p(tl_it);)
             {
                 refda_timeline_event_t *event = refda_timeline_ref(tl_it);
-                if (event->purpose == REFDA_TIMELINE_EXEC)
+                // pending reports are still sent
+                if ((event->purpose == REFDA_TIMELINE_EXEC) || (event->purpose == REFDA_TIMELINE_RPT))
                 {
                     refda_timeline_next(tl_it);
                 }
@@ -286,6 +307,15 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
                     refda_timeline_remove(agent->exec_timeline, tl_it);
                 }
             }
+
+            // and rules waiting on changes
+            refda_sbr_ptr_list_it_t sbr_it;
+            for (refda_sbr_ptr_list_it(sbr_it, agent->sbr_idle); !refda_sbr_ptr_list_end_p(sbr_it);
+                 refda_sbr_ptr_list_next(sbr_it))
+            {
+                (*refda_sbr_ptr_list_ref(sbr_it))->idle = false;
+            }
+            refda_sbr_ptr_list_reset(agent->sbr_idle);
         }
         else
         {
@@ -303,12 +333,15 @@ bool refda_exec_worker_iteration(refda_agent_t *agent)
             refda_msgdata_queue_push_move(agent->rptgs, &undef);
             sem_post(&(agent->rptgs_sem));
 
+            refda_prodcache_end(&(agent->prod_cache));
             return false;
         }
     }
 
     // execute any waiting sequences
     refda_exec_waiting(agent);
+
+    refda_prodcache_end(&(agent->prod_cache));
     return true;
 }
 
@@ -464,7 +497,7 @@ int refda_exec_tbr_disable(refda_agent_t *agent, refda_amm_tbr_desc_t *tbr)
     return 0;
 }
 
-static int refda_exec_schedule_sbr(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr);
+static int refda_exec_schedule_sbr_at(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr, struct timespec schedtime);
 
 static int refda_exec_check_sbr_condition(refda_agent_t *agent, const refda_amm_sbr_desc_t *sbr, cace_ari_t *result)
 {
@@ -489,6 +522,46 @@ static int refda_exec_check_sbr_condition(refda_agent_t *agent, const refda_amm_
     return res;
 }
 
+/** Compute the next scheduled time at which to run the SBR
+ */
+static int refda_exec_sbr_next_scheduled_time(struct timespec *schedtime, const refda_amm_sbr_desc_t *sbr)
+{
+    if (cace_ari_is_lit_typed(&(sbr->min_interval), CACE_ARI_TYPE_TD))
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        cace_ari_get_td(&(sbr->min_interval), schedtime);
+        *schedtime = timespec_add(now, *schedtime);
+    }
+    else
+    {
+        CACE_LOG_ERR("Invalid minimum interval for SBR %p", sbr);
+        return 2;
+    }
+    return 0;
+}
+
+/** Remove a SBR from the idle list, if present.
+ */
+static void refda_exec_sbr_unidle(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
+{
+    if (!sbr->idle)
+    {
+        return;
+    }
+    sbr->idle = false;
+
+    const size_t count = refda_sbr_ptr_list_size(agent->sbr_idle);
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        if (*refda_sbr_ptr_list_get(agent->sbr_idle, ix) == sbr)
+        {
+            refda_sbr_ptr_list_pop_at(NULL, agent->sbr_idle, ix);
+            break;
+        }
+    }
+}
+
 /** Begin a single run of a state based rule, evaluating its condition and
  * executing its action if necessary
  */
@@ -510,17 +583,22 @@ static void refda_exec_run_sbr(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
         return;
     }
 
-    // Schedule next execution of the rule now, to ensure eval interval is
+    // Determine next execution time of the rule now, to ensure eval interval is
     // consistent and independent of condition complexity
-    refda_exec_schedule_sbr(agent, sbr);
+    struct timespec schedtime;
+    const int       sched_res = refda_exec_sbr_next_scheduled_time(&schedtime, sbr);
+
+    // Any input change from this point on will cause a re-evaluation
+    refda_amm_modval_watch_mark(&(sbr->watch));
 
     // Check condition and execute action if necessary
-    cace_ari_t ari_result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_t ari_result  = CACE_ARI_INIT_UNDEFINED;
+    bool       bool_result = false;
 
     int result = refda_exec_check_sbr_condition(agent, sbr, &ari_result);
     if (!result)
     {
-        bool bool_result = cace_amm_ari_is_truthy(&ari_result);
+        bool_result = cace_amm_ari_is_truthy(&ari_result);
         CACE_LOG_INFO("SBR %p condition is bool %d, current count %" PRIu64, sbr, bool_result, sbr->exec_count);
 
         if (bool_result)
@@ -532,33 +610,30 @@ static void refda_exec_run_sbr(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
             }
         }
     }
+    cace_ari_deinit(&ari_result);
 
-    return;
-}
-
-/** Compute the next scheduled time at which to run the SBR
- */
-static int refda_exec_sbr_next_scheduled_time(struct timespec *schedtime, const refda_amm_sbr_desc_t *sbr)
-{
-    if (cace_ari_is_lit_typed(&(sbr->min_interval), CACE_ARI_TYPE_TD))
+    if (sched_res || !sbr->enabled)
     {
-        struct timespec now;
-        clock_gettime(CLOCK_REALTIME, &now);
-        cace_ari_get_td(&(sbr->min_interval), schedtime);
-        *schedtime = timespec_add(now, *schedtime);
+        return;
+    }
+    if (!bool_result && !refda_amm_modval_watch_changed(&(sbr->watch)))
+    {
+        // A false condition will stay false until one of its inputs changes
+        CACE_LOG_DEBUG("SBR %p waiting on condition change", sbr);
+        sbr->idle      = true;
+        sbr->next_eval = schedtime;
+        refda_sbr_ptr_list_push_back(agent->sbr_idle, sbr);
     }
     else
     {
-        CACE_LOG_ERR("Invalid minimum interval for SBR %p", sbr);
-        return 2;
+        refda_exec_schedule_sbr_at(agent, sbr, schedtime);
     }
-    return 0;
 }
 
 /**
  * Schedule execution of a state based rule
  */
-static int refda_exec_schedule_sbr(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
+static int refda_exec_schedule_sbr_at(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr, struct timespec schedtime)
 {
     if (atomic_load(&agent->exec_end))
     {
@@ -572,19 +647,40 @@ static int refda_exec_schedule_sbr(refda_agent_t *agent, refda_amm_sbr_desc_t *s
         return 0;
     }
 
-    struct timespec schedtime;
-    int             result = refda_exec_sbr_next_scheduled_time(&schedtime, sbr);
-    if (!result)
+    refda_timeline_event_t event = { .purpose      = REFDA_TIMELINE_SBR,
+                                     .ts           = schedtime,
+                                     .sbr.agent    = agent,
+                                     .sbr.sbr      = sbr,
+                                     .sbr.callback = refda_exec_run_sbr };
+    refda_timeline_push(agent->exec_timeline, event);
+    return 0;
+}
+
+void refda_exec_sbr_wake(refda_agent_t *agent)
+{
+    CHKVOID(agent);
+
+    struct timespec nowtime;
+    clock_gettime(CLOCK_REALTIME, &nowtime);
+
+    size_t ix = 0;
+    while (ix < refda_sbr_ptr_list_size(agent->sbr_idle))
     {
-        refda_timeline_event_t event = { .purpose      = REFDA_TIMELINE_SBR,
-                                         .ts           = schedtime,
-                                         .sbr.agent    = agent,
-                                         .sbr.sbr      = sbr,
-                                         .sbr.callback = refda_exec_run_sbr };
-        refda_timeline_push(agent->exec_timeline, event);
-    }
+        refda_amm_sbr_desc_t *sbr = *refda_sbr_ptr_list_get(agent->sbr_idle, ix);
+        if (!refda_amm_modval_watch_changed(&(sbr->watch)))
+        {
+            ++ix;
+            continue;
+        }
 
-    return result;
+        refda_sbr_ptr_list_pop_at(NULL, agent->sbr_idle, ix);
+        sbr->idle = false;
+
+        // still honor the minimum interval since the last evaluation
+        const struct timespec schedtime = timespec_gt(sbr->next_eval, nowtime) ? sbr->next_eval : nowtime;
+        CACE_LOG_DEBUG("SBR %p condition input changed", sbr);
+        refda_exec_schedule_sbr_at(agent, sbr, schedtime);
+    }
 }
 
 int refda_exec_sbr_enable(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
@@ -606,8 +702,18 @@ int refda_exec_sbr_enable(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
     sbr->exec_count = 0; // Ensure count is reset when rule is enabled
     atomic_fetch_add(&agent->instr.num_sbrs, 1);
 
+    refda_exec_sbr_unidle(agent, sbr);
+    CACE_MUTEX_LOCK(&agent->objs_mutex);
+    refda_eval_watch_target(agent, &(sbr->watch), &(sbr->condition));
+    CACE_MUTEX_UNLOCK(&agent->objs_mutex);
+
     // Schedule initial rule execution
-    int result = refda_exec_schedule_sbr(agent, sbr);
+    struct timespec schedtime;
+    int             result = refda_exec_sbr_next_scheduled_time(&schedtime, sbr);
+    if (!result)
+    {
+        result = refda_exec_schedule_sbr_at(agent, sbr, schedtime);
+    }
     return result;
 }
 
@@ -615,6 +721,7 @@ int refda_exec_sbr_disable(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr)
 {
     CHKERR1(sbr);
     sbr->enabled = false;
+    refda_exec_sbr_unidle(agent, sbr);
     atomic_fetch_sub(&agent->instr.num_sbrs, 1);
     return 0;
 }
@@ -96,7 +96,9 @@ int refda_exec_tbr_enable(refda_agent_t *agent, refda_amm_tbr_desc_t *tbr);
 int refda_exec_tbr_disable(refda_agent_t *agent, refda_amm_tbr_desc_t *tbr);
 
 /**
- * Begin periodic execution of a state based rule
+ * Begin periodic execution of a state based rule.
+ * While its condition is false and all of its inputs can signal changes,
+ * the rule is idle and is only re-evaluated after an input changes.
  * @param[in] agent The agent context pointer
  * @param[in] sbr The rule to execute
  * @return Non-zero if the rule could not be started
@@ -111,6 +113,15 @@ int refda_exec_sbr_enable(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr);
  */
 int refda_exec_sbr_disable(refda_agent_t *agent, refda_amm_sbr_desc_t *sbr);
 
+/** Schedule evaluation of any idle state based rule with a changed
+ * condition input.
+ * This is called from the exec worker thread after
+ * refda_agent_modval_notify() has indicated some change.
+ *
+ * @param[in] agent The agent context pointer
+ */
+void refda_exec_sbr_wake(refda_agent_t *agent);
+
 /**
  * Setup an ARI to execute next in the sequence.
  * The front of the execution sequence, the current item, is not modified.
@@ -41,6 +41,7 @@ void refda_exec_item_init(refda_exec_item_t *obj)
     cace_ari_init(&(obj->ref));
     cace_amm_lookup_init(&(obj->deref));
     atomic_init(&(obj->execution_stage), REFDA_EXEC_PENDING);
+    obj->exec_start = (struct timespec) { 0 };
     cace_ari_init(&(obj->result));
     cace_amm_user_data_init(&obj->user_data);
 }
@@ -25,6 +25,7 @@
 #include <m-atomic.h>
 
 #include <semaphore.h>
+#include <time.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +94,11 @@ typedef struct
      */
     atomic_int execution_stage;
 
+    /** Monotonic time when execution was started, or zero if not started.
+     * This is used only by the exec worker thread.
+     */
+    struct timespec exec_start;
+
     /** Store of optional CTRL-specific user data which will be cleaned
      * up at the end of execution of this item.
      */
@@ -115,6 +115,13 @@ int refda_exec_proc_ctrl_finish(refda_exec_item_t *item)
 
     // Track number of successes/failures
     refda_agent_t *agent = runctx->agent;
+#if AGENT_LATENCY
+    if (item->exec_start.tv_sec || item->exec_start.tv_nsec)
+    {
+        // includes any time spent waiting
+        REFDA_LATENCY_RECORD(agent, REFDA_LATENCY_CTRL, &(item->deref), &(item->exec_start));
+    }
+#endif /* AGENT_LATENCY */
     if (is_failure)
     {
         atomic_fetch_add(&agent->instr.num_ctrls_failed, 1);
@@ -123,6 +130,7 @@ int refda_exec_proc_ctrl_finish(refda_exec_item_t *item)
     {
         atomic_fetch_add(&agent->instr.num_ctrls_succeeded, 1);
     }
+    REFDA_TRACE_MARK(agent, &(runctx->nonce), REFDA_TRACE_CTRL_FINISH, &(item->ref));
 
     if (!cace_ari_is_null(&(runctx->nonce)))
     {
@@ -184,7 +192,13 @@ int refda_exec_proc_ctrl_start(refda_exec_seq_t *seq)
         refda_ctrl_exec_ctx_t ctx;
         refda_ctrl_exec_ctx_init(&ctx, item_ptr);
         atomic_fetch_add(&ctx.runctx->agent->instr.num_ctrls_run, 1);
+        REFDA_TRACE_MARK(ctx.runctx->agent, &(ctx.runctx->nonce), REFDA_TRACE_CTRL_START, &(item->ref));
+        REFDA_LATENCY_START(&(item->exec_start));
         (ctrl->execute)(&ctx);
+        if (!ctrl->state_preserving)
+        {
+            refda_prodcache_invalidate(&(ctx.runctx->agent->prod_cache));
+        }
         refda_ctrl_exec_ctx_deinit(&ctx);
         CACE_LOG_DEBUG("execution callback returned");
     }
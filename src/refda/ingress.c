@@ -65,6 +65,8 @@ void *refda_ingress_worker(void *arg)
                     continue;
                 }
 
+                REFDA_TRACE_MARK(agent, &(cace_ari_get_execset(val)->nonce), REFDA_TRACE_RECV, NULL);
+
                 refda_msgdata_t exec_item;
                 refda_msgdata_init(&exec_item);
                 cace_ari_set_copy(&exec_item.ident, &meta.src);
@@ -117,6 +119,8 @@ void refda_ingress_push_move(refda_agent_t *agent, const cace_amm_msg_if_metadat
         return;
     }
 
+    REFDA_TRACE_MARK(agent, &(cace_ari_get_execset(ari)->nonce), REFDA_TRACE_RECV, NULL);
+
     refda_msgdata_t execItem;
     refda_msgdata_init(&execItem);
     cace_ari_set_copy(&execItem.ident, &meta->src);
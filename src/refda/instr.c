@@ -40,6 +40,14 @@ void refda_instr_init(refda_instr_t *obj)
     atomic_init(&(obj->num_ctrls_run), 0);
     atomic_init(&(obj->num_ctrls_succeeded), 0);
     atomic_init(&(obj->num_ctrls_failed), 0);
+    atomic_init(&(obj->num_tbl_filter_vector), 0);
+
+#if AGENT_LATENCY
+    refda_latency_init(&(obj->latency));
+#endif /* AGENT_LATENCY */
+#if AGENT_EXEC_TRACE
+    refda_trace_init(&(obj->trace));
+#endif /* AGENT_EXEC_TRACE */
 }
 
 void refda_instr_deinit(refda_instr_t *obj)
@@ -48,5 +56,12 @@ void refda_instr_deinit(refda_instr_t *obj)
 
     cace_ari_deinit(&obj->last_time_recv);
 
+#if AGENT_LATENCY
+    refda_latency_deinit(&(obj->latency));
+#endif /* AGENT_LATENCY */
+#if AGENT_EXEC_TRACE
+    refda_trace_deinit(&(obj->trace));
+#endif /* AGENT_EXEC_TRACE */
+
     // no corresponding clear functions for atomic state
 }
@@ -22,6 +22,9 @@
 #ifndef REFDA_INSTR_H_
 #define REFDA_INSTR_H_
 
+#include "latency.h"
+#include "trace.h"
+
 #include "cace/ari.h"
 #include "cace/config.h"
 
@@ -62,6 +65,18 @@ typedef struct
     atomic_ullong num_ctrls_run;
     atomic_ullong num_ctrls_succeeded;
     atomic_ullong num_ctrls_failed;
+    /// Count of tbl-filter evaluations which used column kernels instead of per-row evaluation
+    atomic_ullong num_tbl_filter_vector;
+
+#if AGENT_LATENCY
+    /// Per-object latency histograms
+    refda_latency_t latency;
+#endif /* AGENT_LATENCY */
+
+#if AGENT_EXEC_TRACE
+    /// EXECSET pipeline trace records
+    refda_trace_t trace;
+#endif /* AGENT_EXEC_TRACE */
 
 } refda_instr_t;
 
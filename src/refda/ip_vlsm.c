@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ip_vlsm.h"
+
+#include "cace/util/defs.h"
+
+#include <string.h>
+
+int refda_ip_vlsm_set(refda_ip_vlsm_t *obj, const cace_data_t *base, uint64_t prefix)
+{
+    CHKERR1(obj);
+    CHKERR1(base);
+    if ((base->len != REFDA_IP_VLSM_IPV4_LEN) && (base->len != REFDA_IP_VLSM_IPV6_LEN))
+    {
+        return 2;
+    }
+    if (prefix > 8 * base->len)
+    {
+        return 3;
+    }
+
+    obj->addr_len   = base->len;
+    obj->full_bytes = prefix / 8;
+    obj->part_mask  = (uint8_t)(0xFF << (8 - (prefix % 8)));
+
+    // bits beyond the prefix are never compared, but clear them for consistency
+    memset(obj->base, 0, sizeof(obj->base));
+    memcpy(obj->base, base->ptr, obj->full_bytes);
+    if (obj->part_mask)
+    {
+        obj->base[obj->full_bytes] = base->ptr[obj->full_bytes] & obj->part_mask;
+    }
+    return 0;
+}
+
+bool refda_ip_vlsm_match(const refda_ip_vlsm_t *obj, const cace_data_t *addr)
+{
+    CHKFALSE(obj);
+    CHKFALSE(addr);
+    if (addr->len != obj->addr_len)
+    {
+        return false;
+    }
+    if (memcmp(addr->ptr, obj->base, obj->full_bytes) != 0)
+    {
+        return false;
+    }
+    if (obj->part_mask)
+    {
+        return (addr->ptr[obj->full_bytes] & obj->part_mask) == obj->base[obj->full_bytes];
+    }
+    return true;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Matching of IP addresses against a variable-length subnet mask (VLSM),
+ * which is a base address and a number of leading prefix bits.
+ */
+#ifndef REFDA_IP_VLSM_H_
+#define REFDA_IP_VLSM_H_
+
+#include "cace/cace_data.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Length of an IPv4 address in bytes
+#define REFDA_IP_VLSM_IPV4_LEN 4
+/// Length of an IPv6 address in bytes
+#define REFDA_IP_VLSM_IPV6_LEN 16
+
+/** A single VLSM block prepared for matching.
+ */
+typedef struct
+{
+    /// Length of the address in bytes, either ::REFDA_IP_VLSM_IPV4_LEN or ::REFDA_IP_VLSM_IPV6_LEN
+    size_t addr_len;
+    /// Number of leading bytes which must be equal
+    size_t full_bytes;
+    /// Mask of the leading bits to compare in the byte after #full_bytes, or zero
+    uint8_t part_mask;
+    /// The base address with all bits after the prefix cleared
+    uint8_t base[REFDA_IP_VLSM_IPV6_LEN];
+} refda_ip_vlsm_t;
+
+/** Prepare a VLSM block for matching.
+ *
+ * @param[out] obj The block to set.
+ * @param[in] base The base address, in network byte order.
+ * @param prefix The number of leading bits of the address to match.
+ * @return Zero if successful, 2 if the base address length is not valid,
+ * or 3 if the prefix is longer than the address.
+ */
+int refda_ip_vlsm_set(refda_ip_vlsm_t *obj, const cace_data_t *base, uint64_t prefix);
+
+/** Determine if an address is within a VLSM block.
+ * This compares at most one byte beyond the whole bytes of the prefix.
+ *
+ * @param[in] obj The block to match with.
+ * @param[in] addr The address to check, in network byte order.
+ * @return True if the address is the same family as the base and
+ * all of its prefix bits are equal.
+ */
+bool refda_ip_vlsm_match(const refda_ip_vlsm_t *obj, const cace_data_t *addr);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_IP_VLSM_H_ */
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Agent latency histogram definitions.
+ */
+#include "latency.h"
+
+#include "cace/util/defs.h"
+#include "cace/util/mutex.h"
+
+#include <string.h>
+
+/// Number of linear sub-buckets in each power-of-two range
+#define SUB_HALF ((uint64_t)1 << (REFDA_LATENCY_SUB_BITS - 1))
+/// Largest recordable value
+#define VALUE_MAX ((((uint64_t)1) << (REFDA_LATENCY_MSB_MAX + 1)) - 1)
+
+/** Get the bucket index for a value.
+ */
+static size_t refda_latency_bucket_ix(uint64_t value)
+{
+    if (value > VALUE_MAX)
+    {
+        value = VALUE_MAX;
+    }
+    if (value < (2 * SUB_HALF))
+    {
+        // exact values
+        return value;
+    }
+
+    const int msb = 63 - __builtin_clzll(value);
+    // keep the top bits of the value, which are at least SUB_HALF
+    const int      shift = msb - REFDA_LATENCY_SUB_BITS + 1;
+    const uint64_t top   = value >> shift;
+    return (size_t)shift * SUB_HALF + top;
+}
+
+/** Get the highest value equivalent to a bucket index.
+ */
+static uint64_t refda_latency_bucket_high(size_t ix)
+{
+    if (ix < (2 * SUB_HALF))
+    {
+        return ix;
+    }
+
+    const size_t   shift = ix / SUB_HALF - 1;
+    const uint64_t top   = ix - shift * SUB_HALF;
+    return ((top + 1) << shift) - 1;
+}
+
+void refda_latency_hist_init(refda_latency_hist_t *obj)
+{
+    CHKVOID(obj);
+    memset(obj, 0, sizeof(refda_latency_hist_t));
+}
+
+void refda_latency_hist_record(refda_latency_hist_t *obj, uint64_t value)
+{
+    CHKVOID(obj);
+
+    if ((obj->count == 0) || (value < obj->min))
+    {
+        obj->min = value;
+    }
+    if (value > obj->max)
+    {
+        obj->max = value;
+    }
+    obj->count += 1;
+    obj->sum += value;
+    obj->buckets[refda_latency_bucket_ix(value)] += 1;
+}
+
+void refda_latency_hist_merge(refda_latency_hist_t *obj, const refda_latency_hist_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    if (src->count == 0)
+    {
+        return;
+    }
+
+    if ((obj->count == 0) || (src->min < obj->min))
+    {
+        obj->min = src->min;
+    }
+    if (src->max > obj->max)
+    {
+        obj->max = src->max;
+    }
+    obj->count += src->count;
+    obj->sum += src->sum;
+    for (size_t ix = 0; ix < REFDA_LATENCY_BUCKETS; ++ix)
+    {
+        obj->buckets[ix] += src->buckets[ix];
+    }
+}
+
+uint64_t refda_latency_hist_quantile(const refda_latency_hist_t *obj, double quantile)
+{
+    CHKRET(obj, 0);
+    if (obj->count == 0)
+    {
+        return 0;
+    }
+
+    if (quantile < 0)
+    {
+        quantile = 0;
+    }
+    else if (quantile > 1)
+    {
+        quantile = 1;
+    }
+    // rank of the value at the quantile, counting from one
+    uint64_t rank = (uint64_t)(quantile * (double)obj->count + 0.5);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t ix = 0; ix < REFDA_LATENCY_BUCKETS; ++ix)
+    {
+        seen += obj->buckets[ix];
+        if (seen >= rank)
+        {
+            const uint64_t high = refda_latency_bucket_high(ix);
+            return (high < obj->max) ? high : obj->max;
+        }
+    }
+    return obj->max;
+}
+
+void refda_latency_entry_init(refda_latency_entry_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_init(&(obj->ref));
+    refda_latency_hist_init(&(obj->hist));
+}
+
+void refda_latency_entry_init_set(refda_latency_entry_t *obj, const refda_latency_entry_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_init_copy(&(obj->ref), &(src->ref));
+    obj->hist = src->hist;
+}
+
+void refda_latency_entry_deinit(refda_latency_entry_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_deinit(&(obj->ref));
+}
+
+void refda_latency_entry_set(refda_latency_entry_t *obj, const refda_latency_entry_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_set_copy(&(obj->ref), &(src->ref));
+    obj->hist = src->hist;
+}
+
+void refda_latency_init(refda_latency_t *obj)
+{
+    CHKVOID(obj);
+    for (size_t ix = 0; ix < REFDA_LATENCY_SHARDS; ++ix)
+    {
+        refda_latency_shard_t *shard = &(obj->shards[ix]);
+        pthread_mutex_init(&(shard->mutex), NULL);
+        for (size_t cat = 0; cat < REFDA_LATENCY_CAT_COUNT; ++cat)
+        {
+            refda_latency_dict_init(shard->objs[cat]);
+        }
+    }
+}
+
+void refda_latency_deinit(refda_latency_t *obj)
+{
+    CHKVOID(obj);
+    for (size_t ix = 0; ix < REFDA_LATENCY_SHARDS; ++ix)
+    {
+        refda_latency_shard_t *shard = &(obj->shards[ix]);
+        for (size_t cat = 0; cat < REFDA_LATENCY_CAT_COUNT; ++cat)
+        {
+            refda_latency_dict_clear(shard->objs[cat]);
+        }
+        pthread_mutex_destroy(&(shard->mutex));
+    }
+}
+
+void refda_latency_start(struct timespec *start)
+{
+    CHKVOID(start);
+    (void)clock_gettime(CLOCK_MONOTONIC, start);
+}
+
+void refda_latency_record(refda_latency_t *obj, refda_latency_cat_t cat, const cace_amm_lookup_t *deref,
+                          const struct timespec *start)
+{
+    CHKVOID(obj);
+    CHKVOID((cat >= 0) && (cat < REFDA_LATENCY_CAT_COUNT));
+    CHKVOID(deref);
+    CHKVOID(deref->obj);
+    CHKVOID(start);
+
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t diff = (int64_t)(now.tv_sec - start->tv_sec) * 1000000000 + (now.tv_nsec - start->tv_nsec);
+    if (diff < 0)
+    {
+        diff = 0;
+    }
+
+    // the same thread always uses the same shard
+    const pthread_t self     = pthread_self();
+    const size_t    shard_ix = m_core_hash(&self, sizeof(self)) % REFDA_LATENCY_SHARDS;
+
+    refda_latency_shard_t *shard = &(obj->shards[shard_ix]);
+    CACE_MUTEX_LOCK(&(shard->mutex));
+
+    refda_latency_entry_t *entry = refda_latency_dict_get(shard->objs[cat], deref->obj);
+    if (!entry)
+    {
+        // only the first recording for an object in each shard allocates
+        entry = refda_latency_dict_safe_get(shard->objs[cat], deref->obj);
+        cace_amm_lookup_ref_int(&(entry->ref), deref);
+    }
+    refda_latency_hist_record(&(entry->hist), (uint64_t)diff);
+
+    CACE_MUTEX_UNLOCK(&(shard->mutex));
+}
+
+static void refda_latency_set_td(cace_ari_t *ari, uint64_t value)
+{
+    cace_ari_set_td(ari, (struct timespec) { .tv_sec = value / 1000000000, .tv_nsec = value % 1000000000 });
+}
+
+int refda_latency_get_table(refda_latency_t *obj, refda_latency_cat_t cat, cace_ari_tbl_t *table)
+{
+    CHKERR1(obj);
+    CHKERR1((cat >= 0) && (cat < REFDA_LATENCY_CAT_COUNT));
+    CHKERR1(table);
+
+    refda_latency_dict_t merged;
+    refda_latency_dict_init(merged);
+
+    for (size_t ix = 0; ix < REFDA_LATENCY_SHARDS; ++ix)
+    {
+        refda_latency_shard_t *shard = &(obj->shards[ix]);
+        CACE_MUTEX_LOCK(&(shard->mutex));
+
+        refda_latency_dict_it_t it;
+        for (refda_latency_dict_it(it, shard->objs[cat]); !refda_latency_dict_end_p(it); refda_latency_dict_next(it))
+        {
+            const refda_latency_dict_itref_t *pair = refda_latency_dict_cref(it);
+
+            refda_latency_entry_t *entry = refda_latency_dict_get(merged, pair->key);
+            if (!entry)
+            {
+                entry = refda_latency_dict_safe_get(merged, pair->key);
+                cace_ari_set_copy(&(entry->ref), &(pair->value.ref));
+            }
+            refda_latency_hist_merge(&(entry->hist), &(pair->value.hist));
+        }
+
+        CACE_MUTEX_UNLOCK(&(shard->mutex));
+    }
+
+    cace_ari_tbl_reset(table, 8, 0);
+
+    refda_latency_dict_it_t it;
+    for (refda_latency_dict_it(it, merged); !refda_latency_dict_end_p(it); refda_latency_dict_next(it))
+    {
+        const refda_latency_entry_t *entry = &(refda_latency_dict_cref(it)->value);
+        const refda_latency_hist_t  *hist  = &(entry->hist);
+
+        cace_ari_array_t row;
+        cace_ari_array_init(row);
+        cace_ari_array_resize(row, table->ncols);
+
+        cace_ari_set_copy(cace_ari_array_get(row, 0), &(entry->ref));
+        cace_ari_set_uvast(cace_ari_array_get(row, 1), hist->count);
+        refda_latency_set_td(cace_ari_array_get(row, 2), hist->min);
+        refda_latency_set_td(cace_ari_array_get(row, 3), hist->sum / hist->count);
+        refda_latency_set_td(cace_ari_array_get(row, 4), refda_latency_hist_quantile(hist, 0.50));
+        refda_latency_set_td(cace_ari_array_get(row, 5), refda_latency_hist_quantile(hist, 0.90));
+        refda_latency_set_td(cace_ari_array_get(row, 6), refda_latency_hist_quantile(hist, 0.99));
+        refda_latency_set_td(cace_ari_array_get(row, 7), hist->max);
+
+        cace_ari_tbl_move_row_array(table, row);
+    }
+
+    refda_latency_dict_clear(merged);
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Agent latency histograms for object execution and production.
+ *
+ * Each histogram uses log-linear buckets, where each power-of-two range
+ * of values is split into a fixed number of linear sub-buckets.
+ * This keeps a fixed relative error for any recorded value without
+ * needing any allocation or floating point math to record a value.
+ *
+ * Histograms are kept per-object and sharded by recording thread, so
+ * recording only contends with readers, and shards are merged on read.
+ *
+ * Recording within the agent is enabled by the AGENT_LATENCY build option.
+ * When disabled, the REFDA_LATENCY_START() and REFDA_LATENCY_RECORD()
+ * macros avoid any clock reads or locking and no per-agent state is kept.
+ */
+#ifndef REFDA_LATENCY_H_
+#define REFDA_LATENCY_H_
+
+#include "cace/amm/lookup.h"
+#include "cace/ari.h"
+#include "cace/config.h"
+
+#include <m-dict.h>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Number of bits of value precision, giving a relative error of 2^-(N-1)
+#define REFDA_LATENCY_SUB_BITS 5
+/// Highest bit position of a recorded value, larger values are clamped
+#define REFDA_LATENCY_MSB_MAX 39
+/// Total number of buckets in each histogram
+#define REFDA_LATENCY_BUCKETS \
+    ((REFDA_LATENCY_MSB_MAX - REFDA_LATENCY_SUB_BITS + 3) << (REFDA_LATENCY_SUB_BITS - 1))
+/// Number of recording shards in each set
+#define REFDA_LATENCY_SHARDS 8
+
+/** The categories of activity which are timed.
+ */
+typedef enum
+{
+    /// Execution of a CTRL, from start until finished
+    REFDA_LATENCY_CTRL = 0,
+    /// Value production of an EDD
+    REFDA_LATENCY_EDD,
+    /// Evaluation of an OPER
+    REFDA_LATENCY_OPER,
+    /// Report generation from a value-object item in a report template
+    REFDA_LATENCY_RPTT,
+    /// Number of categories, not a valid value
+    REFDA_LATENCY_CAT_COUNT
+} refda_latency_cat_t;
+
+/** A single latency histogram with values in nanoseconds.
+ */
+typedef struct
+{
+    /// Total number of recorded values
+    uint64_t count;
+    /// Sum of all recorded values
+    uint64_t sum;
+    /// Least recorded value
+    uint64_t min;
+    /// Greatest recorded value
+    uint64_t max;
+    /// Count of values in each bucket
+    uint32_t buckets[REFDA_LATENCY_BUCKETS];
+} refda_latency_hist_t;
+
+void refda_latency_hist_init(refda_latency_hist_t *obj);
+
+/** Record a single value.
+ *
+ * @param[in,out] obj The histogram to record into.
+ * @param value The value to record.
+ */
+void refda_latency_hist_record(refda_latency_hist_t *obj, uint64_t value);
+
+/** Add all values from one histogram into another.
+ *
+ * @param[in,out] obj The histogram to add into.
+ * @param[in] src The histogram to add from.
+ */
+void refda_latency_hist_merge(refda_latency_hist_t *obj, const refda_latency_hist_t *src);
+
+/** Get an approximate quantile value.
+ *
+ * @param[in] obj The histogram to read.
+ * @param quantile The quantile in the range [0, 1].
+ * @return The highest value equivalent to the bucket of the quantile,
+ * limited to the greatest recorded value, or zero if empty.
+ */
+uint64_t refda_latency_hist_quantile(const refda_latency_hist_t *obj, double quantile);
+
+/** The histogram for a single object.
+ */
+typedef struct
+{
+    /// Reference to the object with integer identifiers
+    cace_ari_t ref;
+    /// The histogram of values
+    refda_latency_hist_t hist;
+} refda_latency_entry_t;
+
+void refda_latency_entry_init(refda_latency_entry_t *obj);
+
+void refda_latency_entry_init_set(refda_latency_entry_t *obj, const refda_latency_entry_t *src);
+
+void refda_latency_entry_deinit(refda_latency_entry_t *obj);
+
+void refda_latency_entry_set(refda_latency_entry_t *obj, const refda_latency_entry_t *src);
+
+/// OPLIST for refda_latency_entry_t
+#define M_OPL_refda_latency_entry_t()                                                      \
+    (INIT(API_2(refda_latency_entry_init)), INIT_SET(API_6(refda_latency_entry_init_set)), \
+     CLEAR(API_2(refda_latency_entry_deinit)), SET(API_6(refda_latency_entry_set)))
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(refda_latency_dict, const cace_amm_obj_desc_t *, M_PTR_OPLIST, refda_latency_entry_t,
+            M_OPL_refda_latency_entry_t())
+/// @endcond
+
+/** Histograms recorded by a subset of threads.
+ */
+typedef struct
+{
+    /// Mutex for all other state
+    pthread_mutex_t mutex;
+    /// Histograms for each category keyed by object descriptor
+    refda_latency_dict_t objs[REFDA_LATENCY_CAT_COUNT];
+} refda_latency_shard_t;
+
+/** The full set of latency histograms for an agent.
+ * Objects are keyed by their descriptor, which are assumed to be retained
+ * for the lifetime of the agent.
+ */
+typedef struct
+{
+    /// Shards selected by recording thread
+    refda_latency_shard_t shards[REFDA_LATENCY_SHARDS];
+} refda_latency_t;
+
+void refda_latency_init(refda_latency_t *obj);
+
+void refda_latency_deinit(refda_latency_t *obj);
+
+/** Get a start time for a later refda_latency_record().
+ *
+ * @param[out] start The monotonic start time.
+ */
+void refda_latency_start(struct timespec *start);
+
+/** Record the time elapsed since a start time for an object.
+ *
+ * @param[in,out] obj The histogram set to record into.
+ * @param cat The category of the activity.
+ * @param[in] deref The object being timed, which must be dereferenced.
+ * @param[in] start The start time from refda_latency_start().
+ */
+void refda_latency_record(refda_latency_t *obj, refda_latency_cat_t cat, const cace_amm_lookup_t *deref,
+                          const struct timespec *start);
+
+/** Produce a summary table for one category with columns:
+ *  1. The object reference
+ *  2. The count of recorded values
+ *  3. The least value
+ *  4. The mean value
+ *  5. The 50th percentile value
+ *  6. The 90th percentile value
+ *  7. The 99th percentile value
+ *  8. The greatest value
+ * where all values are time differences.
+ *
+ * @param[in,out] obj The histogram set to read from.
+ * @param cat The category to summarize.
+ * @param[out] table The table to reset and populate.
+ * @return Zero if successful.
+ */
+int refda_latency_get_table(refda_latency_t *obj, refda_latency_cat_t cat, cace_ari_tbl_t *table);
+
+#if AGENT_LATENCY
+
+/** Get a start time from refda_latency_start() if recording is enabled.
+ *
+ * @param start Pointer to the start time to set.
+ */
+#define REFDA_LATENCY_START(start) refda_latency_start(start)
+
+/** Record an elapsed time from an agent pointer.
+ *
+ * @param agent The agent to record within.
+ * @param cat The category of the activity.
+ * @param deref The object being timed.
+ * @param start Pointer to the start time from REFDA_LATENCY_START().
+ */
+#define REFDA_LATENCY_RECORD(agent, cat, deref, start) \
+    refda_latency_record(&((agent)->instr.latency), (cat), (deref), (start))
+
+#else /* AGENT_LATENCY */
+
+#define REFDA_LATENCY_START(start) (void)(start)
+#define REFDA_LATENCY_RECORD(agent, cat, deref, start)
+
+#endif /* AGENT_LATENCY */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFDA_LATENCY_H_ */
@@ -17,13 +17,16 @@
  */
 #include "loader.h"
 
+#include "adm/dtnma_tools_refda_instr.h"
 #include "adm/ietf.h"
 #include "adm/ietf_alarms.h"
 #include "adm/ietf_amm.h"
 #include "adm/ietf_amm_base.h"
 #include "adm/ietf_amm_semtype.h"
+#include "adm/ietf_bp_base.h"
 #include "adm/ietf_dtnma_agent.h"
 #include "adm/ietf_dtnma_agent_acl.h"
+#include "adm/ietf_inet_base.h"
 #include "adm/ietf_network_base.h"
 
 int refda_loader_basemods(refda_agent_t *agent)
@@ -33,8 +36,11 @@ int refda_loader_basemods(refda_agent_t *agent)
     retval += refda_adm_ietf_amm_base_init(agent) == 0 ? 0 : 1;
     retval += refda_adm_ietf_amm_semtype_init(agent) == 0 ? 0 : 1;
     retval += refda_adm_ietf_network_base_init(agent) == 0 ? 0 : 1;
+    retval += refda_adm_ietf_inet_base_init(agent) == 0 ? 0 : 1;
+    retval += refda_adm_ietf_bp_base_init(agent) == 0 ? 0 : 1;
     retval += refda_adm_ietf_dtnma_agent_init(agent) == 0 ? 0 : 1;
     retval += refda_adm_ietf_dtnma_agent_acl_init(agent) == 0 ? 0 : 1;
     retval += refda_adm_ietf_alarms_init(agent) == 0 ? 0 : 1;
+    retval += refda_adm_dtnma_tools_refda_instr_init(agent) == 0 ? 0 : 1;
     return retval;
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "prodcache.h"
+
+#include "cace/ari/algo.h"
+#include "cace/util/defs.h"
+
+#include <m-core.h>
+
+void refda_prodcache_key_init(refda_prodcache_key_t *obj)
+{
+    obj->obj = NULL;
+    cace_ari_array_init(obj->aparams);
+}
+
+void refda_prodcache_key_init_set(refda_prodcache_key_t *obj, const refda_prodcache_key_t *src)
+{
+    obj->obj = src->obj;
+    cace_ari_array_init_set(obj->aparams, src->aparams);
+}
+
+void refda_prodcache_key_deinit(refda_prodcache_key_t *obj)
+{
+    cace_ari_array_clear(obj->aparams);
+    obj->obj = NULL;
+}
+
+void refda_prodcache_key_set(refda_prodcache_key_t *obj, const refda_prodcache_key_t *src)
+{
+    obj->obj = src->obj;
+    cace_ari_array_set(obj->aparams, src->aparams);
+}
+
+size_t refda_prodcache_key_hash(const refda_prodcache_key_t *obj)
+{
+    M_HASH_DECL(accum);
+    M_HASH_UP(accum, M_HASH_DEFAULT(obj->obj));
+
+    cace_ari_array_it_t it;
+    for (cace_ari_array_it(it, obj->aparams); !cace_ari_array_end_p(it); cace_ari_array_next(it))
+    {
+        M_HASH_UP(accum, cace_ari_hash(cace_ari_array_cref(it)));
+    }
+    return M_HASH_FINAL(accum);
+}
+
+bool refda_prodcache_key_equal(const refda_prodcache_key_t *left, const refda_prodcache_key_t *right)
+{
+    if (left->obj != right->obj)
+    {
+        return false;
+    }
+    const size_t count = cace_ari_array_size(left->aparams);
+    if (cace_ari_array_size(right->aparams) != count)
+    {
+        return false;
+    }
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        if (!cace_ari_equal(cace_ari_array_cget(left->aparams, ix), cace_ari_array_cget(right->aparams, ix)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void refda_prodcache_init(refda_prodcache_t *obj)
+{
+    obj->active = false;
+    refda_prodcache_dict_init(obj->values);
+    obj->num_hits = 0;
+    obj->num_miss = 0;
+}
+
+void refda_prodcache_deinit(refda_prodcache_t *obj)
+{
+    refda_prodcache_dict_clear(obj->values);
+    obj->active = false;
+}
+
+void refda_prodcache_begin(refda_prodcache_t *obj)
+{
+    CHKVOID(obj);
+    obj->owner  = pthread_self();
+    obj->active = true;
+}
+
+void refda_prodcache_end(refda_prodcache_t *obj)
+{
+    CHKVOID(obj);
+    obj->active = false;
+    refda_prodcache_dict_reset(obj->values);
+}
+
+void refda_prodcache_invalidate(refda_prodcache_t *obj)
+{
+    CHKVOID(obj);
+    refda_prodcache_dict_reset(obj->values);
+}
+
+/** Determine if the cache is usable from the current thread.
+ */
+static bool refda_prodcache_usable(const refda_prodcache_t *obj)
+{
+    return obj->active && pthread_equal(obj->owner, pthread_self());
+}
+
+/** Populate a key from a dereference result.
+ */
+static void refda_prodcache_key_from(refda_prodcache_key_t *key, const cace_amm_lookup_t *deref)
+{
+    key->obj = deref->obj;
+    cace_ari_array_set(key->aparams, deref->aparams.ordered);
+}
+
+bool refda_prodcache_get(refda_prodcache_t *obj, const cace_amm_lookup_t *deref, cace_ari_t *value)
+{
+    CHKFALSE(obj);
+    CHKFALSE(deref);
+    CHKFALSE(value);
+    if (!refda_prodcache_usable(obj))
+    {
+        return false;
+    }
+
+    refda_prodcache_key_t key;
+    refda_prodcache_key_init(&key);
+    refda_prodcache_key_from(&key, deref);
+
+    const cace_ari_t *found = refda_prodcache_dict_cget(obj->values, key);
+    if (found)
+    {
+        cace_ari_set_copy(value, found);
+        ++(obj->num_hits);
+    }
+
+    refda_prodcache_key_deinit(&key);
+    return (found != NULL);
+}
+
+void refda_prodcache_put(refda_prodcache_t *obj, const cace_amm_lookup_t *deref, const cace_ari_t *value)
+{
+    CHKVOID(obj);
+    CHKVOID(deref);
+    CHKVOID(value);
+    if (!refda_prodcache_usable(obj))
+    {
+        return;
+    }
+
+    refda_prodcache_key_t key;
+    refda_prodcache_key_init(&key);
+    refda_prodcache_key_from(&key, deref);
+
+    refda_prodcache_dict_set_at(obj->values, key, *value);
+    ++(obj->num_miss);
+
+    refda_prodcache_key_deinit(&key);
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef REFDA_PRODCACHE_H_
+#define REFDA_PRODCACHE_H_
+
+#include "cace/amm/lookup.h"
+#include "cace/ari.h"
+
+#include <m-dict.h>
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Key for a single cached production, which is specific to a single
+ * object and its normalized actual parameters.
+ */
+typedef struct
+{
+    /// The produced object
+    const cace_amm_obj_desc_t *obj;
+    /// Copy of the ordered actual parameters
+    cace_ari_array_t aparams;
+} refda_prodcache_key_t;
+
+void refda_prodcache_key_init(refda_prodcache_key_t *obj);
+
+void refda_prodcache_key_init_set(refda_prodcache_key_t *obj, const refda_prodcache_key_t *src);
+
+void refda_prodcache_key_deinit(refda_prodcache_key_t *obj);
+
+void refda_prodcache_key_set(refda_prodcache_key_t *obj, const refda_prodcache_key_t *src);
+
+size_t refda_prodcache_key_hash(const refda_prodcache_key_t *obj);
+
+bool refda_prodcache_key_equal(const refda_prodcache_key_t *left, const refda_prodcache_key_t *right);
+
+/// M*LIB OPLIST for refda_prodcache_key_t
+#define M_OPL_refda_prodcache_key_t()                                                      \
+    (INIT(API_2(refda_prodcache_key_init)), INIT_SET(API_6(refda_prodcache_key_init_set)), \
+     CLEAR(API_2(refda_prodcache_key_deinit)), SET(API_6(refda_prodcache_key_set)),        \
+     HASH(API_2(refda_prodcache_key_hash)), EQUAL(API_6(refda_prodcache_key_equal)))
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(refda_prodcache_dict, refda_prodcache_key_t, M_OPL_refda_prodcache_key_t(), cace_ari_t, M_OPL_cace_ari_t())
+/// @endcond
+
+/** Short-lived cache of EDD production results.
+ * This is active only for the duration of a single exec worker iteration
+ * so that the same EDD used by many reports within that iteration is
+ * produced once and copied into each report.
+ * Callers use the cache only for EDDs marked as
+ * refda_amm_edd_desc_t::cacheable, because the values of other EDDs can
+ * depend on the run context of the production.
+ *
+ * All state is owned by the thread which called refda_prodcache_begin()
+ * and all access from other threads bypasses the cache.
+ */
+typedef struct
+{
+    /// True between refda_prodcache_begin() and refda_prodcache_end()
+    bool active;
+    /// The thread which owns the cache while active
+    pthread_t owner;
+    /// Cached values
+    refda_prodcache_dict_t values;
+    /// Number of productions avoided since the cache was initialized
+    uint64_t num_hits;
+    /// Number of productions stored since the cache was initialized
+    uint64_t num_miss;
+} refda_prodcache_t;
+
+void refda_prodcache_init(refda_prodcache_t *obj);
+
+void refda_prodcache_deinit(refda_prodcache_t *obj);
+
+/** Activate the cache for the calling thread.
+ */
+void refda_prodcache_begin(refda_prodcache_t *obj);
+
+/** Deactivate the cache and discard all cached values.
+ */
+void refda_prodcache_end(refda_prodcache_t *obj);
+
+/** Discard all cached values but leave the cache active.
+ * This is used after any activity which could change produced values.
+ */
+void refda_prodcache_invalidate(refda_prodcache_t *obj);
+
+/** Get a copy of a cached production result.
+ *
+ * @param[in,out] obj The cache to read.
+ * @param[in] deref The dereferenced object and its actual parameters.
+ * @param[out] value The value to set from the cache.
+ * @return True if the value was present and copied.
+ */
+bool refda_prodcache_get(refda_prodcache_t *obj, const cace_amm_lookup_t *deref, cace_ari_t *value);
+
+/** Store a copy of a production result, if the cache is active.
+ *
+ * @param[in,out] obj The cache to write.
+ * @param[in] deref The dereferenced object and its actual parameters.
+ * @param[in] value The produced value to copy.
+ */
+void refda_prodcache_put(refda_prodcache_t *obj, const cace_amm_lookup_t *deref, const cace_ari_t *value);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_PRODCACHE_H_ */
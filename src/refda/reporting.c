@@ -17,8 +17,10 @@
  */
 #include "reporting.h"
 
+#include "edd_prod_ctx.h"
 #include "eval.h"
 #include "reporting_ctx.h"
+#include "rpt_plan.h"
 #include "valprod.h"
 
 #include "cace/ari/text.h"
@@ -26,6 +28,8 @@
 #include "cace/util/logging.h"
 #include "cace/util/mutex.h"
 
+#include <timespec.h>
+
 int refda_reporting_ctrl(refda_runctx_t *runctx, const cace_ari_t *target, cace_ari_t *result)
 {
     if (cace_ari_is_undefined(&runctx->mgr_ident))
@@ -49,6 +53,7 @@ int refda_reporting_ctrl(refda_runctx_t *runctx, const cace_ari_t *target, cace_
         cace_ari_list_push_back_move(rpt->items, result);
     }
     CACE_LOG_DEBUG("generated an execution report");
+    REFDA_TRACE_MARK(runctx->agent, &(runctx->nonce), REFDA_TRACE_RPT_QUEUE, target);
 
     refda_msgdata_queue_push_move(runctx->agent->rptgs, &msg);
     sem_post(&(runctx->agent->rptgs_sem));
@@ -59,87 +64,137 @@ int refda_reporting_ctrl(refda_runctx_t *runctx, const cace_ari_t *target, cace_
 /** Treat any object reference template item as a value-producing activity, with the
  * produced value as the report item.
  */
-static void refda_reporting_item_ref(refda_runctx_t *runctx, cace_ari_t *rpt_item, const cace_ari_t *rptt_item)
+static void refda_reporting_item_prod(refda_reporting_ctx_t *rptctx, size_t index, cace_ari_t *rpt_item,
+                                      const refda_rpt_plan_step_t *step)
 {
-    cace_amm_lookup_t deref;
-    cace_amm_lookup_init(&deref);
-
-    int res = cace_amm_lookup_deref(&deref, &(runctx->agent->objs), rptt_item);
-    if (res)
+    refda_valprod_ctx_t prodctx;
+    refda_valprod_ctx_init(&prodctx, rptctx->runctx, &(step->item), &(step->deref));
+    prodctx.allow_defer = true;
+    int res             = refda_valprod_run(&prodctx);
+    if (!res && prodctx.pending)
     {
-        CACE_LOG_DEBUG("reporting item reference lookup failed: %d", res);
+        // item is filled in when the production completes
+        refda_reporting_slot_t *slot = refda_reporting_slot_list_push_new(rptctx->slots);
+        slot->index                  = index;
+        slot->pending                = prodctx.pending;
+        prodctx.pending              = NULL;
     }
-    else
+    else if (!res)
     {
-        switch (deref.obj_type)
-        {
-            case CACE_ARI_TYPE_CONST:
-            case CACE_ARI_TYPE_VAR:
-            case CACE_ARI_TYPE_EDD:
-            {
-                refda_valprod_ctx_t prodctx;
-                refda_valprod_ctx_init(&prodctx, runctx, rptt_item, &deref);
-                int res = refda_valprod_run(&prodctx);
-                if (!res)
-                {
-                    // include the produced value directly
-                    cace_ari_set_move(rpt_item, &(prodctx.value));
-                }
-                refda_valprod_ctx_deinit(&prodctx);
-                break;
-            }
-            default:
-                CACE_LOG_DEBUG("reporting item reference to non-value-producing");
-                break;
-        }
+        // include the produced value directly
+        cace_ari_set_move(rpt_item, &(prodctx.value));
     }
-
-    cace_amm_lookup_deinit(&deref);
+    refda_valprod_ctx_deinit(&prodctx);
 }
 
 /** Treat any literal template item as an evaluation activity, with the
  * evaluated result as the report item.
  */
-static void refda_reporting_item_lit(refda_runctx_t *runctx, cace_ari_t *rpt_item, const cace_ari_t *rptt_item)
+static void refda_reporting_item_expr(refda_runctx_t *runctx, cace_ari_t *rpt_item, const refda_rpt_plan_step_t *step)
 {
-    if (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(runctx->agent->expr_type, rptt_item))
+    // item is an expression to be evaluated
+    refda_eval_ctx_t ctx;
+    refda_eval_ctx_init(&ctx, runctx);
+
+    refda_agent_t *agent = runctx->agent;
+    CACE_MUTEX_LOCK(&agent->objs_mutex);
+    int res = refda_eval_expand_program(&ctx, step->program);
+    CACE_MUTEX_UNLOCK(&agent->objs_mutex);
+    if (!res)
     {
-        CACE_LOG_ERR("reporting item literal was not an EXPR");
+        res = refda_eval_reduce(&ctx, rpt_item);
     }
-    else
+
+    refda_eval_ctx_deinit(&ctx);
+    if (res)
     {
-        // item is an expression to be evaluated
-        refda_eval_ctx_t ctx;
-        refda_eval_ctx_init(&ctx, runctx);
-
-        refda_agent_t *agent = runctx->agent;
-        CACE_MUTEX_LOCK(&agent->objs_mutex);
-        int res = refda_eval_expand_expr(&ctx, rptt_item);
-        CACE_MUTEX_UNLOCK(&agent->objs_mutex);
-        if (!res)
+        CACE_LOG_WARNING("reporting item failed to evaluate expression");
+    }
+}
+
+/** Produce all members of one EDD group referenced by a plan together,
+ * with each member value as the report item of its steps.
+ */
+static void refda_reporting_group_prod(refda_reporting_ctx_t *rptctx, const refda_rpt_plan_t *plan, size_t group_ix)
+{
+    refda_runctx_t                    *runctx = rptctx->runctx;
+    refda_agent_t                     *agent  = runctx->agent;
+    const refda_amm_edd_group_t *const group  = *refda_rpt_plan_group_list_cget(plan->groups, group_ix);
+    const size_t                       count  = refda_rpt_plan_step_list_size(plan->steps);
+
+    refda_edd_group_prod_ctx_t ctx;
+    refda_edd_group_prod_ctx_init(&ctx, group, runctx);
+
+    // request only permitted members not already produced in this iteration
+    bool any_request = false;
+    for (size_t index = 0; index < count; ++index)
+    {
+        const refda_rpt_plan_step_t *step = refda_rpt_plan_step_list_cget(plan->steps, index);
+        if ((step->type != REFDA_RPT_PLAN_STEP_GROUP) || (step->group_ix != group_ix))
+        {
+            continue;
+        }
+
+        bool acl_found = refda_acl_search_one_permission(agent, runctx->acl_groups, &(step->item), &(step->deref),
+                                                         agent->acl.permissions.produce, NULL);
+        if (!acl_found)
+        {
+            continue;
+        }
+
+        const refda_amm_edd_desc_t *edd      = step->deref.obj->app_data.ptr;
+        cace_ari_t                 *rpt_item = cace_ari_list_get(rptctx->items, index);
+        if (edd->cacheable && refda_prodcache_get(&(agent->prod_cache), &(step->deref), rpt_item))
         {
-            res = refda_eval_reduce(&ctx, rpt_item);
+            continue;
         }
 
-        refda_eval_ctx_deinit(&ctx);
-        if (res)
+        refda_edd_group_prod_ctx_request(&ctx, step->deref.obj->app_data.ptr);
+        any_request = true;
+    }
+
+    if (any_request)
+    {
+        CACE_LOG_DEBUG("producing EDD group for report template");
+        (group->produce)(&ctx);
+
+        for (size_t index = 0; index < count; ++index)
         {
-            CACE_LOG_WARNING("reporting item failed to evaluate expression");
+            const refda_rpt_plan_step_t *step = refda_rpt_plan_step_list_cget(plan->steps, index);
+            if ((step->type != REFDA_RPT_PLAN_STEP_GROUP) || (step->group_ix != group_ix))
+            {
+                continue;
+            }
+
+            const refda_amm_edd_desc_t *edd      = step->deref.obj->app_data.ptr;
+            const cace_ari_t           *value    = &(ctx.values[edd->group_index]);
+            cace_ari_t                 *rpt_item = cace_ari_list_get(rptctx->items, index);
+            if (!ctx.members[edd->group_index] || cace_ari_is_undefined(value) || !cace_ari_is_undefined(rpt_item))
+            {
+                continue;
+            }
+
+            cace_ari_set_copy(rpt_item, value);
+            if (edd->cacheable)
+            {
+                refda_prodcache_put(&(agent->prod_cache), &(step->deref), value);
+            }
         }
     }
+
+    refda_edd_group_prod_ctx_deinit(&ctx);
 }
 
-/** Actually iterate through an RPTT and produce items.
+/** Actually iterate through an RPTT plan and produce items.
  */
-static int refda_reporting_rptt_val(refda_reporting_ctx_t *rptctx, const cace_ari_t *value)
+static int refda_reporting_rptt_plan(refda_reporting_ctx_t *rptctx, const refda_rpt_plan_t *plan)
 {
-    const cace_ari_ac_t *tgt_ac = cace_ari_cget_ac(value);
-    CHKERR1(tgt_ac);
-
-    cace_ari_list_it_t rptt_it;
-    for (cace_ari_list_it(rptt_it, tgt_ac->items); !cace_ari_list_end_p(rptt_it); cace_ari_list_next(rptt_it))
+    size_t                        index = 0;
+    refda_rpt_plan_step_list_it_t step_it;
+    for (refda_rpt_plan_step_list_it(step_it, plan->steps); !refda_rpt_plan_step_list_end_p(step_it);
+         refda_rpt_plan_step_list_next(step_it), ++index)
     {
-        const cace_ari_t *rptt_item = cace_ari_list_cref(rptt_it);
+        const refda_rpt_plan_step_t *step = refda_rpt_plan_step_list_cref(step_it);
         // init as undefined value
         cace_ari_t *rpt_item = cace_ari_list_push_back_new(rptctx->items);
 
@@ -147,20 +202,25 @@ static int refda_reporting_rptt_val(refda_reporting_ctx_t *rptctx, const cace_ar
         {
             m_string_t buf;
             m_string_init(buf);
-            cace_ari_text_encode(buf, rptt_item, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+            cace_ari_text_encode(buf, &(step->item), CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
             CACE_LOG_DEBUG("Report template item %s", m_string_get_cstr(buf));
             m_string_clear(buf);
         }
 
-        if (rptt_item->is_ref)
+        switch (step->type)
         {
-            // item is a reference to be produced
-            refda_reporting_item_ref(rptctx->runctx, rpt_item, rptt_item);
-        }
-        else
-        {
-            // item is an EXPR to be evaluated
-            refda_reporting_item_lit(rptctx->runctx, rpt_item, rptt_item);
+            case REFDA_RPT_PLAN_STEP_PROD:
+                refda_reporting_item_prod(rptctx, index, rpt_item, step);
+                break;
+            case REFDA_RPT_PLAN_STEP_EXPR:
+                refda_reporting_item_expr(rptctx->runctx, rpt_item, step);
+                break;
+            case REFDA_RPT_PLAN_STEP_GROUP:
+                // item is filled in after all steps
+                continue;
+            default:
+                // item is left undefined
+                break;
         }
 
         if (cace_log_is_enabled_for(LOG_DEBUG))
@@ -173,22 +233,38 @@ static int refda_reporting_rptt_val(refda_reporting_ctx_t *rptctx, const cace_ar
         }
     }
 
+    for (size_t group_ix = 0; group_ix < refda_rpt_plan_group_list_size(plan->groups); ++group_ix)
+    {
+        refda_reporting_group_prod(rptctx, plan, group_ix);
+    }
+
     return 0;
 }
 
 static int refda_reporting_rptt_lit(refda_reporting_ctx_t *rptctx, const cace_ari_t *value)
 {
-    int retval = 0;
-    if (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(rptctx->runctx->agent->rptt_type, value))
-    {
-        CACE_LOG_WARNING("Attempted reporting on a non-RPTT literal");
-        retval = REFDA_REPORTING_ERR_BAD_TYPE;
-    }
-    else
+    refda_agent_t *agent = rptctx->runctx->agent;
+
+    // a cached plan has already been validated as an RPTT
+    refda_rpt_plan_ptr_t *planp = refda_rpt_plan_cache_find(&(agent->rpt_plans), value);
+    if (!planp)
     {
-        CACE_LOG_DEBUG("Reporting on RPTT literal");
-        retval = refda_reporting_rptt_val(rptctx, value);
+        if (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(agent->rptt_type, value))
+        {
+            CACE_LOG_WARNING("Attempted reporting on a non-RPTT literal");
+            return REFDA_REPORTING_ERR_BAD_TYPE;
+        }
+
+        planp = refda_rpt_plan_cache_add(&(agent->rpt_plans), agent, value);
+        if (!planp)
+        {
+            return REFDA_REPORTING_ERR_BAD_TYPE;
+        }
     }
+
+    CACE_LOG_DEBUG("Reporting on RPTT literal");
+    int retval = refda_reporting_rptt_plan(rptctx, refda_rpt_plan_ptr_ref(planp));
+    refda_rpt_plan_ptr_clear(planp);
     return retval;
 }
 
@@ -217,6 +293,9 @@ static int refda_reporting_rptt_ref(refda_reporting_ctx_t *rptctx, const cace_ar
             case CACE_ARI_TYPE_VAR:
             case CACE_ARI_TYPE_EDD:
             {
+                struct timespec start;
+                REFDA_LATENCY_START(&start);
+
                 refda_valprod_ctx_t prodctx;
                 refda_valprod_ctx_init(&prodctx, rptctx->runctx, target, &deref);
                 retval = refda_valprod_run(&prodctx);
@@ -226,6 +305,8 @@ static int refda_reporting_rptt_ref(refda_reporting_ctx_t *rptctx, const cace_ar
                     retval = refda_reporting_rptt_lit(rptctx, &(prodctx.value));
                 }
                 refda_valprod_ctx_deinit(&prodctx);
+
+                REFDA_LATENCY_RECORD(rptctx->runctx->agent, REFDA_LATENCY_RPTT, &deref, &start);
                 break;
             }
             default:
@@ -238,6 +319,99 @@ static int refda_reporting_rptt_ref(refda_reporting_ctx_t *rptctx, const cace_ar
     return retval;
 }
 
+/** Hold a report until its deferred productions complete or its
+ * deadline passes.
+ */
+static void refda_reporting_defer(refda_agent_t *agent, const cace_ari_t *destination, const cace_ari_t *source,
+                                  refda_reporting_ctx_t *rptctx)
+{
+    refda_reporting_pending_t *rpt = CACE_MALLOC(sizeof(refda_reporting_pending_t));
+    refda_reporting_pending_init(rpt);
+    cace_ari_set_copy(&(rpt->destination), destination);
+    cace_ari_set_copy(&(rpt->source), source);
+    cace_ari_list_swap(rpt->items, rptctx->items);
+    refda_reporting_slot_list_swap(rpt->slots, rptctx->slots);
+
+    struct timespec nowtime;
+    clock_gettime(CLOCK_REALTIME, &nowtime);
+    rpt->deadline = timespec_add(nowtime, agent->rpt_pending_timeout);
+
+    CACE_LOG_DEBUG("Report waiting on %zu deferred items", refda_reporting_slot_list_size(rpt->slots));
+    refda_reporting_pending_list_push_back(agent->rpt_pending, rpt);
+
+    refda_timeline_event_t event = {
+        .purpose      = REFDA_TIMELINE_RPT,
+        .ts           = rpt->deadline,
+        .rpt.agent    = agent,
+        .rpt.callback = refda_reporting_pending_check,
+    };
+    refda_timeline_push(agent->exec_timeline, event);
+}
+
+/** Fill in completed items and generate a report.
+ */
+static void refda_reporting_pending_finish(refda_agent_t *agent, refda_reporting_pending_t *rpt)
+{
+    size_t missing = 0;
+
+    refda_reporting_slot_list_it_t it;
+    for (refda_reporting_slot_list_it(it, rpt->slots); !refda_reporting_slot_list_end_p(it);
+         refda_reporting_slot_list_next(it))
+    {
+        const refda_reporting_slot_t *slot = refda_reporting_slot_list_cref(it);
+
+        cace_ari_t *item = cace_ari_list_get(rpt->items, slot->index);
+        if (!refda_edd_pending_take(refda_edd_pending_ptr_ref(slot->pending), item))
+        {
+            ++missing;
+        }
+    }
+    if (missing)
+    {
+        CACE_LOG_WARNING("Report deadline passed with %zu incomplete items", missing);
+    }
+
+    if (!refda_rpt_delta_apply(&(agent->rpt_delta), &(rpt->destination), &(rpt->source), rpt->items))
+    {
+        refda_reporting_gen(agent, &(rpt->destination), &(rpt->source), rpt->items);
+    }
+}
+
+void refda_reporting_pending_check(refda_agent_t *agent)
+{
+    CHKVOID(agent);
+
+    struct timespec nowtime;
+    clock_gettime(CLOCK_REALTIME, &nowtime);
+
+    size_t ix = 0;
+    while (ix < refda_reporting_pending_list_size(agent->rpt_pending))
+    {
+        refda_reporting_pending_t *rpt = *refda_reporting_pending_list_get(agent->rpt_pending, ix);
+
+        bool all_done = true;
+
+        refda_reporting_slot_list_it_t it;
+        for (refda_reporting_slot_list_it(it, rpt->slots); all_done && !refda_reporting_slot_list_end_p(it);
+             refda_reporting_slot_list_next(it))
+        {
+            const refda_reporting_slot_t *slot = refda_reporting_slot_list_cref(it);
+            all_done                           = refda_edd_pending_is_done(refda_edd_pending_ptr_ref(slot->pending));
+        }
+
+        if (!all_done && timespec_gt(rpt->deadline, nowtime))
+        {
+            ++ix;
+            continue;
+        }
+
+        refda_reporting_pending_list_pop_at(NULL, agent->rpt_pending, ix);
+        refda_reporting_pending_finish(agent, rpt);
+        refda_reporting_pending_deinit(rpt);
+        CACE_FREE(rpt);
+    }
+}
+
 int refda_reporting_target(refda_runctx_t *runctx, const cace_ari_t *target, const cace_ari_t *destination)
 {
     CHKERR1(runctx);
@@ -276,7 +450,11 @@ int refda_reporting_target(refda_runctx_t *runctx, const cace_ari_t *target, con
         retval = refda_reporting_rptt_lit(&rptctx, target);
     }
 
-    if (!retval)
+    if (!retval && !refda_reporting_slot_list_empty_p(rptctx.slots))
+    {
+        refda_reporting_defer(runctx->agent, destination, target, &rptctx);
+    }
+    else if (!retval && !refda_rpt_delta_apply(&(runctx->agent->rpt_delta), destination, target, rptctx.items))
     {
         refda_reporting_gen(runctx->agent, destination, target, rptctx.items);
     }
@@ -53,6 +53,14 @@ int refda_reporting_ctrl(refda_runctx_t *runctx, const cace_ari_t *target, cace_
  */
 int refda_reporting_target(refda_runctx_t *runctx, const cace_ari_t *target, const cace_ari_t *destination);
 
+/** Generate reports which were waiting on deferred EDD productions, once
+ * all of their productions have completed or their deadline has passed.
+ * This is called by the refda_exec_worker() thread.
+ *
+ * @param[in,out] agent The agent holding waiting reports.
+ */
+void refda_reporting_pending_check(refda_agent_t *agent);
+
 /** Generate and queue a one-report RPTSET value.
  *
  * @param[in] agent The agent doing the reporting.
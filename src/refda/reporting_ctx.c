@@ -21,6 +21,17 @@
 
 #include "cace/util/defs.h"
 
+void refda_reporting_slot_list_release(refda_reporting_slot_list_t slots)
+{
+    refda_reporting_slot_list_it_t it;
+    for (refda_reporting_slot_list_it(it, slots); !refda_reporting_slot_list_end_p(it);
+         refda_reporting_slot_list_next(it))
+    {
+        refda_edd_pending_ptr_clear(refda_reporting_slot_list_ref(it)->pending);
+    }
+    refda_reporting_slot_list_reset(slots);
+}
+
 void refda_reporting_ctx_init(refda_reporting_ctx_t *obj, const refda_runctx_t *runctx, const cace_ari_t *mgr_ident)
 {
     CHKVOID(obj);
@@ -35,14 +46,37 @@ void refda_reporting_ctx_init(refda_reporting_ctx_t *obj, const refda_runctx_t *
     refda_runctx_check_acl(obj->runctx);
 
     cace_ari_list_init(obj->items);
+    refda_reporting_slot_list_init(obj->slots);
 }
 
 void refda_reporting_ctx_deinit(refda_reporting_ctx_t *obj)
 {
     CHKVOID(obj);
+    refda_reporting_slot_list_release(obj->slots);
+    refda_reporting_slot_list_clear(obj->slots);
     cace_ari_list_clear(obj->items);
 
     refda_runctx_deinit(obj->runctx);
     CACE_FREE(obj->runctx);
     obj->runctx = NULL;
 }
+
+void refda_reporting_pending_init(refda_reporting_pending_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_init(&(obj->destination));
+    cace_ari_init(&(obj->source));
+    cace_ari_list_init(obj->items);
+    refda_reporting_slot_list_init(obj->slots);
+    obj->deadline = (struct timespec) { 0 };
+}
+
+void refda_reporting_pending_deinit(refda_reporting_pending_t *obj)
+{
+    CHKVOID(obj);
+    refda_reporting_slot_list_release(obj->slots);
+    refda_reporting_slot_list_clear(obj->slots);
+    cace_ari_list_clear(obj->items);
+    cace_ari_deinit(&(obj->source));
+    cace_ari_deinit(&(obj->destination));
+}
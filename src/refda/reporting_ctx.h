@@ -19,12 +19,37 @@
 #ifndef REFDA_REPORTING_CTX_H_
 #define REFDA_REPORTING_CTX_H_
 
+#include "edd_pending.h"
 #include "runctx.h"
 
+#include <m-array.h>
+
+#include <time.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** A report item which is waiting on a deferred production.
+ */
+typedef struct
+{
+    /// Index of the item within its report
+    size_t index;
+    /// The deferred production, which is owned by this slot
+    refda_edd_pending_ptr_t *pending;
+} refda_reporting_slot_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_reporting_slot_list, refda_reporting_slot_t, M_POD_OPLIST)
+/// @endcond
+
+/** Release all deferred productions in a slot list and reset it.
+ *
+ * @param[in,out] slots The list to reset.
+ */
+void refda_reporting_slot_list_release(refda_reporting_slot_list_t slots);
+
 /** Context for reporting activities.
  */
 typedef struct
@@ -38,6 +63,11 @@ typedef struct
      * This is initialized as empty and is pushed back as items are added.
      */
     cace_ari_list_t items;
+
+    /** Items which are waiting on deferred productions.
+     * This is initialized as empty.
+     */
+    refda_reporting_slot_list_t slots;
 } refda_reporting_ctx_t;
 
 /** Initialize a context based on an parent runtime context and a destination
@@ -51,6 +81,30 @@ void refda_reporting_ctx_init(refda_reporting_ctx_t *obj, const refda_runctx_t *
 
 void refda_reporting_ctx_deinit(refda_reporting_ctx_t *obj);
 
+/** A report which is assembled as its deferred productions complete.
+ */
+typedef struct
+{
+    /// The destination manager
+    cace_ari_t destination;
+    /// The report source
+    cace_ari_t source;
+    /// The report items, with undefined values in place of each slot
+    cace_ari_list_t items;
+    /// Items waiting on deferred productions
+    refda_reporting_slot_list_t slots;
+    /// Time after which the report is sent with any incomplete items undefined
+    struct timespec deadline;
+} refda_reporting_pending_t;
+
+void refda_reporting_pending_init(refda_reporting_pending_t *obj);
+
+void refda_reporting_pending_deinit(refda_reporting_pending_t *obj);
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_reporting_pending_list, refda_reporting_pending_t *, M_PTR_OPLIST)
+/// @endcond
+
 #ifdef __cplusplus
 } // extern C
 #endif
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "rpt_delta.h"
+
+#include "cace/ari/rpt_delta.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+#include "cace/util/mutex.h"
+
+#include <strings.h>
+#include <time.h>
+
+static const char *refda_rpt_delta_mode_names[] = {
+    [REFDA_RPT_DELTA_NONE]     = "none",
+    [REFDA_RPT_DELTA_SUPPRESS] = "suppress",
+    [REFDA_RPT_DELTA_CHANGED]  = "changed",
+};
+
+const char *refda_rpt_delta_mode_name(refda_rpt_delta_mode_t mode)
+{
+    if ((size_t)mode >= sizeof(refda_rpt_delta_mode_names) / sizeof(refda_rpt_delta_mode_names[0]))
+    {
+        return "unknown";
+    }
+    return refda_rpt_delta_mode_names[mode];
+}
+
+int refda_rpt_delta_mode_from_text(refda_rpt_delta_mode_t *mode, const char *text)
+{
+    CHKERR1(mode);
+    CHKERR1(text);
+    for (size_t ix = 0; ix < sizeof(refda_rpt_delta_mode_names) / sizeof(refda_rpt_delta_mode_names[0]); ++ix)
+    {
+        if (strcasecmp(text, refda_rpt_delta_mode_names[ix]) == 0)
+        {
+            *mode = (refda_rpt_delta_mode_t)ix;
+            return 0;
+        }
+    }
+    return 2;
+}
+
+void refda_rpt_delta_entry_init(refda_rpt_delta_entry_t *obj)
+{
+    CHKVOID(obj);
+    obj->seq.epoch  = 0;
+    obj->seq.seq    = 0;
+    obj->since_full = 0;
+    obj->last_use   = 0;
+    cace_ari_list_init(obj->items);
+}
+
+void refda_rpt_delta_entry_init_set(refda_rpt_delta_entry_t *obj, const refda_rpt_delta_entry_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->seq        = src->seq;
+    obj->since_full = src->since_full;
+    obj->last_use   = src->last_use;
+    cace_ari_list_init_set(obj->items, src->items);
+}
+
+void refda_rpt_delta_entry_deinit(refda_rpt_delta_entry_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_list_clear(obj->items);
+}
+
+void refda_rpt_delta_entry_set(refda_rpt_delta_entry_t *obj, const refda_rpt_delta_entry_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->seq        = src->seq;
+    obj->since_full = src->since_full;
+    obj->last_use   = src->last_use;
+    cace_ari_list_set(obj->items, src->items);
+}
+
+void refda_rpt_delta_init(refda_rpt_delta_t *obj)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    obj->default_mode = REFDA_RPT_DELTA_NONE;
+    cace_ari_dict_init(obj->modes);
+    obj->full_period = REFDA_RPT_DELTA_FULL_PERIOD;
+    obj->max_entries = REFDA_RPT_DELTA_MAX_ENTRIES;
+    obj->next_epoch  = (cace_ari_uvast)time(NULL);
+    obj->use_count   = 0;
+    refda_rpt_delta_dict_init(obj->last);
+}
+
+void refda_rpt_delta_deinit(refda_rpt_delta_t *obj)
+{
+    CHKVOID(obj);
+    refda_rpt_delta_dict_clear(obj->last);
+    cace_ari_dict_clear(obj->modes);
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+void refda_rpt_delta_set_mode(refda_rpt_delta_t *obj, const cace_ari_t *manager, refda_rpt_delta_mode_t mode)
+{
+    CHKVOID(obj);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (manager)
+    {
+        cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_uvast(&val, mode);
+        cace_ari_dict_set_at(obj->modes, *manager, val);
+        cace_ari_deinit(&val);
+    }
+    else
+    {
+        obj->default_mode = mode;
+    }
+    refda_rpt_delta_dict_reset(obj->last);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+}
+
+void refda_rpt_delta_resync(refda_rpt_delta_t *obj, const cace_ari_t *manager)
+{
+    CHKVOID(obj);
+    CHKVOID(manager);
+
+    cace_ari_list_t remove;
+    cace_ari_list_init(remove);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    refda_rpt_delta_dict_it_t it;
+    for (refda_rpt_delta_dict_it(it, obj->last); !refda_rpt_delta_dict_end_p(it); refda_rpt_delta_dict_next(it))
+    {
+        const cace_ari_t    *key   = &(refda_rpt_delta_dict_cref(it)->key);
+        const cace_ari_ac_t *keyac = cace_ari_cget_ac(key);
+        if (keyac && cace_ari_equal(cace_ari_list_front(keyac->items), manager))
+        {
+            cace_ari_list_push_back(remove, *key);
+        }
+    }
+
+    CACE_LOG_INFO("Resynchronizing %zu report sources", cace_ari_list_size(remove));
+    cace_ari_list_it_t rem_it;
+    for (cace_ari_list_it(rem_it, remove); !cace_ari_list_end_p(rem_it); cace_ari_list_next(rem_it))
+    {
+        refda_rpt_delta_dict_erase(obj->last, *cace_ari_list_cref(rem_it));
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    cace_ari_list_clear(remove);
+}
+
+/** Discard the least recently used entry with the mutex already locked.
+ */
+static void refda_rpt_delta_evict_locked(refda_rpt_delta_t *obj)
+{
+    const cace_ari_t *oldest     = NULL;
+    uint64_t          oldest_use = UINT64_MAX;
+
+    refda_rpt_delta_dict_it_t it;
+    for (refda_rpt_delta_dict_it(it, obj->last); !refda_rpt_delta_dict_end_p(it); refda_rpt_delta_dict_next(it))
+    {
+        const refda_rpt_delta_dict_itref_t *pair = refda_rpt_delta_dict_cref(it);
+        if (pair->value.last_use < oldest_use)
+        {
+            oldest     = &(pair->key);
+            oldest_use = pair->value.last_use;
+        }
+    }
+    if (oldest)
+    {
+        cace_ari_t key = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_copy(&key, oldest);
+        refda_rpt_delta_dict_erase(obj->last, key);
+        cace_ari_deinit(&key);
+    }
+}
+
+/** Get the mode with the mutex already locked.
+ */
+static refda_rpt_delta_mode_t refda_rpt_delta_get_mode_locked(refda_rpt_delta_t *obj, const cace_ari_t *manager)
+{
+    const cace_ari_t *found = cace_ari_dict_cget(obj->modes, *manager);
+
+    cace_ari_uvast val;
+    if (found && !cace_ari_get_uvast(found, &val))
+    {
+        return (refda_rpt_delta_mode_t)val;
+    }
+    return obj->default_mode;
+}
+
+refda_rpt_delta_mode_t refda_rpt_delta_get_mode(refda_rpt_delta_t *obj, const cace_ari_t *manager)
+{
+    CHKRET(obj, REFDA_RPT_DELTA_NONE);
+    CHKRET(manager, REFDA_RPT_DELTA_NONE);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    refda_rpt_delta_mode_t mode = refda_rpt_delta_get_mode_locked(obj, manager);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return mode;
+}
+
+bool refda_rpt_delta_apply(refda_rpt_delta_t *obj, const cace_ari_t *manager, const cace_ari_t *source,
+                           cace_ari_list_t items)
+{
+    CHKFALSE(obj);
+    CHKFALSE(manager);
+    CHKFALSE(source);
+
+    bool suppress = false;
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    const refda_rpt_delta_mode_t mode = refda_rpt_delta_get_mode_locked(obj, manager);
+    if (mode != REFDA_RPT_DELTA_NONE)
+    {
+        cace_ari_t key = CACE_ARI_INIT_UNDEFINED;
+        {
+            cace_ari_ac_t acval;
+            cace_ari_ac_init(&acval);
+            cace_ari_list_push_back(acval.items, *manager);
+            cace_ari_list_push_back(acval.items, *source);
+            cace_ari_set_ac(&key, &acval);
+        }
+
+        refda_rpt_delta_entry_t *entry  = refda_rpt_delta_dict_get(obj->last, key);
+        const bool               is_new = !entry;
+        if (is_new)
+        {
+            while (obj->max_entries && (refda_rpt_delta_dict_size(obj->last) >= obj->max_entries))
+            {
+                refda_rpt_delta_evict_locked(obj);
+            }
+
+            entry            = refda_rpt_delta_dict_safe_get(obj->last, key);
+            entry->seq.epoch = obj->next_epoch++;
+        }
+        entry->last_use = ++(obj->use_count);
+
+        const bool force_full = is_new || (obj->full_period && (entry->since_full + 1 >= obj->full_period));
+
+        cace_ari_list_t empty, encoded;
+        cace_ari_list_init(empty);
+        cace_ari_list_init(encoded);
+
+        size_t changed = 0;
+        if (cace_ari_rpt_delta_encode(encoded, &changed, &(entry->seq), force_full ? empty : entry->items, items))
+        {
+            CACE_LOG_ERR("Failed to delta encode a report");
+        }
+        else if (!changed && !force_full)
+        {
+            CACE_LOG_DEBUG("Suppressing report with no changed items");
+            ++(entry->since_full);
+            suppress = true;
+        }
+        else
+        {
+            const size_t count = cace_ari_list_size(items);
+
+            entry->since_full = (changed == count) ? 0 : entry->since_full + 1;
+            ++(entry->seq.seq);
+            cace_ari_list_set(entry->items, items);
+            if (mode == REFDA_RPT_DELTA_CHANGED)
+            {
+                CACE_LOG_DEBUG("Reporting %zu changed of %zu items", changed, count);
+                cace_ari_list_move(items, encoded);
+                cace_ari_list_init(encoded);
+            }
+        }
+
+        cace_ari_list_clear(empty);
+        cace_ari_list_clear(encoded);
+        cace_ari_deinit(&key);
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    return suppress;
+}
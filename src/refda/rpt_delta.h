@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Agent state for report-by-exception (delta) reporting.
+ */
+#ifndef REFDA_RPT_DELTA_H_
+#define REFDA_RPT_DELTA_H_
+
+#include "cace/ari.h"
+#include "cace/ari/rpt_delta.h"
+
+#include <m-dict.h>
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Possible delta reporting modes for a manager.
+ */
+typedef enum
+{
+    /// Every report is sent in full
+    REFDA_RPT_DELTA_NONE = 0,
+    /// Reports with no changed items are not sent, others are sent in full
+    REFDA_RPT_DELTA_SUPPRESS,
+    /** Reports with no changed items are not sent, others are sent using
+     * the encoding from cace/ari/rpt_delta.h with only changed items.
+     */
+    REFDA_RPT_DELTA_CHANGED,
+} refda_rpt_delta_mode_t;
+
+/** Get a text name for a mode.
+ *
+ * @param mode The mode to name.
+ * @return The text name, which is never null.
+ */
+const char *refda_rpt_delta_mode_name(refda_rpt_delta_mode_t mode);
+
+/** Get a mode from its text name.
+ *
+ * @param[out] mode The mode to set.
+ * @param[in] text The text name.
+ * @return Zero if successful.
+ */
+int refda_rpt_delta_mode_from_text(refda_rpt_delta_mode_t *mode, const char *text);
+
+/// Default value of refda_rpt_delta_t::full_period
+#define REFDA_RPT_DELTA_FULL_PERIOD 10
+/// Default value of refda_rpt_delta_t::max_entries
+#define REFDA_RPT_DELTA_MAX_ENTRIES 256
+
+/** State for a single combination of source and manager.
+ */
+typedef struct
+{
+    /// Position of the next report sent
+    cace_ari_rpt_delta_seq_t seq;
+    /// Number of reports generated, sent or not, since the last complete report
+    size_t since_full;
+    /// Value of refda_rpt_delta_t::use_count when this was last used
+    uint64_t last_use;
+    /// Items of the last report sent
+    cace_ari_list_t items;
+} refda_rpt_delta_entry_t;
+
+void refda_rpt_delta_entry_init(refda_rpt_delta_entry_t *obj);
+
+void refda_rpt_delta_entry_init_set(refda_rpt_delta_entry_t *obj, const refda_rpt_delta_entry_t *src);
+
+void refda_rpt_delta_entry_deinit(refda_rpt_delta_entry_t *obj);
+
+void refda_rpt_delta_entry_set(refda_rpt_delta_entry_t *obj, const refda_rpt_delta_entry_t *src);
+
+/// M*LIB OPLIST for refda_rpt_delta_entry_t
+#define M_OPL_refda_rpt_delta_entry_t()                                                        \
+    (INIT(API_2(refda_rpt_delta_entry_init)), INIT_SET(API_6(refda_rpt_delta_entry_init_set)), \
+     CLEAR(API_2(refda_rpt_delta_entry_deinit)), SET(API_6(refda_rpt_delta_entry_set)))
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(refda_rpt_delta_dict, cace_ari_t, M_OPL_cace_ari_t(), refda_rpt_delta_entry_t,
+            M_OPL_refda_rpt_delta_entry_t())
+/// @endcond
+
+/** Delta reporting configuration and the last items reported for each
+ * combination of source and manager.
+ */
+typedef struct
+{
+    /// Mutex for all state
+    pthread_mutex_t mutex;
+    /// Mode for any manager not present in #modes
+    refda_rpt_delta_mode_t default_mode;
+    /// Mode by manager identity, stored as UVAST values
+    cace_ari_dict_t modes;
+    /** Number of generated reports after which a complete report is sent
+     * even if no items changed, or zero to never force a complete report.
+     */
+    size_t full_period;
+    /** Maximum number of entries in #last, after which the least recently
+     * used entry is discarded.
+     */
+    size_t max_entries;
+    /** Epoch of the next new entry, which starts from the initialization
+     * time so that a restarted agent does not reuse an earlier epoch.
+     */
+    cace_ari_uvast next_epoch;
+    /// Counter used to find the least recently used entry
+    uint64_t use_count;
+    /// Last report state, keyed by AC of (manager, source)
+    refda_rpt_delta_dict_t last;
+} refda_rpt_delta_t;
+
+void refda_rpt_delta_init(refda_rpt_delta_t *obj);
+
+void refda_rpt_delta_deinit(refda_rpt_delta_t *obj);
+
+/** Set the mode for a single manager or the default mode.
+ * Any change of mode discards all last-reported state so that the next
+ * report from each source is complete.
+ *
+ * @param[in,out] obj The state to update.
+ * @param[in] manager The manager identity, or NULL to set the default mode.
+ * @param mode The mode to use.
+ */
+void refda_rpt_delta_set_mode(refda_rpt_delta_t *obj, const cace_ari_t *manager, refda_rpt_delta_mode_t mode);
+
+/** Discard all last-reported state for a single manager so that the next
+ * report from each source to that manager is complete.
+ *
+ * @param[in,out] obj The state to update.
+ * @param[in] manager The manager identity.
+ */
+void refda_rpt_delta_resync(refda_rpt_delta_t *obj, const cace_ari_t *manager);
+
+/** Get the mode used for a single manager.
+ *
+ * @param[in] obj The state to read.
+ * @param[in] manager The manager identity.
+ * @return The mode for that manager.
+ */
+refda_rpt_delta_mode_t refda_rpt_delta_get_mode(refda_rpt_delta_t *obj, const cace_ari_t *manager);
+
+/** Apply delta reporting to a generated report.
+ * A complete report is sent for the first report from each source, after
+ * every refda_rpt_delta_t::full_period reports, and whenever the item
+ * count changes.
+ *
+ * @param[in,out] obj The state to use and update.
+ * @param[in] manager The destination manager identity.
+ * @param[in] source The report source.
+ * @param[in,out] items The complete report items, which may be replaced by
+ * delta-encoded items.
+ * @return True if the report should not be sent.
+ */
+bool refda_rpt_delta_apply(refda_rpt_delta_t *obj, const cace_ari_t *manager, const cace_ari_t *source,
+                           cace_ari_list_t items);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_RPT_DELTA_H_ */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "rpt_plan.h"
+
+#include "agent.h"
+#include "eval.h"
+
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+#include "cace/util/mutex.h"
+
+void refda_rpt_plan_step_init(refda_rpt_plan_step_t *obj)
+{
+    CHKVOID(obj);
+    obj->type = REFDA_RPT_PLAN_STEP_INVALID;
+    cace_ari_init(&(obj->item));
+    cace_amm_lookup_init(&(obj->deref));
+    obj->group_ix = 0;
+    refda_eval_program_init(obj->program);
+}
+
+void refda_rpt_plan_step_init_set(refda_rpt_plan_step_t *obj, const refda_rpt_plan_step_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->type = src->type;
+    cace_ari_init_copy(&(obj->item), &(src->item));
+    cace_amm_lookup_init_set(&(obj->deref), &(src->deref));
+    obj->group_ix = src->group_ix;
+    refda_eval_program_init_set(obj->program, src->program);
+}
+
+void refda_rpt_plan_step_deinit(refda_rpt_plan_step_t *obj)
+{
+    CHKVOID(obj);
+    refda_eval_program_clear(obj->program);
+    cace_amm_lookup_deinit(&(obj->deref));
+    cace_ari_deinit(&(obj->item));
+}
+
+void refda_rpt_plan_step_set(refda_rpt_plan_step_t *obj, const refda_rpt_plan_step_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->type = src->type;
+    cace_ari_set_copy(&(obj->item), &(src->item));
+    cace_amm_lookup_set(&(obj->deref), &(src->deref));
+    obj->group_ix = src->group_ix;
+    refda_eval_program_set(obj->program, src->program);
+}
+
+void refda_rpt_plan_init(refda_rpt_plan_t *obj)
+{
+    CHKVOID(obj);
+    refda_rpt_plan_step_list_init(obj->steps);
+    refda_rpt_plan_group_list_init(obj->groups);
+}
+
+void refda_rpt_plan_deinit(refda_rpt_plan_t *obj)
+{
+    CHKVOID(obj);
+    refda_rpt_plan_group_list_clear(obj->groups);
+    refda_rpt_plan_step_list_clear(obj->steps);
+}
+
+/** Resolve a single template item into its step.
+ */
+static void refda_rpt_plan_compile_step(refda_rpt_plan_step_t *step, refda_agent_t *agent, const cace_ari_t *item)
+{
+    cace_ari_set_copy(&(step->item), item);
+
+    if (item->is_ref)
+    {
+        // item is a reference to be produced
+        int res = cace_amm_lookup_deref(&(step->deref), &(agent->objs), item);
+        if (res)
+        {
+            CACE_LOG_DEBUG("reporting item reference lookup failed: %d", res);
+            return;
+        }
+        switch (step->deref.obj_type)
+        {
+            case CACE_ARI_TYPE_CONST:
+            case CACE_ARI_TYPE_VAR:
+            case CACE_ARI_TYPE_EDD:
+                step->type = REFDA_RPT_PLAN_STEP_PROD;
+                break;
+            default:
+                CACE_LOG_DEBUG("reporting item reference to non-value-producing");
+                break;
+        }
+    }
+    else
+    {
+        // item is an EXPR to be evaluated
+        if (CACE_AMM_TYPE_MATCH_POSITIVE != cace_amm_type_match(agent->expr_type, item))
+        {
+            CACE_LOG_ERR("reporting item literal was not an EXPR");
+            return;
+        }
+        int res = refda_eval_compile_expr(step->program, agent, item);
+        if (res)
+        {
+            CACE_LOG_WARNING("reporting item failed to compile expression: %d", res);
+            return;
+        }
+        step->type = REFDA_RPT_PLAN_STEP_EXPR;
+    }
+}
+
+/** Get the group of an EDD production step, if it has one.
+ */
+static const refda_amm_edd_group_t *refda_rpt_plan_step_group(const refda_rpt_plan_step_t *step)
+{
+    if ((step->type != REFDA_RPT_PLAN_STEP_PROD) || (step->deref.obj_type != CACE_ARI_TYPE_EDD))
+    {
+        return NULL;
+    }
+    const refda_amm_edd_desc_t *edd = step->deref.obj->app_data.ptr;
+    if (!edd || !edd->group || (edd->group_index >= REFDA_AMM_EDD_GROUP_MAX)
+        || !cace_amm_formal_param_list_empty_p(step->deref.obj->fparams))
+    {
+        return NULL;
+    }
+    return edd->group;
+}
+
+/** Combine production steps for any group with more than one referenced member.
+ */
+static void refda_rpt_plan_compile_groups(refda_rpt_plan_t *obj)
+{
+    const size_t count = refda_rpt_plan_step_list_size(obj->steps);
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        refda_rpt_plan_step_t       *step  = refda_rpt_plan_step_list_get(obj->steps, ix);
+        const refda_amm_edd_group_t *group = refda_rpt_plan_step_group(step);
+        if (!group)
+        {
+            continue;
+        }
+
+        size_t members = 1;
+        for (size_t other = ix + 1; other < count; ++other)
+        {
+            if (refda_rpt_plan_step_group(refda_rpt_plan_step_list_get(obj->steps, other)) == group)
+            {
+                ++members;
+            }
+        }
+        if (members < 2)
+        {
+            continue;
+        }
+
+        const size_t group_ix = refda_rpt_plan_group_list_size(obj->groups);
+        refda_rpt_plan_group_list_push_back(obj->groups, group);
+        for (size_t other = ix; other < count; ++other)
+        {
+            refda_rpt_plan_step_t *member = refda_rpt_plan_step_list_get(obj->steps, other);
+            if (refda_rpt_plan_step_group(member) == group)
+            {
+                member->type     = REFDA_RPT_PLAN_STEP_GROUP;
+                member->group_ix = group_ix;
+            }
+        }
+    }
+}
+
+int refda_rpt_plan_compile(refda_rpt_plan_t *obj, refda_agent_t *agent, const cace_ari_t *rptt)
+{
+    CHKERR1(obj);
+    CHKERR1(agent);
+    CHKERR1(rptt);
+
+    const cace_ari_ac_t *ac = cace_ari_cget_ac(rptt);
+    CHKERR1(ac);
+
+    refda_rpt_plan_step_list_reset(obj->steps);
+    refda_rpt_plan_group_list_reset(obj->groups);
+    refda_rpt_plan_step_list_reserve(obj->steps, cace_ari_list_size(ac->items));
+
+    cace_ari_list_it_t it;
+    for (cace_ari_list_it(it, ac->items); !cace_ari_list_end_p(it); cace_ari_list_next(it))
+    {
+        refda_rpt_plan_step_t *step = refda_rpt_plan_step_list_push_new(obj->steps);
+        refda_rpt_plan_compile_step(step, agent, cace_ari_list_cref(it));
+    }
+    refda_rpt_plan_compile_groups(obj);
+    return 0;
+}
+
+void refda_rpt_plan_cache_init(refda_rpt_plan_cache_t *obj)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    refda_rpt_plan_dict_init(obj->plans);
+    obj->num_hits = 0;
+    obj->num_miss = 0;
+}
+
+void refda_rpt_plan_cache_deinit(refda_rpt_plan_cache_t *obj)
+{
+    CHKVOID(obj);
+    refda_rpt_plan_dict_clear(obj->plans);
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+void refda_rpt_plan_cache_invalidate(refda_rpt_plan_cache_t *obj)
+{
+    CHKVOID(obj);
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (!refda_rpt_plan_dict_empty_p(obj->plans))
+    {
+        CACE_LOG_DEBUG("Discarding %zu report plans", refda_rpt_plan_dict_size(obj->plans));
+        refda_rpt_plan_dict_reset(obj->plans);
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+}
+
+refda_rpt_plan_ptr_t *refda_rpt_plan_cache_find(refda_rpt_plan_cache_t *obj, const cace_ari_t *rptt)
+{
+    CHKNULL(obj);
+    CHKNULL(rptt);
+
+    refda_rpt_plan_ptr_t *found = NULL;
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    refda_rpt_plan_ptr_t **ptr = refda_rpt_plan_dict_get(obj->plans, *rptt);
+    if (ptr)
+    {
+        found = refda_rpt_plan_ptr_acquire(*ptr);
+        ++(obj->num_hits);
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    return found;
+}
+
+refda_rpt_plan_ptr_t *refda_rpt_plan_cache_add(refda_rpt_plan_cache_t *obj, refda_agent_t *agent,
+                                               const cace_ari_t *rptt)
+{
+    CHKNULL(obj);
+    CHKNULL(agent);
+    CHKNULL(rptt);
+
+    refda_rpt_plan_ptr_t *planp = refda_rpt_plan_ptr_new();
+
+    CACE_MUTEX_LOCK(&(agent->objs_mutex));
+    int res = refda_rpt_plan_compile(refda_rpt_plan_ptr_ref(planp), agent, rptt);
+    CACE_MUTEX_UNLOCK(&(agent->objs_mutex));
+    if (res)
+    {
+        refda_rpt_plan_ptr_clear(planp);
+        return NULL;
+    }
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (refda_rpt_plan_dict_size(obj->plans) >= REFDA_RPT_PLAN_CACHE_MAX)
+    {
+        // simple bound on templates which are used once
+        refda_rpt_plan_dict_reset(obj->plans);
+    }
+    refda_rpt_plan_dict_set_at(obj->plans, *rptt, planp);
+    ++(obj->num_miss);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    return planp;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Pre-resolved plans for producing reports from RPTT values.
+ */
+#ifndef REFDA_RPT_PLAN_H_
+#define REFDA_RPT_PLAN_H_
+
+#include "amm/edd.h"
+#include "eval_ctx.h"
+
+#include "cace/amm/lookup.h"
+#include "cace/ari.h"
+
+#include <m-array.h>
+#include <m-dict.h>
+#include <m-shared-ptr.h>
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Largest number of plans kept before the cache is emptied
+#define REFDA_RPT_PLAN_CACHE_MAX 256
+
+/** The type of activity for a single report plan step.
+ */
+typedef enum
+{
+    /// The template item is not valid and always reports as undefined
+    REFDA_RPT_PLAN_STEP_INVALID = 0,
+    /// The template item is a reference to a value-producing object
+    REFDA_RPT_PLAN_STEP_PROD,
+    /// The template item is an EXPR to be evaluated
+    REFDA_RPT_PLAN_STEP_EXPR,
+    /// The template item is an EDD produced together with others in its group
+    REFDA_RPT_PLAN_STEP_GROUP,
+} refda_rpt_plan_step_type_t;
+
+/** A single pre-resolved item of an RPTT.
+ */
+typedef struct
+{
+    /// The type of this step
+    refda_rpt_plan_step_type_t type;
+    /// Copy of the original template item
+    cace_ari_t item;
+    /// Dereferenced object for a ::REFDA_RPT_PLAN_STEP_PROD or ::REFDA_RPT_PLAN_STEP_GROUP step
+    cace_amm_lookup_t deref;
+    /// Index into refda_rpt_plan_t::groups for a ::REFDA_RPT_PLAN_STEP_GROUP step
+    size_t group_ix;
+    /// Compiled expression for a ::REFDA_RPT_PLAN_STEP_EXPR step
+    refda_eval_program_t program;
+} refda_rpt_plan_step_t;
+
+void refda_rpt_plan_step_init(refda_rpt_plan_step_t *obj);
+
+void refda_rpt_plan_step_init_set(refda_rpt_plan_step_t *obj, const refda_rpt_plan_step_t *src);
+
+void refda_rpt_plan_step_deinit(refda_rpt_plan_step_t *obj);
+
+void refda_rpt_plan_step_set(refda_rpt_plan_step_t *obj, const refda_rpt_plan_step_t *src);
+
+/// M*LIB OPLIST for refda_rpt_plan_step_t
+#define M_OPL_refda_rpt_plan_step_t()                                                      \
+    (INIT(API_2(refda_rpt_plan_step_init)), INIT_SET(API_6(refda_rpt_plan_step_init_set)), \
+     CLEAR(API_2(refda_rpt_plan_step_deinit)), SET(API_6(refda_rpt_plan_step_set)))
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refda_rpt_plan_step_list, refda_rpt_plan_step_t)
+M_ARRAY_DEF(refda_rpt_plan_group_list, const refda_amm_edd_group_t *, M_PTR_OPLIST)
+/// @endcond
+
+/** A pre-resolved plan for producing the items of a single RPTT value.
+ */
+typedef struct
+{
+    /// Steps in the same order as the RPTT items
+    refda_rpt_plan_step_list_t steps;
+    /** EDD groups with more than one member referenced by #steps.
+     * Each group is produced once for all of its steps.
+     */
+    refda_rpt_plan_group_list_t groups;
+} refda_rpt_plan_t;
+
+void refda_rpt_plan_init(refda_rpt_plan_t *obj);
+
+void refda_rpt_plan_deinit(refda_rpt_plan_t *obj);
+
+/** Resolve each item of an RPTT value into a plan step.
+ * Any item which cannot be resolved results in an invalid step.
+ * References to several members of the same EDD group are combined so
+ * that the group is produced once.
+ *
+ * @pre The @c refda_agent_s::objs_mutex must already be locked.
+ * @param[out] obj The plan to reset and populate.
+ * @param[in] agent The agent containing all referenced objects.
+ * @param[in] rptt The RPTT value to compile, which must be an AC.
+ * @return Zero if successful.
+ */
+int refda_rpt_plan_compile(refda_rpt_plan_t *obj, refda_agent_t *agent, const cace_ari_t *rptt);
+
+/// M*LIB OPLIST for refda_rpt_plan_t
+#define M_OPL_refda_rpt_plan_t() \
+    (INIT(API_2(refda_rpt_plan_init)), INIT_SET(0), CLEAR(API_2(refda_rpt_plan_deinit)), SET(0))
+
+/** @struct refda_rpt_plan_ptr_t
+ * Thread-safe shared pointer to a report plan.
+ */
+/// @cond Doxygen_Suppress
+M_SHARED_PTR_DEF(refda_rpt_plan_ptr, refda_rpt_plan_t)
+M_DICT_DEF2(refda_rpt_plan_dict, cace_ari_t, M_OPL_cace_ari_t(), refda_rpt_plan_ptr_t *,
+            M_SHARED_PTR_OPLIST(refda_rpt_plan_ptr, M_OPL_refda_rpt_plan_t()))
+/// @endcond
+
+/** Cache of report plans keyed by RPTT value.
+ * Plans hold pointers to object descriptors, so the cache must be
+ * invalidated whenever objects are added to or obsoleted from the agent.
+ */
+typedef struct
+{
+    /// Mutex for all state
+    pthread_mutex_t mutex;
+    /// Plans keyed by RPTT value
+    refda_rpt_plan_dict_t plans;
+    /// Number of plans used from the cache since it was initialized
+    uint64_t num_hits;
+    /// Number of plans compiled since the cache was initialized
+    uint64_t num_miss;
+} refda_rpt_plan_cache_t;
+
+void refda_rpt_plan_cache_init(refda_rpt_plan_cache_t *obj);
+
+void refda_rpt_plan_cache_deinit(refda_rpt_plan_cache_t *obj);
+
+/** Discard all cached plans.
+ * Plans already in use are freed when they are released.
+ */
+void refda_rpt_plan_cache_invalidate(refda_rpt_plan_cache_t *obj);
+
+/** Get a shared pointer to a cached plan.
+ *
+ * @param[in,out] obj The cache to read.
+ * @param[in] rptt The RPTT value to find a plan for.
+ * @return A new shared pointer which must be cleared by the caller,
+ * or NULL if no plan is cached.
+ */
+refda_rpt_plan_ptr_t *refda_rpt_plan_cache_find(refda_rpt_plan_cache_t *obj, const cace_ari_t *rptt);
+
+/** Compile a new plan and add it to the cache.
+ * This function locks the @c refda_agent_s::objs_mutex while compiling.
+ *
+ * @param[in,out] obj The cache to add to.
+ * @param[in] agent The agent containing all referenced objects.
+ * @param[in] rptt The RPTT value to compile, which must already be
+ * validated as an RPTT.
+ * @return A new shared pointer which must be cleared by the caller,
+ * or NULL if compiling failed.
+ */
+refda_rpt_plan_ptr_t *refda_rpt_plan_cache_add(refda_rpt_plan_cache_t *obj, refda_agent_t *agent,
+                                               const cace_ari_t *rptt);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_RPT_PLAN_H_ */
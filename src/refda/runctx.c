@@ -22,29 +22,6 @@
 
 #include "cace/util/defs.h"
 
-void refda_amm_modval_state_init(refda_amm_modval_state_t *obj)
-{
-    obj->_ctr             = 0;
-    obj->notify           = NULL;
-    obj->notify_user_data = NULL;
-}
-
-void refda_amm_modval_state_deinit(refda_amm_modval_state_t *obj)
-{
-    // no real cleanup
-    memset(obj, 0, sizeof(*obj));
-}
-
-void refda_amm_modval_state_inc(refda_amm_modval_state_t *obj)
-{
-    obj->_ctr += 1;
-
-    if (obj->notify)
-    {
-        (obj->notify)(obj, obj->notify_user_data);
-    }
-}
-
 void refda_runctx_init(refda_runctx_t *ctx)
 {
     CHKVOID(ctx);
@@ -19,6 +19,7 @@
 #define REFDA_RUNCTX_H_
 
 #include "acl.h"
+#include "amm/modval.h"
 
 #include "cace/amm/lookup.h"
 #include "cace/ari/base.h"
@@ -33,34 +34,6 @@ extern "C" {
 typedef struct refda_agent_s   refda_agent_t;
 typedef struct refda_msgdata_s refda_msgdata_t;
 
-/** Modifiable value state counter.
- * This is used by EDD and VAR objects.
- */
-typedef struct refda_amm_modval_state_s
-{
-    /// The internal counter
-    uint64_t _ctr;
-
-    /** A callback used when the state counter is incremented.
-     *
-     * @param obj The specific counter which changed.
-     * @param user_data A copy of the #notify_user_data pointer.
-     */
-    void (*notify)(struct refda_amm_modval_state_s *obj, void *user_data);
-    /// Optional context data for the #notify callback
-    void *notify_user_data;
-
-} refda_amm_modval_state_t;
-
-void refda_amm_modval_state_init(refda_amm_modval_state_t *obj);
-
-void refda_amm_modval_state_deinit(refda_amm_modval_state_t *obj);
-
-/** Increment the counter to the next value and signal to a registered callback.
- *
- */
-void refda_amm_modval_state_inc(refda_amm_modval_state_t *obj);
-
 /** Context for all agent runtime activities.
  */
 typedef struct
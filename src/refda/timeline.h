@@ -80,6 +80,18 @@ typedef struct refda_timeline_tbr_event_s
     void (*callback)(refda_agent_t *agent, refda_amm_tbr_desc_t *tbr);
 } refda_timeline_tbr_event_t;
 
+typedef struct refda_timeline_rpt_event_s
+{
+    /// Agent which has reports waiting on deferred productions
+    refda_agent_t *agent;
+
+    /** Reporting-defined callback, which should not be null.
+     *
+     * @param[in,out] agent The associated agent.
+     */
+    void (*callback)(refda_agent_t *agent);
+} refda_timeline_rpt_event_t;
+
 typedef struct refda_timeline_event_s
 {
     enum
@@ -87,6 +99,7 @@ typedef struct refda_timeline_event_s
         REFDA_TIMELINE_EXEC = 0,
         REFDA_TIMELINE_TBR,
         REFDA_TIMELINE_SBR,
+        REFDA_TIMELINE_RPT,
     } purpose;
     /** Specific time at which the event should occur.
      */
@@ -97,6 +110,7 @@ typedef struct refda_timeline_event_s
         refda_timeline_exec_event_t exec;
         refda_timeline_sbr_event_t  sbr;
         refda_timeline_tbr_event_t  tbr;
+        refda_timeline_rpt_event_t  rpt;
     };
 
 } refda_timeline_event_t;
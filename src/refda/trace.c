@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Agent EXECSET pipeline tracing.
+ */
+#include "trace.h"
+
+#include "cace/util/defs.h"
+#include "cace/util/mutex.h"
+
+static const char *stage_names[] = {
+    "recv", "dequeue", "expand", "ctrl-start", "ctrl-finish", "rpt-queue", "send",
+};
+
+const char *refda_trace_stage_name(refda_trace_stage_t stage)
+{
+    if ((stage < 0) || ((size_t)stage >= sizeof(stage_names) / sizeof(stage_names[0])))
+    {
+        return "unknown";
+    }
+    return stage_names[stage];
+}
+
+#if AGENT_EXEC_TRACE
+
+void refda_trace_init(refda_trace_t *obj)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    for (size_t ix = 0; ix < REFDA_TRACE_RING_SIZE; ++ix)
+    {
+        refda_trace_rec_t *rec = &(obj->recs[ix]);
+        cace_ari_init(&(rec->nonce));
+        cace_ari_init(&(rec->target));
+    }
+    obj->next  = 0;
+    obj->count = 0;
+}
+
+void refda_trace_deinit(refda_trace_t *obj)
+{
+    CHKVOID(obj);
+    for (size_t ix = 0; ix < REFDA_TRACE_RING_SIZE; ++ix)
+    {
+        refda_trace_rec_t *rec = &(obj->recs[ix]);
+        cace_ari_deinit(&(rec->nonce));
+        cace_ari_deinit(&(rec->target));
+    }
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+void refda_trace_mark(refda_trace_t *obj, const cace_ari_t *nonce, refda_trace_stage_t stage,
+                      const cace_ari_t *target)
+{
+    CHKVOID(obj);
+    CHKVOID(nonce);
+    if (cace_ari_is_undefined(nonce) || cace_ari_is_null(nonce))
+    {
+        return;
+    }
+
+    struct timespec now;
+    (void)clock_gettime(CLOCK_REALTIME, &now);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+
+    refda_trace_rec_t *rec = &(obj->recs[obj->next]);
+    cace_ari_set_copy(&(rec->nonce), nonce);
+    rec->stage     = stage;
+    rec->timestamp = now;
+    if (target)
+    {
+        cace_ari_set_copy(&(rec->target), target);
+    }
+    else
+    {
+        cace_ari_reset(&(rec->target));
+    }
+
+    obj->next = (obj->next + 1) % REFDA_TRACE_RING_SIZE;
+    if (obj->count < REFDA_TRACE_RING_SIZE)
+    {
+        ++(obj->count);
+    }
+
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+}
+
+int refda_trace_get_table(refda_trace_t *obj, cace_ari_tbl_t *table)
+{
+    CHKERR1(obj);
+    CHKERR1(table);
+
+    cace_ari_tbl_reset(table, 4, 0);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+
+    // oldest record is just after the newest
+    size_t rec_ix = (obj->next + REFDA_TRACE_RING_SIZE - obj->count) % REFDA_TRACE_RING_SIZE;
+    for (size_t cnt = 0; cnt < obj->count; ++cnt)
+    {
+        const refda_trace_rec_t *rec = &(obj->recs[rec_ix]);
+
+        cace_ari_array_t row;
+        cace_ari_array_init(row);
+        cace_ari_array_resize(row, table->ncols);
+
+        cace_ari_set_copy(cace_ari_array_get(row, 0), &(rec->nonce));
+        cace_ari_set_tstr(cace_ari_array_get(row, 1), refda_trace_stage_name(rec->stage), true);
+        cace_ari_set_tp_posix(cace_ari_array_get(row, 2), rec->timestamp);
+        if (cace_ari_is_undefined(&(rec->target)))
+        {
+            cace_ari_set_null(cace_ari_array_get(row, 3));
+        }
+        else
+        {
+            cace_ari_set_copy(cace_ari_array_get(row, 3), &(rec->target));
+        }
+
+        cace_ari_tbl_move_row_array(table, row);
+
+        rec_ix = (rec_ix + 1) % REFDA_TRACE_RING_SIZE;
+    }
+
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return 0;
+}
+
+#endif /* AGENT_EXEC_TRACE */
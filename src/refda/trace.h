@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refda
+ * Agent EXECSET pipeline tracing.
+ *
+ * When enabled by the AGENT_EXEC_TRACE build option, each stage an EXECSET
+ * with a non-null nonce passes through is recorded with a timestamp into a
+ * bounded ring, where the oldest records are overwritten by newer ones.
+ * When disabled, the REFDA_TRACE_MARK() macro expands to nothing and no
+ * state is kept.
+ */
+#ifndef REFDA_TRACE_H_
+#define REFDA_TRACE_H_
+
+#include "cace/ari.h"
+#include "cace/config.h"
+
+#include <pthread.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Number of records retained in each trace ring
+#define REFDA_TRACE_RING_SIZE 1024
+
+/** The pipeline stages which are traced.
+ */
+typedef enum
+{
+    /// An EXECSET was received and queued by the ingress worker
+    REFDA_TRACE_RECV = 0,
+    /// An EXECSET was taken from the queue by the exec worker
+    REFDA_TRACE_DEQUEUE,
+    /// All targets of an EXECSET were expanded into sequences
+    REFDA_TRACE_EXPAND,
+    /// Execution of a single CTRL started
+    REFDA_TRACE_CTRL_START,
+    /// Execution of a single CTRL finished, successfully or not
+    REFDA_TRACE_CTRL_FINISH,
+    /// An execution RPTSET was queued for egress
+    REFDA_TRACE_RPT_QUEUE,
+    /// An execution RPTSET was sent by the egress worker
+    REFDA_TRACE_SEND,
+} refda_trace_stage_t;
+
+/** Get a human-readable name for a trace stage.
+ *
+ * @param stage The stage to name.
+ * @return The static name text.
+ */
+const char *refda_trace_stage_name(refda_trace_stage_t stage);
+
+#if AGENT_EXEC_TRACE || defined(DOXYGEN)
+
+/** A single trace record.
+ */
+typedef struct
+{
+    /// The EXECSET nonce associated with this record
+    cace_ari_t nonce;
+    /// The stage being recorded
+    refda_trace_stage_t stage;
+    /// Local real time of the record
+    struct timespec timestamp;
+    /// The CTRL or report source for this stage, or undefined
+    cace_ari_t target;
+} refda_trace_rec_t;
+
+/** A bounded ring of trace records.
+ */
+typedef struct
+{
+    /// Mutex for all other state
+    pthread_mutex_t mutex;
+    /// Storage for the ring
+    refda_trace_rec_t recs[REFDA_TRACE_RING_SIZE];
+    /// Index of the next record to write
+    size_t next;
+    /// Number of valid records
+    size_t count;
+} refda_trace_t;
+
+void refda_trace_init(refda_trace_t *obj);
+
+void refda_trace_deinit(refda_trace_t *obj);
+
+/** Record a single stage, overwriting the oldest record if the ring is full.
+ * Nothing is recorded for a null or undefined nonce, which are used for
+ * agent-internal execution.
+ *
+ * @param[in,out] obj The ring to record into.
+ * @param[in] nonce The nonce of the EXECSET being traced.
+ * @param stage The stage being recorded.
+ * @param[in] target The optional CTRL or report source, which may be NULL.
+ */
+void refda_trace_mark(refda_trace_t *obj, const cace_ari_t *nonce, refda_trace_stage_t stage,
+                      const cace_ari_t *target);
+
+/** Produce a table of all records, oldest first, with columns:
+ *  1. The EXECSET nonce
+ *  2. The stage name
+ *  3. The time of the record
+ *  4. The CTRL or report source, or null
+ *
+ * @param[in,out] obj The ring to read from.
+ * @param[out] table The table to reset and populate.
+ * @return Zero if successful.
+ */
+int refda_trace_get_table(refda_trace_t *obj, cace_ari_tbl_t *table);
+
+/** Record a trace stage from an agent pointer.
+ *
+ * @param agent The agent to record within.
+ * @param nonce Pointer to the nonce of the EXECSET.
+ * @param stage The stage being recorded.
+ * @param target Optional pointer to an associated target.
+ */
+#define REFDA_TRACE_MARK(agent, nonce, stage, target) \
+    refda_trace_mark(&((agent)->instr.trace), (nonce), (stage), (target))
+
+#else /* AGENT_EXEC_TRACE */
+
+#define REFDA_TRACE_MARK(agent, nonce, stage, target)
+
+#endif /* AGENT_EXEC_TRACE */
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDA_TRACE_H_ */
@@ -154,7 +154,11 @@ static int refda_valprod_edd_run(const refda_amm_edd_desc_t *obj, refda_valprod_
 
     (obj->produce)(&eddctx);
 
-    if (cace_log_is_enabled_for(LOG_DEBUG))
+    if (prodctx->pending)
+    {
+        CACE_LOG_DEBUG("production deferred by the producer");
+    }
+    else if (cace_log_is_enabled_for(LOG_DEBUG))
     {
         m_string_t buf;
         m_string_init(buf);
@@ -175,11 +179,17 @@ void refda_valprod_ctx_init(refda_valprod_ctx_t *obj, refda_runctx_t *runctx, co
     obj->ref    = ref;
     obj->deref  = deref;
     cace_ari_init(&(obj->value));
+    obj->allow_defer = false;
+    obj->pending     = NULL;
 }
 
 void refda_valprod_ctx_deinit(refda_valprod_ctx_t *obj)
 {
     CHKVOID(obj);
+    if (obj->pending)
+    {
+        refda_edd_pending_ptr_clear(obj->pending);
+    }
     cace_ari_deinit(&(obj->value));
     memset(obj, 0, sizeof(refda_valprod_ctx_t));
 }
@@ -228,7 +238,21 @@ int refda_valprod_run(refda_valprod_ctx_t *ctx)
         {
             refda_amm_edd_desc_t *edd = ctx->deref->obj->app_data.ptr;
 
+            refda_prodcache_t *cache = edd->cacheable ? &(ctx->runctx->agent->prod_cache) : NULL;
+            if (cache && refda_prodcache_get(cache, ctx->deref, &(ctx->value)))
+            {
+                CACE_LOG_DEBUG("production reused from this iteration");
+                break;
+            }
+
+            struct timespec start;
+            REFDA_LATENCY_START(&start);
             retval = refda_valprod_edd_run(edd, ctx);
+            REFDA_LATENCY_RECORD(ctx->runctx->agent, REFDA_LATENCY_EDD, ctx->deref, &start);
+            if (cache && !retval && !cace_ari_is_undefined(&(ctx->value)))
+            {
+                refda_prodcache_put(cache, ctx->deref, &(ctx->value));
+            }
             break;
         }
         default:
@@ -18,6 +18,7 @@
 #ifndef REFDA_VALPROD_H_
 #define REFDA_VALPROD_H_
 
+#include "edd_pending.h"
 #include "runctx.h"
 
 #ifdef __cplusplus
@@ -49,6 +50,17 @@ typedef struct
      * to indicate successful production.
      */
     cace_ari_t value;
+
+    /** True if the consumer of this production is able to use a deferred
+     * result from #pending.
+     * This is initialized as false.
+     */
+    bool allow_defer;
+
+    /** Set if an EDD producer deferred its result, in which case #value
+     * is left undefined.
+     */
+    refda_edd_pending_ptr_t *pending;
 } refda_valprod_ctx_t;
 
 /** Initialize a context based on an object reference ARI and
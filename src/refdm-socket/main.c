@@ -40,7 +40,7 @@ static void daemon_signal_handler(int signum)
 
 static void show_usage(const char *argv0)
 {
-    fprintf(stderr, "Usage: %s {-h} -a <listen-EID>\n", argv0);
+    fprintf(stderr, "Usage: %s {-h} {-r <archive-dir>} -a <listen-EID>\n", argv0);
 }
 
 int main(int argc, char *argv[])
@@ -59,7 +59,7 @@ int main(int argc, char *argv[])
     {
         {
             int opt;
-            while ((opt = getopt(argc, argv, ":hl:a:")) != -1)
+            while ((opt = getopt(argc, argv, ":hl:a:r:")) != -1)
             {
                 switch (opt)
                 {
@@ -79,6 +79,13 @@ int main(int argc, char *argv[])
                         }
                         m_string_set_cstr(own_eid, optarg);
                         break;
+                    case 'r':
+#if !POSTGRESQL_FOUND
+                        m_string_set_cstr(mgr.archive_dir, optarg);
+#else
+                        fprintf(stderr, "Report archive is not used with a database\n");
+#endif
+                        break;
                     case 'h':
                     default:
                         show_usage(argv[0]);
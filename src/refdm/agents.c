@@ -37,127 +37,27 @@
 
 #include "agents.h"
 
-#include "cace/ari/text_util.h"
 #include "cace/util/defs.h"
-#include "cace/util/logging.h"
-#include "cace/util/mutex.h"
-
-#include <sys/stat.h>
 
 void refdm_agent_init(refdm_agent_t *obj)
 {
     CHKVOID(obj);
     m_string_init(obj->eid);
+    atomic_init(&(obj->num_rptset_recv), 0);
+    atomic_init(&(obj->last_recv_time), 0);
+    refdm_rpt_delta_dict_init(obj->rpt_delta_last);
+    obj->rpt_delta_resync_time = 0;
 #if !POSTGRESQL_FOUND
-    cace_ari_list_init(obj->rptsets);
-    obj->mgr_time = 0;
+    refdm_archive_init(&(obj->rptsets));
 #endif
-
-    pthread_mutex_init(&(obj->log_mutex), NULL);
-    obj->log_fd       = NULL;
-    obj->log_fd_cnt   = 0;
-    obj->log_file_num = 0;
 }
 
 void refdm_agent_deinit(refdm_agent_t *obj)
 {
     CHKVOID(obj);
-
-    if (obj->log_fd)
-    {
-        fclose(obj->log_fd);
-        obj->log_fd = NULL;
-    }
-
-    pthread_mutex_destroy(&(obj->log_mutex));
 #if !POSTGRESQL_FOUND
-    cace_ari_list_clear(obj->rptsets);
+    refdm_archive_deinit(&(obj->rptsets));
 #endif
+    refdm_rpt_delta_dict_clear(obj->rpt_delta_last);
     m_string_clear(obj->eid);
 }
-
-void refdm_agent_rotate_log(refdm_agent_t *agent, const refdm_agent_autologging_cfg_t *cfg, bool force)
-{
-    static char agent_autologging_sep = '_';
-
-    CACE_MUTEX_LOCK(&agent->log_mutex);
-
-    if (cfg->enabled)
-    {
-        if (agent->log_fd != NULL)
-        {
-            // Roate log if cnt has been reset to < 0, or if it exceeds defined limit
-            if (force || (agent->log_fd_cnt < 0) || ((cfg->limit > 0) && (agent->log_fd_cnt > cfg->limit)))
-            {
-                fclose(agent->log_fd);
-                agent->log_fd = NULL;
-            }
-            else
-            {
-                return; // Keep using the open file
-            }
-        }
-
-        m_string_t eid_path_seg;
-        m_string_init(eid_path_seg);
-        // Ensure EID is encoded to filesystem-compatible character set
-        {
-            cace_data_t eid_bytes;
-            cace_data_init_view(&eid_bytes, m_string_size(agent->eid) + 1,
-                                (cace_data_ptr_t)m_string_get_cstr(agent->eid));
-            cace_uri_percent_encode(eid_path_seg, &eid_bytes, NULL);
-        }
-
-        m_string_t filepath;
-        m_string_init(filepath);
-        // Create sub-directories if required (first file only)
-        if (cfg->agent_dirs)
-        {
-            agent_autologging_sep = '/';
-
-            if (agent->log_fd_cnt == 0)
-            {
-                int res = m_string_printf(filepath, "%s/%s", cfg->dir, m_string_get_cstr(eid_path_seg));
-                if (res < 0)
-                {
-                    CACE_LOG_ERR("Failed to write file path, got size %d", res);
-                }
-                else
-                {
-                    // This will fail if directory already exists, which is acceptable
-                    mkdir(m_string_get_cstr(filepath), 0770);
-                }
-            }
-        }
-        int res = m_string_printf(filepath, "%s/%s%c%d.log", cfg->dir, m_string_get_cstr(eid_path_seg),
-                                  agent_autologging_sep, // Set to "/" to use separate directories per agent
-                                  agent->log_file_num);
-        if (res < 0)
-        {
-            CACE_LOG_ERR("Failed to write file path, got size %d", res);
-        }
-        else
-        {
-            agent->log_fd = fopen(m_string_get_cstr(filepath), "a");
-            if (agent->log_fd != NULL)
-            {
-                agent->log_fd_cnt = 0;
-                agent->log_file_num++;
-            }
-            else
-            {
-                CACE_LOG_ERR("Failed to open report log file (%s) for agent %s", m_string_get_cstr(filepath),
-                             m_string_get_cstr(agent->eid));
-            }
-        }
-
-        m_string_clear(filepath);
-        m_string_clear(eid_path_seg);
-    }
-    else if (agent->log_fd != NULL)
-    {
-        fclose(agent->log_fd);
-        agent->log_fd = NULL;
-    }
-    CACE_MUTEX_UNLOCK(&agent->log_mutex);
-}
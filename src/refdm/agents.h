@@ -38,18 +38,33 @@
 #define REFDM_AGENTS_H_
 
 #include "refdm/config.h"
+#if !POSTGRESQL_FOUND
+#include "archive.h"
+#endif
 
 #include "cace/ari.h"
+#include "cace/ari/rpt_delta.h"
 #include "cace/cace_data.h"
 
+#include <m-atomic.h>
+#include <m-dict.h>
 #include <m-string.h>
 
 #include <pthread.h>
+#include <time.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/// Minimum interval in seconds between resync requests to one agent
+#define REFDM_RPT_DELTA_RESYNC_HOLDOFF 10
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(refdm_rpt_delta_dict, cace_ari_t, M_OPL_cace_ari_t(), cace_ari_rpt_delta_base_t,
+            M_OPL_cace_ari_rpt_delta_base_t())
+/// @endcond
+
 /**
  * Data structure representing a managed remote agent.
  **/
@@ -58,18 +73,24 @@ typedef struct
     /// Endpoint ID (opaque URI) for this agent
     m_string_t eid;
 
+    /// Count of RPTSET values received from this agent
+    atomic_ullong num_rptset_recv;
+    /// Reception time of the last RPTSET in POSIX seconds, or zero if none
+    atomic_llong last_recv_time;
+
+    /** State for reassembling delta-encoded reports from each source.
+     * This is owned by the ingress worker thread.
+     */
+    refdm_rpt_delta_dict_t rpt_delta_last;
+    /** Time of the last resync request sent to this agent in POSIX seconds,
+     * or zero if none. This is owned by the ingress worker thread.
+     */
+    time_t rpt_delta_resync_time;
+
 #if !POSTGRESQL_FOUND
-    /// Received RPTSET values
-    cace_ari_list_t rptsets;
-    /// Local time of last #rptsets
-    time_t mgr_time;
+    /// Received RPTSET values with their local reception times
+    refdm_archive_t rptsets;
 #endif
-
-    /// Mutex for #log_fd and related data
-    pthread_mutex_t log_mutex;
-    FILE           *log_fd;
-    int             log_fd_cnt;
-    int             log_file_num;
 } refdm_agent_t;
 
 void refdm_agent_init(refdm_agent_t *obj);
@@ -84,17 +105,12 @@ void refdm_agent_deinit(refdm_agent_t *obj);
 typedef struct
 {
     bool enabled;
-    bool rx_rpt;     // Log all reports to file upon receipt
-    int  limit;      // Number of entries (reports+tables) per file
-    int  agent_dirs; // If true, create discrete directories for each agent
-    char dir[32];    // directory to save report logs to (or place sub-directories in)
+    bool rx_rpt;  // Log all RPTSETs to binary segment files upon receipt
+    int  limit;   // Number of records per segment file, or zero for no rotation
+    char dir[32]; // directory to save report log segments to
 
 } refdm_agent_autologging_cfg_t;
 
-/** Common log file management.
- */
-void refdm_agent_rotate_log(refdm_agent_t *agent, const refdm_agent_autologging_cfg_t *cfg, bool force);
-
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,776 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Append-only per-agent report archive definitions.
+ */
+#include "archive.h"
+
+#include "cace/ari/cbor.h"
+#include "cace/ari/cbor_scan.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+#include "cace/util/mutex.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+void refdm_archive_src_init(refdm_archive_src_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_init(&(obj->source));
+    refdm_archive_rpt_loc_list_init(obj->reports);
+}
+
+void refdm_archive_src_init_set(refdm_archive_src_t *obj, const refdm_archive_src_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_init_copy(&(obj->source), &(src->source));
+    refdm_archive_rpt_loc_list_init_set(obj->reports, src->reports);
+}
+
+void refdm_archive_src_deinit(refdm_archive_src_t *obj)
+{
+    CHKVOID(obj);
+    refdm_archive_rpt_loc_list_clear(obj->reports);
+    cace_ari_deinit(&(obj->source));
+}
+
+void refdm_archive_src_set(refdm_archive_src_t *obj, const refdm_archive_src_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_ari_set_copy(&(obj->source), &(src->source));
+    refdm_archive_rpt_loc_list_set(obj->reports, src->reports);
+}
+
+static void refdm_archive_hdr_encode(uint8_t *hdr, uint32_t len, int64_t mgr_time)
+{
+    for (int ix = 0; ix < 4; ++ix)
+    {
+        hdr[ix] = (len >> (8 * (3 - ix))) & 0xFF;
+    }
+    const uint64_t tval = (uint64_t)mgr_time;
+    for (int ix = 0; ix < 8; ++ix)
+    {
+        hdr[4 + ix] = (tval >> (8 * (7 - ix))) & 0xFF;
+    }
+}
+
+static void refdm_archive_hdr_decode(const uint8_t *hdr, uint32_t *len, int64_t *mgr_time)
+{
+    uint32_t lval = 0;
+    for (int ix = 0; ix < 4; ++ix)
+    {
+        lval = (lval << 8) | hdr[ix];
+    }
+    uint64_t tval = 0;
+    for (int ix = 0; ix < 8; ++ix)
+    {
+        tval = (tval << 8) | hdr[4 + ix];
+    }
+    *len      = lval;
+    *mgr_time = (int64_t)tval;
+}
+
+/** Open a backing file descriptor.
+ *
+ * @param[in] path The file to open or create, or NULL for an unnamed file.
+ * @param trunc True if existing content is to be discarded.
+ * @return The file descriptor, or negative upon failure.
+ */
+static int refdm_archive_open_fd(const char *path, bool trunc)
+{
+    int fd;
+    if (path)
+    {
+        fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC | (trunc ? O_TRUNC : 0), 0660);
+        if (fd < 0)
+        {
+            CACE_LOG_ERR("Failed to open archive file %s errno %d", path, errno);
+        }
+    }
+    else
+    {
+        const char *tmpdir = getenv("TMPDIR");
+        m_string_t  tmppath;
+        m_string_init_printf(tmppath, "%s/refdm-archive-XXXXXX", tmpdir ? tmpdir : "/tmp");
+        // mkstemp() needs a mutable name buffer
+        char *name = strdup(m_string_get_cstr(tmppath));
+        m_string_clear(tmppath);
+
+        fd = mkstemp(name);
+        if (fd < 0)
+        {
+            CACE_LOG_ERR("Failed to create temporary archive file %s errno %d", name, errno);
+        }
+        else
+        {
+            // the name is not needed after opening
+            unlink(name);
+        }
+        free(name);
+    }
+    return fd;
+}
+
+static int refdm_archive_write_full(int fd, const uint8_t *buf, size_t len, uint64_t offset)
+{
+    while (len > 0)
+    {
+        ssize_t got = pwrite(fd, buf, len, (off_t)offset);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return 2;
+        }
+        buf += got;
+        len -= got;
+        offset += got;
+    }
+    return 0;
+}
+
+/** Release a reference to a mapping, unmapping it when unused.
+ * @pre The archive mutex is held.
+ */
+static void refdm_archive_map_unref(refdm_archive_map_t *map)
+{
+    if (--(map->refcnt) == 0)
+    {
+        munmap(map->ptr, map->len);
+        CACE_FREE(map);
+    }
+}
+
+/** Take a reference to the current mapping.
+ * @pre The mutex is held.
+ * @return The mapping, which is NULL for an empty archive.
+ */
+static refdm_archive_map_t *refdm_archive_map_ref(refdm_archive_t *obj)
+{
+    if (obj->map)
+    {
+        obj->map->refcnt++;
+    }
+    return obj->map;
+}
+
+/** Release a mapping reference taken by refdm_archive_map_ref().
+ * @pre The mutex is not held.
+ */
+static void refdm_archive_map_release(refdm_archive_t *obj, refdm_archive_map_t *map)
+{
+    if (map)
+    {
+        CACE_MUTEX_LOCK(&(obj->mutex));
+        refdm_archive_map_unref(map);
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+    }
+}
+
+/** Release the current mapping, which remains valid for other holders.
+ * @pre The mutex is held.
+ */
+static void refdm_archive_unmap(refdm_archive_t *obj)
+{
+    if (obj->map)
+    {
+        refdm_archive_map_unref(obj->map);
+        obj->map = NULL;
+    }
+}
+
+/** Ensure the mapping covers all valid content.
+ * @pre The mutex is held.
+ */
+static int refdm_archive_remap(refdm_archive_t *obj)
+{
+    if (obj->map ? (obj->map->len == obj->size) : (obj->size == 0))
+    {
+        return 0;
+    }
+
+    refdm_archive_unmap(obj);
+    if (obj->size == 0)
+    {
+        return 0;
+    }
+
+    refdm_archive_map_t *map = CACE_MALLOC(sizeof(refdm_archive_map_t));
+    if (!map)
+    {
+        return 2;
+    }
+    void *ptr = mmap(NULL, obj->size, PROT_READ, MAP_SHARED, obj->fd, 0);
+    if (ptr == MAP_FAILED)
+    {
+        CACE_LOG_ERR("Failed to map archive file errno %d", errno);
+        CACE_FREE(map);
+        return 2;
+    }
+    map->ptr    = ptr;
+    map->len    = obj->size;
+    map->refcnt = 1;
+    obj->map    = map;
+    return 0;
+}
+
+/** Add each report of a record to the source index.
+ * Only the report sources are decoded, and only the first time each
+ * distinct source is seen.
+ * @pre The mutex is held.
+ */
+static void refdm_archive_track_sources(refdm_archive_t *obj, time_t mgr_time, uint64_t offset,
+                                        const uint8_t *body_ptr, uint32_t body_len)
+{
+    cace_data_t body;
+    // not really mutable, but needed for the view interface
+    cace_data_init_view(&body, body_len, (cace_data_ptr_t)body_ptr);
+
+    cace_ari_cbor_index_t idx;
+    cace_ari_cbor_scan_t  rptset_it;
+    cace_ari_cbor_span_t  span;
+    if (cace_ari_cbor_index(&idx, &body, 0) || (idx.ari_type != CACE_ARI_TYPE_RPTSET) || !idx.is_container
+        || cace_ari_cbor_scan_enter(&rptset_it, &body, idx.value.offset))
+    {
+        CACE_LOG_WARNING("Archive record at offset %" PRIu64 " is not an RPTSET", offset);
+        return;
+    }
+    // skip over the nonce and reference time
+    if (cace_ari_cbor_scan_next(&rptset_it, &span) || cace_ari_cbor_scan_next(&rptset_it, &span))
+    {
+        return;
+    }
+
+    cace_ari_cbor_span_t rpt_span;
+    while (!cace_ari_cbor_scan_next(&rptset_it, &rpt_span))
+    {
+        // the source follows the relative time
+        cace_ari_cbor_scan_t rpt_it;
+        if (cace_ari_cbor_scan_enter(&rpt_it, &body, rpt_span.offset) || cace_ari_cbor_scan_next(&rpt_it, &span)
+            || cace_ari_cbor_scan_next(&rpt_it, &span))
+        {
+            continue;
+        }
+
+        cace_data_t key;
+        cace_data_init_view(&key, span.len, body.ptr + span.offset);
+
+        refdm_archive_src_t *src = refdm_archive_src_dict_get(obj->sources, key);
+        if (!src)
+        {
+            src = refdm_archive_src_dict_safe_get(obj->sources, key);
+            if (cace_ari_cbor_decode(&(src->source), &key, NULL, NULL))
+            {
+                // still tracked, but will never match
+                cace_ari_reset(&(src->source));
+            }
+        }
+        cace_data_deinit(&key);
+
+        const refdm_archive_rpt_loc_t loc = {
+            .mgr_time   = mgr_time,
+            .offset     = offset,
+            .rpt_offset = rpt_span.offset,
+            .rpt_len    = rpt_span.len,
+        };
+        refdm_archive_rpt_loc_list_push_back(src->reports, loc);
+    }
+}
+
+/** Update the count and indices for a new record.
+ * @pre The mutex is held.
+ */
+static void refdm_archive_track(refdm_archive_t *obj, time_t mgr_time, uint64_t offset, const uint8_t *body_ptr,
+                                uint32_t body_len)
+{
+    if ((obj->count % REFDM_ARCHIVE_INDEX_STRIDE) == 0)
+    {
+        refdm_archive_idx_list_push_back(obj->index, (refdm_archive_idx_t) { .mgr_time = mgr_time, .offset = offset });
+    }
+    refdm_archive_track_sources(obj, mgr_time, offset, body_ptr, body_len);
+    obj->count++;
+    obj->last_time = mgr_time;
+}
+
+/** Reset all record tracking state.
+ * @pre The mutex is held.
+ */
+static void refdm_archive_untrack(refdm_archive_t *obj)
+{
+    refdm_archive_idx_list_reset(obj->index);
+    refdm_archive_src_dict_reset(obj->sources);
+    obj->size      = 0;
+    obj->count     = 0;
+    obj->last_time = 0;
+}
+
+void refdm_archive_init(refdm_archive_t *obj)
+{
+    CHKVOID(obj);
+    pthread_mutex_init(&(obj->mutex), NULL);
+    m_string_init(obj->path);
+    obj->fd        = -1;
+    obj->size      = 0;
+    obj->map       = NULL;
+    obj->count     = 0;
+    obj->last_time = 0;
+    refdm_archive_idx_list_init(obj->index);
+    refdm_archive_src_dict_init(obj->sources);
+}
+
+void refdm_archive_deinit(refdm_archive_t *obj)
+{
+    CHKVOID(obj);
+    refdm_archive_close(obj);
+    refdm_archive_src_dict_clear(obj->sources);
+    refdm_archive_idx_list_clear(obj->index);
+    m_string_clear(obj->path);
+    pthread_mutex_destroy(&(obj->mutex));
+}
+
+int refdm_archive_open(refdm_archive_t *obj, const char *path)
+{
+    CHKERR1(obj);
+    refdm_archive_close(obj);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (path)
+    {
+        m_string_set_cstr(obj->path, path);
+    }
+    else
+    {
+        m_string_reset(obj->path);
+    }
+
+    obj->fd = refdm_archive_open_fd(path, false);
+    if (obj->fd < 0)
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return 2;
+    }
+
+    struct stat st;
+    if (fstat(obj->fd, &st))
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return 2;
+    }
+    obj->size = st.st_size;
+    if (refdm_archive_remap(obj))
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return 3;
+    }
+
+    // rebuild state from existing records
+    const uint8_t *map_ptr   = obj->map ? obj->map->ptr : NULL;
+    const uint64_t file_size = obj->size;
+    uint64_t       offset    = 0;
+    refdm_archive_untrack(obj);
+    while (offset + REFDM_ARCHIVE_HDR_LEN <= file_size)
+    {
+        uint32_t len;
+        int64_t  mgr_time;
+        refdm_archive_hdr_decode(map_ptr + offset, &len, &mgr_time);
+        if (offset + REFDM_ARCHIVE_HDR_LEN + len > file_size)
+        {
+            break;
+        }
+        refdm_archive_track(obj, (time_t)mgr_time, offset, map_ptr + offset + REFDM_ARCHIVE_HDR_LEN, len);
+        offset += REFDM_ARCHIVE_HDR_LEN + len;
+    }
+    obj->size = offset;
+
+    if (offset < file_size)
+    {
+        CACE_LOG_WARNING("Truncating partial archive record at offset %" PRIu64, offset);
+        if (ftruncate(obj->fd, (off_t)offset))
+        {
+            CACE_LOG_ERR("Failed to truncate archive file errno %d", errno);
+        }
+    }
+    CACE_LOG_INFO("Opened archive with %zu records", obj->count);
+
+    int retval = refdm_archive_remap(obj) ? 3 : 0;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return retval;
+}
+
+void refdm_archive_close(refdm_archive_t *obj)
+{
+    CHKVOID(obj);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    refdm_archive_unmap(obj);
+    if (obj->fd >= 0)
+    {
+        close(obj->fd);
+        obj->fd = -1;
+    }
+    refdm_archive_untrack(obj);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+}
+
+int refdm_archive_append(refdm_archive_t *obj, time_t mgr_time, const cace_data_t *body)
+{
+    CHKERR1(obj);
+    CHKERR1(body);
+    if (body->len > UINT32_MAX)
+    {
+        return 2;
+    }
+
+    uint8_t hdr[REFDM_ARCHIVE_HDR_LEN];
+    refdm_archive_hdr_encode(hdr, body->len, mgr_time);
+
+    int retval = 0;
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (obj->fd < 0)
+    {
+        retval = 3;
+    }
+    else
+    {
+        struct iovec parts[] = {
+            { .iov_base = hdr, .iov_len = sizeof(hdr) },
+            { .iov_base = body->ptr, .iov_len = body->len },
+        };
+        const size_t total = parts[0].iov_len + parts[1].iov_len;
+
+        ssize_t got = pwritev(obj->fd, parts, 2, (off_t)obj->size);
+        if ((got >= 0) && ((size_t)got < total))
+        {
+            // finish any short write piecewise
+            size_t done = got;
+            if (done < sizeof(hdr))
+            {
+                if (refdm_archive_write_full(obj->fd, hdr + done, sizeof(hdr) - done, obj->size + done))
+                {
+                    got = -1;
+                }
+                done = sizeof(hdr);
+            }
+            if ((got >= 0)
+                && refdm_archive_write_full(obj->fd, body->ptr + (done - sizeof(hdr)), total - done, obj->size + done))
+            {
+                got = -1;
+            }
+        }
+
+        if (got < 0)
+        {
+            CACE_LOG_ERR("Failed to write archive record errno %d", errno);
+            // discard any partial record
+            if (ftruncate(obj->fd, (off_t)obj->size))
+            {
+                CACE_LOG_ERR("Failed to truncate archive file errno %d", errno);
+            }
+            retval = 4;
+        }
+        else
+        {
+            refdm_archive_track(obj, mgr_time, obj->size, body->ptr, body->len);
+            obj->size += total;
+        }
+    }
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return retval;
+}
+
+int refdm_archive_foreach(refdm_archive_t *obj, time_t from, refdm_archive_visit_f visit, void *ctx)
+{
+    CHKERR1(obj);
+    CHKERR1(visit);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (refdm_archive_remap(obj))
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return -1;
+    }
+
+    // find the last indexed record strictly before the start time
+    uint64_t offset = 0;
+    {
+        size_t low  = 0;
+        size_t high = refdm_archive_idx_list_size(obj->index);
+        while (low < high)
+        {
+            const size_t               mid   = low + (high - low) / 2;
+            const refdm_archive_idx_t *entry = refdm_archive_idx_list_cget(obj->index, mid);
+            if (entry->mgr_time < from)
+            {
+                offset = entry->offset;
+                low    = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+    }
+
+    // records are never modified once written, so only the mapping is held
+    refdm_archive_map_t *map = refdm_archive_map_ref(obj);
+    const uint64_t       end = obj->size;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    int retval = 0;
+    while (offset < end)
+    {
+        uint32_t len;
+        int64_t  mgr_time;
+        refdm_archive_hdr_decode(map->ptr + offset, &len, &mgr_time);
+
+        if ((time_t)mgr_time >= from)
+        {
+            cace_data_t body;
+            cace_data_init_view(&body, len, map->ptr + offset + REFDM_ARCHIVE_HDR_LEN);
+            retval = visit((time_t)mgr_time, &body, ctx);
+            if (retval)
+            {
+                break;
+            }
+        }
+        offset += REFDM_ARCHIVE_HDR_LEN + len;
+    }
+
+    refdm_archive_map_release(obj, map);
+    return retval;
+}
+
+int refdm_archive_query(refdm_archive_t *obj, time_t from, time_t until, refdm_archive_match_f match,
+                        refdm_archive_rpt_visit_f visit, void *ctx)
+{
+    CHKERR1(obj);
+    CHKERR1(match);
+    CHKERR1(visit);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if (refdm_archive_remap(obj))
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return -1;
+    }
+
+    // copy matching locations, which can change with later appends
+    refdm_archive_rpt_loc_list_t locs;
+    refdm_archive_rpt_loc_list_init(locs);
+
+    refdm_archive_src_dict_it_t src_it;
+    for (refdm_archive_src_dict_it(src_it, obj->sources); !refdm_archive_src_dict_end_p(src_it);
+         refdm_archive_src_dict_next(src_it))
+    {
+        const refdm_archive_src_t *src = &(refdm_archive_src_dict_cref(src_it)->value);
+        if (cace_ari_is_undefined(&(src->source)) || !match(&(src->source), ctx))
+        {
+            continue;
+        }
+
+        // find the first report at or after the start time
+        size_t low  = 0;
+        size_t high = refdm_archive_rpt_loc_list_size(src->reports);
+        while (low < high)
+        {
+            const size_t mid = low + (high - low) / 2;
+            if (refdm_archive_rpt_loc_list_cget(src->reports, mid)->mgr_time < from)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        for (size_t ix = low; ix < refdm_archive_rpt_loc_list_size(src->reports); ++ix)
+        {
+            const refdm_archive_rpt_loc_t *loc = refdm_archive_rpt_loc_list_cget(src->reports, ix);
+            if (loc->mgr_time > until)
+            {
+                break;
+            }
+            refdm_archive_rpt_loc_list_push_back(locs, *loc);
+        }
+    }
+
+    refdm_archive_map_t *map = refdm_archive_map_ref(obj);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+
+    int retval = 0;
+
+    refdm_archive_rpt_loc_list_it_t loc_it;
+    for (refdm_archive_rpt_loc_list_it(loc_it, locs); !retval && !refdm_archive_rpt_loc_list_end_p(loc_it);
+         refdm_archive_rpt_loc_list_next(loc_it))
+    {
+        const refdm_archive_rpt_loc_t *loc = refdm_archive_rpt_loc_list_cref(loc_it);
+
+        uint32_t len;
+        int64_t  mgr_time;
+        refdm_archive_hdr_decode(map->ptr + loc->offset, &len, &mgr_time);
+        uint8_t *body_ptr = map->ptr + loc->offset + REFDM_ARCHIVE_HDR_LEN;
+
+        cace_data_t body;
+        cace_data_init_view(&body, len, body_ptr);
+        cace_data_t report;
+        cace_data_init_view(&report, loc->rpt_len, body_ptr + loc->rpt_offset);
+
+        retval = visit(loc->mgr_time, &body, &report, ctx);
+    }
+
+    refdm_archive_map_release(obj, map);
+    refdm_archive_rpt_loc_list_clear(locs);
+    return retval;
+}
+
+int refdm_archive_compact(refdm_archive_t *obj, time_t before)
+{
+    CHKERR1(obj);
+
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    if ((obj->fd < 0) || refdm_archive_remap(obj))
+    {
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return 2;
+    }
+
+    const bool named = !m_string_empty_p(obj->path);
+    m_string_t tmppath;
+    m_string_init(tmppath);
+    if (named)
+    {
+        m_string_printf(tmppath, "%s.tmp", m_string_get_cstr(obj->path));
+    }
+
+    int newfd = refdm_archive_open_fd(named ? m_string_get_cstr(tmppath) : NULL, true);
+    if (newfd < 0)
+    {
+        m_string_clear(tmppath);
+        CACE_MUTEX_UNLOCK(&(obj->mutex));
+        return 3;
+    }
+
+    // copy the retained records directly from the old mapping
+    const uint8_t *old_ptr  = obj->map ? obj->map->ptr : NULL;
+    const uint64_t old_size = obj->size;
+    uint64_t       offset   = 0;
+    const size_t   old_cnt  = obj->count;
+    refdm_archive_untrack(obj);
+
+    int retval = 0;
+    while (offset < old_size)
+    {
+        uint32_t len;
+        int64_t  mgr_time;
+        refdm_archive_hdr_decode(old_ptr + offset, &len, &mgr_time);
+        const size_t reclen = REFDM_ARCHIVE_HDR_LEN + len;
+
+        if ((time_t)mgr_time >= before)
+        {
+            if (refdm_archive_write_full(newfd, old_ptr + offset, reclen, obj->size))
+            {
+                CACE_LOG_ERR("Failed to write compacted archive errno %d", errno);
+                retval = 4;
+                break;
+            }
+            refdm_archive_track(obj, (time_t)mgr_time, obj->size, old_ptr + offset + REFDM_ARCHIVE_HDR_LEN, len);
+            obj->size += reclen;
+        }
+        offset += reclen;
+    }
+
+    if (!retval && fsync(newfd))
+    {
+        retval = 4;
+    }
+    if (!retval && named && rename(m_string_get_cstr(tmppath), m_string_get_cstr(obj->path)))
+    {
+        CACE_LOG_ERR("Failed to replace archive file errno %d", errno);
+        retval = 5;
+    }
+
+    if (retval)
+    {
+        // keep the original file and restore its state
+        close(newfd);
+        if (named)
+        {
+            unlink(m_string_get_cstr(tmppath));
+        }
+
+        refdm_archive_untrack(obj);
+        offset = 0;
+        while (offset < old_size)
+        {
+            uint32_t len;
+            int64_t  mgr_time;
+            refdm_archive_hdr_decode(old_ptr + offset, &len, &mgr_time);
+            refdm_archive_track(obj, (time_t)mgr_time, offset, old_ptr + offset + REFDM_ARCHIVE_HDR_LEN, len);
+            offset += REFDM_ARCHIVE_HDR_LEN + len;
+        }
+        obj->size = old_size;
+    }
+    else
+    {
+        CACE_LOG_INFO("Compacted archive from %zu to %zu records", old_cnt, obj->count);
+        refdm_archive_unmap(obj);
+        close(obj->fd);
+        obj->fd = newfd;
+        if (refdm_archive_remap(obj))
+        {
+            retval = 6;
+        }
+    }
+
+    m_string_clear(tmppath);
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return retval;
+}
+
+size_t refdm_archive_count(refdm_archive_t *obj)
+{
+    CHKRET(obj, 0);
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    size_t count = obj->count;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return count;
+}
+
+time_t refdm_archive_last_time(refdm_archive_t *obj)
+{
+    CHKRET(obj, 0);
+    CACE_MUTEX_LOCK(&(obj->mutex));
+    time_t last_time = obj->last_time;
+    CACE_MUTEX_UNLOCK(&(obj->mutex));
+    return last_time;
+}
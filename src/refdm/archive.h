@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Append-only per-agent report archive used when there is no database.
+ *
+ * Each archive is a single file containing a sequence of records, where each
+ * record has a 12-octet header followed by the CBOR-encoded RPTSET.
+ * The header contains a 4-octet big-endian body length and an 8-octet
+ * big-endian signed manager reception time in POSIX seconds.
+ *
+ * Reads are performed through a read-only memory mapping of the file,
+ * so record bodies can be handed out as views without any copy or decoding.
+ *
+ * Each archive also keeps an in-memory index of reports by their source
+ * object, which is rebuilt when the file is opened or compacted.
+ */
+#ifndef REFDM_ARCHIVE_H_
+#define REFDM_ARCHIVE_H_
+
+#include "cace/ari.h"
+#include "cace/cace_data.h"
+
+#include <m-array.h>
+#include <m-dict.h>
+#include <m-string.h>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Size of each record header
+#define REFDM_ARCHIVE_HDR_LEN 12
+/// Number of records between each sparse index entry
+#define REFDM_ARCHIVE_INDEX_STRIDE 64
+/// File name suffix for archive files
+#define REFDM_ARCHIVE_SUFFIX ".rpts"
+
+/** A sparse index entry for an archive.
+ */
+typedef struct
+{
+    /// Reception time of the indexed record
+    time_t mgr_time;
+    /// File offset of the indexed record header
+    uint64_t offset;
+} refdm_archive_idx_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refdm_archive_idx_list, refdm_archive_idx_t, M_POD_OPLIST)
+/// @endcond
+
+/** The location of a single report within an archive.
+ */
+typedef struct
+{
+    /// Reception time of the containing record
+    time_t mgr_time;
+    /// File offset of the containing record header
+    uint64_t offset;
+    /// Offset of the report within the record body
+    uint32_t rpt_offset;
+    /// Length of the encoded report
+    uint32_t rpt_len;
+} refdm_archive_rpt_loc_t;
+
+/// @cond Doxygen_Suppress
+M_ARRAY_DEF(refdm_archive_rpt_loc_list, refdm_archive_rpt_loc_t, M_POD_OPLIST)
+/// @endcond
+
+/** All reports in an archive from a single source object.
+ */
+typedef struct
+{
+    /// The decoded source, which is undefined if it failed to decode
+    cace_ari_t source;
+    /// Report locations in file order
+    refdm_archive_rpt_loc_list_t reports;
+} refdm_archive_src_t;
+
+void refdm_archive_src_init(refdm_archive_src_t *obj);
+
+void refdm_archive_src_init_set(refdm_archive_src_t *obj, const refdm_archive_src_t *src);
+
+void refdm_archive_src_deinit(refdm_archive_src_t *obj);
+
+void refdm_archive_src_set(refdm_archive_src_t *obj, const refdm_archive_src_t *src);
+
+/// OPLIST for refdm_archive_src_t
+#define M_OPL_refdm_archive_src_t()                                                    \
+    (INIT(API_2(refdm_archive_src_init)), INIT_SET(API_6(refdm_archive_src_init_set)), \
+     CLEAR(API_2(refdm_archive_src_deinit)), SET(API_6(refdm_archive_src_set)))
+
+/// @cond Doxygen_Suppress
+M_DICT_DEF2(refdm_archive_src_dict, cace_data_t, M_OPL_cace_data_t(), refdm_archive_src_t,
+            M_OPL_refdm_archive_src_t())
+/// @endcond
+
+/** A reference-counted read-only mapping of an archive file.
+ * Readers hold a reference while visiting records so that the archive
+ * mutex is not held during each visit and the mapping outlives any
+ * concurrent remapping or compaction.
+ */
+typedef struct
+{
+    /// Start of the mapping
+    uint8_t *ptr;
+    /// Size of the mapping at #ptr
+    size_t len;
+    /// Number of holders, which is protected by the archive mutex
+    size_t refcnt;
+} refdm_archive_map_t;
+
+/** State for a single archive file.
+ */
+typedef struct
+{
+    /// Mutex for all other state
+    pthread_mutex_t mutex;
+    /// Backing file path, or empty for an unnamed temporary file
+    m_string_t path;
+    /// Open file descriptor, or negative if not open
+    int fd;
+    /// Size of valid content in the file
+    uint64_t size;
+    /// Current mapping of the file, which may be smaller than #size or NULL
+    refdm_archive_map_t *map;
+    /// Number of records in the file
+    size_t count;
+    /// Reception time of the last record
+    time_t last_time;
+    /// Every Nth record in file order
+    refdm_archive_idx_list_t index;
+    /// Reports keyed by the encoded form of their source
+    refdm_archive_src_dict_t sources;
+} refdm_archive_t;
+
+void refdm_archive_init(refdm_archive_t *obj);
+
+void refdm_archive_deinit(refdm_archive_t *obj);
+
+/** Open an archive file, creating it if necessary.
+ * Any existing content is scanned to rebuild the index, and a trailing
+ * partial record (from an interrupted write) is truncated.
+ *
+ * @param[in,out] obj The archive to open.
+ * @param[in] path The file path to open, or NULL to use an unnamed
+ * temporary file which is not persisted.
+ * @return Zero if successful.
+ */
+int refdm_archive_open(refdm_archive_t *obj, const char *path);
+
+/** Close any open archive file.
+ *
+ * @param[in,out] obj The archive to close.
+ */
+void refdm_archive_close(refdm_archive_t *obj);
+
+/** Append a single record to the end of the archive.
+ *
+ * @param[in,out] obj The archive to append to.
+ * @param mgr_time The reception time of the record.
+ * @param[in] body The encoded RPTSET to store.
+ * @return Zero if successful.
+ */
+int refdm_archive_append(refdm_archive_t *obj, time_t mgr_time, const cace_data_t *body);
+
+/** Callback for refdm_archive_foreach().
+ *
+ * @param[in] mgr_time The reception time of the record.
+ * @param[in] body A view into the stored record body, which is valid only
+ * for the duration of the callback.
+ * @param[in] ctx The user context.
+ * @return Zero to continue iteration, or non-zero to stop.
+ */
+typedef int (*refdm_archive_visit_f)(time_t mgr_time, const cace_data_t *body, void *ctx);
+
+/** Iterate over stored records in reception order.
+ * The archive is locked only to take a reference to the current mapping,
+ * so records appended during the iteration are not visited and the
+ * callback is free to block.
+ *
+ * @param[in,out] obj The archive to read from.
+ * @param from The earliest reception time to visit.
+ * The sparse index is used to skip over earlier records.
+ * @param visit The callback for each record.
+ * @param[in] ctx The user context for the callback.
+ * @return Zero if successful, or the non-zero value returned by the callback.
+ */
+int refdm_archive_foreach(refdm_archive_t *obj, time_t from, refdm_archive_visit_f visit, void *ctx);
+
+/** Predicate for refdm_archive_query().
+ *
+ * @param[in] source The decoded report source.
+ * @param[in] ctx The user context.
+ * @return True if reports from this source are to be visited.
+ */
+typedef bool (*refdm_archive_match_f)(const cace_ari_t *source, void *ctx);
+
+/** Callback for refdm_archive_query().
+ *
+ * @param[in] mgr_time The reception time of the containing record.
+ * @param[in] body A view into the stored record body.
+ * @param[in] report A view into the single matching report within @c body.
+ * Both views are valid only for the duration of the callback.
+ * @param[in] ctx The user context.
+ * @return Zero to continue iteration, or non-zero to stop.
+ */
+typedef int (*refdm_archive_rpt_visit_f)(time_t mgr_time, const cace_data_t *body, const cace_data_t *report,
+                                         void *ctx);
+
+/** Iterate over stored reports from matching sources within a time range.
+ * The predicate is evaluated once per distinct source, and then only the
+ * indexed reports of matching sources are visited.
+ * Reports are visited grouped by source and in reception order within
+ * each source.
+ * The archive is locked only while the predicate is evaluated and the
+ * matching report locations are copied, not during the callback.
+ *
+ * @param[in,out] obj The archive to read from.
+ * @param from The earliest reception time to visit.
+ * @param until The latest reception time to visit.
+ * @param match The predicate for each source.
+ * @param visit The callback for each report.
+ * @param[in] ctx The user context for both callbacks.
+ * @return Zero if successful, or the non-zero value returned by the callback.
+ */
+int refdm_archive_query(refdm_archive_t *obj, time_t from, time_t until, refdm_archive_match_f match,
+                        refdm_archive_rpt_visit_f visit, void *ctx);
+
+/** Rewrite the archive to remove all records received before a time.
+ * The new content is written to a temporary file which atomically
+ * replaces the original.
+ *
+ * @param[in,out] obj The archive to compact.
+ * @param before The earliest reception time to keep.
+ * @return Zero if successful.
+ */
+int refdm_archive_compact(refdm_archive_t *obj, time_t before);
+
+/** Get the number of stored records.
+ *
+ * @param[in,out] obj The archive to read from.
+ * @return The record count.
+ */
+size_t refdm_archive_count(refdm_archive_t *obj);
+
+/** Get the time of the last stored record.
+ *
+ * @param[in,out] obj The archive to read from.
+ * @return The reception time, or zero if the archive is empty.
+ */
+time_t refdm_archive_last_time(refdm_archive_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFDM_ARCHIVE_H_ */
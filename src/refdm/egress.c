@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Asynchronous outbound request definitions.
+ */
+#include "egress.h"
+
+#include "mgr.h"
+
+#include "cace/ari/rpt_delta.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+
+#include <sched.h>
+
+void refdm_egress_init(refdm_egress_t *obj)
+{
+    CHKVOID(obj);
+    refdm_egress_queue_init(obj->queue, REFDM_EGRESS_QUEUE_SIZE);
+    sem_init(&(obj->queue_sem), 0, 0);
+}
+
+void refdm_egress_deinit(refdm_egress_t *obj)
+{
+    CHKVOID(obj);
+    sem_destroy(&(obj->queue_sem));
+    refdm_egress_queue_clear(obj->queue);
+}
+
+int refdm_egress_push_resync(refdm_egress_t *obj, refdm_agent_t *agent)
+{
+    CHKERR1(obj);
+    // would be seen as the sentinel
+    CHKERR1(agent);
+
+    if (!refdm_egress_queue_push(obj->queue, agent))
+    {
+        return 2;
+    }
+    sem_post(&(obj->queue_sem));
+    return 0;
+}
+
+void refdm_egress_push_end(refdm_egress_t *obj)
+{
+    CHKVOID(obj);
+
+    // this sentinel must not be dropped
+    while (!refdm_egress_queue_push(obj->queue, NULL))
+    {
+        sched_yield();
+    }
+    sem_post(&(obj->queue_sem));
+}
+
+/** Send a single delta report resync request.
+ *
+ * @param[in] mgr The manager to send from.
+ * @param[in] agent The agent to send to.
+ */
+static void refdm_egress_send_resync(refdm_mgr_t *mgr, refdm_agent_t *agent)
+{
+    CACE_LOG_INFO("Requesting delta report resync from %s", m_string_get_cstr(agent->eid));
+
+    cace_ari_list_t tosend;
+    cace_ari_list_init(tosend);
+    {
+        cace_ari_execset_t *eset = cace_ari_set_execset(cace_ari_list_push_back_new(tosend));
+        cace_ari_set_null(&(eset->nonce));
+        cace_ari_rpt_delta_set_resync(cace_ari_list_push_back_new(eset->targets));
+    }
+
+    cace_amm_msg_if_metadata_t meta;
+    cace_amm_msg_if_metadata_init(&meta);
+    cace_ari_set_tstr(&meta.dest, m_string_get_cstr(agent->eid), true);
+
+    struct timespec timeout = { .tv_sec = REFDM_EGRESS_SEND_TIMEOUT };
+
+    int res = (mgr->mif.send)(tosend, &meta, &timeout, mgr->mif.ctx);
+    if (res)
+    {
+        CACE_LOG_ERR("Failed to send resync request with status %d", res);
+        atomic_fetch_add(&mgr->instr.num_execset_sent_failure, 1);
+    }
+    else
+    {
+        atomic_fetch_add(&mgr->instr.num_execset_sent, 1);
+    }
+
+    cace_amm_msg_if_metadata_deinit(&meta);
+    cace_ari_list_clear(tosend);
+}
+
+void *refdm_egress_worker(void *arg)
+{
+    refdm_mgr_t    *mgr = arg;
+    refdm_egress_t *obj = &(mgr->egress);
+    CACE_LOG_INFO("Worker started");
+
+    // run until explicitly told to stop via refdm_egress_push_end()
+    bool at_end = false;
+    while (!at_end)
+    {
+        sem_wait(&(obj->queue_sem));
+
+        refdm_agent_t *agent = NULL;
+        if (!refdm_egress_queue_pop(&agent, obj->queue))
+        {
+            // shouldn't happen
+            CACE_LOG_WARNING("failed to pop from egress queue");
+            continue;
+        }
+
+        if (!agent)
+        {
+            at_end = true;
+        }
+        else
+        {
+            refdm_egress_send_resync(mgr, agent);
+        }
+    }
+
+    CACE_LOG_INFO("Worker stopped");
+    return NULL;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Asynchronous outbound requests generated by the manager itself.
+ *
+ * These are sent from their own worker thread so that a slow or unreachable
+ * agent does not block report ingest.
+ */
+#ifndef REFDM_EGRESS_H_
+#define REFDM_EGRESS_H_
+
+#include "agents.h"
+
+#include <m-buffer.h>
+
+#include <semaphore.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Size of the outbound hand-off queue
+#define REFDM_EGRESS_QUEUE_SIZE 64
+/// Send timeout for each outbound message, in seconds
+#define REFDM_EGRESS_SEND_TIMEOUT 5
+
+/// @cond Doxygen_Suppress
+M_QUEUE_SPSC_DEF(refdm_egress_queue, refdm_agent_t *, M_BUFFER_QUEUE, M_PTR_OPLIST)
+/// @endcond
+
+/** State of the outbound request sender.
+ */
+typedef struct refdm_egress_s
+{
+    /** Hand-off queue from the ingress thread of agents to request a
+     * delta report resync from.
+     * A NULL agent is the end-of-input sentinel.
+     */
+    refdm_egress_queue_t queue;
+    /// Semaphore for items in #queue
+    sem_t queue_sem;
+} refdm_egress_t;
+
+void refdm_egress_init(refdm_egress_t *obj);
+
+void refdm_egress_deinit(refdm_egress_t *obj);
+
+/** Queue a delta report resync request to be sent by the background worker.
+ * This does not block, and if the queue is full the request is dropped.
+ *
+ * @param[in,out] obj The sender state to push into.
+ * @param[in] agent The agent to send to, which must outlive the worker.
+ * @return Zero if successful, or 2 if the queue was full.
+ */
+int refdm_egress_push_resync(refdm_egress_t *obj, refdm_agent_t *agent);
+
+/** Queue a sentinel to cause the worker to exit.
+ *
+ * @param[in,out] obj The sender state to push into.
+ */
+void refdm_egress_push_end(refdm_egress_t *obj);
+
+/** Work thread function for the outbound request sender.
+ * This will run until the sentinel from refdm_egress_push_end() is seen.
+ *
+ * @param[in] arg The context ::refdm_mgr_t pointer.
+ * @return Always NULL pointer.
+ */
+void *refdm_egress_worker(void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFDM_EGRESS_H_ */
@@ -50,54 +50,275 @@
 #if POSTGRESQL_FOUND
 #include "nm_sql.h"
 #endif
+#include "cace/ari/cbor.h"
+#include "cace/ari/cbor_scan.h"
+#include "cace/ari/rpt_delta.h"
 #include "cace/ari/text.h"
 #include "cace/util/daemon_run.h"
 #include "cace/util/logging.h"
-#include "cace/util/mutex.h"
+
+#include <time.h>
+
+/** Check the shape of an RPTSET which was left undefined by the transport,
+ * without decoding its reports.
+ *
+ * @param[in] encoded The encoded form of the value.
+ * @return Zero if the value is an RPTSET.
+ */
+static int refdm_ingress_scan_rptset(const cace_data_t *encoded)
+{
+    cace_ari_cbor_index_t idx;
+    if (cace_ari_cbor_index(&idx, encoded, 0) || !idx.has_ari_type || (idx.ari_type != CACE_ARI_TYPE_RPTSET)
+        || (idx.count < 2))
+    {
+        return 2;
+    }
+
+    if (cace_log_is_enabled_for(LOG_DEBUG))
+    {
+        // only the head of the RPTSET is decoded
+        cace_ari_t      nonce = CACE_ARI_INIT_UNDEFINED;
+        struct timespec reftime;
+        if (!cace_ari_cbor_decode_span(&nonce, encoded, idx.items[0])
+            && !cace_ari_cbor_decode_span_timespec(&reftime, encoded, idx.items[1]))
+        {
+            m_string_t buf;
+            m_string_init(buf);
+            cace_ari_text_encode(buf, &nonce, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+            CACE_LOG_DEBUG("Received RPTSET with nonce %s reftime %lld with %zu reports", m_string_get_cstr(buf),
+                           (long long)reftime.tv_sec, idx.count - 2);
+            m_string_clear(buf);
+        }
+        cace_ari_deinit(&nonce);
+    }
+    return 0;
+}
+
+/** Ensure that a value which was left undefined by the transport is
+ * decoded, decoding it only if necessary.
+ *
+ * @param[in,out] val The value to decode into.
+ * @param[in] encoded The encoded form of the value, or NULL.
+ * @return Zero if the value is available in decoded form.
+ */
+static int refdm_ingress_ensure_value(cace_ari_t *val, const cace_data_t *encoded)
+{
+    if (!cace_ari_is_undefined(val) || !encoded)
+    {
+        return 0;
+    }
+
+    char *errm = NULL;
+    if (cace_ari_cbor_decode(val, encoded, NULL, &errm))
+    {
+        CACE_LOG_ERR("Failed to decode RPTSET: %s", errm);
+        CACE_FREE(errm);
+        return 2;
+    }
+    return 0;
+}
+
+/** Determine if any report of an RPTSET is delta-encoded.
+ * When the value was left undefined by the transport only the first item
+ * of each report is decoded.
+ *
+ * @param[in] val The value to check, which may be undefined.
+ * @param[in] encoded The encoded form of the value, or NULL.
+ * @return True if at least one report is delta-encoded.
+ */
+static bool refdm_ingress_has_delta(const cace_ari_t *val, const cace_data_t *encoded)
+{
+    if (!cace_ari_is_undefined(val) || !encoded)
+    {
+        const cace_ari_rptset_t *rptset = cace_ari_cget_rptset(val);
+        if (!rptset)
+        {
+            return false;
+        }
+
+        cace_ari_report_list_it_t it;
+        for (cace_ari_report_list_it(it, rptset->reports); !cace_ari_report_list_end_p(it);
+             cace_ari_report_list_next(it))
+        {
+            if (cace_ari_rpt_delta_is_encoded(cace_ari_report_list_cref(it)->items))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    cace_ari_cbor_index_t idx;
+    cace_ari_cbor_scan_t  rptset;
+    if (cace_ari_cbor_index(&idx, encoded, 0) || !idx.is_container
+        || cace_ari_cbor_scan_enter(&rptset, encoded, idx.value.offset))
+    {
+        return false;
+    }
+
+    cace_ari_cbor_span_t span;
+    // skip over nonce and reftime
+    if (cace_ari_cbor_scan_next(&rptset, &span) || cace_ari_cbor_scan_next(&rptset, &span))
+    {
+        return false;
+    }
+
+    bool found = false;
+    while (!found && !cace_ari_cbor_scan_next(&rptset, &span))
+    {
+        cace_ari_cbor_scan_t rpt;
+        if (cace_ari_cbor_scan_enter(&rpt, encoded, span.offset))
+        {
+            break;
+        }
+
+        // skip over reltime and source
+        cace_ari_cbor_span_t item;
+        if (cace_ari_cbor_scan_next(&rpt, &item) || cace_ari_cbor_scan_next(&rpt, &item)
+            || cace_ari_cbor_scan_next(&rpt, &item))
+        {
+            continue;
+        }
+
+        cace_ari_t first = CACE_ARI_INIT_UNDEFINED;
+        found            = !cace_ari_cbor_decode_span(&first, encoded, item) && cace_ari_rpt_delta_is_marker(&first);
+        cace_ari_deinit(&first);
+    }
+    return found;
+}
+
+/** Reassemble all delta-encoded reports of an RPTSET in-place using the
+ * last items received from each source.
+ * Any report which cannot be reassembled is left as received.
+ *
+ * @param[in,out] agent The agent holding last-received state.
+ * @param[in,out] val The decoded RPTSET value.
+ * @return True if any report could not be reassembled and the agent
+ * needs to send complete reports.
+ */
+static bool refdm_ingress_rpt_delta(refdm_agent_t *agent, cace_ari_t *val)
+{
+    cace_ari_rptset_t *rptset = cace_ari_get_rptset(val);
+    if (!rptset)
+    {
+        return false;
+    }
+
+    bool need_resync = false;
+
+    cace_ari_report_list_it_t it;
+    for (cace_ari_report_list_it(it, rptset->reports); !cace_ari_report_list_end_p(it); cace_ari_report_list_next(it))
+    {
+        cace_ari_report_t *rpt = cace_ari_report_list_ref(it);
+        if (!cace_ari_rpt_delta_is_encoded(rpt->items))
+        {
+            continue;
+        }
+
+        cace_ari_rpt_delta_base_t *base = refdm_rpt_delta_dict_safe_get(agent->rpt_delta_last, rpt->source);
+
+        int res = cace_ari_rpt_delta_decode(rpt->items, base);
+        if (res)
+        {
+            m_string_t buf;
+            m_string_init(buf);
+            cace_ari_text_encode(buf, &(rpt->source), CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+            CACE_LOG_WARNING("Unable to reassemble delta report from %s for source %s, result %d",
+                             m_string_get_cstr(agent->eid), m_string_get_cstr(buf), res);
+            m_string_clear(buf);
+
+            // the base is no longer usable for any later report
+            base->valid = false;
+            if (res == 3)
+            {
+                need_resync = true;
+            }
+        }
+    }
+
+    return need_resync;
+}
+
+/** Request that an agent send complete reports, at most once per
+ * ::REFDM_RPT_DELTA_RESYNC_HOLDOFF interval.
+ * The request is sent by the egress worker so that ingest is not blocked.
+ *
+ * @param[in] mgr The manager to send from.
+ * @param[in,out] agent The agent to send to.
+ */
+static void refdm_ingress_rpt_delta_resync(refdm_mgr_t *mgr, refdm_agent_t *agent)
+{
+    const time_t nowtime = time(NULL);
+    if (agent->rpt_delta_resync_time && (nowtime - agent->rpt_delta_resync_time < REFDM_RPT_DELTA_RESYNC_HOLDOFF))
+    {
+        return;
+    }
+    agent->rpt_delta_resync_time = nowtime;
+
+    if (refdm_egress_push_resync(&mgr->egress, agent))
+    {
+        CACE_LOG_WARNING("Dropped resync request for %s", m_string_get_cstr(agent->eid));
+        atomic_fetch_add(&mgr->instr.num_execset_sent_failure, 1);
+    }
+}
 
 /** Handle a received RPTSET value.
  *
  * @param[in] mgr The manager to operate under.
  * @param[in] agent The agent object associated with this reception.
- * @param[in,out] val The value to move from.
+ * @param[in] val The value, which is undefined if decoding was deferred
+ * and not needed or if decoding failed.
+ * @param[in] encoded The original binary form of @c val, or NULL if the
+ * transport did not retain it.
  */
-static void handle_recv(refdm_mgr_t *mgr, refdm_agent_t *agent, cace_ari_t *val)
+static void handle_recv(refdm_mgr_t *mgr, refdm_agent_t *agent, cace_ari_t *val, const cace_data_t *encoded)
 {
+    // only encode when the original form is not available
+    cace_data_t body;
+    cace_data_init(&body);
+    if (encoded)
+    {
+        cace_data_init_view(&body, encoded->len, encoded->ptr);
+    }
+    else if (cace_ari_cbor_encode(&body, val))
+    {
+        CACE_LOG_ERR("Failed to encode RPTSET for storage");
+    }
+
 #if POSTGRESQL_FOUND
     /* Copy the message group to the database tables */
-    refdm_db_insert_rptset(val, agent);
+    if (cace_ari_is_undefined(val))
+    {
+        // failure was already counted
+        CACE_LOG_WARNING("Not storing undecodable RPTSET from %s", m_string_get_cstr(agent->eid));
+    }
+    else
+    {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        refdm_db_insert_rptset(val, &body, agent);
+        refdm_instr_hist_record_since(&(mgr->instr.sql_insert_latency), &start);
+    }
 #else
     // local daemon storage
-    cace_ari_set_copy(cace_ari_list_push_back_new(agent->rptsets), val);
-    agent->mgr_time = time(NULL);
+    if (refdm_archive_append(&(agent->rptsets), time(NULL), &body))
+    {
+        CACE_LOG_ERR("Failed to archive RPTSET from %s", m_string_get_cstr(agent->eid));
+    }
 #endif
 
+    if (mgr->agent_log_cfg.enabled && mgr->agent_log_cfg.rx_rpt && !cace_data_is_empty(&body))
     {
-        bool wrote = false;
-        CACE_MUTEX_LOCK(&agent->log_mutex);
-        if (agent->log_fd && mgr->agent_log_cfg.rx_rpt)
-        {
-            m_string_t buf;
-            m_string_init(buf);
-            cace_ari_text_encode(buf, val, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
-            CACE_LOG_INFO("Received value from %s with %s", m_string_get_cstr(agent->eid), m_string_get_cstr(buf));
-            fprintf(agent->log_fd, "Received value from %s with %s", m_string_get_cstr(agent->eid),
-                    m_string_get_cstr(buf));
-            m_string_clear(buf);
+        struct timespec nowtime;
+        clock_gettime(CLOCK_REALTIME, &nowtime);
 
-            agent->log_fd_cnt++;
-            wrote = true;
-        }
-        if (agent->log_fd && wrote)
+        // the binary form is copied and file output happens on the log worker
+        if (refdm_rptlog_push_encoded(&mgr->rptlog, agent->eid, &nowtime, &body))
         {
-            // Flush file after we've written set
-            fflush(agent->log_fd);
+            atomic_fetch_add(&mgr->instr.num_rptlog_drop, 1);
         }
-        CACE_MUTEX_UNLOCK(&agent->log_mutex);
     }
-
-    // And check for file rotation (we won't break up a set between files)
-    refdm_agent_rotate_log(agent, &mgr->agent_log_cfg, false);
+    cace_data_deinit(&body);
 }
 
 void *refdm_ingress_worker(void *arg)
@@ -109,6 +330,8 @@ void *refdm_ingress_worker(void *arg)
     cace_ari_list_init(values);
     cace_amm_msg_if_metadata_t meta;
     cace_amm_msg_if_metadata_init(&meta);
+    // values are decoded only when needed for storage or logging
+    meta.defer_decode = true;
 
     /*
      * mgr->running controls the overall execution of threads in the
@@ -144,19 +367,47 @@ void *refdm_ingress_worker(void *arg)
             }
 
             cace_ari_list_it_t val_it;
+            size_t             val_ix = 0;
             /* For each received ARI, validate it */
-            for (cace_ari_list_it(val_it, values); !cace_ari_list_end_p(val_it); cace_ari_list_next(val_it))
+            for (cace_ari_list_it(val_it, values); !cace_ari_list_end_p(val_it); cace_ari_list_next(val_it), ++val_ix)
             {
                 cace_ari_t *val = cace_ari_list_ref(val_it);
-                if (!cace_ari_get_rptset(val))
+
+                // view into the received message, if available
+                cace_data_t encoded;
+                const bool  has_encoded = !cace_amm_msg_if_metadata_get_encoded(&meta, val_ix, &encoded);
+
+                const bool is_rptset = (has_encoded && cace_ari_is_undefined(val))
+                                           ? !refdm_ingress_scan_rptset(&encoded)
+                                           : (cace_ari_get_rptset(val) != NULL);
+                if (!is_rptset)
                 {
                     CACE_LOG_ERR("Ignoring input ARI that is not an RPTSET");
                     // item is left in list for later deinit
                     continue;
                 }
 
-                handle_recv(mgr, agent, val);
+                const cace_data_t *body      = has_encoded ? &encoded : NULL;
+                const bool         has_delta = refdm_ingress_has_delta(val, body);
+                // the database and delta reassembly use the decoded value
+                if ((POSTGRESQL_FOUND || has_delta) && refdm_ingress_ensure_value(val, body))
+                {
+                    atomic_fetch_add(&mgr->instr.num_rptset_decode_failure, 1);
+                }
+                else if (has_delta)
+                {
+                    if (refdm_ingress_rpt_delta(agent, val))
+                    {
+                        refdm_ingress_rpt_delta_resync(mgr, agent);
+                    }
+                    // the reassembled value is stored instead of the original
+                    body = NULL;
+                }
+
+                handle_recv(mgr, agent, val, body);
                 atomic_fetch_add(&mgr->instr.num_rptset_recv, 1);
+                atomic_fetch_add(&agent->num_rptset_recv, 1);
+                atomic_store(&agent->last_recv_time, (long long)time(NULL));
             }
         }
 
@@ -169,6 +420,10 @@ void *refdm_ingress_worker(void *arg)
         }
     }
 
+    // no more items to log or send
+    refdm_rptlog_push_end(&mgr->rptlog);
+    refdm_egress_push_end(&mgr->egress);
+
     cace_amm_msg_if_metadata_deinit(&meta);
     cace_ari_list_clear(values);
 
@@ -23,11 +23,69 @@
 
 #include "cace/util/defs.h"
 
+const refdm_instr_hist_bound_t refdm_instr_hist_bounds[REFDM_INSTR_HIST_BOUNDS] = {
+    { 50000, "0.00005" },
+    { 100000, "0.0001" },
+    { 250000, "0.00025" },
+    { 500000, "0.0005" },
+    { 1000000, "0.001" },
+    { 2500000, "0.0025" },
+    { 5000000, "0.005" },
+    { 10000000, "0.01" },
+    { 25000000, "0.025" },
+    { 50000000, "0.05" },
+    { 100000000, "0.1" },
+    { 250000000, "0.25" },
+    { 500000000, "0.5" },
+    { 1000000000, "1" },
+};
+
+void refdm_instr_hist_init(refdm_instr_hist_t *obj)
+{
+    CHKVOID(obj);
+    for (size_t ix = 0; ix <= REFDM_INSTR_HIST_BOUNDS; ++ix)
+    {
+        atomic_init(&(obj->buckets[ix]), 0);
+    }
+    atomic_init(&(obj->sum_nanos), 0);
+}
+
+void refdm_instr_hist_record_since(refdm_instr_hist_t *obj, const struct timespec *start)
+{
+    CHKVOID(obj);
+    CHKVOID(start);
+
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t diff = (int64_t)(now.tv_sec - start->tv_sec) * 1000000000 + (now.tv_nsec - start->tv_nsec);
+    if (diff < 0)
+    {
+        diff = 0;
+    }
+
+    // few enough bounds that a linear search is fine
+    size_t ix = 0;
+    while ((ix < REFDM_INSTR_HIST_BOUNDS) && ((uint64_t)diff > refdm_instr_hist_bounds[ix].nanos))
+    {
+        ++ix;
+    }
+    atomic_fetch_add(&(obj->buckets[ix]), 1);
+    atomic_fetch_add(&(obj->sum_nanos), (uint64_t)diff);
+}
+
 void refdm_instr_init(refdm_instr_t *obj)
 {
     atomic_init(&(obj->num_execset_sent), 0);
     atomic_init(&(obj->num_execset_sent_failure), 0);
     atomic_init(&(obj->num_rptset_recv), 0);
+    atomic_init(&(obj->num_rptset_decode_failure), 0);
+    atomic_init(&(obj->num_rptlog_drop), 0);
+    atomic_init(&(obj->num_rptlog_failure), 0);
+    refdm_instr_hist_init(&(obj->sql_insert_latency));
+    for (size_t ix = 0; ix < REFDM_INSTR_REST_ROUTES; ++ix)
+    {
+        refdm_instr_hist_init(&(obj->rest_latency[ix]));
+    }
 }
 
 void refdm_instr_deinit(refdm_instr_t *obj _U_) {}
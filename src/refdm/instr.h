@@ -24,6 +24,48 @@
 
 #include <m-atomic.h>
 
+#include <stdint.h>
+#include <time.h>
+
+/// Number of finite bucket bounds in each latency histogram
+#define REFDM_INSTR_HIST_BOUNDS 14
+/// Largest number of REST routes with individual latency histograms
+#define REFDM_INSTR_REST_ROUTES 16
+
+/** An upper bound of a latency histogram bucket.
+ */
+typedef struct
+{
+    /// The inclusive bound in nanoseconds
+    uint64_t nanos;
+    /// The bound in decimal seconds
+    const char *text;
+} refdm_instr_hist_bound_t;
+
+/// Bucket bounds shared by all latency histograms, in increasing order
+extern const refdm_instr_hist_bound_t refdm_instr_hist_bounds[REFDM_INSTR_HIST_BOUNDS];
+
+/** A latency histogram with fixed bucket bounds.
+ * Each member is independently atomic, so the histogram can be recorded
+ * into and read from any thread without locking.
+ */
+typedef struct
+{
+    /// Non-cumulative bucket counts, with the last bucket being unbounded
+    atomic_ullong buckets[REFDM_INSTR_HIST_BOUNDS + 1];
+    /// Sum of all recorded values in nanoseconds
+    atomic_ullong sum_nanos;
+} refdm_instr_hist_t;
+
+void refdm_instr_hist_init(refdm_instr_hist_t *obj);
+
+/** Record the time elapsed since a start time.
+ *
+ * @param[in,out] obj The histogram to record into.
+ * @param[in] start The start time from the CLOCK_MONOTONIC clock.
+ */
+void refdm_instr_hist_record_since(refdm_instr_hist_t *obj, const struct timespec *start);
+
 /** Instrumentation counters for a Manager.
  */
 typedef struct
@@ -34,6 +76,16 @@ typedef struct
     atomic_ullong num_execset_sent_failure;
     /// Count of RPTSET values received from any Agent
     atomic_ullong num_rptset_recv;
+    /// Count of received RPTSET values which failed to decode
+    atomic_ullong num_rptset_decode_failure;
+    /// Count of received values dropped from the report log queue
+    atomic_ullong num_rptlog_drop;
+    /// Count of received values failed to write to the report log
+    atomic_ullong num_rptlog_failure;
+    /// Latency of storing each received RPTSET into the database
+    refdm_instr_hist_t sql_insert_latency;
+    /// Latency of each REST handler, indexed by route
+    refdm_instr_hist_t rest_latency[REFDM_INSTR_REST_ROUTES];
 } refdm_instr_t;
 
 /** Initialize counters to zero.
@@ -45,10 +45,13 @@
 #if CIVETWEB_FOUND
 #include "nm_rest.h"
 #endif // CIVETWEB_FOUND
+#include "cace/ari/text_util.h"
 #include "cace/util/defs.h"
 #include "cace/util/logging.h"
 #include "cace/util/mutex.h"
 
+#include <dirent.h>
+
 #if POSTGRESQL_FOUND
 #include "nm_sql.h"
 
@@ -64,6 +67,67 @@ static char *refdm_envdup(const char *name)
     return cpy;
 }
 
+#else // POSTGRESQL_FOUND
+
+/** Get the archive file path for a specific agent.
+ *
+ * @param[out] path The path to write.
+ * @param[in] mgr The manager configuration.
+ * @param[in] eid The agent EID.
+ */
+static void refdm_archive_path(m_string_t path, const refdm_mgr_t *mgr, const m_string_t eid)
+{
+    // Ensure EID is encoded to filesystem-compatible character set
+    cace_data_t eid_bytes;
+    cace_data_init_view(&eid_bytes, m_string_size(eid) + 1, (cace_data_ptr_t)m_string_get_cstr(eid));
+
+    m_string_printf(path, "%s/", m_string_get_cstr(mgr->archive_dir));
+    cace_uri_percent_encode(path, &eid_bytes, NULL);
+    m_string_cat_cstr(path, REFDM_ARCHIVE_SUFFIX);
+}
+
+/** Register agents for all existing archive files.
+ *
+ * @param[in,out] mgr The manager to update.
+ */
+static void refdm_archive_load_agents(refdm_mgr_t *mgr)
+{
+    if (m_string_empty_p(mgr->archive_dir))
+    {
+        return;
+    }
+
+    DIR *dir = opendir(m_string_get_cstr(mgr->archive_dir));
+    if (!dir)
+    {
+        CACE_LOG_WARNING("Unable to read archive directory %s", m_string_get_cstr(mgr->archive_dir));
+        return;
+    }
+
+    const size_t   sfx_len = strlen(REFDM_ARCHIVE_SUFFIX);
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        const size_t name_len = strlen(ent->d_name);
+        if ((name_len <= sfx_len) || (strcmp(ent->d_name + name_len - sfx_len, REFDM_ARCHIVE_SUFFIX) != 0))
+        {
+            continue;
+        }
+
+        cace_data_t name_bytes;
+        cace_data_init_view(&name_bytes, name_len - sfx_len, (cace_data_ptr_t)ent->d_name);
+        m_string_t eid;
+        m_string_init(eid);
+        if (!cace_uri_percent_decode(eid, &name_bytes))
+        {
+            CACE_LOG_INFO("Initializing agent %s from archive", m_string_get_cstr(eid));
+            refdm_mgr_agent_add(mgr, m_string_get_cstr(eid), NULL);
+        }
+        m_string_clear(eid);
+    }
+    closedir(dir);
+}
+
 #endif // POSTGRESQL_FOUND
 
 void refdm_mgr_init(refdm_mgr_t *mgr)
@@ -75,15 +139,16 @@ void refdm_mgr_init(refdm_mgr_t *mgr)
 
     mgr->agent_log_cfg = (refdm_agent_autologging_cfg_t) {
         // Defaults (nominal, disabled on startup)
-        .enabled    = 0,  // Disabled by default
-        .rx_rpt     = 0,  // Log Parsed Report on receipt
-        .limit      = 50, // Number of reports per file before rotation
-        .agent_dirs = 0,  // Create discrete sub-folders per agent
-        .dir        = "." // root log directory will be the working directory mgr started from as default
+        .enabled = 0,  // Disabled by default
+        .rx_rpt  = 0,  // Log binary RPTSET on receipt
+        .limit   = 50, // Number of records per segment before rotation
+        .dir     = "." // root log directory will be the working directory mgr started from as default
     };
 
     cace_daemon_run_init(&(mgr->running));
     cace_threadset_init(mgr->threads);
+    refdm_rptlog_init(&(mgr->rptlog));
+    refdm_egress_init(&(mgr->egress));
     refdm_agent_list_init(mgr->agent_list);
     refdm_agent_dict_init(mgr->agent_dict);
     pthread_mutex_init(&(mgr->agent_mutex), NULL);
@@ -107,6 +172,8 @@ void refdm_mgr_init(refdm_mgr_t *mgr)
         CACE_LOG_INFO("Initializing agents from DB");
         refdm_db_load_agents(mgr);
     }
+#else  // POSTGRESQL_FOUND
+    m_string_init(mgr->archive_dir);
 #endif // POSTGRESQL_FOUND
 }
 
@@ -135,18 +202,29 @@ void refdm_mgr_deinit(refdm_mgr_t *mgr)
         }
     }
     refdm_agent_list_clear(mgr->agent_list);
+    refdm_egress_deinit(&(mgr->egress));
+    refdm_rptlog_deinit(&(mgr->rptlog));
     cace_threadset_clear(mgr->threads);
     cace_daemon_run_cleanup(&(mgr->running));
+#if !POSTGRESQL_FOUND
+    m_string_clear(mgr->archive_dir);
+#endif // !POSTGRESQL_FOUND
 }
 
 int refdm_mgr_start(refdm_mgr_t *mgr)
 {
-    cace_threadinfo_t threadinfo[3] = {
+    cace_threadinfo_t threadinfo[4] = {
         { &refdm_ingress_worker, "refdm_ingress" },
+        { &refdm_rptlog_worker, "refdm_rptlog" },
+        { &refdm_egress_worker, "refdm_egress" },
         //        { &ui_thread, "nm_mgr_ui" },
         { NULL, NULL },
     };
 
+#if !POSTGRESQL_FOUND
+    refdm_archive_load_agents(mgr);
+#endif // !POSTGRESQL_FOUND
+
     if (cace_threadset_start(mgr->threads, threadinfo, sizeof(threadinfo) / sizeof(cace_threadinfo_t), mgr))
     {
         return 2;
@@ -200,6 +278,22 @@ refdm_agent_t *refdm_mgr_agent_add(refdm_mgr_t *mgr, const char *agent_eid, bool
         refdm_agent_init(agent);
         m_string_set_cstr(agent->eid, agent_eid);
 
+#if !POSTGRESQL_FOUND
+        // storage must be ready before the agent is visible
+        m_string_t path;
+        m_string_init(path);
+        const bool named = !m_string_empty_p(mgr->archive_dir);
+        if (named)
+        {
+            refdm_archive_path(path, mgr, agent->eid);
+        }
+        if (refdm_archive_open(&(agent->rptsets), named ? m_string_get_cstr(path) : NULL))
+        {
+            CACE_LOG_ERR("Failed to open report archive for agent %s", m_string_get_cstr(agent->eid));
+        }
+        m_string_clear(path);
+#endif // !POSTGRESQL_FOUND
+
         // key is pointer to own member data
         CACE_LOG_INFO("adding agent for %s", m_string_get_cstr(agent->eid));
         refdm_agent_list_push_back(mgr->agent_list, agent);
@@ -215,8 +309,6 @@ refdm_agent_t *refdm_mgr_agent_add(refdm_mgr_t *mgr, const char *agent_eid, bool
 
     if (created && agent)
     {
-        refdm_agent_rotate_log(agent, &mgr->agent_log_cfg, true);
-
 #if POSTGRESQL_FOUND
         /* Copy the message group to the database tables */
         CACE_LOG_INFO("logging agent in db started");
@@ -273,7 +365,7 @@ void refdm_mgr_clear_reports(refdm_mgr_t *mgr _U_, refdm_agent_t *agent)
         refdm_db_clear_rptset(idx);
     }
 #else
-    cace_ari_list_reset(agent->rptsets);
-    agent->mgr_time = 0;
+    // drop everything received up to now
+    refdm_archive_compact(&(agent->rptsets), time(NULL) + 1);
 #endif // POSTGRESQL_FOUND
 }
@@ -42,7 +42,9 @@
 #define REFDM_MGR_H_
 
 #include "agents.h"
+#include "egress.h"
 #include "instr.h"
+#include "rptlog.h"
 
 #include "refdm/config.h"
 
@@ -116,6 +118,10 @@ typedef struct refdm_mgr_s
     refdm_instr_t instr;
     /// Threads associated with the mgr
     cace_threadset_t threads;
+    /// Binary log of received reports, used when #agent_log_cfg is enabled
+    refdm_rptlog_t rptlog;
+    /// Outbound requests generated by the manager itself
+    refdm_egress_t egress;
 
     /// Agent state storage
     refdm_agent_list_t agent_list;
@@ -134,6 +140,11 @@ typedef struct refdm_mgr_s
     /// SQL client state, managed by a background thread
     refdm_db_t      sql_info;
     pthread_mutex_t sql_lock;
+#else
+    /** Directory holding per-agent report archive files.
+     * If empty, archives use unnamed temporary files and do not persist.
+     */
+    m_string_t archive_dir;
 #endif
 
 } refdm_mgr_t;
@@ -151,6 +162,10 @@ void refdm_mgr_deinit(refdm_mgr_t *mgr);
  * @pre The manager must have set values for:
  *  * refdm_mgr_t::agent_log_cfg
  *  * refdm_mgr_t::rest_listen_port
+ *  * refdm_mgr_t::archive_dir
+ *
+ * When not using a database, any existing archive files are used to
+ * register their agents before reception begins.
  *
  * @param[in] mgr The manager to start.
  * @sa refdm_mgr_stop()
@@ -17,8 +17,11 @@
  */
 
 #include "nm_rest.h"
+#include "rptset.h"
 
+#include "cace/amm/objpat_set.h"
 #include "cace/ari/cbor.h"
+#include "cace/ari/cbor_scan.h"
 #include "cace/ari/text.h"
 #include "cace/ari/text_util.h"
 #include "cace/util/defs.h"
@@ -32,6 +35,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <time.h>
+#include <unistd.h>
 
 #if POSTGRESQL_FOUND
 #include "nm_sql.h"
@@ -195,7 +200,7 @@ static int agentsGetHandler(struct mg_connection *conn)
                 cJSON_AddNumberToObject(agentObj, "rpts_count", count);
             }
 #else
-            size_t count = cace_ari_list_size(agent->rptsets);
+            size_t count = refdm_archive_count(&(agent->rptsets));
             cJSON_AddNumberToObject(agentObj, "rpts_count", count);
 #endif
         }
@@ -571,184 +576,206 @@ static int agentSendItems(struct mg_connection *conn, refdm_agent_t *agent, cace
     return retval;
 }
 
-static int agentShowReports(struct mg_connection *conn, refdm_agent_t *agent, const char *form)
+/** State for streaming a report response body.
+ * The response header is sent only when the first report is written, so
+ * that a response with no reports can still be sent as no-content.
+ */
+typedef struct
 {
-    CHKRET(agent, HTTP_INTERNAL_ERROR);
-    CHKRET(form, HTTP_INTERNAL_ERROR);
-
+    /// The connection to respond on
+    struct mg_connection *conn;
+    /// The encoded form to use
+    const char *form;
+    /// The content type for the form
+    const char *ctype;
+    /// The last-modified time to send
     struct tm mgr_time;
-    // Flag that defines if the rptsets came from a remote source (i.e. a database). If this
-    // is set to true, then the variable ptr_rptsets should be cleared within this method.
-    bool             is_remote_rptsets = false;
-    cace_ari_list_t *ptr_rptsets       = NULL;
+    /// True after the response header has been sent
+    bool started;
+    /// Scratch buffer for each text item
+    m_string_t item_text;
+} refdm_rest_rpt_body_t;
 
-#if POSTGRESQL_FOUND
-    // Synthesize the rptsets (on the stack)
-    cace_ari_list_t rptsets;
-    cace_ari_list_init(rptsets);
+static void rptBodyInit(refdm_rest_rpt_body_t *obj, struct mg_connection *conn, const char *form)
+{
+    obj->conn     = conn;
+    obj->form     = form;
+    obj->mgr_time = (struct tm) { 0 };
+    obj->started  = false;
+    m_string_init(obj->item_text);
 
-    int32_t idx = refdm_db_fetch_agent_idx(m_string_get_cstr(agent->eid));
-    // Retrieve the rptsets from the remote (database) source
-    int ecode = refdm_db_fetch_rptset_list(idx, &rptsets, &mgr_time);
-    if (ecode != 0)
+    if ((strcasecmp(form, "uri") == 0) || (strcasecmp(form, "text") == 0))
     {
-        cace_ari_list_clear(rptsets);
-
-        mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "Database error encountered.");
-        return HTTP_INTERNAL_ERROR;
+        obj->ctype = "text/uri-list";
+    }
+    else if (strcasecmp(form, "cbor") == 0)
+    {
+        obj->ctype = "application/cbor-seq";
+    }
+    else
+    {
+        obj->ctype = "text/plain";
     }
+}
 
-    // Set the prt_rptsets to point to the stack
-    ptr_rptsets       = &rptsets;
-    is_remote_rptsets = true;
-#else  // POSTGRESQL_FOUND
-    // Set the prt_rptsets to point to the local copy on the agent
-    ptr_rptsets = &agent->rptsets;
-    gmtime_r(&agent->mgr_time, &mgr_time);
-    is_remote_rptsets = false;
-#endif // POSTGRESQL_FOUND
+static void rptBodyDeinit(refdm_rest_rpt_body_t *obj)
+{
+    m_string_clear(obj->item_text);
+}
 
-    // Return no content if there are no reports
-    if (cace_ari_list_empty_p(*ptr_rptsets))
+/** Send one chunk of the response body, starting the response if needed.
+ *
+ * @return Zero if successful.
+ */
+static int rptBodyWrite(refdm_rest_rpt_body_t *obj, const void *ptr, size_t len)
+{
+    if (!obj->started)
     {
-        // Clear the internals of data pointed to by ptr_rptsets (if it was sourced remotely).
-        if (is_remote_rptsets == true)
-        {
-            cace_ari_list_clear(*ptr_rptsets);
-        }
+        mg_response_header_start(obj->conn, HTTP_OK);
+        mg_response_header_add(obj->conn, "Content-Type", obj->ctype, -1);
+        mg_response_header_add(obj->conn, "Transfer-Encoding", "chunked", -1);
 
-        mg_response_header_start(conn, HTTP_NO_CONTENT);
-        mg_response_header_send(conn);
-        return HTTP_NO_CONTENT;
+        char   buf[64];
+        size_t buf_used = strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &(obj->mgr_time));
+        mg_response_header_add(obj->conn, "Last-Modified", buf, (int)buf_used);
+
+        mg_response_header_send(obj->conn);
+        obj->started = true;
     }
+    return (mg_send_chunk(obj->conn, ptr, len) < 0) ? 3 : 0;
+}
 
-    int         retval = 0;
-    const char *ctype  = NULL;
-    size_t      clen   = 0;
-    // Optional one of text or bytes body
-    m_string_t body_text;
-    m_string_init(body_text);
-    m_bstring_t body_bytes;
-    m_bstring_init(body_bytes);
+/** Stream a single RPTSET into a response body.
+ * For the binary and hex forms the stored binary form is used directly,
+ * only the text form requires decoding the value.
+ * A stored RPTSET which cannot be decoded is logged and skipped.
+ *
+ * @return Zero if successful.
+ */
+static int rptBodyAppend(refdm_rest_rpt_body_t *obj, refdm_rptset_t *rptset)
+{
+    if (strcasecmp(obj->form, "cbor") == 0)
+    {
+        return rptBodyWrite(obj, rptset->encoded.ptr, rptset->encoded.len);
+    }
 
-    if ((strcasecmp(form, "uri") == 0) || (strcasecmp(form, "text") == 0))
+    m_string_reset(obj->item_text);
+    if ((strcasecmp(obj->form, "uri") == 0) || (strcasecmp(obj->form, "text") == 0))
     {
-        /* Iterate through all RPTSET for this agent in one buffer */
-        cace_ari_list_it_t rpt_it;
-        for (cace_ari_list_it(rpt_it, *ptr_rptsets); !cace_ari_list_end_p(rpt_it); cace_ari_list_next(rpt_it))
+        const cace_ari_t *val = refdm_rptset_get_value(rptset);
+        if (!val)
         {
-            const cace_ari_t *val = cace_ari_list_cref(rpt_it);
-
-            m_string_t uristr;
-            m_string_init(uristr);
-            int enc_ret = cace_ari_text_encode(uristr, val, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
-
-            m_string_cat(body_text, uristr);
-            m_string_clear(uristr);
-            m_string_cat_cstr(body_text, "\r\n"); // HTTP convention
-
-            if (enc_ret)
-            {
-                mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "encoding failure");
-                retval = HTTP_INTERNAL_ERROR;
-                break;
-            }
+            cace_base16_encode(obj->item_text, &(rptset->encoded), true);
+            CACE_LOG_WARNING("Skipping RPTSET which failed to decode: %s", m_string_get_cstr(obj->item_text));
+            return 0;
+        }
+        if (cace_ari_text_encode(obj->item_text, val, CACE_ARI_TEXT_ENC_OPTS_DEFAULT))
+        {
+            return 2;
         }
-
-        ctype = "text/uri-list";
-        clen  = m_string_size(body_text);
     }
-    else if (strcasecmp(form, "cbor") == 0)
+    else
     {
-        /* Iterate through all RPTSET for this agent. */
-        cace_ari_list_it_t rpt_it;
-        for (cace_ari_list_it(rpt_it, *ptr_rptsets); !cace_ari_list_end_p(rpt_it); cace_ari_list_next(rpt_it))
+        if (cace_base16_encode(obj->item_text, &(rptset->encoded), false))
         {
-            const cace_ari_t *val = cace_ari_list_cref(rpt_it);
+            return 2;
+        }
+    }
+    m_string_cat_cstr(obj->item_text, "\r\n"); // HTTP convention
 
-            cace_data_t bytestr;
-            cace_data_init(&bytestr);
-            int enc_ret = cace_ari_cbor_encode(&bytestr, val);
+    return rptBodyWrite(obj, m_string_get_cstr(obj->item_text), m_string_size(obj->item_text));
+}
 
-            m_bstring_push_back_bytes(body_bytes, bytestr.len, bytestr.ptr);
-            cace_data_deinit(&bytestr);
+#if !POSTGRESQL_FOUND
+/// Adapter for refdm_archive_foreach()
+static int rptBodyVisitArchive(time_t mgr_time _U_, const cace_data_t *body, void *ctx)
+{
+    // view directly into the archive
+    refdm_rptset_t rptset;
+    refdm_rptset_init(&rptset);
+    refdm_rptset_set_encoded(&rptset, body, false);
 
-            if (enc_ret)
-            {
-                mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "encoding failure");
-                retval = HTTP_INTERNAL_ERROR;
-                break;
-            }
-        }
+    int retval = rptBodyAppend(ctx, &rptset);
 
-        ctype = "application/cbor-seq";
-        clen  = m_bstring_size(body_bytes);
-    }
-    else if ((strcasecmp(form, "cborhex") == 0) || (strcasecmp(form, "hex") == 0))
-    {
-        /* Iterate through all RPTSET for this agent. */
-        cace_ari_list_it_t rpt_it;
-        for (cace_ari_list_it(rpt_it, *ptr_rptsets); !cace_ari_list_end_p(rpt_it); cace_ari_list_next(rpt_it))
-        {
-            const cace_ari_t *val = cace_ari_list_cref(rpt_it);
+    refdm_rptset_deinit(&rptset);
+    return retval;
+}
+#endif // !POSTGRESQL_FOUND
 
-            cace_data_t bytestr;
-            cace_data_init(&bytestr);
-            int enc_ret = cace_ari_cbor_encode(&bytestr, val);
+static int agentShowReports(struct mg_connection *conn, refdm_agent_t *agent, const char *form, time_t since)
+{
+    CHKRET(agent, HTTP_INTERNAL_ERROR);
+    CHKRET(form, HTTP_INTERNAL_ERROR);
 
-            m_string_t hexstr;
-            m_string_init(hexstr);
-            int hex_ret = cace_base16_encode(hexstr, &bytestr, false);
-            cace_data_deinit(&bytestr);
+    refdm_rest_rpt_body_t body;
+    rptBodyInit(&body, conn, form);
+    int enc_ret = 0;
 
-            m_string_cat(body_text, hexstr);
-            m_string_clear(hexstr);
-            m_string_cat_cstr(body_text, "\r\n"); // HTTP convention
+#if POSTGRESQL_FOUND
+    // the database query has no time filter
+    (void)since;
 
-            if (enc_ret || hex_ret)
-            {
-                mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "encoding failure");
-                retval = HTTP_INTERNAL_ERROR;
-                break;
-            }
-        }
+    // Synthesize the rptsets (on the stack)
+    refdm_rptset_list_t rptsets;
+    refdm_rptset_list_init(rptsets);
+
+    int32_t idx = refdm_db_fetch_agent_idx(m_string_get_cstr(agent->eid));
+    // Retrieve the rptsets from the remote (database) source
+    int ecode = refdm_db_fetch_rptset_list(idx, &rptsets, &(body.mgr_time));
+    if (ecode != 0)
+    {
+        refdm_rptset_list_clear(rptsets);
+        rptBodyDeinit(&body);
 
-        ctype = "text/plain";
-        clen  = m_string_size(body_text);
+        mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "Database error encountered.");
+        return HTTP_INTERNAL_ERROR;
     }
 
-    if (!retval)
+    /* Stream all RPTSET for this agent */
+    refdm_rptset_list_it_t rpt_it;
+    for (refdm_rptset_list_it(rpt_it, rptsets); !enc_ret && !refdm_rptset_list_end_p(rpt_it);
+         refdm_rptset_list_next(rpt_it))
     {
-        mg_response_header_start(conn, HTTP_OK);
-        mg_response_header_add(conn, "Content-Type", ctype, -1);
-
-        char   buf[64];
-        size_t buf_used = snprintf(buf, sizeof(buf), "%zu", clen);
-        mg_response_header_add(conn, "Content-Length", buf, (int)buf_used);
+        enc_ret = rptBodyAppend(&body, refdm_rptset_list_ref(rpt_it));
+    }
+    refdm_rptset_list_clear(rptsets);
+#else  // POSTGRESQL_FOUND
+    // Serve directly from the local archive
+    const time_t last_time = refdm_archive_last_time(&(agent->rptsets));
+    gmtime_r(&last_time, &(body.mgr_time));
 
-        buf_used = strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &mgr_time);
-        mg_response_header_add(conn, "Last-Modified", buf, (int)buf_used);
+    enc_ret = refdm_archive_foreach(&(agent->rptsets), since, rptBodyVisitArchive, &body);
+#endif // POSTGRESQL_FOUND
 
-        mg_response_header_send(conn);
-        if (!m_string_empty_p(body_text))
+    int retval;
+    if (body.started)
+    {
+        if (enc_ret)
         {
-            mg_write(conn, m_string_get_cstr(body_text), clen);
+            // too late for an error status, so truncate the body
+            CACE_LOG_ERR("Report response ended early due to error %d", enc_ret);
         }
-        else if (!m_bstring_empty_p(body_bytes))
+        else
         {
-            mg_write(conn, m_bstring_view(body_bytes, 0, clen), clen);
+            // end of chunked body
+            mg_send_chunk(conn, "", 0);
         }
         retval = HTTP_OK;
     }
-
-    // Release the resources of rptsets (if it is sourced remotely)
-    if (is_remote_rptsets == true)
+    else if (enc_ret)
     {
-        cace_ari_list_clear(*ptr_rptsets);
+        mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "encoding failure");
+        retval = HTTP_INTERNAL_ERROR;
+    }
+    else
+    {
+        // Return no content if there are no reports (possibly after filtering)
+        mg_response_header_start(conn, HTTP_NO_CONTENT);
+        mg_response_header_send(conn);
+        retval = HTTP_NO_CONTENT;
     }
 
-    m_bstring_clear(body_bytes);
-    m_string_clear(body_text);
+    rptBodyDeinit(&body);
     return retval;
 }
 
@@ -831,6 +858,35 @@ static int getFormParam(struct mg_connection *conn, char *form, size_t form_len)
     return 0;
 }
 
+/** Get an optional decimal POSIX time query parameter.
+ *
+ * @param[in] conn The connection to read from and respond to.
+ * @param[in] name The parameter name.
+ * @param[in,out] value The value to update only if the parameter is present.
+ * @return Zero if successful, or an HTTP status code after sending an error.
+ */
+static int getTimeParam(struct mg_connection *conn, const char *name, time_t *value)
+{
+    const struct mg_request_info *ri = mg_get_request_info(conn);
+    if (!ri->query_string)
+    {
+        return 0;
+    }
+
+    char text[24]; // enough for any decimal time
+    if (mg_get_var(ri->query_string, strlen(ri->query_string), name, text, sizeof(text)) > 0)
+    {
+        char *end = NULL;
+        *value    = strtoll(text, &end, 10);
+        if (!end || (*end != '\0'))
+        {
+            mg_send_http_error(conn, HTTP_BAD_REQUEST, "The %s parameter must be a decimal POSIX time", name);
+            return HTTP_BAD_REQUEST;
+        }
+    }
+    return 0;
+}
+
 /** The ./send resource of either agent form.
  */
 static int agentAnySendHandler(struct mg_connection *conn, refdm_agent_t *agent)
@@ -1022,7 +1078,15 @@ static int agentAnyReportsHandler(struct mg_connection *conn, refdm_agent_t *age
     }
     else if (0 == strcasecmp(ri->request_method, "GET"))
     {
-        retval = agentShowReports(conn, agent, form);
+        // optional lower bound on reception time
+        time_t since = 0;
+        retval       = getTimeParam(conn, "since", &since);
+        if (retval)
+        {
+            return retval;
+        }
+
+        retval = agentShowReports(conn, agent, form, since);
     }
     else
     {
@@ -1171,6 +1235,571 @@ static int agentIdxReportsHandler(struct mg_connection *conn, void *cbdata _U_)
     return agentAnyReportsHandler(conn, agent);
 }
 
+#if !POSTGRESQL_FOUND
+/** State for a single report query across agents.
+ */
+typedef struct
+{
+    /// The source pattern set to match
+    const cace_ari_t *pattern;
+    /// True if the text form is used for each result
+    bool as_text;
+    /// The agent currently being queried
+    const refdm_agent_t *agent;
+    /// The JSON array to append results to
+    cJSON *results;
+    /// Scratch buffer for each synthesized RPTSET
+    cace_data_t buf;
+} refdm_rest_rpt_query_t;
+
+/// Predicate for refdm_archive_query()
+static bool rptQueryMatch(const cace_ari_t *source, void *ctx)
+{
+    const refdm_rest_rpt_query_t *query = ctx;
+    return source->is_ref && cace_amm_objpat_set_match_path(query->pattern, &(source->as_ref.objpath));
+}
+
+/** Adapter for refdm_archive_query() which synthesizes an RPTSET containing
+ * only the matching report along with the nonce and reference time of its
+ * original RPTSET.
+ */
+static int rptQueryVisit(time_t mgr_time, const cace_data_t *body, const cace_data_t *report, void *ctx)
+{
+    refdm_rest_rpt_query_t *query = ctx;
+
+    cace_ari_cbor_index_t idx;
+    cace_ari_cbor_scan_t  rptset_it;
+    cace_ari_cbor_span_t  nonce;
+    cace_ari_cbor_span_t  reftime;
+    if (cace_ari_cbor_index(&idx, body, 0) || !idx.is_container
+        || cace_ari_cbor_scan_enter(&rptset_it, body, idx.value.offset) || cace_ari_cbor_scan_next(&rptset_it, &nonce)
+        || cace_ari_cbor_scan_next(&rptset_it, &reftime))
+    {
+        return 2;
+    }
+
+    // typed literal head and an array of three items, small type IDs encode as themselves
+    const uint8_t head[] = { 0x82, CACE_ARI_TYPE_RPTSET, 0x83 };
+    // the nonce and reference time are adjacent
+    const size_t prefix_len = reftime.offset + reftime.len - nonce.offset;
+
+    cace_data_copy_from(&(query->buf), sizeof(head), (cace_data_ptr_t)head);
+    cace_data_append_from(&(query->buf), prefix_len, body->ptr + nonce.offset);
+    cace_data_append_from(&(query->buf), report->len, report->ptr);
+
+    m_string_t valstr;
+    m_string_init(valstr);
+    int res;
+    if (query->as_text)
+    {
+        cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+        res            = cace_ari_cbor_decode(&val, &(query->buf), NULL, NULL);
+        if (!res)
+        {
+            res = cace_ari_text_encode(valstr, &val, CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+        }
+        cace_ari_deinit(&val);
+    }
+    else
+    {
+        res = cace_base16_encode(valstr, &(query->buf), false);
+    }
+
+    if (res)
+    {
+        // skip over this one report
+        CACE_LOG_WARNING("Failed to encode queried report from %s (err %d)", m_string_get_cstr(query->agent->eid),
+                         res);
+    }
+    else
+    {
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "agent", m_string_get_cstr(query->agent->eid));
+        cJSON_AddNumberToObject(item, "time", (double)mgr_time);
+        cJSON_AddStringToObject(item, "value", m_string_get_cstr(valstr));
+        cJSON_AddItemToArray(query->results, item);
+    }
+    m_string_clear(valstr);
+    return 0;
+}
+
+/** Determine if an agent is in the set requested by the query string.
+ *
+ * @return Zero if it is not, 1 if it is, or an HTTP status code after sending an error.
+ */
+static int rptQueryHasAgent(struct mg_connection *conn, const refdm_agent_t *agent)
+{
+    const struct mg_request_info *ri = mg_get_request_info(conn);
+    if (!ri->query_string)
+    {
+        // no filter means all agents
+        return 1;
+    }
+    const size_t query_len = strlen(ri->query_string);
+
+    char eid[256]; // NOLINT
+    int  found = 0;
+    for (int occurrence = 0;; ++occurrence)
+    {
+        int res = mg_get_var2(ri->query_string, query_len, "agent", eid, sizeof(eid), occurrence);
+        if (res == -1)
+        {
+            break;
+        }
+        else if (res < 0)
+        {
+            mg_send_http_error(conn, HTTP_BAD_REQUEST, "Agent parameter is too long");
+            return HTTP_BAD_REQUEST;
+        }
+        if (m_string_equal_cstr_p(agent->eid, eid))
+        {
+            return 1;
+        }
+        found += 1;
+    }
+    // no filter means all agents
+    return (found == 0) ? 1 : 0;
+}
+
+/** Decode the required pattern query parameter as either text ARI or
+ * base-16 encoded binary ARI.
+ *
+ * @return Zero if successful, or an HTTP status code after sending an error.
+ */
+static int rptQueryGetPattern(struct mg_connection *conn, cace_ari_t *pattern)
+{
+    const struct mg_request_info *ri = mg_get_request_info(conn);
+    if (!ri->query_string)
+    {
+        mg_send_http_error(conn, HTTP_BAD_REQUEST, "Missing pattern parameter");
+        return HTTP_BAD_REQUEST;
+    }
+
+    // parameter value is never longer than the whole query
+    const size_t query_len = strlen(ri->query_string);
+    char        *text      = CACE_MALLOC(query_len + 1);
+    if (!text)
+    {
+        mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "Server error");
+        return HTTP_INTERNAL_ERROR;
+    }
+    if (mg_get_var(ri->query_string, query_len, "pattern", text, query_len + 1) <= 0)
+    {
+        CACE_FREE(text);
+        mg_send_http_error(conn, HTTP_BAD_REQUEST, "Missing pattern parameter");
+        return HTTP_BAD_REQUEST;
+    }
+
+    m_string_t intext;
+    m_string_init_set_cstr(intext, text);
+    CACE_FREE(text);
+
+    cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+    char      *errm = NULL;
+    int        res;
+    if (m_string_start_with_str_p(intext, "ari:"))
+    {
+#if ARI_TEXT_PARSE
+        res = cace_ari_text_decode(&val, intext, &errm);
+#else
+        res = 1;
+#endif
+    }
+    else
+    {
+        cace_data_t databuf;
+        cace_data_init(&databuf);
+        res = cace_base16_decode(&databuf, intext);
+        if (!res)
+        {
+            res = cace_ari_cbor_decode(&val, &databuf, NULL, &errm);
+        }
+        cace_data_deinit(&databuf);
+    }
+    m_string_clear(intext);
+
+    int retval = 0;
+    if (res)
+    {
+        mg_send_http_error(conn, HTTP_BAD_REQUEST, "Error decoding pattern ARI: %s", errm ? errm : "invalid");
+        retval = HTTP_BAD_REQUEST;
+    }
+    else
+    {
+        cace_amm_objpat_set_from_value(pattern, &val);
+        if (cace_ari_list_empty_p(cace_ari_cget_ac(pattern)->items))
+        {
+            mg_send_http_error(conn, HTTP_BAD_REQUEST, "Pattern must be an OBJPAT or AC of OBJPAT");
+            retval = HTTP_BAD_REQUEST;
+        }
+    }
+    if (errm)
+    {
+        CACE_FREE(errm);
+    }
+    cace_ari_deinit(&val);
+    return retval;
+}
+#endif // !POSTGRESQL_FOUND
+
+/** Handler /reports - Query individual reports from any agent by source
+ * pattern and reception time range.
+ */
+static int reportsQueryHandler(struct mg_connection *conn, void *cbdata _U_)
+{
+    const struct mg_request_info *ri = mg_get_request_info(conn);
+
+    if (0 == strcasecmp(ri->request_method, "OPTIONS"))
+    {
+        mg_response_header_start(conn, HTTP_NO_CONTENT);
+        mg_response_header_add(conn, "Allow", "OPTIONS,GET", -1);
+        mg_response_header_send(conn);
+        return HTTP_NO_CONTENT;
+    }
+    else if (0 != strcasecmp(ri->request_method, "GET"))
+    {
+        mg_send_http_error(conn, HTTP_METHOD_NOT_ALLOWED, "Only GET method supported");
+        return HTTP_METHOD_NOT_ALLOWED;
+    }
+
+#if POSTGRESQL_FOUND
+    // the source index is part of the local archive
+    mg_send_http_error(conn, HTTP_NOT_IMPLEMENTED, "Report queries are not available with a database");
+    return HTTP_NOT_IMPLEMENTED;
+#else
+    refdm_mgr_t *mgr = mg_get_user_data(mg_get_context(conn));
+
+    char form[10] = "uri"; // size enough to hold valid values
+    int  retval   = getFormParam(conn, form, sizeof(form));
+    if (retval)
+    {
+        return retval;
+    }
+    if (strcasecmp(form, "cbor") == 0)
+    {
+        mg_send_http_error(conn, HTTP_BAD_REQUEST, "Form parameter must be either uri or cborhex");
+        return HTTP_BAD_REQUEST;
+    }
+
+    time_t from  = 0;
+    time_t until = (time_t)INT64_MAX;
+    retval       = getTimeParam(conn, "from", &from);
+    if (!retval)
+    {
+        retval = getTimeParam(conn, "until", &until);
+    }
+    if (retval)
+    {
+        return retval;
+    }
+
+    cace_ari_t pattern = CACE_ARI_INIT_UNDEFINED;
+    retval             = rptQueryGetPattern(conn, &pattern);
+    if (retval)
+    {
+        cace_ari_deinit(&pattern);
+        return retval;
+    }
+
+    cJSON *obj = cJSON_CreateObject();
+    if (!obj)
+    {
+        cace_ari_deinit(&pattern);
+        mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "Server error");
+        return HTTP_INTERNAL_ERROR;
+    }
+
+    refdm_rest_rpt_query_t query = {
+        .pattern = &pattern,
+        .as_text = (strcasecmp(form, "uri") == 0) || (strcasecmp(form, "text") == 0),
+        .results = cJSON_AddArrayToObject(obj, "reports"),
+    };
+    cace_data_init(&(query.buf));
+
+    CACE_MUTEX_LOCK(&mgr->agent_mutex);
+    refdm_agent_list_it_t agent_it;
+    for (refdm_agent_list_it(agent_it, mgr->agent_list); !retval && !refdm_agent_list_end_p(agent_it);
+         refdm_agent_list_next(agent_it))
+    {
+        refdm_agent_t *agent = *refdm_agent_list_ref(agent_it);
+
+        int has = rptQueryHasAgent(conn, agent);
+        if (has == 1)
+        {
+            query.agent = agent;
+            if (refdm_archive_query(&(agent->rptsets), from, until, rptQueryMatch, rptQueryVisit, &query))
+            {
+                mg_send_http_error(conn, HTTP_INTERNAL_ERROR, "Archive read failure");
+                retval = HTTP_INTERNAL_ERROR;
+            }
+        }
+        else if (has)
+        {
+            retval = has;
+        }
+    }
+    CACE_MUTEX_UNLOCK(&mgr->agent_mutex);
+
+    if (!retval)
+    {
+        SendJSON(conn, obj);
+        retval = HTTP_OK;
+    }
+
+    cace_data_deinit(&(query.buf));
+    cJSON_Delete(obj);
+    cace_ari_deinit(&pattern);
+    return retval;
+#endif // POSTGRESQL_FOUND
+}
+
+/** A single REST route with its own latency histogram.
+ */
+typedef struct
+{
+    /// The URI pattern, which always ends with an anchor
+    const char *uri;
+    /// The handler to call
+    mg_request_handler handler;
+} refdm_rest_route_t;
+
+static int metricsHandler(struct mg_connection *conn, void *cbdata);
+
+/// All REST routes, in the order they are registered
+static const refdm_rest_route_t rest_routes[] = {
+    { BASE_API_URI "/version$", versionHandler },
+    { BASE_API_URI "/agents$", agentsHandler },
+    { BASE_API_URI "/reports$", reportsQueryHandler },
+    { "/metrics$", metricsHandler },
+
+    { AGENTS_EID_PREFIX "*$", agentEidInfoHandler },
+    { AGENTS_EID_PREFIX "*/$", agentEidInfoHandler },
+    { AGENTS_EID_PREFIX "*/clear_reports$", agentEidClearReportsHandler },
+    { AGENTS_EID_PREFIX "*/send$", agentEidSendHandler },
+    { AGENTS_EID_PREFIX "*/reports$", agentEidReportsHandler },
+
+    { AGENTS_IDX_PREFIX "*$", agentIdxInfoHandler },
+    { AGENTS_IDX_PREFIX "*/$", agentIdxInfoHandler },
+    { AGENTS_IDX_PREFIX "*/clear_reports$", agentIdxClearReportsHandler },
+    { AGENTS_IDX_PREFIX "*/send$", agentIdxSendHandler },
+    { AGENTS_IDX_PREFIX "*/reports$", agentIdxReportsHandler },
+};
+/// Number of items in #rest_routes
+#define REST_ROUTE_COUNT (sizeof(rest_routes) / sizeof(rest_routes[0]))
+
+_Static_assert(REST_ROUTE_COUNT <= REFDM_INSTR_REST_ROUTES, "Too many REST routes for latency histograms");
+
+/** Append a label value with Prometheus text escaping.
+ */
+static void metricsLabelValue(m_string_t out, const char *value)
+{
+    for (const char *curs = value; *curs; ++curs)
+    {
+        switch (*curs)
+        {
+            case '\\':
+                m_string_cat_cstr(out, "\\\\");
+                break;
+            case '"':
+                m_string_cat_cstr(out, "\\\"");
+                break;
+            case '\n':
+                m_string_cat_cstr(out, "\\n");
+                break;
+            default:
+                m_string_push_back(out, *curs);
+                break;
+        }
+    }
+}
+
+static void metricsHeader(m_string_t out, const char *name, const char *type, const char *help)
+{
+    m_string_cat_printf(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void metricsCounter(m_string_t out, const char *name, const char *help, unsigned long long value)
+{
+    metricsHeader(out, name, "counter", help);
+    m_string_cat_printf(out, "%s %llu\n", name, value);
+}
+
+/** Append all series of a single histogram from a snapshot of its buckets.
+ *
+ * @param[out] out The text to append to.
+ * @param[in] name The metric family name.
+ * @param[in] labels Optional label pairs, without braces, to add to each series.
+ * @param[in] hist The histogram to read.
+ */
+static void metricsHist(m_string_t out, const char *name, const char *labels, const refdm_instr_hist_t *hist)
+{
+    const char *sep = labels ? "," : "";
+    if (!labels)
+    {
+        labels = "";
+    }
+
+    unsigned long long cumul = 0;
+    for (size_t ix = 0; ix <= REFDM_INSTR_HIST_BOUNDS; ++ix)
+    {
+        cumul += atomic_load(&(hist->buckets[ix]));
+        const char *bound = (ix < REFDM_INSTR_HIST_BOUNDS) ? refdm_instr_hist_bounds[ix].text : "+Inf";
+        m_string_cat_printf(out, "%s_bucket{%s%sle=\"%s\"} %llu\n", name, labels, sep, bound, cumul);
+    }
+    const unsigned long long sum   = atomic_load(&(hist->sum_nanos));
+    const char              *open  = *labels ? "{" : "";
+    const char              *close = *labels ? "}" : "";
+    m_string_cat_printf(out, "%s_sum%s%s%s %llu.%09llu\n", name, open, labels, close, sum / 1000000000,
+                        sum % 1000000000);
+    m_string_cat_printf(out, "%s_count%s%s%s %llu\n", name, open, labels, close, cumul);
+}
+
+/** Append process memory use from the proc filesystem, if available.
+ */
+static void metricsProcess(m_string_t out)
+{
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (!statm)
+    {
+        return;
+    }
+
+    unsigned long long vsize = 0, rss = 0;
+    if (fscanf(statm, "%llu %llu", &vsize, &rss) == 2)
+    {
+        const unsigned long long page = (unsigned long long)sysconf(_SC_PAGESIZE);
+
+        metricsHeader(out, "process_virtual_memory_bytes", "gauge", "Virtual memory size in bytes.");
+        m_string_cat_printf(out, "process_virtual_memory_bytes %llu\n", vsize * page);
+        metricsHeader(out, "process_resident_memory_bytes", "gauge", "Resident memory size in bytes.");
+        m_string_cat_printf(out, "process_resident_memory_bytes %llu\n", rss * page);
+    }
+    fclose(statm);
+}
+
+/** Handle the /metrics resource with Prometheus text exposition.
+ * All values are read from atomic state, and the agent mutex is held only
+ * long enough to take a copy of the agent list.
+ */
+static int metricsHandler(struct mg_connection *conn, void *cbdata _U_)
+{
+    const struct mg_request_info *ri = mg_get_request_info(conn);
+
+    if (0 == strcasecmp(ri->request_method, "OPTIONS"))
+    {
+        mg_response_header_start(conn, HTTP_NO_CONTENT);
+        mg_response_header_add(conn, "Allow", "OPTIONS,GET", -1);
+        mg_response_header_send(conn);
+        return HTTP_NO_CONTENT;
+    }
+    else if (0 != strcasecmp(ri->request_method, "GET"))
+    {
+        mg_send_http_error(conn, HTTP_METHOD_NOT_ALLOWED, "Only GET method supported");
+        return HTTP_METHOD_NOT_ALLOWED;
+    }
+
+    refdm_mgr_t *mgr = mg_get_user_data(mg_get_context(conn));
+
+    // agents are never removed while running
+    refdm_agent_list_t agents;
+    refdm_agent_list_init(agents);
+    CACE_MUTEX_LOCK(&mgr->agent_mutex);
+    refdm_agent_list_set(agents, mgr->agent_list);
+    CACE_MUTEX_UNLOCK(&mgr->agent_mutex);
+
+    m_string_t out;
+    m_string_init(out);
+
+    metricsCounter(out, "refdm_execset_sent_total", "Count of EXECSET values sent to any agent.",
+                   atomic_load(&mgr->instr.num_execset_sent));
+    metricsCounter(out, "refdm_execset_sent_failures_total", "Count of EXECSET values failed to send.",
+                   atomic_load(&mgr->instr.num_execset_sent_failure));
+    metricsCounter(out, "refdm_rptset_received_total", "Count of RPTSET values received from any agent.",
+                   atomic_load(&mgr->instr.num_rptset_recv));
+    metricsCounter(out, "refdm_rptset_decode_failures_total", "Count of received RPTSET values which failed to decode.",
+                   atomic_load(&mgr->instr.num_rptset_decode_failure));
+    metricsCounter(out, "refdm_rptlog_dropped_total", "Count of received values dropped from the report log queue.",
+                   atomic_load(&mgr->instr.num_rptlog_drop));
+    metricsCounter(out, "refdm_rptlog_failures_total", "Count of received values failed to write to the report log.",
+                   atomic_load(&mgr->instr.num_rptlog_failure));
+
+    metricsHeader(out, "refdm_rptlog_queue_depth", "gauge", "Number of values waiting in the report log queue.");
+    m_string_cat_printf(out, "refdm_rptlog_queue_depth %zu\n", refdm_rptlog_queue_depth(&mgr->rptlog));
+
+    metricsHeader(out, "refdm_agents", "gauge", "Number of known agents.");
+    m_string_cat_printf(out, "refdm_agents %zu\n", refdm_agent_list_size(agents));
+
+    refdm_agent_list_it_t agent_it;
+    metricsHeader(out, "refdm_agent_rptset_received_total", "counter", "Count of RPTSET values received per agent.");
+    for (refdm_agent_list_it(agent_it, agents); !refdm_agent_list_end_p(agent_it); refdm_agent_list_next(agent_it))
+    {
+        refdm_agent_t *agent = *refdm_agent_list_ref(agent_it);
+        m_string_cat_cstr(out, "refdm_agent_rptset_received_total{agent=\"");
+        metricsLabelValue(out, m_string_get_cstr(agent->eid));
+        m_string_cat_printf(out, "\"} %llu\n", atomic_load(&agent->num_rptset_recv));
+    }
+    metricsHeader(out, "refdm_agent_last_seen_seconds", "gauge",
+                  "Reception time of the last RPTSET per agent in POSIX seconds.");
+    for (refdm_agent_list_it(agent_it, agents); !refdm_agent_list_end_p(agent_it); refdm_agent_list_next(agent_it))
+    {
+        refdm_agent_t  *agent    = *refdm_agent_list_ref(agent_it);
+        const long long lastseen = atomic_load(&agent->last_recv_time);
+        if (!lastseen)
+        {
+            continue;
+        }
+        m_string_cat_cstr(out, "refdm_agent_last_seen_seconds{agent=\"");
+        metricsLabelValue(out, m_string_get_cstr(agent->eid));
+        m_string_cat_printf(out, "\"} %lld\n", lastseen);
+    }
+
+#if POSTGRESQL_FOUND
+    metricsHeader(out, "refdm_sql_insert_duration_seconds", "histogram",
+                  "Time to store each received RPTSET into the database.");
+    metricsHist(out, "refdm_sql_insert_duration_seconds", NULL, &(mgr->instr.sql_insert_latency));
+#endif
+
+    metricsHeader(out, "refdm_rest_request_duration_seconds", "histogram", "Time to handle each REST request.");
+    for (size_t ix = 0; ix < REST_ROUTE_COUNT; ++ix)
+    {
+        m_string_t labels;
+        m_string_init_set_cstr(labels, "route=\"");
+        // strip the trailing anchor
+        const char *uri = rest_routes[ix].uri;
+        m_string_cat_printf(labels, "%.*s\"", (int)(strlen(uri) - 1), uri);
+        metricsHist(out, "refdm_rest_request_duration_seconds", m_string_get_cstr(labels),
+                    &(mgr->instr.rest_latency[ix]));
+        m_string_clear(labels);
+    }
+
+    metricsProcess(out);
+
+    mg_send_http_ok(conn, "text/plain; version=0.0.4; charset=utf-8", m_string_size(out));
+    mg_write(conn, m_string_get_cstr(out), m_string_size(out));
+
+    m_string_clear(out);
+    refdm_agent_list_clear(agents);
+    return HTTP_OK;
+}
+
+/** Time any handler as a REST route.
+ *
+ * @param[in] cbdata The associated ::refdm_rest_route_t.
+ */
+static int timedHandler(struct mg_connection *conn, void *cbdata)
+{
+    const refdm_rest_route_t *route = cbdata;
+    refdm_mgr_t              *mgr   = mg_get_user_data(mg_get_context(conn));
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    int retval = (route->handler)(conn, NULL);
+
+    refdm_instr_hist_record_since(&(mgr->instr.rest_latency[route - rest_routes]), &start);
+    return retval;
+}
+
 int refdm_nm_rest_start(struct mg_context **ctx, refdm_mgr_t *mgr)
 {
     CHKERR1(ctx);
@@ -1240,21 +1869,12 @@ int refdm_nm_rest_start(struct mg_context **ctx, refdm_mgr_t *mgr)
         return 4;
     }
 
-    /* Add URL Handlers.   */
-    mg_set_request_handler(*ctx, BASE_API_URI "/version$", versionHandler, 0);
-    mg_set_request_handler(*ctx, BASE_API_URI "/agents$", agentsHandler, 0);
-
-    mg_set_request_handler(*ctx, AGENTS_EID_PREFIX "*$", agentEidInfoHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_EID_PREFIX "*/$", agentEidInfoHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_EID_PREFIX "*/clear_reports$", agentEidClearReportsHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_EID_PREFIX "*/send$", agentEidSendHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_EID_PREFIX "*/reports$", agentEidReportsHandler, 0);
-
-    mg_set_request_handler(*ctx, AGENTS_IDX_PREFIX "*$", agentIdxInfoHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_IDX_PREFIX "*/$", agentIdxInfoHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_IDX_PREFIX "*/clear_reports$", agentIdxClearReportsHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_IDX_PREFIX "*/send$", agentIdxSendHandler, 0);
-    mg_set_request_handler(*ctx, AGENTS_IDX_PREFIX "*/reports$", agentIdxReportsHandler, 0);
+    /* Add URL Handlers, each timed by its route.   */
+    for (size_t ix = 0; ix < REST_ROUTE_COUNT; ++ix)
+    {
+        const refdm_rest_route_t *route = &(rest_routes[ix]);
+        mg_set_request_handler(*ctx, route->uri, timedHandler, (void *)route);
+    }
 
     CACE_LOG_INFO("REST API Server Started on port %s", port_buf);
     return 0;
@@ -594,30 +594,31 @@ int32_t refdm_db_mgt_query_insert(int db_idx, uint32_t *idx, char *format, ...)
 }
 
 /**
- * Takes a C string and returns the corresponding ::cace_ari_t
+ * Takes an escaped PostgreSQL bytea value and keeps it as the binary form of
+ * a report set, without decoding it.
  *
  *  \return Returns @c RET_PASS on success otherwise @c RET_FAIL_* on failure.
  *
- * * @param[out] ari_item The ARI to decode into.
+ * * @param[out] rptset The report set to hold a copy of the binary form.
  *
- * * @param[in] cbor_str The string to decode from.
- *
- *  @param[out] errm If non-null, this will be set to a specific error message
- * associated with any failure. When the return code is non-zero, if the pointed-to pointer is non-null
- * it must be freed using CACE_FREE().
+ * * @param[in] cbor_str The escaped bytea text from a query result.
  */
-static int transform_cbor_str_to_cace_data(cace_ari_t *ari_item, char *cbor_str, char **errm)
+static int transform_cbor_str_to_rptset(refdm_rptset_t *rptset, char *cbor_str)
 {
     size_t   bytea_len = 0;
     uint8_t *bytea_ptr = PQunescapeBytea((const uint8_t *)cbor_str, &bytea_len);
+    if (!bytea_ptr)
+    {
+        return RET_FAIL_UNEXPECTED;
+    }
 
     cace_data_t inbin;
     cace_data_init_view(&inbin, bytea_len, bytea_ptr);
 
-    // Transform from CBOR to ARI
-    int ecode = cace_ari_cbor_decode(ari_item, &inbin, NULL, errm);
+    // Keep the binary form, decoding is deferred until needed
+    int ecode = refdm_rptset_set_encoded(rptset, &inbin, true);
     cace_data_deinit(&inbin);
-    free(bytea_ptr);
+    PQfreemem(bytea_ptr);
     if (ecode != 0)
     {
         return RET_FAIL_UNEXPECTED;
@@ -709,7 +710,7 @@ int refdm_db_fetch_rptset_count(int32_t agent_idx, size_t *count)
 }
 
 //-------------------------------------------------------------------------------------
-int refdm_db_fetch_rptset_list(int32_t agent_idx, cace_ari_list_t *rptsets, struct tm *mgr_time)
+int refdm_db_fetch_rptset_list(int32_t agent_idx, refdm_rptset_list_t *rptsets, struct tm *mgr_time)
 {
     // Get the rptset rows from the database
     PGresult *res   = NULL;
@@ -740,22 +741,16 @@ int refdm_db_fetch_rptset_list(int32_t agent_idx, cace_ari_list_t *rptsets, stru
         // Extract the report_list_cbor from the database row
         char *cbor_str = PQgetvalue(res, row, idx_report_list_cbor);
 
-        // Transform from database BYTEA to a RPTSET value
-        cace_ari_t ari_item;
-        cace_ari_init(&ari_item);
-        char *errm = NULL;
-        ecode      = transform_cbor_str_to_cace_data(&ari_item, cbor_str, &errm);
+        // Transform from database BYTEA to a lazy RPTSET value
+        refdm_rptset_t *item = refdm_rptset_list_push_back_new(*rptsets);
+        ecode                = transform_cbor_str_to_rptset(item, cbor_str);
         if (ecode != RET_PASS)
         {
             // Skip to next on failure
-            CACE_LOG_ERR("Database has invalid report.   row: %d   |   ecode: %d   |   errm: %s", row, ecode, errm);
-            CACE_FREE(errm);
+            CACE_LOG_ERR("Database has invalid report.   row: %d   |   ecode: %d", row, ecode);
+            refdm_rptset_list_pop_back(NULL, *rptsets);
             continue;
         }
-        CACE_FREE(errm);
-
-        // Add the report to the list
-        cace_ari_list_push_back_move(*rptsets, &ari_item);
     }
     PQclear(res);
 
@@ -852,13 +847,14 @@ int32_t refdm_db_fetch_agent_idx(const char *eid)
 
 /**
  * @param val Report
+ * @param encoded The binary form of @c val to store
  * @param agent agent table set being inserted in
  * @param status Set to 0 if
  * parsing fails, but not modified on
  * success
  * @returns  Set ID, or 0 on error
  */
-uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const refdm_agent_t *agent)
+uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const cace_data_t *encoded, const refdm_agent_t *agent)
 {
     CACE_LOG_INFO("logging report set in db started");
 
@@ -893,11 +889,6 @@ uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const refdm_agent_t *agen
     m_string_init(tp);
     cace_utctime_encode(tp, &ref_time, true);
 
-    // report_list varchar as cbor,
-    cace_data_t cbordata;
-    cace_data_init(&cbordata);
-    cace_ari_cbor_encode(&cbordata, val);
-
     getConn(DB_RPT_CON);
 
     // insert into rpt set and dependant tables
@@ -905,7 +896,7 @@ uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const refdm_agent_t *agen
     dbprep_bind_param_byte(0, nonce_cbor.ptr, nonce_cbor.len);
     dbprep_bind_param_str(1, m_string_get_cstr(tp));         //  report timestamp
     dbprep_bind_param_str(2, m_string_get_cstr(agent->eid)); // agent_id
-    dbprep_bind_param_byte(3, cbordata.ptr, cbordata.len);
+    dbprep_bind_param_byte(3, encoded->ptr, encoded->len); // report_list as received CBOR
     dbexec_prepared;
     CACE_LOG_DEBUG("Done insert into ARI_RPTSET");
 
@@ -997,7 +988,6 @@ uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const refdm_agent_t *agen
     giveConn(DB_RPT_CON);
     // cleaning up vars
     m_string_clear(tp);
-    cace_data_deinit(&cbordata);
     cace_data_deinit(&nonce_cbor);
 
     return rtv;
@@ -23,6 +23,7 @@
 
 #include "agents.h"
 #include "mgr.h"
+#include "rptset.h"
 
 #include "refdm/config.h"
 
@@ -112,7 +113,7 @@ int32_t refdm_db_mgt_query_fetch(int db_idx, PGresult **res, char *format, ...);
 int32_t refdm_db_mgt_query_insert(int db_idx, uint32_t *idx, char *format, ...);
 
 /* Functions to process outgoing EXECSET and incoming RPTSET. */
-uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const refdm_agent_t *agent);
+uint32_t refdm_db_insert_rptset(const cace_ari_t *val, const cace_data_t *encoded, const refdm_agent_t *agent);
 uint32_t refdm_db_insert_agent(const m_string_t eid);
 uint32_t refdm_db_insert_execset(const cace_ari_t *val, const refdm_agent_t *agent);
 
@@ -149,11 +150,12 @@ int refdm_db_fetch_rptset_count(int32_t agent_idx, size_t *count);
  * Runs a query on the database and retrieves the list of RPTSETs.
  *
  * @param agent_idx The row index of the source Agent.
- * @param[out] rptsets The list used to hold the retrieved RPTSETs.
+ * @param[out] rptsets The list used to hold the retrieved RPTSETs, which are
+ * left in their binary form until accessed.
  * @param[out] mgr_time The manager timestamp for the latest record.
  * @return Returns ::RET_PASS on success otherwise @c RET_FAIL_* on failure.
  */
-int refdm_db_fetch_rptset_list(int32_t agent_idx, cace_ari_list_t *rptsets, struct tm *mgr_time);
+int refdm_db_fetch_rptset_list(int32_t agent_idx, refdm_rptset_list_t *rptsets, struct tm *mgr_time);
 
 /** Utility function to insert debug or error informational messages into the database.
  * NOTE: If operating within a transaction, caller is responsible for committing transaction.
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Stand-alone tool to convert binary report log segments into text.
+ */
+#include "rptlog.h"
+
+#include "cace/ari/text.h"
+#include "cace/config.h"
+#include "cace/util/logging.h"
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <string.h>
+
+static FILE *get_file(const char *name, const char *mode)
+{
+    if (!name || (strcmp(name, "-") == 0))
+    {
+        if (mode[0] == 'r')
+        {
+            return stdin;
+        }
+        else
+        {
+            return stdout;
+        }
+    }
+    FILE *file = fopen(name, mode);
+    if (!file)
+    {
+        char buf[256];
+        strerror_r(errno, buf, sizeof(buf));
+        fprintf(stderr, "Failed to open file %s (err %d): %s\n", name, errno, buf);
+    }
+    return file;
+}
+
+static int write_text(const refdm_rptlog_item_t *item, FILE *dest)
+{
+    m_string_t outtext;
+    m_string_init(outtext);
+
+    int res = cace_ari_text_encode(outtext, &(item->value), CACE_ARI_TEXT_ENC_OPTS_DEFAULT);
+    if (res)
+    {
+        fprintf(stderr, "Failed to encode text ARI (err %d)\n", res);
+        m_string_clear(outtext);
+        return 1;
+    }
+
+    struct tm rxtm;
+    gmtime_r(&(item->timestamp.tv_sec), &rxtm);
+    char tmbuf[32]; // NOLINT
+    strftime(tmbuf, sizeof(tmbuf), "%Y-%m-%dT%H:%M:%S", &rxtm);
+
+    res = fprintf(dest, "%s.%09ldZ %s %s\n", tmbuf, item->timestamp.tv_nsec, m_string_get_cstr(item->eid),
+                  m_string_get_cstr(outtext));
+    m_string_clear(outtext);
+    if (res < 1)
+    {
+        char buf[256];
+        strerror_r(errno, buf, sizeof(buf));
+        fprintf(stderr, "Failed to write output (err %d): %s\n", errno, buf);
+        return 2;
+    }
+
+    return 0;
+}
+
+/** Convert all records from a single segment.
+ *
+ * @return The number of records which failed to convert.
+ */
+static int convert_segment(FILE *source, FILE *dest)
+{
+    int failures = 0;
+
+    cace_data_t buf;
+    cace_data_init(&buf);
+
+    bool cont = true;
+    while (cont)
+    {
+        refdm_rptlog_item_t item;
+        refdm_rptlog_item_init(&item);
+
+        int res = refdm_rptlog_record_read(&item, &buf, source);
+        if (res < 0)
+        {
+            cont = false;
+        }
+        else if (res == 2)
+        {
+            // a short read leaves no way to find the next record
+            fprintf(stderr, "Segment ends with a truncated record\n");
+            failures += 1;
+            cont = false;
+        }
+        else if (res)
+        {
+            // length prefix still allows skipping over the record
+            fprintf(stderr, "Failed to decode record (err %d)\n", res);
+            failures += 1;
+        }
+        else if (write_text(&item, dest))
+        {
+            failures += 1;
+        }
+
+        refdm_rptlog_item_deinit(&item);
+    }
+
+    cace_data_deinit(&buf);
+    return failures;
+}
+
+static void show_usage(const char *argv0)
+{
+    fprintf(stderr,
+            "Usage: %s {--log-level,-l <log-level>} "
+            "[--dest,-d {filename or -}] "
+            "{segment filename or -}...\n",
+            argv0);
+}
+
+int main(int argc, char *argv[])
+{
+    int   log_limit = LOG_WARNING;
+    FILE *dest      = stdout;
+
+    cace_openlog();
+
+#if HAVE_GETOPT_LONG
+    static const struct option longopts[] = {
+        { "help", no_argument, NULL, 'h' },
+        { "log-level", required_argument, NULL, 'l' },
+        { "dest", required_argument, NULL, 'd' },
+        { NULL, 0, NULL, 0 },
+    };
+#endif /* HAVE_GETOPT_LONG */
+
+    bool cont   = true;
+    int  retval = 0;
+    while (cont)
+    {
+#if HAVE_GETOPT_LONG
+        int option_index = 0;
+        int res          = getopt_long(argc, argv, ":hl:d:", longopts, &option_index);
+#else
+        int res = getopt(argc, argv, ":hl:d:");
+#endif /* HAVE_GETOPT_LONG */
+
+        if (res == -1)
+        {
+            break;
+        }
+        switch (res)
+        {
+            case 'l':
+                if (cace_log_get_severity(&log_limit, optarg))
+                {
+                    fprintf(stderr, "Invalid log severity: %s\n", optarg);
+                    retval = 1;
+                    cont   = false;
+                }
+                break;
+            case 'd':
+                if (dest && (dest != stdout))
+                {
+                    fclose(dest);
+                }
+                dest = get_file(optarg, "w");
+                if (!dest)
+                {
+                    retval = 1;
+                    cont   = false;
+                }
+                break;
+            case 'h':
+                show_usage(argv[0]);
+                cont = false;
+                // still exit code zero
+                break;
+            default:
+                retval = 1;
+                cont   = false;
+                break;
+        }
+    }
+    if (retval)
+    {
+        fprintf(stderr, "Failed to handle program options\n\n");
+        show_usage(argv[0]);
+        cont = false;
+    }
+    cace_log_set_least_severity(log_limit);
+    CACE_LOG_DEBUG("Starting up with log limit %d", log_limit);
+
+    // handle each segment in-turn
+    int failures = 0;
+    if (cont && (optind >= argc))
+    {
+        CACE_LOG_DEBUG("Converting segment from stdin");
+        failures += convert_segment(stdin, dest);
+    }
+    for (int ix = optind; cont && (ix < argc); ++ix)
+    {
+        FILE *source = get_file(argv[ix], "rb");
+        if (!source)
+        {
+            failures += 1;
+            continue;
+        }
+        CACE_LOG_DEBUG("Converting segment %s", argv[ix]);
+
+        failures += convert_segment(source, dest);
+        fflush(dest);
+
+        if (source != stdin)
+        {
+            fclose(source);
+        }
+    }
+    if (failures)
+    {
+        retval = 2 + failures;
+    }
+
+    if (dest && (dest != stdout))
+    {
+        fclose(dest);
+    }
+
+    cace_closelog();
+    return retval;
+}
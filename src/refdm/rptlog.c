@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Asynchronous binary report log definitions.
+ */
+#include "rptlog.h"
+
+#include "mgr.h"
+
+#include "cace/ari/cbor.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+
+#include <qcbor/qcbor_spiffy_decode.h>
+
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+
+void refdm_rptlog_item_init(refdm_rptlog_item_t *obj)
+{
+    CHKVOID(obj);
+    obj->timestamp = (struct timespec) { 0 };
+    m_string_init(obj->eid);
+    cace_data_init(&(obj->encoded));
+    cace_ari_init(&(obj->value));
+}
+
+void refdm_rptlog_item_init_move(refdm_rptlog_item_t *obj, refdm_rptlog_item_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->timestamp = src->timestamp;
+    m_string_init_move(obj->eid, src->eid);
+    cace_data_init(&(obj->encoded));
+    cace_data_move(&(obj->encoded), &(src->encoded));
+    cace_ari_init_move(&(obj->value), &(src->value));
+}
+
+void refdm_rptlog_item_deinit(refdm_rptlog_item_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_deinit(&(obj->value));
+    cace_data_deinit(&(obj->encoded));
+    m_string_clear(obj->eid);
+}
+
+void refdm_rptlog_item_set(refdm_rptlog_item_t *obj, const refdm_rptlog_item_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    obj->timestamp = src->timestamp;
+    m_string_set(obj->eid, src->eid);
+    cace_data_copy(&(obj->encoded), &(src->encoded));
+    cace_ari_set_copy(&(obj->value), &(src->value));
+}
+
+void refdm_rptlog_init(refdm_rptlog_t *obj)
+{
+    CHKVOID(obj);
+    refdm_rptlog_queue_init(obj->queue, REFDM_RPTLOG_QUEUE_SIZE);
+    sem_init(&(obj->queue_sem), 0, 0);
+
+    m_string_init(obj->seg_base);
+    obj->seg_num    = 0;
+    obj->seg_cnt    = 0;
+    obj->seg_offset = 0;
+    obj->seg_file   = NULL;
+    obj->idx_file   = NULL;
+}
+
+static void refdm_rptlog_close(refdm_rptlog_t *obj)
+{
+    if (obj->seg_file)
+    {
+        fclose(obj->seg_file);
+        obj->seg_file = NULL;
+    }
+    if (obj->idx_file)
+    {
+        fclose(obj->idx_file);
+        obj->idx_file = NULL;
+    }
+}
+
+void refdm_rptlog_deinit(refdm_rptlog_t *obj)
+{
+    CHKVOID(obj);
+    refdm_rptlog_close(obj);
+    m_string_clear(obj->seg_base);
+
+    sem_destroy(&(obj->queue_sem));
+    refdm_rptlog_queue_clear(obj->queue);
+}
+
+int refdm_rptlog_push_encoded(refdm_rptlog_t *obj, const m_string_t eid, const struct timespec *timestamp,
+                              const cace_data_t *encoded)
+{
+    CHKERR1(obj);
+    CHKERR1(timestamp);
+    CHKERR1(encoded);
+    if (cace_data_is_empty(encoded))
+    {
+        // would be seen as the sentinel
+        return 2;
+    }
+
+    refdm_rptlog_item_t item;
+    refdm_rptlog_item_init(&item);
+    item.timestamp = *timestamp;
+    m_string_set(item.eid, eid);
+    if (cace_data_copy(&(item.encoded), encoded))
+    {
+        refdm_rptlog_item_deinit(&item);
+        return 2;
+    }
+
+    if (!refdm_rptlog_queue_push_move(obj->queue, &item))
+    {
+        refdm_rptlog_item_deinit(&item);
+        return 2;
+    }
+    sem_post(&(obj->queue_sem));
+    return 0;
+}
+
+void refdm_rptlog_push_end(refdm_rptlog_t *obj)
+{
+    CHKVOID(obj);
+
+    refdm_rptlog_item_t undef;
+    refdm_rptlog_item_init(&undef);
+    // this sentinel must not be dropped
+    while (!refdm_rptlog_queue_push_move(obj->queue, &undef))
+    {
+        sched_yield();
+    }
+    sem_post(&(obj->queue_sem));
+}
+
+size_t refdm_rptlog_queue_depth(refdm_rptlog_t *obj)
+{
+    CHKRET(obj, 0);
+
+    // semaphore value tracks items not yet taken by the worker
+    int value = 0;
+    if (sem_getvalue(&(obj->queue_sem), &value) || (value < 0))
+    {
+        return 0;
+    }
+    return (size_t)value;
+}
+
+static void refdm_rptlog_record_body(QCBOREncodeContext *enc, const refdm_rptlog_item_t *item, int *res)
+{
+    QCBOREncode_OpenArray(enc);
+    QCBOREncode_AddInt64(enc, item->timestamp.tv_sec);
+    QCBOREncode_AddUInt64(enc, item->timestamp.tv_nsec);
+    const UsefulBufC eid = { .ptr = m_string_get_cstr(item->eid), .len = m_string_size(item->eid) };
+    QCBOREncode_AddText(enc, eid);
+    if (!cace_data_is_empty(&(item->encoded)))
+    {
+        // already a single encoded data item
+        QCBOREncode_AddEncoded(enc, (UsefulBufC) { item->encoded.ptr, item->encoded.len });
+    }
+    else
+    {
+        *res = cace_ari_cbor_encode_stream(enc, &(item->value));
+    }
+    QCBOREncode_CloseArray(enc);
+}
+
+int refdm_rptlog_record_encode(cace_data_t *buf, const refdm_rptlog_item_t *item)
+{
+    CHKERR1(buf);
+    CHKERR1(item);
+
+    int res = 0;
+
+    QCBOREncodeContext encoder;
+    QCBOREncode_Init(&encoder, SizeCalculateUsefulBuf);
+    refdm_rptlog_record_body(&encoder, item, &res);
+    size_t needlen;
+    if (res || (QCBOR_SUCCESS != QCBOREncode_FinishGetSize(&encoder, &needlen)) || (needlen > UINT32_MAX))
+    {
+        CACE_LOG_WARNING("CBOR early encoding did not complete properly");
+        return 2;
+    }
+
+    if (cace_data_resize(buf, REFDM_RPTLOG_PREFIX_LEN + needlen))
+    {
+        return 2;
+    }
+    // big-endian length prefix
+    buf->ptr[0] = (needlen >> 24) & 0xFF;
+    buf->ptr[1] = (needlen >> 16) & 0xFF;
+    buf->ptr[2] = (needlen >> 8) & 0xFF;
+    buf->ptr[3] = needlen & 0xFF;
+
+    QCBOREncode_Init(&encoder, (UsefulBuf) { buf->ptr + REFDM_RPTLOG_PREFIX_LEN, needlen });
+    refdm_rptlog_record_body(&encoder, item, &res);
+    UsefulBufC encdata;
+    if (res || (QCBOR_SUCCESS != QCBOREncode_Finish(&encoder, &encdata)))
+    {
+        CACE_LOG_WARNING("CBOR late encoding did not complete properly");
+        return 3;
+    }
+
+    return 0;
+}
+
+int refdm_rptlog_record_decode(refdm_rptlog_item_t *item, const cace_data_t *buf)
+{
+    CHKERR1(item);
+    CHKERR1(buf);
+
+    QCBORDecodeContext dec;
+    QCBORDecode_Init(&dec, (UsefulBufC) { buf->ptr, buf->len }, QCBOR_DECODE_MODE_MAP_AS_ARRAY);
+
+    int64_t    secs;
+    uint64_t   nsecs;
+    UsefulBufC eid;
+    QCBORDecode_EnterArray(&dec, NULL);
+    QCBORDecode_GetInt64(&dec, &secs);
+    QCBORDecode_GetUInt64(&dec, &nsecs);
+    QCBORDecode_GetTextString(&dec, &eid);
+    if (QCBORDecode_GetError(&dec))
+    {
+        return 2;
+    }
+    if (nsecs >= CACE_ARI_SUBSEC_SCALE)
+    {
+        return 3;
+    }
+    item->timestamp = (struct timespec) {
+        .tv_sec  = secs,
+        .tv_nsec = (long)nsecs,
+    };
+    m_string_set_cstrn(item->eid, eid.ptr, eid.len);
+
+    if (cace_ari_cbor_decode_stream(&dec, &(item->value)))
+    {
+        return 3;
+    }
+    QCBORDecode_ExitArray(&dec);
+    if (QCBORDecode_Finish(&dec) != QCBOR_SUCCESS)
+    {
+        return 2;
+    }
+    return 0;
+}
+
+int refdm_rptlog_record_read(refdm_rptlog_item_t *item, cace_data_t *buf, FILE *file)
+{
+    CHKERR1(item);
+    CHKERR1(buf);
+    CHKERR1(file);
+
+    uint8_t prefix[REFDM_RPTLOG_PREFIX_LEN];
+    size_t  got = fread(prefix, 1, sizeof(prefix), file);
+    if (got == 0)
+    {
+        return -1;
+    }
+    else if (got < sizeof(prefix))
+    {
+        // truncated trailing record
+        return 2;
+    }
+    const size_t len = ((size_t)prefix[0] << 24) | ((size_t)prefix[1] << 16) | ((size_t)prefix[2] << 8) | prefix[3];
+
+    if (cace_data_resize(buf, len))
+    {
+        return 3;
+    }
+    if (fread(buf->ptr, 1, len, file) != len)
+    {
+        return 2;
+    }
+
+    return refdm_rptlog_record_decode(item, buf) ? 4 : 0;
+}
+
+/** Open the next segment and index files.
+ *
+ * @param[in,out] obj The log state to update.
+ * @param[in] cfg The logging configuration.
+ * @return Zero if successful.
+ */
+static int refdm_rptlog_open(refdm_rptlog_t *obj, const refdm_agent_autologging_cfg_t *cfg)
+{
+    if (m_string_empty_p(obj->seg_base))
+    {
+        // segments from this process share a start-time name
+        struct timespec nowtime;
+        clock_gettime(CLOCK_REALTIME, &nowtime);
+        struct tm nowtm;
+        gmtime_r(&nowtime.tv_sec, &nowtm);
+
+        char tmbuf[32]; // NOLINT
+        strftime(tmbuf, sizeof(tmbuf), "%Y%m%dT%H%M%SZ", &nowtm);
+        m_string_printf(obj->seg_base, "%s/rptlog-%s", cfg->dir, tmbuf);
+    }
+
+    m_string_t filepath;
+    m_string_init_printf(filepath, "%s-%04u" REFDM_RPTLOG_SEG_SUFFIX, m_string_get_cstr(obj->seg_base), obj->seg_num);
+    obj->seg_file = fopen(m_string_get_cstr(filepath), "ab");
+    if (!obj->seg_file)
+    {
+        CACE_LOG_ERR("Failed to open report log file (%s) errno %d", m_string_get_cstr(filepath), errno);
+    }
+
+    m_string_printf(filepath, "%s-%04u" REFDM_RPTLOG_IDX_SUFFIX, m_string_get_cstr(obj->seg_base), obj->seg_num);
+    obj->idx_file = fopen(m_string_get_cstr(filepath), "ab");
+    if (!obj->idx_file)
+    {
+        CACE_LOG_ERR("Failed to open report index file (%s) errno %d", m_string_get_cstr(filepath), errno);
+    }
+    m_string_clear(filepath);
+
+    if (!obj->seg_file || !obj->idx_file)
+    {
+        refdm_rptlog_close(obj);
+        return 2;
+    }
+
+    // offsets continue from any existing content
+    fseek(obj->seg_file, 0, SEEK_END);
+    long pos        = ftell(obj->seg_file);
+    obj->seg_offset = (pos > 0) ? pos : 0;
+    obj->seg_cnt    = 0;
+    obj->seg_num++;
+    return 0;
+}
+
+static int refdm_rptlog_index_encode(cace_data_t *buf, const refdm_rptlog_item_t *item, uint64_t offset)
+{
+    const UsefulBufC eid = { .ptr = m_string_get_cstr(item->eid), .len = m_string_size(item->eid) };
+
+    // size is bounded by the EID plus four maximum-size integers
+    if (cace_data_resize(buf, eid.len + 48))
+    {
+        return 2;
+    }
+
+    QCBOREncodeContext encoder;
+    QCBOREncode_Init(&encoder, (UsefulBuf) { buf->ptr, buf->len });
+    QCBOREncode_OpenArray(&encoder);
+    QCBOREncode_AddInt64(&encoder, item->timestamp.tv_sec);
+    QCBOREncode_AddUInt64(&encoder, item->timestamp.tv_nsec);
+    QCBOREncode_AddText(&encoder, eid);
+    QCBOREncode_AddUInt64(&encoder, offset);
+    QCBOREncode_CloseArray(&encoder);
+
+    UsefulBufC encdata;
+    if (QCBOR_SUCCESS != QCBOREncode_Finish(&encoder, &encdata))
+    {
+        return 3;
+    }
+    return cace_data_resize(buf, encdata.len);
+}
+
+/** Write a single record to the current segment, rotating if needed.
+ *
+ * @param[in,out] obj The log state to update.
+ * @param[in] cfg The logging configuration.
+ * @param[in] item The item to write.
+ * @param[in,out] buf Scratch buffer for encoding.
+ * @return Zero if successful.
+ */
+static int refdm_rptlog_write(refdm_rptlog_t *obj, const refdm_agent_autologging_cfg_t *cfg,
+                              const refdm_rptlog_item_t *item, cace_data_t *buf)
+{
+    if (obj->seg_file && (cfg->limit > 0) && (obj->seg_cnt >= cfg->limit))
+    {
+        refdm_rptlog_close(obj);
+    }
+    if (!obj->seg_file)
+    {
+        if (refdm_rptlog_open(obj, cfg))
+        {
+            return 2;
+        }
+    }
+
+    if (refdm_rptlog_record_encode(buf, item))
+    {
+        return 3;
+    }
+    const uint64_t offset = obj->seg_offset;
+    if (fwrite(buf->ptr, 1, buf->len, obj->seg_file) != buf->len)
+    {
+        CACE_LOG_ERR("Failed to write report log record");
+        return 4;
+    }
+    obj->seg_offset += buf->len;
+    obj->seg_cnt++;
+
+    if (refdm_rptlog_index_encode(buf, item, offset))
+    {
+        return 3;
+    }
+    if (fwrite(buf->ptr, 1, buf->len, obj->idx_file) != buf->len)
+    {
+        CACE_LOG_ERR("Failed to write report index entry");
+        return 4;
+    }
+
+    return 0;
+}
+
+void *refdm_rptlog_worker(void *arg)
+{
+    refdm_mgr_t    *mgr = arg;
+    refdm_rptlog_t *obj = &(mgr->rptlog);
+    CACE_LOG_INFO("Worker started");
+
+    cace_data_t buf;
+    cace_data_init(&buf);
+
+    // run until explicitly told to stop via refdm_rptlog_push_end()
+    bool at_end = false;
+    while (!at_end)
+    {
+        sem_wait(&(obj->queue_sem));
+
+        // group commit all available records up to a limit
+        size_t count = 0;
+        do
+        {
+            refdm_rptlog_item_t item;
+            if (!refdm_rptlog_queue_pop_move(&item, obj->queue))
+            {
+                // shouldn't happen
+                CACE_LOG_WARNING("failed to pop from rptlog queue");
+                continue;
+            }
+
+            if (cace_data_is_empty(&(item.encoded)))
+            {
+                at_end = true;
+            }
+            else if (refdm_rptlog_write(obj, &(mgr->agent_log_cfg), &item, &buf))
+            {
+                atomic_fetch_add(&mgr->instr.num_rptlog_failure, 1);
+            }
+            else
+            {
+                ++count;
+            }
+            refdm_rptlog_item_deinit(&item);
+        }
+        while (!at_end && (count < REFDM_RPTLOG_BATCH_MAX) && (sem_trywait(&(obj->queue_sem)) == 0));
+
+        if (count && obj->seg_file)
+        {
+            CACE_LOG_DEBUG("Flushing %zu report log records", count);
+            fflush(obj->seg_file);
+            fflush(obj->idx_file);
+        }
+    }
+
+    refdm_rptlog_close(obj);
+    cace_data_deinit(&buf);
+
+    CACE_LOG_INFO("Worker stopped");
+    return NULL;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Asynchronous binary report log for received RPTSET values.
+ *
+ * Each log segment file is a sequence of records, where each record is a
+ * 4-octet big-endian length prefix followed by a single CBOR array of:
+ *  1. The manager reception time as POSIX seconds
+ *  2. The sub-second nanoseconds of reception time
+ *  3. The agent EID as a text string
+ *  4. The received value in ARI binary form
+ *
+ * A sidecar index file with the same base name as each segment holds a CBOR
+ * sequence of arrays containing (seconds, nanoseconds, agent EID, offset)
+ * where the offset is the position of the record prefix within its segment.
+ */
+#ifndef REFDM_RPTLOG_H_
+#define REFDM_RPTLOG_H_
+
+#include "cace/ari.h"
+#include "cace/cace_data.h"
+
+#include <m-buffer.h>
+#include <m-string.h>
+
+#include <semaphore.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Size of the log hand-off queue
+#define REFDM_RPTLOG_QUEUE_SIZE 1024
+/// Largest number of records written before a group flush
+#define REFDM_RPTLOG_BATCH_MAX 64
+/// Size of the record length prefix
+#define REFDM_RPTLOG_PREFIX_LEN 4
+/// File name suffix for segment files
+#define REFDM_RPTLOG_SEG_SUFFIX ".cbor"
+/// File name suffix for index files
+#define REFDM_RPTLOG_IDX_SUFFIX ".idx"
+
+/** A single record in a report log.
+ */
+typedef struct refdm_rptlog_item_s
+{
+    /// Local reception time
+    struct timespec timestamp;
+    /// The agent EID text
+    m_string_t eid;
+    /** The received value in ARI binary form, which is written as-is.
+     * This is empty as an end-of-input sentinel.
+     */
+    cace_data_t encoded;
+    /// The decoded value, which is only set when reading a record
+    cace_ari_t value;
+} refdm_rptlog_item_t;
+
+void refdm_rptlog_item_init(refdm_rptlog_item_t *obj);
+
+void refdm_rptlog_item_init_move(refdm_rptlog_item_t *obj, refdm_rptlog_item_t *src);
+
+void refdm_rptlog_item_deinit(refdm_rptlog_item_t *obj);
+
+void refdm_rptlog_item_set(refdm_rptlog_item_t *obj, const refdm_rptlog_item_t *src);
+
+static inline void refdm_rptlog_item_init_set(refdm_rptlog_item_t *obj, const refdm_rptlog_item_t *src)
+{
+    refdm_rptlog_item_init(obj);
+    refdm_rptlog_item_set(obj, src);
+}
+
+/// OPLIST for refdm_rptlog_item_t
+#define M_OPL_refdm_rptlog_item_t()                                                         \
+    (INIT(API_2(refdm_rptlog_item_init)), INIT_SET(API_6(refdm_rptlog_item_init_set)),      \
+     INIT_MOVE(API_6(refdm_rptlog_item_init_move)), CLEAR(API_2(refdm_rptlog_item_deinit)), \
+     SET(API_6(refdm_rptlog_item_set)))
+
+/// @cond Doxygen_Suppress
+M_QUEUE_SPSC_DEF(refdm_rptlog_queue, refdm_rptlog_item_t, M_BUFFER_QUEUE)
+/// @endcond
+
+/** State of the report log writer.
+ */
+typedef struct refdm_rptlog_s
+{
+    /// Hand-off queue from the ingress thread
+    refdm_rptlog_queue_t queue;
+    /// Semaphore for items in #queue
+    sem_t queue_sem;
+
+    /// Base name shared by all segments from this process
+    m_string_t seg_base;
+    /// Sequence number of the current segment
+    unsigned int seg_num;
+    /// Number of records in the current segment
+    int seg_cnt;
+    /// Size of the current segment
+    uint64_t seg_offset;
+    /// Current segment file, owned by refdm_rptlog_worker()
+    FILE *seg_file;
+    /// Current index file, owned by refdm_rptlog_worker()
+    FILE *idx_file;
+} refdm_rptlog_t;
+
+void refdm_rptlog_init(refdm_rptlog_t *obj);
+
+void refdm_rptlog_deinit(refdm_rptlog_t *obj);
+
+/** Queue a value to be logged by the background worker.
+ * This does not block, and if the queue is full the value is dropped.
+ * The value is logged from its binary form, so it is never decoded or
+ * re-encoded.
+ *
+ * @param[in,out] obj The log state to push into.
+ * @param[in] eid The source agent EID.
+ * @param[in] timestamp The reception time.
+ * @param[in] encoded The received value in ARI binary form, which is copied.
+ * @return Zero if successful, or 2 if the queue was full.
+ */
+int refdm_rptlog_push_encoded(refdm_rptlog_t *obj, const m_string_t eid, const struct timespec *timestamp,
+                              const cace_data_t *encoded);
+
+/** Queue a sentinel to cause the worker to flush and exit.
+ *
+ * @param[in,out] obj The log state to push into.
+ */
+void refdm_rptlog_push_end(refdm_rptlog_t *obj);
+
+/** Get the approximate number of items waiting in the hand-off queue.
+ * This does not block and is safe to call from any thread.
+ *
+ * @param[in] obj The log state to read.
+ * @return The queue depth.
+ */
+size_t refdm_rptlog_queue_depth(refdm_rptlog_t *obj);
+
+/** Work thread function for the report log writer.
+ * This will run until the sentinel from refdm_rptlog_push_end() is seen.
+ *
+ * @param[in] arg The context ::refdm_mgr_t pointer.
+ * @return Always NULL pointer.
+ */
+void *refdm_rptlog_worker(void *arg);
+
+/** Encode a single record, including its length prefix.
+ * The item's binary form is used if present, otherwise its decoded value
+ * is encoded.
+ *
+ * @param[out] buf The buffer to write into, which must already be initialized.
+ * @param[in] item The record to encode.
+ * @return Zero if successful.
+ */
+int refdm_rptlog_record_encode(cace_data_t *buf, const refdm_rptlog_item_t *item);
+
+/** Decode a single record body without its length prefix.
+ *
+ * @param[out] item The record to decode into, which must already be initialized.
+ * @param[in] buf The record body.
+ * @return Zero if successful.
+ */
+int refdm_rptlog_record_decode(refdm_rptlog_item_t *item, const cace_data_t *buf);
+
+/** Read and decode the next record from a segment file.
+ *
+ * @param[out] item The record to decode into, which must already be initialized.
+ * @param[in,out] buf Scratch buffer to hold the record body.
+ * @param[in] file The segment file to read from.
+ * @return Zero if successful, a negative value at end-of-file, or a positive
+ * value upon failure.
+ */
+int refdm_rptlog_record_read(refdm_rptlog_item_t *item, cace_data_t *buf, FILE *file);
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDM_RPTLOG_H_ */
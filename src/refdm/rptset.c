@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * Lazily decoded RPTSET definitions.
+ */
+#include "rptset.h"
+
+#include "cace/ari/cbor.h"
+#include "cace/util/defs.h"
+#include "cace/util/logging.h"
+
+void refdm_rptset_init(refdm_rptset_t *obj)
+{
+    CHKVOID(obj);
+    cace_data_init(&(obj->encoded));
+    obj->is_decoded = false;
+    cace_ari_init(&(obj->value));
+}
+
+void refdm_rptset_init_set(refdm_rptset_t *obj, const refdm_rptset_t *src)
+{
+    refdm_rptset_init(obj);
+    refdm_rptset_set(obj, src);
+}
+
+void refdm_rptset_init_move(refdm_rptset_t *obj, refdm_rptset_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    cace_data_init(&(obj->encoded));
+    cace_data_move(&(obj->encoded), &(src->encoded));
+    obj->is_decoded = src->is_decoded;
+    cace_ari_init_move(&(obj->value), &(src->value));
+    src->is_decoded = false;
+}
+
+void refdm_rptset_deinit(refdm_rptset_t *obj)
+{
+    CHKVOID(obj);
+    cace_ari_deinit(&(obj->value));
+    obj->is_decoded = false;
+    cace_data_deinit(&(obj->encoded));
+}
+
+void refdm_rptset_set(refdm_rptset_t *obj, const refdm_rptset_t *src)
+{
+    CHKVOID(obj);
+    CHKVOID(src);
+    // copies always own their binary form
+    refdm_rptset_set_encoded(obj, &(src->encoded), true);
+    if (src->is_decoded)
+    {
+        cace_ari_set_copy(&(obj->value), &(src->value));
+        obj->is_decoded = true;
+    }
+}
+
+int refdm_rptset_set_encoded(refdm_rptset_t *obj, const cace_data_t *encoded, bool copy)
+{
+    CHKERR1(obj);
+    CHKERR1(encoded);
+
+    cace_ari_reset(&(obj->value));
+    obj->is_decoded = false;
+
+    // avoid resizing in-place if currently a view
+    cace_data_clear(&(obj->encoded));
+    if (copy)
+    {
+        return cace_data_copy(&(obj->encoded), encoded);
+    }
+    else
+    {
+        return cace_data_init_view(&(obj->encoded), encoded->len, encoded->ptr);
+    }
+}
+
+const cace_ari_t *refdm_rptset_get_value(refdm_rptset_t *obj)
+{
+    CHKNULL(obj);
+    if (!obj->is_decoded)
+    {
+        char *errm = NULL;
+        if (cace_ari_cbor_decode(&(obj->value), &(obj->encoded), NULL, &errm))
+        {
+            CACE_LOG_ERR("Failed to decode stored RPTSET: %s", errm);
+            CACE_FREE(errm);
+            return NULL;
+        }
+        obj->is_decoded = true;
+    }
+    return &(obj->value);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @ingroup group_refdm
+ * A received RPTSET retained in its encoded form with on-demand decoding.
+ */
+#ifndef REFDM_RPTSET_H_
+#define REFDM_RPTSET_H_
+
+#include "cace/ari.h"
+#include "cace/cace_data.h"
+
+#include <m-deque.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** An RPTSET value which is always available in its original binary form
+ * and is decoded only when its value is actually needed.
+ * The binary form is used directly for storage and for binary output forms.
+ */
+typedef struct
+{
+    /// The binary form of the RPTSET, which may be a view
+    cace_data_t encoded;
+    /// True if #value has been decoded
+    bool is_decoded;
+    /// The decoded value, which is valid only when #is_decoded is true
+    cace_ari_t value;
+} refdm_rptset_t;
+
+void refdm_rptset_init(refdm_rptset_t *obj);
+
+void refdm_rptset_init_set(refdm_rptset_t *obj, const refdm_rptset_t *src);
+
+void refdm_rptset_init_move(refdm_rptset_t *obj, refdm_rptset_t *src);
+
+void refdm_rptset_deinit(refdm_rptset_t *obj);
+
+void refdm_rptset_set(refdm_rptset_t *obj, const refdm_rptset_t *src);
+
+/** Set from only the binary form, leaving the value to be decoded on demand.
+ *
+ * @param[in,out] obj The object to set.
+ * @param[in] encoded The binary form to copy from.
+ * @param copy If true, the binary form is copied, otherwise a view is kept
+ * and the caller must ensure the source outlives this object.
+ * @return Zero if successful.
+ */
+int refdm_rptset_set_encoded(refdm_rptset_t *obj, const cace_data_t *encoded, bool copy);
+
+/** Get the decoded value, decoding it if necessary.
+ *
+ * @param[in,out] obj The object to access.
+ * @return The decoded value, or NULL if decoding failed.
+ */
+const cace_ari_t *refdm_rptset_get_value(refdm_rptset_t *obj);
+
+/// OPLIST for refdm_rptset_t
+#define M_OPL_refdm_rptset_t()                                               \
+    (INIT(API_2(refdm_rptset_init)), INIT_SET(API_6(refdm_rptset_init_set)), \
+     INIT_MOVE(API_6(refdm_rptset_init_move)), CLEAR(API_2(refdm_rptset_deinit)), SET(API_6(refdm_rptset_set)))
+
+/// @cond Doxygen_Suppress
+M_DEQUE_DEF(refdm_rptset_list, refdm_rptset_t)
+/// @endcond
+
+#ifdef __cplusplus
+} // extern C
+#endif
+
+#endif /* REFDM_RPTSET_H_ */
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Benchmark of the storage size and copy cost of a large table in its row
+ * form, as compact values, and in the packed columnar form of a TBL literal.
+ * Even columns hold small integers and odd columns hold short text.
+ *
+ * Usage: bench_ari_compact [cells]
+ */
+#include <cace/ari/compact.h>
+#include <cace/ari/tbl_cols.h>
+#include <cace/util/defs.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/// Column count of the table
+#define NCOLS 10
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *stop)
+{
+    return (double)(stop->tv_sec - start->tv_sec) * 1e9 + (double)(stop->tv_nsec - start->tv_nsec);
+}
+
+/// Storage size of all values in a columnar table, not counting boxes
+static size_t cols_size(const cace_ari_tbl_cols_t *cols)
+{
+    size_t total = 0;
+
+    cace_ari_tbl_col_array_it_t it;
+    for (cace_ari_tbl_col_array_it(it, cols->cols); !cace_ari_tbl_col_array_end_p(it);
+         cace_ari_tbl_col_array_next(it))
+    {
+        const cace_ari_tbl_col_t *col = cace_ari_tbl_col_array_cref(it);
+        total += col->packed ? sizeof(cace_ari_tbl_word_t) * cace_ari_tbl_word_array_size(col->words)
+                             : sizeof(cace_ari_compact_t) * cace_ari_compact_array_size(col->items);
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    long count = 100000;
+    if (argc > 1)
+    {
+        count = strtol(argv[1], NULL, 10);
+    }
+    if ((count <= 0) || (count % NCOLS != 0))
+    {
+        fprintf(stderr, "Usage: %s [cells, multiple of %d]\n", argv[0], NCOLS);
+        return 1;
+    }
+    struct timespec start, stop;
+
+    cace_ari_tbl_t tbl;
+    cace_ari_tbl_init(&tbl);
+    cace_ari_tbl_reset(&tbl, NCOLS, count / NCOLS);
+    for (long ix = 0; ix < count; ++ix)
+    {
+        cace_ari_t *item = cace_ari_array_get(tbl.items, ix);
+        if (ix % 2)
+        {
+            char text[24];
+            snprintf(text, sizeof(text), "v%ld", ix % 100000);
+            cace_ari_set_tstr(item, text, true);
+        }
+        else
+        {
+            cace_ari_set_uvast(item, (cace_ari_uvast)ix);
+        }
+    }
+
+    {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        cace_ari_tbl_t dup;
+        cace_ari_tbl_init(&dup);
+        dup.ncols = tbl.ncols;
+        cace_ari_array_set(dup.items, tbl.items);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        cace_ari_tbl_deinit(&dup);
+
+        printf("row form: %zu bytes, copy %.1f ns/cell\n", sizeof(cace_ari_t) * (size_t)count,
+               elapsed_ns(&start, &stop) / (double)count);
+    }
+
+    {
+        cace_ari_compact_array_t arr;
+        cace_ari_compact_array_init(arr);
+        cace_ari_compact_array_resize(arr, count);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long ix = 0; ix < count; ++ix)
+        {
+            cace_ari_compact_set_ari(cace_ari_compact_array_get(arr, ix), cace_ari_array_cget(tbl.items, ix));
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf("compact: %zu bytes, convert %.1f ns/cell", sizeof(cace_ari_compact_t) * (size_t)count,
+               elapsed_ns(&start, &stop) / (double)count);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        cace_ari_compact_array_t dup;
+        cace_ari_compact_array_init_set(dup, arr);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf(", copy %.1f ns/cell\n", elapsed_ns(&start, &stop) / (double)count);
+
+        cace_ari_compact_array_clear(dup);
+        cace_ari_compact_array_clear(arr);
+    }
+
+    {
+        // packing moves values out of the row form
+        cace_ari_tbl_t packed;
+        cace_ari_tbl_init(&packed);
+        packed.ncols = tbl.ncols;
+        cace_ari_array_set(packed.items, tbl.items);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        cace_ari_tbl_pack(&packed);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf("packed TBL: %zu bytes, convert %.1f ns/cell", cols_size(packed.cols),
+               elapsed_ns(&start, &stop) / (double)count);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        cace_ari_tbl_cols_t dup;
+        cace_ari_tbl_cols_init_set(&dup, packed.cols);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf(", copy %.1f ns/cell\n", elapsed_ns(&start, &stop) / (double)count);
+
+        cace_ari_tbl_cols_deinit(&dup);
+        cace_ari_tbl_deinit(&packed);
+    }
+
+    cace_ari_tbl_deinit(&tbl);
+    return 0;
+}
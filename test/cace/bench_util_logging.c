@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Benchmark of the cost of each logging call, both for events which are
+ * suppressed by severity and events which are emitted.
+ * Emitted events are written to the null device so that the result shows
+ * only the logging overhead.
+ *
+ * Usage: bench_util_logging [iterations]
+ */
+#include <cace/util/logging.h>
+#include <cace/util/defs.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *stop)
+{
+    return (double)(stop->tv_sec - start->tv_sec) * 1e9 + (double)(stop->tv_nsec - start->tv_nsec);
+}
+
+int main(int argc, char *argv[])
+{
+    long count = 1000000;
+    if (argc > 1)
+    {
+        count = strtol(argv[1], NULL, 10);
+    }
+    if (count <= 0)
+    {
+        fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    // discard all log output
+    int devnull = open("/dev/null", O_WRONLY);
+    if ((devnull < 0) || (dup2(devnull, STDERR_FILENO) < 0))
+    {
+        perror("Failed to redirect stderr");
+        return 1;
+    }
+    close(devnull);
+
+    cace_openlog();
+    struct timespec start, stop;
+
+    cace_log_set_least_severity(LOG_WARNING);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long ix = 0; ix < count; ++ix)
+    {
+        CACE_LOG_DEBUG("suppressed event %ld of %ld", ix, count);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    printf("suppressed: %.1f ns/event\n", elapsed_ns(&start, &stop) / (double)count);
+
+    cace_log_set_least_severity(LOG_DEBUG);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long ix = 0; ix < count; ++ix)
+    {
+        CACE_LOG_DEBUG("emitted event %ld of %ld", ix, count);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    printf("emitted (caller): %.1f ns/event\n", elapsed_ns(&start, &stop) / (double)count);
+
+    // include the time to write all queued events
+    cace_closelog();
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    printf("emitted (drained): %.1f ns/event\n", elapsed_ns(&start, &stop) / (double)count);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the cace/amm/objpat_set.h interfaces.
+ */
+#include <cace/amm/objpat_set.h>
+#include <cace/ari/text.h>
+#include <cace/util/logging.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    cace_closelog();
+    return failures;
+}
+
+/// Resource cleanup for failure messages
+static char *errm = NULL;
+
+void tearDown(void)
+{
+    if (errm)
+    {
+        CACE_FREE(errm);
+        errm = NULL;
+    }
+}
+
+#if ARI_TEXT_PARSE
+
+static void decode_text(cace_ari_t *ari, const char *text)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, text);
+    int res = cace_ari_text_decode(ari, intext, &errm);
+    m_string_clear(intext);
+    if (res && errm)
+    {
+        TEST_FAIL_MESSAGE(errm);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_ari_text_decode() failed");
+}
+
+TEST_CASE("ari:/OBJPAT/(*)(*)(*)(*)", "ari://65535/10/CTRL/4", true)
+TEST_CASE("ari:/OBJPAT/(65535)(*)(*)(*)", "ari://65535/10/CTRL/4", true)
+TEST_CASE("ari:/OBJPAT/(65534)(*)(*)(*)", "ari://65535/10/CTRL/4", false)
+TEST_CASE("ari:/OBJPAT/(65535)(1..10)(-3)(3..)", "ari://65535/10/CTRL/4", true)
+TEST_CASE("ari:/OBJPAT/(65535)(1..10)(-4)(3..)", "ari://65535/10/CTRL/4", false)
+TEST_CASE("ari:/OBJPAT/(example)(adm)(*)(hi)", "ari://example/adm/CTRL/hi", true)
+TEST_CASE("ari:/OBJPAT/(example)(adm)(*)(hi)", "ari://example/adm/CTRL/eh", false)
+TEST_CASE("ari:/OBJPAT/(65535)(*)(*)(*)", "ari://example/adm/CTRL/hi", false)
+TEST_CASE("ari:/AC/(/OBJPAT/(1)(*)(*)(*),/OBJPAT/(example)(*)(*)(*))", "ari://example/adm/CTRL/hi", true)
+TEST_CASE("ari:/AC/()", "ari://example/adm/CTRL/hi", false)
+void test_objpat_set_match_path(const char *pattext, const char *reftext, bool expect)
+{
+    cace_ari_t pat = CACE_ARI_INIT_UNDEFINED;
+    decode_text(&pat, pattext);
+    cace_ari_t ref = CACE_ARI_INIT_UNDEFINED;
+    decode_text(&ref, reftext);
+    TEST_ASSERT_TRUE(ref.is_ref);
+
+    TEST_ASSERT_EQUAL(expect, cace_amm_objpat_set_match_path(&pat, &(ref.as_ref.objpath)));
+
+    cace_ari_deinit(&ref);
+    cace_ari_deinit(&pat);
+}
+
+#endif /* ARI_TEXT_PARSE */
@@ -17,6 +17,7 @@
  */
 #include <cace/amm/parameters.h>
 #include <cace/amm/semtype.h>
+#include <cace/ari/algo.h>
 #include <cace/ari/cbor.h>
 #include <cace/ari/text_util.h>
 #include <cace/util/logging.h>
@@ -189,3 +190,71 @@ void test_fparam_one_object(const char *inhex, int expect_res)
     cace_ari_itemized_deinit(&aparams);
     cace_amm_formal_param_list_clear(fparams);
 }
+
+TEST_CASE("8519FFFF02200481F5", 0, false)     // ari://65535/2/-1/4(true)
+TEST_CASE("8519FFFF02200481626869", 0, false) // ari://65535/2/-1/4(hi) implicit cast to bool
+TEST_CASE("8519FFFF02200481F6", 0, false)     // ari://65535/2/-1/4(null) implicit cast to bool
+TEST_CASE("8519FFFF02200482F5F5", 3, false)   // ari://65535/2/-1/4(true,true) too many params
+void test_fparam_cached(const char *inhex, int expect_res, bool expect_undefined)
+{
+    cace_amm_formal_param_list_t fparams;
+    cace_amm_formal_param_list_init(fparams);
+    {
+        cace_amm_formal_param_t *fparam = cace_amm_formal_param_list_push_back_new(fparams);
+
+        fparam->index = 0;
+        m_string_set_cstr(fparam->name, "hi");
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(fparam->typeobj), CACE_ARI_TYPE_BOOL));
+    }
+
+    cace_ari_t inval = CACE_ARI_INIT_UNDEFINED;
+    {
+        m_string_t intext;
+        m_string_init_set_cstr(intext, inhex);
+        cace_data_t indata;
+        cace_data_init(&indata);
+        TEST_ASSERT_EQUAL_INT(0, cace_base16_decode(&indata, intext));
+        m_string_clear(intext);
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode(&inval, &indata, NULL, NULL));
+        cace_data_deinit(&indata);
+        TEST_ASSERT_TRUE(inval.is_ref);
+    }
+
+    cace_amm_actual_param_cache_t cache;
+    cace_amm_actual_param_cache_init(&cache);
+
+    cace_ari_itemized_t first;
+    cace_ari_itemized_init(&first);
+    int res = cace_amm_actual_param_set_populate_cached(&first, &cache, fparams, &(inval.as_ref.params));
+    TEST_ASSERT_EQUAL_INT(expect_res, res);
+
+    // second time from the cache, if successful
+    cace_ari_itemized_t second;
+    cace_ari_itemized_init(&second);
+    res = cace_amm_actual_param_set_populate_cached(&second, &cache, fparams, &(inval.as_ref.params));
+    TEST_ASSERT_EQUAL_INT(expect_res, res);
+
+    if (!expect_res)
+    {
+        TEST_ASSERT_EQUAL(expect_undefined, first.any_undefined);
+        TEST_ASSERT_EQUAL(expect_undefined, second.any_undefined);
+        TEST_ASSERT_EQUAL_INT(1, cace_ari_array_size(second.ordered));
+        TEST_ASSERT_TRUE(cace_ari_equal(cace_ari_array_cget(first.ordered, 0), cace_ari_array_cget(second.ordered, 0)));
+
+        // names refer to the copied items
+        cace_ari_t *const *named = cace_named_ari_ptr_dict_cget(second.named, "hi");
+        TEST_ASSERT_NOT_NULL(named);
+        TEST_ASSERT_EQUAL_PTR(cace_ari_array_get(second.ordered, 0), *named);
+    }
+
+    // after reset the results are the same
+    cace_amm_actual_param_cache_reset(&cache);
+    res = cace_amm_actual_param_set_populate_cached(&second, &cache, fparams, &(inval.as_ref.params));
+    TEST_ASSERT_EQUAL_INT(expect_res, res);
+
+    cace_ari_itemized_deinit(&second);
+    cace_ari_itemized_deinit(&first);
+    cace_amm_actual_param_cache_deinit(&cache);
+    cace_ari_deinit(&inval);
+    cace_amm_formal_param_list_clear(fparams);
+}
@@ -17,6 +17,7 @@
  */
 #include <cace/amm/obj_store.h>
 #include <cace/amm/semtype.h>
+#include <cace/amm/type_prog.h>
 #include <cace/amm/typing.h>
 #include <cace/ari/cbor.h>
 #include <cace/ari/text_util.h>
@@ -305,6 +306,9 @@ void test_amm_type_match_semtype_use_1(const char *inhex, cace_amm_type_match_re
 
     TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&mytype, CACE_ARI_TYPE_INT));
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -335,6 +339,9 @@ void test_amm_type_match_semtype_ulist_1(const char *inhex, cace_amm_type_match_
         semtype->size.i_min   = 2;
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -371,6 +378,9 @@ void test_amm_type_match_semtype_dlist_2item(const char *inhex, cace_amm_type_ma
         }
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -415,6 +425,9 @@ void test_amm_type_match_semtype_dlist_seq_minmax(const char *inhex, cace_amm_ty
         }
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -442,6 +455,9 @@ void test_amm_type_match_semtype_umap_1(const char *inhex, cace_amm_type_match_r
         TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(semtype->val_type), CACE_ARI_TYPE_BOOL));
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -471,6 +487,9 @@ void test_amm_type_match_semtype_tblt_1(const char *inhex, cace_amm_type_match_r
         }
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -502,6 +521,9 @@ void test_amm_type_match_semtype_union_1(const char *inhex, cace_amm_type_match_
         }
     }
 
+    check_match(&mytype, inhex, expect);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
     check_match(&mytype, inhex, expect);
     cace_amm_type_deinit(&mytype);
 }
@@ -693,3 +715,58 @@ void test_amm_type_convert_td(const char *inhex, const char *expecthex)
     const cace_amm_type_t *type = cace_amm_type_get_builtin(CACE_ARI_TYPE_TD);
     check_convert(type, inhex, expecthex);
 }
+
+TEST_CASE("F6", NULL)                                 // ari:null
+TEST_CASE("82118101", NULL)                           // ari:/AC/(1) too few items
+TEST_CASE("8211820102", "821182820401820402")         // ari:/AC/(1,2)
+TEST_CASE("821183010203", "821183820401820402820403") // ari:/AC/(1,2,3)
+TEST_CASE("82118201F5", NULL)                         // ari:/AC/(1,true)
+void test_amm_type_convert_semtype_ulist_1(const char *inhex, const char *expecthex)
+{
+    cace_amm_type_t mytype;
+    cace_amm_type_init(&mytype);
+    {
+        cace_amm_semtype_ulist_t *semtype = cace_amm_type_set_ulist(&mytype);
+        TEST_ASSERT_NOT_NULL(semtype);
+
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(semtype->item_type), CACE_ARI_TYPE_INT));
+
+        semtype->size.has_min = true;
+        semtype->size.i_min   = 2;
+    }
+
+    check_convert(&mytype, inhex, expecthex);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
+    check_convert(&mytype, inhex, expecthex);
+    cace_amm_type_deinit(&mytype);
+}
+
+TEST_CASE("F6", NULL)                                 // ari:null
+TEST_CASE("82138102", "82138102")                     // ari:/TBL/c=2;
+TEST_CASE("8213830201F5", "821383028204018201F5")     // ari:/TBL/c=2;(1,true)
+TEST_CASE("821383020103", "821383028204018201F5")     // ari:/TBL/c=2;(1,3)
+TEST_CASE("82138301F5F4", NULL)                       // ari:/TBL/c=1;(true,false)
+void test_amm_type_convert_semtype_tblt_1(const char *inhex, const char *expecthex)
+{
+    cace_amm_type_t mytype;
+    cace_amm_type_init(&mytype);
+    {
+        cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&mytype, 2);
+        TEST_ASSERT_NOT_NULL(semtype);
+        {
+            cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+            TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(col->typeobj), CACE_ARI_TYPE_INT));
+        }
+        {
+            cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 1);
+            TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(col->typeobj), CACE_ARI_TYPE_BOOL));
+        }
+    }
+
+    check_convert(&mytype, inhex, expecthex);
+    // compiled program has the same result
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_type_compile(&mytype));
+    check_convert(&mytype, inhex, expecthex);
+    cace_amm_type_deinit(&mytype);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cace/amp/msg.h>
+#include <cace/ari/algo.h>
+#include <cace/ari/cbor.h>
+#include <cace/util/logging.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    cace_closelog();
+    return failures;
+}
+
+void test_decode_spans(void)
+{
+    // version 1, then items 42 and true
+    const uint8_t msgbuf[] = { 0x01, 0x18, 0x2A, 0xF5 };
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_amm_msg_if_span_list_t spans;
+    cace_amm_msg_if_span_list_init(spans);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_amp_msg_decode_spans(items, spans, msgbuf, sizeof(msgbuf)));
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(items));
+    TEST_ASSERT_EQUAL_size_t(2, cace_amm_msg_if_span_list_size(spans));
+
+    const cace_amm_msg_if_span_t *span = cace_amm_msg_if_span_list_cget(spans, 0);
+    TEST_ASSERT_EQUAL_size_t(1, span->offset);
+    TEST_ASSERT_EQUAL_size_t(2, span->len);
+    span = cace_amm_msg_if_span_list_cget(spans, 1);
+    TEST_ASSERT_EQUAL_size_t(3, span->offset);
+    TEST_ASSERT_EQUAL_size_t(1, span->len);
+
+    cace_amm_msg_if_span_list_clear(spans);
+    cace_ari_list_clear(items);
+}
+
+void test_decode_meta(void)
+{
+    const uint8_t msgbuf[] = { 0x01, 0x18, 0x2A, 0xF5 };
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_amm_msg_if_metadata_t meta;
+    cace_amm_msg_if_metadata_init(&meta);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&meta.encoded, sizeof(msgbuf), (cace_data_ptr_t)msgbuf));
+    TEST_ASSERT_EQUAL_INT(0, cace_amp_msg_decode_meta(items, &meta, 0));
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(items));
+    TEST_ASSERT_EQUAL_size_t(sizeof(msgbuf), meta.encoded.len);
+
+    // each view decodes to the same value as the item
+    for (size_t ix = 0; ix < cace_ari_list_size(items); ++ix)
+    {
+        cace_data_t view;
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_msg_if_metadata_get_encoded(&meta, ix, &view));
+
+        cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode(&val, &view, NULL, NULL));
+        TEST_ASSERT_TRUE(cace_ari_equal(cace_ari_list_get(items, ix), &val));
+        cace_ari_deinit(&val);
+        cace_data_deinit(&view);
+    }
+
+    // out of range
+    cace_data_t view;
+    TEST_ASSERT_NOT_EQUAL_INT(0, cace_amm_msg_if_metadata_get_encoded(&meta, 2, &view));
+
+    // reuse of metadata replaces old spans
+    cace_ari_list_reset(items);
+    const uint8_t msgbuf2[] = { 0x01, 0xF4 };
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&meta.encoded, sizeof(msgbuf2), (cace_data_ptr_t)msgbuf2));
+    TEST_ASSERT_EQUAL_INT(0, cace_amp_msg_decode_meta(items, &meta, 0));
+    TEST_ASSERT_EQUAL_size_t(1, cace_amm_msg_if_span_list_size(meta.item_spans));
+
+    // offset past the end
+    TEST_ASSERT_NOT_EQUAL_INT(0, cace_amp_msg_decode_meta(items, &meta, 3));
+
+    cace_amm_msg_if_metadata_deinit(&meta);
+    cace_ari_list_clear(items);
+}
+
+void test_decode_meta_offset(void)
+{
+    // transport header of text "hi", then version 1 and item true
+    const uint8_t msgbuf[] = { 0x62, 0x68, 0x69, 0x01, 0xF5 };
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_amm_msg_if_metadata_t meta;
+    cace_amm_msg_if_metadata_init(&meta);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&meta.encoded, sizeof(msgbuf), (cace_data_ptr_t)msgbuf));
+    TEST_ASSERT_EQUAL_INT(0, cace_amp_msg_decode_meta(items, &meta, 3));
+    TEST_ASSERT_EQUAL_size_t(1, cace_ari_list_size(items));
+
+    // span is relative to the whole message
+    const cace_amm_msg_if_span_t *span = cace_amm_msg_if_span_list_cget(meta.item_spans, 0);
+    TEST_ASSERT_EQUAL_size_t(4, span->offset);
+    TEST_ASSERT_EQUAL_size_t(1, span->len);
+
+    cace_amm_msg_if_metadata_deinit(&meta);
+    cace_ari_list_clear(items);
+}
+
+void test_decode_meta_defer(void)
+{
+    // version 1, then items 42 and an unterminated array
+    const uint8_t msgbuf[] = { 0x01, 0x18, 0x2A, 0x82, 0x01 };
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_amm_msg_if_metadata_t meta;
+    cace_amm_msg_if_metadata_init(&meta);
+    meta.defer_decode = true;
+
+    // framing still detects the truncated item
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&meta.encoded, sizeof(msgbuf), (cace_data_ptr_t)msgbuf));
+    TEST_ASSERT_NOT_EQUAL_INT(0, cace_amp_msg_decode_meta(items, &meta, 0));
+    TEST_ASSERT_EQUAL_size_t(1, cace_ari_list_size(items));
+    TEST_ASSERT_TRUE(cace_ari_is_undefined(cace_ari_list_get(items, 0)));
+
+    cace_data_t view;
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_msg_if_metadata_get_encoded(&meta, 0, &view));
+    cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode(&val, &view, NULL, NULL));
+    cace_ari_uvast uval;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&val, &uval));
+    TEST_ASSERT_EQUAL_UINT64(42, uval);
+    cace_ari_deinit(&val);
+    cace_data_deinit(&view);
+
+    cace_amm_msg_if_metadata_deinit(&meta);
+    cace_ari_list_clear(items);
+}
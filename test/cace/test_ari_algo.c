@@ -314,3 +314,40 @@ void test_ari_equal(void)
         }
     }
 }
+
+void test_ari_copy_shares_container(void)
+{
+    cace_ari_t orig = CACE_ARI_INIT_UNDEFINED;
+    {
+        cace_ari_ac_t *ac = cace_ari_set_ac(&orig, NULL);
+        cace_ari_set_uvast(cace_ari_list_push_back_new(ac->items), 1);
+        cace_ari_set_tbl(cace_ari_list_push_back_new(ac->items), NULL)->ncols = 2;
+    }
+
+    cace_ari_t copy = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_copy(&copy, &orig);
+    TEST_ASSERT_EQUAL_PTR(cace_ari_cget_ac(&orig), cace_ari_cget_ac(&copy));
+    TEST_ASSERT_TRUE(cace_ari_equal(&orig, &copy));
+
+    // modification through the copy leaves the original alone
+    cace_ari_ac_t *copy_ac = cace_ari_get_ac(&copy);
+    TEST_ASSERT_NOT_NULL(copy_ac);
+    TEST_ASSERT_NOT_EQUAL(cace_ari_cget_ac(&orig), copy_ac);
+    cace_ari_set_uvast(cace_ari_list_push_back_new(copy_ac->items), 3);
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(cace_ari_cget_ac(&orig)->items));
+    TEST_ASSERT_EQUAL_size_t(3, cace_ari_list_size(copy_ac->items));
+
+    // nested containers are still shared
+    const cace_ari_t *orig_tbl = cace_ari_list_cget(cace_ari_cget_ac(&orig)->items, 1);
+    cace_ari_t       *copy_tbl = cace_ari_list_get(copy_ac->items, 1);
+    TEST_ASSERT_EQUAL_PTR(cace_ari_cget_tbl(orig_tbl), cace_ari_cget_tbl(copy_tbl));
+    cace_ari_get_tbl(copy_tbl)->ncols = 3;
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_cget_tbl(orig_tbl)->ncols);
+
+    // sole owner modifies in-place
+    const cace_ari_ac_t *orig_ac = cace_ari_cget_ac(&orig);
+    cace_ari_deinit(&copy);
+    TEST_ASSERT_EQUAL_PTR(orig_ac, cace_ari_get_ac(&orig));
+
+    cace_ari_deinit(&orig);
+}
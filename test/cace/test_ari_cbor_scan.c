@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the cace_ari_cbor_scan.h interfaces.
+ */
+#include <cace/ari/cbor_scan.h>
+#include <cace/ari/text_util.h>
+#include <cace/util/logging.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    cace_closelog();
+    return failures;
+}
+
+static void load_hex(cace_data_t *data, const char *inhex)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, inhex);
+    cace_data_init(data);
+    TEST_ASSERT_EQUAL_INT(0, cace_base16_decode(data, intext));
+    m_string_clear(intext);
+}
+
+TEST_CASE("00")                 // 0
+TEST_CASE("3903E7")             // -1000
+TEST_CASE("426869")             // h'6869'
+TEST_CASE("5F41684169FF")       // (_ h'68', h'69')
+TEST_CASE("83010203")           // [1, 2, 3]
+TEST_CASE("9F0102FF")           // [_ 1, 2]
+TEST_CASE("A201020304")         // {1: 2, 3: 4}
+TEST_CASE("C11A2B450625")       // 1(725943845)
+TEST_CASE("FB3FF3333333333333") // 1.2
+void test_skip_valid(const char *inhex)
+{
+    cace_data_t indata;
+    load_hex(&indata, inhex);
+
+    cace_ari_cbor_span_t span;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_skip(&indata, 0, &span));
+    TEST_ASSERT_EQUAL_size_t(0, span.offset);
+    TEST_ASSERT_EQUAL_size_t(indata.len, span.len);
+
+    cace_data_deinit(&indata);
+}
+
+TEST_CASE("19", 2)     // missing argument
+TEST_CASE("4268", 2)   // short byte string
+TEST_CASE("830102", 2) // short array
+TEST_CASE("9F0102", 2) // missing break
+TEST_CASE("9B", 2)     // missing count
+TEST_CASE("1C", 3)     // reserved additional info
+TEST_CASE("FF", 3)     // break alone
+TEST_CASE("1F", 3)     // indefinite integer
+TEST_CASE("5F01FF", 3) // bad string chunk
+void test_skip_invalid(const char *inhex, int expect)
+{
+    cace_data_t indata;
+    load_hex(&indata, inhex);
+
+    cace_ari_cbor_span_t span;
+    TEST_ASSERT_EQUAL_INT(expect, cace_ari_cbor_skip(&indata, 0, &span));
+
+    cace_data_deinit(&indata);
+}
+
+void test_scan_array(void)
+{
+    cace_data_t indata;
+    // [_ 1, [2, 3], h'68']
+    load_hex(&indata, "9F018202034168FF");
+
+    cace_ari_cbor_scan_t scan;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_enter(&scan, &indata, 0));
+
+    cace_ari_cbor_span_t span;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+    TEST_ASSERT_EQUAL_size_t(1, span.offset);
+    TEST_ASSERT_EQUAL_size_t(1, span.len);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+    TEST_ASSERT_EQUAL_size_t(2, span.offset);
+    TEST_ASSERT_EQUAL_size_t(3, span.len);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+    TEST_ASSERT_EQUAL_size_t(5, span.offset);
+    TEST_ASSERT_EQUAL_size_t(2, span.len);
+    TEST_ASSERT_LESS_THAN_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+
+    // not a container
+    TEST_ASSERT_EQUAL_INT(3, cace_ari_cbor_scan_enter(&scan, &indata, 1));
+
+    cace_data_deinit(&indata);
+}
+
+TEST_CASE("1904D2")                                           // ari:1234
+TEST_CASE("84676578616D706C65647465737422626869")             // ari://example/test/CTRL/hi
+TEST_CASE("8214821904D284676578616D706C65647465737422626869") // ari:/EXECSET/n=1234;(//example/test/CTRL/hi)
+void test_index_whole(const char *inhex)
+{
+    cace_data_t indata;
+    load_hex(&indata, inhex);
+
+    cace_ari_cbor_index_t idx;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_index(&idx, &indata, 0));
+    TEST_ASSERT_EQUAL_size_t(0, idx.whole.offset);
+    TEST_ASSERT_EQUAL_size_t(indata.len, idx.whole.len);
+
+    cace_data_deinit(&indata);
+}
+
+void test_index_execset(void)
+{
+    cace_data_t indata;
+    // ari:/EXECSET/n=1234;(//example/test/CTRL/hi)
+    load_hex(&indata, "8214821904D284676578616D706C65647465737422626869");
+
+    cace_ari_cbor_index_t idx;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_index(&idx, &indata, 0));
+    TEST_ASSERT_TRUE(idx.has_ari_type);
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_TYPE_EXECSET, idx.ari_type);
+    TEST_ASSERT_TRUE(idx.is_container);
+    TEST_ASSERT_EQUAL_size_t(2, idx.count);
+
+    cace_ari_t nonce = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode_span(&nonce, &indata, idx.items[0]));
+    cace_ari_uvast uval;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&nonce, &uval));
+    TEST_ASSERT_EQUAL_UINT64(1234, uval);
+    cace_ari_deinit(&nonce);
+
+    cace_data_t view;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_index_get(&idx, &indata, 1, &view));
+    TEST_ASSERT_EQUAL_size_t(18, view.len);
+    cace_data_deinit(&view);
+    TEST_ASSERT_NOT_EQUAL_INT(0, cace_ari_cbor_index_get(&idx, &indata, 2, &view));
+
+    cace_data_deinit(&indata);
+}
+
+void test_index_rptset(void)
+{
+    cace_data_t indata;
+    // ari:/RPTSET/n=1234;r=/TP/20000101T001640Z;(t=/TD/PT0S;s=//example/test/CTRL/hi;(null,3,h'6869'))
+    load_hex(&indata, "8215831904D21903E8850084676578616D706C65647465737422626869F603426869");
+
+    cace_ari_cbor_index_t idx;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_index(&idx, &indata, 0));
+    TEST_ASSERT_TRUE(idx.has_ari_type);
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_TYPE_RPTSET, idx.ari_type);
+    TEST_ASSERT_EQUAL_size_t(3, idx.count);
+
+    struct timespec reftime;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode_span_timespec(&reftime, &indata, idx.items[1]));
+    TEST_ASSERT_EQUAL_INT64(1000, reftime.tv_sec);
+    TEST_ASSERT_EQUAL_INT64(0, reftime.tv_nsec);
+
+    // the report source is the second item
+    cace_ari_cbor_scan_t scan;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_enter(&scan, &indata, idx.items[2].offset));
+    cace_ari_cbor_span_t span;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_scan_next(&scan, &span));
+
+    cace_ari_t source = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode_span(&source, &indata, span));
+    TEST_ASSERT_TRUE(source.is_ref);
+    cace_ari_deinit(&source);
+
+    cace_data_deinit(&indata);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the compact.h interfaces.
+ */
+#include <cace/ari/compact.h>
+#include <cace/ari/cbor.h>
+#include <cace/ari/text_util.h>
+#include <cace/util/defs.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+static void decode_ari(cace_ari_t *ari, const char *inhex)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, inhex);
+    cace_data_t indata;
+    cace_data_init(&indata);
+    int res = cace_base16_decode(&indata, intext);
+    m_string_clear(intext);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_base16_decode() failed");
+
+    res = cace_ari_cbor_decode(ari, &indata, NULL, NULL);
+    cace_data_deinit(&indata);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_ari_cbor_decode() failed");
+}
+
+void test_ari_compact_sizeof(void)
+{
+    TEST_ASSERT_EQUAL_size_t(16, sizeof(cace_ari_compact_t));
+    // the whole point of this form
+    TEST_ASSERT_LESS_THAN_size_t(sizeof(cace_ari_t), sizeof(cace_ari_compact_t));
+}
+
+TEST_CASE("F7", false)                         // ari:undefined
+TEST_CASE("F6", false)                         // ari:null
+TEST_CASE("F5", false)                         // ari:true
+TEST_CASE("0A", false)                         // ari:10
+TEST_CASE("29", false)                         // ari:-10
+TEST_CASE("82041864", false)                   // ari:/INT/100
+TEST_CASE("8209F93E00", false)                 // ari:/REAL64/1.5
+TEST_CASE("626869", false)                     // ari:hi
+TEST_CASE("6761626364656667", false)           // ari:abcdefg
+TEST_CASE("43010203", false)                   // ari:h'010203'
+TEST_CASE("686162636465666768", true)          // ari:abcdefgh
+TEST_CASE("820C1A2B450625", true)              // ari:/TP/20230102T030405Z
+TEST_CASE("82138102", true)                    // ari:/TBL/c=2;
+TEST_CASE("8519FFFF02200481626869", true)      // ari://65535/2/-1/4(hi)
+void test_ari_compact_roundtrip(const char *inhex, bool expect_boxed)
+{
+    cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+    decode_ari(&val, inhex);
+
+    cace_ari_compact_t cval;
+    cace_ari_compact_init(&cval);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_compact_set_ari(&cval, &val));
+    TEST_ASSERT_EQUAL(expect_boxed, cace_ari_compact_is_boxed(&cval));
+
+    {
+        cace_ari_t        buf;
+        const cace_ari_t *view = cace_ari_compact_cview(&cval, &buf);
+        TEST_ASSERT_NOT_NULL(view);
+        TEST_ASSERT_TRUE(cace_ari_equal(&val, view));
+    }
+
+    // copy is independent of the original
+    cace_ari_compact_t other;
+    cace_ari_compact_init_set(&other, &cval);
+    cace_ari_compact_deinit(&cval);
+
+    cace_ari_t out = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_compact_get_ari(&out, &other));
+    TEST_ASSERT_TRUE(cace_ari_equal(&val, &out));
+
+    cace_ari_deinit(&out);
+    cace_ari_compact_deinit(&other);
+    cace_ari_deinit(&val);
+}
+
+void test_ari_compact_move(void)
+{
+    cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+    // ari:/TBL/c=2;(1,true)
+    decode_ari(&val, "8213830201F5");
+    const cace_ari_tbl_t *tbl = cace_ari_cget_tbl(&val);
+    TEST_ASSERT_NOT_NULL(tbl);
+
+    cace_ari_compact_t cval;
+    cace_ari_compact_init(&cval);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_compact_set_ari_move(&cval, &val));
+    TEST_ASSERT_TRUE(cace_ari_compact_is_boxed(&cval));
+    TEST_ASSERT_TRUE(cace_ari_is_undefined(&val));
+
+    // same container without a copy
+    cace_ari_t buf;
+    TEST_ASSERT_EQUAL_PTR(tbl, cace_ari_cget_tbl(cace_ari_compact_cview(&cval, &buf)));
+
+    cace_ari_compact_deinit(&cval);
+    cace_ari_deinit(&val);
+}
+
+void test_ari_compact_array(void)
+{
+    cace_ari_compact_array_t arr;
+    cace_ari_compact_array_init(arr);
+
+    cace_ari_t val = CACE_ARI_INIT_UNDEFINED;
+    for (cace_ari_uvast ix = 0; ix < 100; ++ix)
+    {
+        cace_ari_set_uvast(&val, ix);
+        cace_ari_compact_set_ari(cace_ari_compact_array_push_new(arr), &val);
+    }
+    cace_ari_set_tstr(&val, "a longer text value", false);
+    cace_ari_compact_set_ari(cace_ari_compact_array_push_new(arr), &val);
+
+    cace_ari_compact_array_t dup;
+    cace_ari_compact_array_init_set(dup, arr);
+    cace_ari_compact_array_clear(arr);
+
+    TEST_ASSERT_EQUAL_size_t(101, cace_ari_compact_array_size(dup));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_compact_get_ari(&val, cace_ari_compact_array_cget(dup, 42)));
+    cace_ari_uvast uval;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&val, &uval));
+    TEST_ASSERT_EQUAL_UINT64(42, uval);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_compact_get_ari(&val, cace_ari_compact_array_cget(dup, 100)));
+    TEST_ASSERT_EQUAL_STRING("a longer text value", cace_ari_cget_tstr_cstr(&val));
+
+    cace_ari_deinit(&val);
+    cace_ari_compact_array_clear(dup);
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the rpt_delta.h interfaces.
+ */
+#include <cace/ari/rpt_delta.h>
+#include <cace/util/defs.h>
+
+#include <unity.h>
+
+static void set_items(cace_ari_list_t items, const cace_ari_uvast *vals, size_t count)
+{
+    cace_ari_list_reset(items);
+    for (size_t ix = 0; ix < count; ++ix)
+    {
+        cace_ari_set_uvast(cace_ari_list_push_back_new(items), vals[ix]);
+    }
+}
+
+static void check_items(const cace_ari_list_t items, const cace_ari_uvast *vals, size_t count)
+{
+    TEST_ASSERT_EQUAL_size_t(count, cace_ari_list_size(items));
+    size_t             ix = 0;
+    cace_ari_list_it_t it;
+    for (cace_ari_list_it(it, items); !cace_ari_list_end_p(it); cace_ari_list_next(it), ++ix)
+    {
+        cace_ari_uvast got;
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(cace_ari_list_cref(it), &got));
+        TEST_ASSERT_EQUAL_UINT64(vals[ix], got);
+    }
+}
+
+void test_rpt_delta_marker(void)
+{
+    cace_ari_t marker = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_rpt_delta_set_marker(&marker);
+    TEST_ASSERT_TRUE(cace_ari_rpt_delta_is_marker(&marker));
+    cace_ari_deinit(&marker);
+
+    // a plain label is an ordinary report item
+    cace_ari_t label = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_label_tstr(&label, "delta", true);
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_marker(&label));
+    cace_ari_deinit(&label);
+
+    cace_ari_t ctrl = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_rpt_delta_set_resync(&ctrl);
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_marker(&ctrl));
+    cace_ari_deinit(&ctrl);
+}
+
+void test_rpt_delta_full_without_prev(void)
+{
+    const cace_ari_uvast           vals[] = { 1, 2, 3 };
+    const cace_ari_rpt_delta_seq_t seq    = { .epoch = 10, .seq = 4 };
+
+    cace_ari_list_t prev, cur, out;
+    cace_ari_list_init(prev);
+    cace_ari_list_init(cur);
+    cace_ari_list_init(out);
+    set_items(cur, vals, 3);
+
+    size_t changed = 0;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_encode(out, &changed, &seq, prev, cur));
+    TEST_ASSERT_EQUAL_size_t(3, changed);
+    TEST_ASSERT_TRUE(cace_ari_rpt_delta_is_encoded(out));
+    TEST_ASSERT_EQUAL_size_t(CACE_ARI_RPT_DELTA_HEAD_COUNT + 3, cace_ari_list_size(out));
+
+    // complete report needs no previous value
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(out, &base));
+    check_items(out, vals, 3);
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_encoded(out));
+
+    TEST_ASSERT_TRUE(base.valid);
+    TEST_ASSERT_EQUAL_UINT64(10, base.seq.epoch);
+    TEST_ASSERT_EQUAL_UINT64(4, base.seq.seq);
+    check_items(base.items, vals, 3);
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(out);
+    cace_ari_list_clear(cur);
+    cace_ari_list_clear(prev);
+}
+
+void test_rpt_delta_changed_only(void)
+{
+    // more than one mask byte
+    const cace_ari_uvast           prev_vals[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const cace_ari_uvast           cur_vals[]  = { 0, 1, 20, 3, 4, 5, 6, 7, 8, 90 };
+    const cace_ari_rpt_delta_seq_t seq         = { .epoch = 10, .seq = 5 };
+
+    cace_ari_list_t prev, cur, out;
+    cace_ari_list_init(prev);
+    cace_ari_list_init(cur);
+    cace_ari_list_init(out);
+    set_items(prev, prev_vals, 10);
+    set_items(cur, cur_vals, 10);
+
+    size_t changed = 0;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_encode(out, &changed, &seq, prev, cur));
+    TEST_ASSERT_EQUAL_size_t(2, changed);
+    TEST_ASSERT_EQUAL_size_t(CACE_ARI_RPT_DELTA_HEAD_COUNT + 2, cace_ari_list_size(out));
+
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+
+    // cannot reassemble without the base
+    TEST_ASSERT_EQUAL_INT(3, cace_ari_rpt_delta_decode(out, &base));
+
+    base.valid     = true;
+    base.seq.epoch = 10;
+    base.seq.seq   = 4;
+    cace_ari_list_set(base.items, prev);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(out, &base));
+    check_items(out, cur_vals, 10);
+    TEST_ASSERT_EQUAL_UINT64(5, base.seq.seq);
+    check_items(base.items, cur_vals, 10);
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(out);
+    cace_ari_list_clear(cur);
+    cace_ari_list_clear(prev);
+}
+
+TEST_CASE(10, 3)
+TEST_CASE(10, 5)
+TEST_CASE(11, 4)
+void test_rpt_delta_decode_gap(int base_epoch, int base_seq)
+{
+    const cace_ari_uvast           prev_vals[] = { 5, 6 };
+    const cace_ari_uvast           cur_vals[]  = { 5, 7 };
+    const cace_ari_rpt_delta_seq_t seq         = { .epoch = 10, .seq = 5 };
+
+    cace_ari_list_t prev, cur, out;
+    cace_ari_list_init(prev);
+    cace_ari_list_init(cur);
+    cace_ari_list_init(out);
+    set_items(prev, prev_vals, 2);
+    set_items(cur, cur_vals, 2);
+
+    size_t changed = 0;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_encode(out, &changed, &seq, prev, cur));
+    TEST_ASSERT_EQUAL_size_t(1, changed);
+
+    // base from a different epoch or not the preceding report
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+    base.valid     = true;
+    base.seq.epoch = base_epoch;
+    base.seq.seq   = base_seq;
+    cace_ari_list_set(base.items, prev);
+
+    TEST_ASSERT_EQUAL_INT(3, cace_ari_rpt_delta_decode(out, &base));
+    TEST_ASSERT_TRUE(cace_ari_rpt_delta_is_encoded(out));
+    // base is unchanged
+    TEST_ASSERT_EQUAL_UINT64(base_seq, base.seq.seq);
+    check_items(base.items, prev_vals, 2);
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(out);
+    cace_ari_list_clear(cur);
+    cace_ari_list_clear(prev);
+}
+
+void test_rpt_delta_unchanged(void)
+{
+    const cace_ari_uvast           vals[] = { 5, 6 };
+    const cace_ari_rpt_delta_seq_t seq    = { .epoch = 10, .seq = 1 };
+
+    cace_ari_list_t prev, cur, out;
+    cace_ari_list_init(prev);
+    cace_ari_list_init(cur);
+    cace_ari_list_init(out);
+    set_items(prev, vals, 2);
+    set_items(cur, vals, 2);
+
+    size_t changed = 1;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_encode(out, &changed, &seq, prev, cur));
+    TEST_ASSERT_EQUAL_size_t(0, changed);
+
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+    base.valid     = true;
+    base.seq.epoch = 10;
+    base.seq.seq   = 0;
+    cace_ari_list_set(base.items, prev);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(out, &base));
+    check_items(out, vals, 2);
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(out);
+    cace_ari_list_clear(cur);
+    cace_ari_list_clear(prev);
+}
+
+void test_rpt_delta_decode_invalid(void)
+{
+    const cace_ari_uvast vals[] = { 5, 6 };
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+
+    // plain report is not delta-encoded
+    set_items(items, vals, 2);
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_encoded(items));
+    TEST_ASSERT_EQUAL_INT(2, cace_ari_rpt_delta_decode(items, &base));
+
+    // plain report beginning with the old label marker
+    cace_ari_set_label_tstr(cace_ari_list_push_front_new(items), "delta", true);
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_encoded(items));
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(items);
+}
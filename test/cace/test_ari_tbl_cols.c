@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the tbl_cols.h interfaces and the columnar form of TBL literals.
+ */
+#include <cace/amm/semtype.h>
+#include <cace/ari/cbor.h>
+#include <cace/ari/tbl_cols.h>
+#include <cace/ari/text.h>
+#include <cace/ari/text_util.h>
+#include <cace/util/defs.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+static void decode_ari(cace_ari_t *ari, const char *inhex)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, inhex);
+    cace_data_t indata;
+    cace_data_init(&indata);
+    int res = cace_base16_decode(&indata, intext);
+    m_string_clear(intext);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_base16_decode() failed");
+
+    res = cace_ari_cbor_decode(ari, &indata, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_ari_cbor_decode() failed");
+
+    cace_data_deinit(&indata);
+}
+
+/// Set a table with 2 columns of /UVAST and BOOL values
+static void make_table(cace_ari_t *ari, size_t nrows)
+{
+    cace_ari_tbl_t *tbl = cace_ari_set_tbl(ari, NULL);
+    cace_ari_tbl_reset(tbl, 2, 0);
+    for (size_t row_ix = 0; row_ix < nrows; ++row_ix)
+    {
+        cace_ari_array_t row;
+        cace_ari_array_init(row);
+        cace_ari_array_resize(row, 2);
+        cace_ari_set_uvast(cace_ari_array_get(row, 0), row_ix);
+        cace_ari_set_bool(cace_ari_array_get(row, 1), row_ix % 2);
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_move_row_array(tbl, row));
+    }
+}
+
+TEST_CASE("82138102")                     // ari:/TBL/c=2;
+TEST_CASE("82138100")                     // ari:/TBL/c=0;
+TEST_CASE("8213870201F502F403F5")         // ari:/TBL/c=2;(1,true)(2,false)(3,true)
+TEST_CASE("82138502820705F5820706F4")     // ari:/TBL/c=2;(/UVAST/5,true)(/UVAST/6,false)
+TEST_CASE("8213850201F502626869")         // ari:/TBL/c=2;(1,true)(2,hi)
+void test_ari_tbl_pack_roundtrip(const char *inhex)
+{
+    cace_ari_t expect = CACE_ARI_INIT_UNDEFINED;
+    decode_ari(&expect, inhex);
+    TEST_ASSERT_FALSE(cace_ari_tbl_is_packed(cace_ari_cget_tbl(&expect)));
+
+    cace_ari_t packed = CACE_ARI_INIT_UNDEFINED;
+    decode_ari(&packed, inhex);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_pack(cace_ari_get_tbl(&packed)));
+    TEST_ASSERT_TRUE(cace_ari_tbl_is_packed(cace_ari_cget_tbl(&packed)));
+
+    // same value as the row form in both directions
+    TEST_ASSERT_TRUE(cace_ari_equal(&expect, &packed));
+    TEST_ASSERT_TRUE(cace_ari_equal(&packed, &expect));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cmp(&expect, &packed));
+    TEST_ASSERT_EQUAL_UINT64(cace_ari_hash(&expect), cace_ari_hash(&packed));
+
+    // same encoded bytes as the row form
+    {
+        cace_data_t expect_data, got_data;
+        cace_data_init(&expect_data);
+        cace_data_init(&got_data);
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_encode(&expect_data, &expect));
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_encode(&got_data, &packed));
+        TEST_ASSERT_TRUE(cace_data_equal(&expect_data, &got_data));
+        cace_data_deinit(&got_data);
+        cace_data_deinit(&expect_data);
+    }
+    // same text as the row form
+    {
+        m_string_t expect_text, got_text;
+        m_string_init(expect_text);
+        m_string_init(got_text);
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_text_encode(expect_text, &expect, CACE_ARI_TEXT_ENC_OPTS_DEFAULT));
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_text_encode(got_text, &packed, CACE_ARI_TEXT_ENC_OPTS_DEFAULT));
+        TEST_ASSERT_EQUAL_STRING(m_string_get_cstr(expect_text), m_string_get_cstr(got_text));
+        m_string_clear(got_text);
+        m_string_clear(expect_text);
+    }
+
+    // copy keeps the columnar form
+    {
+        cace_ari_t copy = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_copy(&copy, &packed);
+        TEST_ASSERT_TRUE(cace_ari_tbl_is_packed(cace_ari_cget_tbl(&copy)));
+        TEST_ASSERT_TRUE(cace_ari_equal(&expect, &copy));
+        cace_ari_deinit(&copy);
+    }
+
+    // mutable access is in row form
+    cace_ari_tbl_t *tbl = cace_ari_get_tbl(&packed);
+    TEST_ASSERT_FALSE(cace_ari_tbl_is_packed(tbl));
+    TEST_ASSERT_EQUAL_size_t(cace_ari_array_size(cace_ari_cget_tbl(&expect)->items), cace_ari_array_size(tbl->items));
+    TEST_ASSERT_TRUE(cace_ari_equal(&expect, &packed));
+
+    cace_ari_deinit(&packed);
+    cace_ari_deinit(&expect);
+}
+
+void test_ari_tbl_pack_incomplete(void)
+{
+    cace_ari_tbl_t tbl;
+    cace_ari_tbl_init(&tbl);
+    cace_ari_tbl_reset(&tbl, 2, 0);
+    cace_ari_set_uvast(cace_ari_array_push_new(tbl.items), 1);
+
+    TEST_ASSERT_NOT_EQUAL_INT(0, cace_ari_tbl_pack(&tbl));
+    TEST_ASSERT_FALSE(cace_ari_tbl_is_packed(&tbl));
+    TEST_ASSERT_EQUAL_size_t(1, cace_ari_array_size(tbl.items));
+
+    cace_ari_tbl_deinit(&tbl);
+}
+
+void test_ari_tbl_cols_packed(void)
+{
+    cace_ari_t ari = CACE_ARI_INIT_UNDEFINED;
+    // ari:/TBL/c=2;(/UVAST/5,true)(/UVAST/6,false)
+    decode_ari(&ari, "82138502820705F5820706F4");
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_pack(cace_ari_get_tbl(&ari)));
+
+    const cace_ari_tbl_t *tbl = cace_ari_cget_tbl(&ari);
+    TEST_ASSERT_TRUE(cace_ari_array_empty_p(tbl->items));
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_tbl_num_rows(tbl));
+
+    const cace_ari_tbl_cols_t *cols = tbl->cols;
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_tbl_cols_num_cols(cols));
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_tbl_cols_num_rows(cols));
+
+    const cace_ari_tbl_col_t *col = cace_ari_tbl_col_array_cget(cols->cols, 0);
+    TEST_ASSERT_TRUE(col->packed);
+    TEST_ASSERT_TRUE(col->has_ari_type);
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_TYPE_UVAST, col->ari_type);
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_tbl_word_array_size(col->words));
+    TEST_ASSERT_EQUAL_UINT64(6, cace_ari_tbl_word_array_cget(col->words, 1)->as_uint64);
+
+    col = cace_ari_tbl_col_array_cget(cols->cols, 1);
+    TEST_ASSERT_TRUE(col->packed);
+    TEST_ASSERT_FALSE(col->has_ari_type);
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_PRIM_BOOL, col->prim_type);
+
+    cace_ari_t        buf;
+    const cace_ari_t *item = cace_ari_tbl_cview(tbl, 1, 0, &buf);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_TRUE(cace_ari_is_lit_typed(item, CACE_ARI_TYPE_UVAST));
+    cace_ari_uvast uval;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(item, &uval));
+    TEST_ASSERT_EQUAL_UINT64(6, uval);
+    TEST_ASSERT_NULL(cace_ari_tbl_cview(tbl, 2, 0, &buf));
+    TEST_ASSERT_NULL(cace_ari_tbl_cview(tbl, 0, 2, &buf));
+
+    cace_ari_deinit(&ari);
+}
+
+void test_ari_tbl_cols_demote(void)
+{
+    cace_ari_tbl_cols_t cols;
+    cace_ari_tbl_cols_init(&cols);
+    cace_ari_tbl_cols_reset(&cols, 1);
+
+    cace_ari_t item = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_uvast(&item, 10);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_cols_push_move(&cols, &item));
+    cace_ari_set_tstr(&item, "hi", true);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_cols_push_move(&cols, &item));
+
+    const cace_ari_tbl_col_t *col = cace_ari_tbl_col_array_cget(cols.cols, 0);
+    TEST_ASSERT_FALSE(col->packed);
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_tbl_col_size(col));
+    // generic values are held in compact form
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_COMPACT_UINT64, cace_ari_compact_array_cget(col->items, 0)->tag);
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_COMPACT_TSTR, cace_ari_compact_array_cget(col->items, 1)->tag);
+
+    // earlier packed value is preserved
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_cols_get(&item, &cols, 0, 0));
+    cace_ari_uvast uval;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&item, &uval));
+    TEST_ASSERT_EQUAL_UINT64(10, uval);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_cols_get(&item, &cols, 1, 0));
+    TEST_ASSERT_EQUAL_STRING("hi", cace_ari_cget_tstr_cstr(&item));
+
+    cace_ari_deinit(&item);
+    cace_ari_tbl_cols_deinit(&cols);
+}
+
+TEST_CASE(CACE_ARI_TBL_PACK_MIN_ROWS - 1, false)
+TEST_CASE(CACE_ARI_TBL_PACK_MIN_ROWS, true)
+TEST_CASE(100, true)
+void test_ari_tbl_cbor_decode_packed(size_t nrows, bool expect_packed)
+{
+    cace_ari_t expect = CACE_ARI_INIT_UNDEFINED;
+    make_table(&expect, nrows);
+
+    cace_data_t data;
+    cace_data_init(&data);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_encode(&data, &expect));
+
+    // large tables decode directly into columns
+    cace_ari_t got = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_decode(&got, &data, NULL, NULL));
+    const cace_ari_tbl_t *tbl = cace_ari_cget_tbl(&got);
+    TEST_ASSERT_NOT_NULL(tbl);
+    TEST_ASSERT_EQUAL(expect_packed, cace_ari_tbl_is_packed(tbl));
+    TEST_ASSERT_EQUAL_size_t(nrows, cace_ari_tbl_num_rows(tbl));
+    TEST_ASSERT_TRUE(cace_ari_equal(&expect, &got));
+
+    // and re-encode identically
+    cace_data_t again;
+    cace_data_init(&again);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_cbor_encode(&again, &got));
+    TEST_ASSERT_TRUE(cace_data_equal(&data, &again));
+
+    cace_data_deinit(&again);
+    cace_ari_deinit(&got);
+    cace_data_deinit(&data);
+    cace_ari_deinit(&expect);
+}
+
+TEST_CASE("82138102", CACE_AMM_TYPE_MATCH_POSITIVE)             // ari:/TBL/c=2;
+TEST_CASE("8213870201F502F403F5", CACE_AMM_TYPE_MATCH_POSITIVE) // ari:/TBL/c=2;(1,true)(2,false)(3,true)
+TEST_CASE("821383020103", CACE_AMM_TYPE_MATCH_NEGATIVE)         // ari:/TBL/c=2;(1,3)
+TEST_CASE("8213850201F502626869", CACE_AMM_TYPE_MATCH_NEGATIVE) // ari:/TBL/c=2;(1,true)(2,hi)
+TEST_CASE("821382010A", CACE_AMM_TYPE_MATCH_NEGATIVE)           // ari:/TBL/c=1;(10)
+void test_ari_tbl_cols_match_tblt(const char *inhex, cace_amm_type_match_res_t expect)
+{
+    cace_amm_type_t mytype;
+    cace_amm_type_init(&mytype);
+    {
+        cace_amm_semtype_tblt_t *semtype = cace_amm_type_set_tblt_size(&mytype, 2);
+        TEST_ASSERT_NOT_NULL(semtype);
+        cace_amm_named_type_t *col = cace_amm_named_type_array_get(semtype->columns, 0);
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(col->typeobj), CACE_ARI_TYPE_INT));
+        col = cace_amm_named_type_array_get(semtype->columns, 1);
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_set_use_builtin(&(col->typeobj), CACE_ARI_TYPE_BOOL));
+    }
+
+    cace_ari_t row = CACE_ARI_INIT_UNDEFINED;
+    decode_ari(&row, inhex);
+    cace_ari_t packed = CACE_ARI_INIT_UNDEFINED;
+    decode_ari(&packed, inhex);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_tbl_pack(cace_ari_get_tbl(&packed)));
+
+    // same result as the row form
+    TEST_ASSERT_EQUAL_INT(expect, cace_amm_type_match(&mytype, &row));
+    TEST_ASSERT_EQUAL_INT(expect, cace_amm_type_match(&mytype, &packed));
+
+    if (expect == CACE_AMM_TYPE_MATCH_POSITIVE)
+    {
+        cace_ari_t row_out    = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_t packed_out = CACE_ARI_INIT_UNDEFINED;
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_convert(&mytype, &row_out, &row));
+        TEST_ASSERT_EQUAL_INT(0, cace_amm_type_convert(&mytype, &packed_out, &packed));
+
+        // output keeps the input form
+        TEST_ASSERT_FALSE(cace_ari_tbl_is_packed(cace_ari_cget_tbl(&row_out)));
+        TEST_ASSERT_TRUE(cace_ari_tbl_is_packed(cace_ari_cget_tbl(&packed_out)));
+        TEST_ASSERT_TRUE(cace_ari_equal(&row_out, &packed_out));
+        TEST_ASSERT_EQUAL_INT(CACE_AMM_TYPE_MATCH_POSITIVE, cace_amm_type_match(&mytype, &packed_out));
+
+        cace_ari_deinit(&packed_out);
+        cace_ari_deinit(&row_out);
+    }
+
+    cace_ari_deinit(&packed);
+    cace_ari_deinit(&row);
+    cace_amm_type_deinit(&mytype);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the cace_data.h interfaces.
+ */
+#include <cace/cace_data.h>
+#include <cace/util/defs.h>
+
+#include <string.h>
+#include <unity.h>
+
+void test_cace_data_small_resize_in_place(void)
+{
+    cace_data_t data;
+    cace_data_init(&data);
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&data, 2, (cace_data_ptr_t) "hi"));
+    TEST_ASSERT_TRUE(data.owned);
+    const cace_data_ptr_t orig = data.ptr;
+
+    // text decoding appends the null terminator
+    TEST_ASSERT_EQUAL_INT(0, cace_data_append_byte(&data, 0));
+    TEST_ASSERT_EQUAL_PTR(orig, data.ptr);
+    TEST_ASSERT_EQUAL_size_t(3, data.len);
+    TEST_ASSERT_EQUAL_STRING("hi", (const char *)data.ptr);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_resize(&data, CACE_DATA_SMALL_MAX));
+    TEST_ASSERT_EQUAL_PTR(orig, data.ptr);
+
+    cace_data_deinit(&data);
+}
+
+void test_cace_data_grow_shrink(void)
+{
+    uint8_t large[3 * CACE_DATA_SMALL_MAX];
+    for (size_t ix = 0; ix < sizeof(large); ++ix)
+    {
+        large[ix] = (uint8_t)ix;
+    }
+
+    cace_data_t data;
+    cace_data_init(&data);
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from(&data, 4, large));
+    TEST_ASSERT_EQUAL_INT(0, cace_data_append_from(&data, sizeof(large) - 4, large + 4));
+    TEST_ASSERT_EQUAL_size_t(sizeof(large), data.len);
+    TEST_ASSERT_EQUAL_MEMORY(large, data.ptr, sizeof(large));
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_resize(&data, 5));
+    TEST_ASSERT_EQUAL_size_t(5, data.len);
+    TEST_ASSERT_EQUAL_MEMORY(large, data.ptr, 5);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_resize(&data, 0));
+    TEST_ASSERT_NULL(data.ptr);
+    TEST_ASSERT_FALSE(data.owned);
+
+    cace_data_deinit(&data);
+}
+
+void test_cace_data_small_reuse(void)
+{
+    cace_data_t data;
+    cace_data_init(&data);
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from_cstr(&data, "first"));
+    const cace_data_ptr_t orig = data.ptr;
+    cace_data_deinit(&data);
+
+    // same thread gets the released block back
+    cace_data_init(&data);
+    TEST_ASSERT_EQUAL_INT(0, cace_data_copy_from_cstr(&data, "second"));
+    TEST_ASSERT_EQUAL_PTR(orig, data.ptr);
+    TEST_ASSERT_EQUAL_STRING("second", (const char *)data.ptr);
+    cace_data_deinit(&data);
+}
+
+void test_cace_data_view_to_owned(void)
+{
+    char text[] = "view";
+
+    cace_data_t data;
+    TEST_ASSERT_EQUAL_INT(0, cace_data_init_view(&data, 4, (cace_data_ptr_t)text));
+    TEST_ASSERT_FALSE(data.owned);
+
+    TEST_ASSERT_EQUAL_INT(0, cace_data_append_byte(&data, 0));
+    TEST_ASSERT_TRUE(data.owned);
+    TEST_ASSERT_NOT_EQUAL((void *)text, (void *)data.ptr);
+    TEST_ASSERT_EQUAL_STRING("view", (const char *)data.ptr);
+
+    cace_data_t other;
+    TEST_ASSERT_EQUAL_INT(0, cace_data_init_set(&other, &data));
+    TEST_ASSERT_TRUE(cace_data_equal(&data, &other));
+    TEST_ASSERT_NOT_EQUAL((void *)data.ptr, (void *)other.ptr);
+
+    cace_data_deinit(&other);
+    cace_data_deinit(&data);
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cace/util/defs.h>
+#include <cace/util/logging.h>
+
+#include <m-atomic.h>
+#include <unity.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/// Number of events from each thread
+#define EVENT_COUNT 50
+
+/// Original stderr while it is redirected
+static int orig_stderr = -1;
+
+/// Redirect stderr to a new file descriptor
+static void redirect_stderr(int fd)
+{
+    orig_stderr = dup(STDERR_FILENO);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, orig_stderr);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, dup2(fd, STDERR_FILENO));
+}
+
+/// Restore the original stderr
+static void restore_stderr(void)
+{
+    dup2(orig_stderr, STDERR_FILENO);
+    close(orig_stderr);
+    orig_stderr = -1;
+}
+
+void setUp(void)
+{
+    cace_log_set_least_severity(LOG_DEBUG);
+}
+
+void tearDown(void)
+{
+    if (orig_stderr >= 0)
+    {
+        restore_stderr();
+    }
+}
+
+void test_least_severity(void)
+{
+    cace_log_set_least_severity(LOG_WARNING);
+    TEST_ASSERT_EQUAL_INT(LOG_WARNING, cace_log_get_least_severity());
+    TEST_ASSERT_TRUE(CACE_LOG_ENABLED_FOR(LOG_ERR));
+    TEST_ASSERT_FALSE(CACE_LOG_ENABLED_FOR(LOG_INFO));
+
+    // invalid value is ignored
+    cace_log_set_least_severity(100);
+    TEST_ASSERT_EQUAL_INT(LOG_WARNING, cace_log_get_least_severity());
+}
+
+/// State shared by threads which take turns logging
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    /// The next event number
+    int turn;
+} turn_state_t;
+
+typedef struct
+{
+    turn_state_t *state;
+    /// The parity of turns taken by this thread
+    int parity;
+} turn_arg_t;
+
+static void *turn_worker(void *arg)
+{
+    turn_arg_t   *targ  = arg;
+    turn_state_t *state = targ->state;
+
+    pthread_mutex_lock(&state->mutex);
+    while (state->turn < 2 * EVENT_COUNT)
+    {
+        if ((state->turn % 2) != targ->parity)
+        {
+            pthread_cond_wait(&state->cond, &state->mutex);
+            continue;
+        }
+        CACE_LOG_INFO("event %d", state->turn);
+        state->turn++;
+        pthread_cond_broadcast(&state->cond);
+    }
+    pthread_mutex_unlock(&state->mutex);
+    return NULL;
+}
+
+void test_merge_order(void)
+{
+    int pipefd[2];
+    TEST_ASSERT_EQUAL_INT(0, pipe(pipefd));
+    redirect_stderr(pipefd[1]);
+    close(pipefd[1]);
+
+    cace_openlog();
+    {
+        turn_state_t state = {
+            .mutex = PTHREAD_MUTEX_INITIALIZER,
+            .cond  = PTHREAD_COND_INITIALIZER,
+            .turn  = 0,
+        };
+        turn_arg_t args[2] = {
+            { .state = &state, .parity = 0 },
+            { .state = &state, .parity = 1 },
+        };
+        pthread_t thr[2];
+        for (size_t ix = 0; ix < 2; ++ix)
+        {
+            TEST_ASSERT_EQUAL_INT(0, pthread_create(&thr[ix], NULL, turn_worker, &args[ix]));
+        }
+        for (size_t ix = 0; ix < 2; ++ix)
+        {
+            pthread_join(thr[ix], NULL);
+        }
+    }
+    // flushes all events
+    cace_closelog();
+    restore_stderr();
+
+    // pipe has capacity for all events
+    size_t cap  = 65536;
+    char  *text = malloc(cap);
+    size_t len  = 0;
+    while (len < cap - 1)
+    {
+        ssize_t got = read(pipefd[0], text + len, cap - 1 - len);
+        if (got <= 0)
+        {
+            break;
+        }
+        len += got;
+    }
+    text[len] = '\0';
+    close(pipefd[0]);
+
+    // each event appears once in the order logged
+    int         expect = 0;
+    const char *curs   = text;
+    while ((curs = strstr(curs, "event ")) != NULL)
+    {
+        curs += strlen("event ");
+        TEST_ASSERT_EQUAL_INT(expect, atoi(curs));
+        ++expect;
+    }
+    TEST_ASSERT_EQUAL_INT(2 * EVENT_COUNT, expect);
+    free(text);
+}
+
+/// Set to stop the busy worker
+static atomic_bool busy_stop;
+
+static void *busy_worker(void *arg _U_)
+{
+    while (!atomic_load(&busy_stop))
+    {
+        CACE_LOG_DEBUG("busy");
+    }
+    return NULL;
+}
+
+void test_close_while_logging(void)
+{
+    int nullfd = open("/dev/null", O_WRONLY);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, nullfd);
+    redirect_stderr(nullfd);
+    close(nullfd);
+
+    atomic_store(&busy_stop, false);
+    cace_openlog();
+
+    pthread_t thr;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thr, NULL, busy_worker, NULL));
+    usleep(10000);
+
+    // the worker keeps logging, directly, with its ring still in place
+    cace_closelog();
+    usleep(10000);
+
+    // and back to the ring after reopening
+    cace_openlog();
+    usleep(10000);
+
+    atomic_store(&busy_stop, true);
+    pthread_join(thr, NULL);
+    cace_closelog();
+}
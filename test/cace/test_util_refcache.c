@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cace/util/refcache.h>
+#include <cace/util/defs.h>
+#include <cace/util/logging.h>
+
+#include <string.h>
+#include <unity.h>
+
+/// A cached object for testing
+typedef struct
+{
+    cace_util_refcache_entry_t entry;
+    int                        value;
+} test_obj_t;
+
+static int free_count = 0;
+
+static void test_obj_free(cace_util_refcache_entry_t *entry)
+{
+    ++free_count;
+    CACE_FREE(entry);
+}
+
+static cace_util_refcache_t cache;
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    cace_closelog();
+    return failures;
+}
+
+void setUp(void)
+{
+    free_count = 0;
+    cace_util_refcache_init(&cache, 2, test_obj_free);
+}
+
+void tearDown(void)
+{
+    cace_util_refcache_deinit(&cache);
+}
+
+static test_obj_t *test_obj_acquire(const char *name, int value)
+{
+    cace_data_t key;
+    cace_data_init_view_cstr(&key, name);
+
+    test_obj_t *obj = (test_obj_t *)cace_util_refcache_get(&cache, &key);
+    if (!obj)
+    {
+        obj = CACE_MALLOC(sizeof(test_obj_t));
+        TEST_ASSERT_NOT_NULL(obj);
+        obj->value = value;
+        obj        = (test_obj_t *)cace_util_refcache_put(&cache, &key, &(obj->entry));
+    }
+    cace_data_deinit(&key);
+    return obj;
+}
+
+void test_util_refcache_shared(void)
+{
+    test_obj_t *first = test_obj_acquire("a", 1);
+    TEST_ASSERT_NOT_NULL(first);
+    test_obj_t *second = test_obj_acquire("a", 2);
+    TEST_ASSERT_EQUAL_PTR(first, second);
+    TEST_ASSERT_EQUAL_INT(1, second->value);
+    TEST_ASSERT_EQUAL_size_t(3, first->entry.refcnt);
+
+    cace_util_refcache_release(&cache, &(first->entry));
+    cace_util_refcache_release(&cache, &(second->entry));
+    // still held by the cache
+    TEST_ASSERT_EQUAL_INT(0, free_count);
+
+    cace_util_refcache_clear(&cache);
+    TEST_ASSERT_EQUAL_INT(1, free_count);
+}
+
+void test_util_refcache_put_existing(void)
+{
+    test_obj_t *first = test_obj_acquire("a", 1);
+
+    cace_data_t key;
+    cace_data_init_view_cstr(&key, "a");
+    test_obj_t *other = CACE_MALLOC(sizeof(test_obj_t));
+    TEST_ASSERT_NOT_NULL(other);
+    other->value = 2;
+    // as if another thread added the same key first
+    test_obj_t *second = (test_obj_t *)cace_util_refcache_put(&cache, &key, &(other->entry));
+    cace_data_deinit(&key);
+    TEST_ASSERT_EQUAL_PTR(first, second);
+    TEST_ASSERT_EQUAL_INT(1, free_count);
+
+    cace_util_refcache_release(&cache, &(first->entry));
+    cace_util_refcache_release(&cache, &(second->entry));
+}
+
+void test_util_refcache_evict(void)
+{
+    test_obj_t *obj_a = test_obj_acquire("a", 1);
+    test_obj_t *obj_b = test_obj_acquire("b", 2);
+    cace_util_refcache_release(&cache, &(obj_b->entry));
+    // make "a" more recently used than "b"
+    cace_util_refcache_release(&cache, &(test_obj_acquire("a", 1)->entry));
+
+    test_obj_t *obj_c = test_obj_acquire("c", 3);
+    // "b" was least recently used and not referenced elsewhere
+    TEST_ASSERT_EQUAL_INT(1, free_count);
+
+    // "a" is still cached
+    test_obj_t *again = test_obj_acquire("a", 4);
+    TEST_ASSERT_EQUAL_PTR(obj_a, again);
+    cace_util_refcache_release(&cache, &(again->entry));
+
+    cace_util_refcache_release(&cache, &(obj_c->entry));
+    cace_util_refcache_release(&cache, &(obj_a->entry));
+    TEST_ASSERT_EQUAL_INT(1, free_count);
+}
+
+void test_util_refcache_evict_referenced(void)
+{
+    test_obj_t *obj_a = test_obj_acquire("a", 1);
+    test_obj_t *obj_b = test_obj_acquire("b", 2);
+    test_obj_t *obj_c = test_obj_acquire("c", 3);
+
+    // "a" was evicted but remains valid until released
+    TEST_ASSERT_EQUAL_INT(0, free_count);
+    TEST_ASSERT_EQUAL_INT(1, obj_a->value);
+    cace_util_refcache_release(&cache, &(obj_a->entry));
+    TEST_ASSERT_EQUAL_INT(1, free_count);
+
+    cace_util_refcache_release(&cache, &(obj_b->entry));
+    cace_util_refcache_release(&cache, &(obj_c->entry));
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cace/util/regex.h>
+#include <cace/util/logging.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    cace_util_regex_cache_clear();
+    cace_closelog();
+    return failures;
+}
+
+TEST_CASE("[a-z]+", "hi", true)
+TEST_CASE("[a-z]+", "", false)
+TEST_CASE("[a-z]+", "heLLo", false)
+TEST_CASE("[a-z]+", "hi there", false)
+TEST_CASE("([a-z]+)-([0-9]+)", "abc-123", true)
+TEST_CASE("([a-z]+)-([0-9]+)", "abc-", false)
+void test_util_regex_match(const char *pat, const char *text, bool expect)
+{
+    cace_util_regex_t *obj = cace_util_regex_acquire(pat, strlen(pat));
+    TEST_ASSERT_NOT_NULL(obj);
+    TEST_ASSERT_EQUAL(expect, cace_util_regex_match(obj, text, strlen(text)));
+    cace_util_regex_release(obj);
+}
+
+void test_util_regex_invalid(void)
+{
+    const char *pat = "[a-z";
+    TEST_ASSERT_NULL(cace_util_regex_acquire(pat, strlen(pat)));
+}
+
+void test_util_regex_shared(void)
+{
+    // not null terminated
+    const char pat[] = { '[', 'a', '-', 'z', ']', '+', 'X' };
+
+    cace_util_regex_t *first = cace_util_regex_acquire(pat, 6);
+    TEST_ASSERT_NOT_NULL(first);
+    cace_util_regex_t *second = cace_util_regex_acquire(pat, 6);
+    TEST_ASSERT_EQUAL_PTR(first, second);
+
+    // still valid after removal from the cache
+    cace_util_regex_cache_clear();
+    TEST_ASSERT_TRUE(cace_util_regex_match(first, "hi", 2));
+    cace_util_regex_release(first);
+    TEST_ASSERT_TRUE(cace_util_regex_match(second, "hi", 2));
+    cace_util_regex_release(second);
+
+    cace_util_regex_t *third = cace_util_regex_acquire(pat, 7);
+    TEST_ASSERT_NOT_NULL(third);
+    TEST_ASSERT_FALSE(cace_util_regex_match(third, "hi", 2));
+    TEST_ASSERT_TRUE(cace_util_regex_match(third, "hiX", 3));
+    cace_util_regex_release(third);
+}
+
+void test_util_regex_evict(void)
+{
+    cace_util_regex_t *held = cace_util_regex_acquire("held", 4);
+    TEST_ASSERT_NOT_NULL(held);
+
+    // more than the cache will hold
+    for (int ix = 0; ix < 2 * CACE_UTIL_REGEX_CACHE_SIZE; ++ix)
+    {
+        char pat[32];
+        int  patlen = snprintf(pat, sizeof(pat), "item%d", ix);
+
+        cace_util_regex_t *obj = cace_util_regex_acquire(pat, patlen);
+        TEST_ASSERT_NOT_NULL(obj);
+        TEST_ASSERT_TRUE(cace_util_regex_match(obj, pat, patlen));
+        cace_util_regex_release(obj);
+    }
+
+    TEST_ASSERT_TRUE(cace_util_regex_match(held, "held", 4));
+    cace_util_regex_release(held);
+}
+
+static void *match_worker(void *arg)
+{
+    cace_util_regex_t *obj = arg;
+
+    bool valid = true;
+    for (int ix = 0; ix < 1000; ++ix)
+    {
+        valid = valid && cace_util_regex_match(obj, "abc-123", 7);
+        valid = valid && !cace_util_regex_match(obj, "abc-", 4);
+    }
+    return valid ? obj : NULL;
+}
+
+void test_util_regex_threads(void)
+{
+    const char        *pat = "([a-z]+)-([0-9]+)";
+    cace_util_regex_t *obj = cace_util_regex_acquire(pat, strlen(pat));
+    TEST_ASSERT_NOT_NULL(obj);
+
+    pthread_t thr[4];
+    for (size_t ix = 0; ix < 4; ++ix)
+    {
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&thr[ix], NULL, match_worker, obj));
+    }
+    for (size_t ix = 0; ix < 4; ++ix)
+    {
+        void *res = NULL;
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(thr[ix], &res));
+        TEST_ASSERT_EQUAL_PTR(obj, res);
+    }
+
+    cace_util_regex_release(obj);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Benchmark of EID pattern matching throughput for a pattern with many
+ * node intervals, comparing a naive match which decodes the pattern for
+ * every EID with the cached and already-compiled forms.
+ *
+ * Usage: bench_eid_pattern [iterations] [intervals]
+ */
+#include <refda/eid_pattern.h>
+#include <cace/util/defs.h>
+
+#include <qcbor/qcbor_encode.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/// Size of the EID encoding buffer
+#define EID_BUF_SIZE 32
+
+static double elapsed_ns(const struct timespec *start, const struct timespec *stop)
+{
+    return (double)(stop->tv_sec - start->tv_sec) * 1e9 + (double)(stop->tv_nsec - start->tv_nsec);
+}
+
+/** Encode a pattern [[2, [[intervals...], true]]] where each interval
+ * covers 5 node numbers and intervals are 10 apart.
+ */
+static void encode_pattern(cace_data_t *out, long intervals)
+{
+    cace_data_resize(out, 16 + 20 * (size_t)intervals);
+
+    QCBOREncodeContext enc;
+    QCBOREncode_Init(&enc, (UsefulBuf) { out->ptr, out->len });
+    QCBOREncode_OpenArray(&enc);
+    QCBOREncode_OpenArray(&enc);
+    QCBOREncode_AddUInt64(&enc, REFDA_EID_SCHEME_IPN);
+    QCBOREncode_OpenArray(&enc);
+    QCBOREncode_OpenArray(&enc);
+    for (long ix = 0; ix < intervals; ++ix)
+    {
+        QCBOREncode_OpenArray(&enc);
+        QCBOREncode_AddUInt64(&enc, 10 * ix);
+        QCBOREncode_AddUInt64(&enc, 10 * ix + 4);
+        QCBOREncode_CloseArray(&enc);
+    }
+    QCBOREncode_CloseArray(&enc);
+    QCBOREncode_AddBool(&enc, true);
+    QCBOREncode_CloseArray(&enc);
+    QCBOREncode_CloseArray(&enc);
+    QCBOREncode_CloseArray(&enc);
+
+    UsefulBufC encdata;
+    if (QCBOREncode_Finish(&enc, &encdata) != QCBOR_SUCCESS)
+    {
+        fprintf(stderr, "Failed to encode pattern\n");
+        exit(1);
+    }
+    cace_data_resize(out, encdata.len);
+}
+
+/// Encode an EID [2, [node, 1]] as a view into a buffer
+static void encode_eid(cace_data_t *out, uint8_t *buf, uint64_t node)
+{
+    QCBOREncodeContext enc;
+    QCBOREncode_Init(&enc, (UsefulBuf) { buf, EID_BUF_SIZE });
+    QCBOREncode_OpenArray(&enc);
+    QCBOREncode_AddUInt64(&enc, REFDA_EID_SCHEME_IPN);
+    QCBOREncode_OpenArray(&enc);
+    QCBOREncode_AddUInt64(&enc, node);
+    QCBOREncode_AddUInt64(&enc, 1);
+    QCBOREncode_CloseArray(&enc);
+    QCBOREncode_CloseArray(&enc);
+
+    UsefulBufC encdata;
+    QCBOREncode_Finish(&enc, &encdata);
+    cace_data_init_view(out, encdata.len, buf);
+}
+
+int main(int argc, char *argv[])
+{
+    long count     = 100000;
+    long intervals = 100;
+    if (argc > 1)
+    {
+        count = strtol(argv[1], NULL, 10);
+    }
+    if (argc > 2)
+    {
+        intervals = strtol(argv[2], NULL, 10);
+    }
+    if ((count <= 0) || (intervals <= 0))
+    {
+        fprintf(stderr, "Usage: %s [iterations] [intervals]\n", argv[0]);
+        return 1;
+    }
+    struct timespec start, stop;
+
+    cace_data_t patdata;
+    cace_data_init(&patdata);
+    encode_pattern(&patdata, intervals);
+
+    uint8_t     eidbuf[EID_BUF_SIZE];
+    cace_data_t eid;
+
+    // node numbers covering all intervals, about half matching
+    const uint64_t node_span = 10 * (uint64_t)intervals;
+
+    {
+        long matches = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long ix = 0; ix < count; ++ix)
+        {
+            encode_eid(&eid, eidbuf, (uint64_t)ix % node_span);
+
+            refda_eid_pattern_t pat;
+            refda_eid_pattern_init(&pat);
+            refda_eid_pattern_decode(&pat, &patdata);
+            matches += refda_eid_pattern_match_cbor(&pat, &eid);
+            refda_eid_pattern_deinit(&pat);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf("naive: %.1f ns/match (%ld matched)\n", elapsed_ns(&start, &stop) / (double)count, matches);
+    }
+
+    {
+        long matches = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long ix = 0; ix < count; ++ix)
+        {
+            encode_eid(&eid, eidbuf, (uint64_t)ix % node_span);
+
+            refda_eid_pattern_t *pat = refda_eid_pattern_acquire(&patdata);
+            matches += refda_eid_pattern_match_cbor(pat, &eid);
+            refda_eid_pattern_release(pat);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf("cached: %.1f ns/match (%ld matched)\n", elapsed_ns(&start, &stop) / (double)count, matches);
+    }
+
+    {
+        refda_eid_pattern_t *pat = refda_eid_pattern_acquire(&patdata);
+
+        long matches = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long ix = 0; ix < count; ++ix)
+        {
+            encode_eid(&eid, eidbuf, (uint64_t)ix % node_span);
+            matches += refda_eid_pattern_match_cbor(pat, &eid);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        printf("compiled: %.1f ns/match (%ld matched)\n", elapsed_ns(&start, &stop) / (double)count, matches);
+
+        refda_eid_pattern_release(pat);
+    }
+
+    refda_eid_pattern_cache_clear();
+    cace_data_deinit(&patdata);
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the agent-private ADM for implementation instrumentation.
+ */
+#include "util/agent.h"
+#include "util/ari.h"
+#include "util/runctx.h"
+
+#include <refda/valprod.h>
+#include <refda/adm/dtnma_tools.h>
+#include <refda/adm/dtnma_tools_refda_instr.h>
+
+#include <cace/ari/rpt_delta.h>
+#include <cace/util/defs.h>
+#include <cace/util/logging.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+// Agent context for testing
+static refda_agent_t agent;
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+
+    refda_agent_init(&agent);
+    test_util_agent_crit_adms(&agent);
+    assert(0 == refda_adm_dtnma_tools_refda_instr_init(&agent));
+
+    int res = refda_agent_bindrefs(&agent);
+    assert(0 == res);
+}
+
+int suiteTearDown(int failures)
+{
+    refda_agent_deinit(&agent);
+
+    cace_closelog();
+    return failures;
+}
+
+void test_refda_adm_dtnma_tools_refda_instr_ns(void)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_objref_path_intid(&target, REFDA_ADM_DTNMA_TOOLS_ENUM, REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_MODEL_ENUM,
+                                   CACE_ARI_TYPE_EDD,
+                                   REFDA_ADM_DTNMA_TOOLS_REFDA_INSTR_ENUM_OBJID_EDD_CTRL_LATENCY_LIST);
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_lookup_deref(&deref, &(agent.objs), &target));
+    TEST_ASSERT_NOT_NULL(deref.ns);
+    TEST_ASSERT_FALSE(cace_amm_obj_ns_is_odm(deref.ns));
+
+    cace_amm_lookup_deinit(&deref);
+    cace_ari_deinit(&target);
+}
+
+void test_refda_adm_dtnma_tools_refda_instr_rpt_delta_objs(void)
+{
+    cace_ari_t marker = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_rpt_delta_set_marker(&marker);
+    cace_ari_t resync = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_rpt_delta_set_resync(&resync);
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_lookup_deref(&deref, &(agent.objs), &marker));
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_TYPE_IDENT, deref.obj_type);
+    cace_amm_lookup_deinit(&deref);
+
+    cace_amm_lookup_init(&deref);
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_lookup_deref(&deref, &(agent.objs), &resync));
+    TEST_ASSERT_EQUAL_INT(CACE_ARI_TYPE_CTRL, deref.obj_type);
+    cace_amm_lookup_deinit(&deref);
+
+    cace_ari_deinit(&resync);
+    cace_ari_deinit(&marker);
+}
+
+// clang-format off
+// ari://-1/1/EDD/ctrl-latency-list -> ari:/TBL/c=8;
+TEST_CASE("8420012300", 8)
+// ari://-1/1/EDD/edd-latency-list -> ari:/TBL/c=8;
+TEST_CASE("8420012301", 8)
+// ari://-1/1/EDD/oper-latency-list -> ari:/TBL/c=8;
+TEST_CASE("8420012302", 8)
+// ari://-1/1/EDD/rptt-latency-list -> ari:/TBL/c=8;
+TEST_CASE("8420012303", 8)
+// ari://-1/1/EDD/exec-trace-list -> ari:/TBL/c=4;
+TEST_CASE("8420012304", 4)
+// clang-format on
+void test_refda_adm_dtnma_tools_refda_instr_edd_produce(const char *targethex, size_t expect_cols)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, targethex));
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_lookup_deref(&deref, &(agent.objs), &target));
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+    refda_valprod_ctx_t prodctx;
+    refda_valprod_ctx_init(&prodctx, &runctx, &target, &deref);
+
+    int res = refda_valprod_run(&prodctx);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "refda_valprod_run() disagrees");
+
+    // verify produced value
+    {
+        m_string_t buf;
+        TEST_ASSERT_EQUAL_INT(0, test_util_ari_encode(buf, &(prodctx.value)));
+        TEST_PRINTF("Produced value %s", m_string_get_cstr(buf));
+        m_string_clear(buf);
+    }
+    const cace_ari_tbl_t *table = cace_ari_cget_tbl(&(prodctx.value));
+    TEST_ASSERT_NOT_NULL(table);
+    TEST_ASSERT_EQUAL_size_t(expect_cols, table->ncols);
+
+    refda_valprod_ctx_deinit(&prodctx);
+    refda_runctx_deinit(&runctx);
+    cace_amm_lookup_deinit(&deref);
+    cace_ari_deinit(&target);
+}
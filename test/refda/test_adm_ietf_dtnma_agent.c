@@ -23,6 +23,7 @@
 #include <refda/amm/edd.h>
 #include <refda/amm/var.h>
 #include <refda/binding.h>
+#include <refda/eval.h>
 #include <refda/register.h>
 #include <refda/valprod.h>
 #include <refda/adm/ietf.h>
@@ -356,3 +357,101 @@ void test_refda_adm_ietf_dtnma_agent_ctrl_var_store_reset(void)
     refda_runctx_deinit(&runctx);
     cace_ari_deinit(&var_ref);
 }
+
+// clang-format off
+// fixed value of ari://1/1/EDD/sw-vendor
+TEST_CASE(REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_SW_VENDOR, false)
+// changing value of ari://1/1/EDD/num-exec-started
+TEST_CASE(REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_NUM_EXEC_STARTED, true)
+// clang-format on
+void test_refda_adm_ietf_dtnma_agent_edd_watch(cace_ari_int_id_t obj_enum, bool expect_poll)
+{
+    cace_ari_t     cond = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_ac_t *ac   = cace_ari_set_ac(&cond, NULL);
+    cace_ari_set_objref_path_intid(cace_ari_list_push_back_new(ac->items), REFDA_ADM_IETF_ENUM,
+                                   REFDA_ADM_IETF_DTNMA_AGENT_ENUM_ADM, CACE_ARI_TYPE_EDD, obj_enum);
+
+    refda_amm_modval_watch_t watch;
+    refda_amm_modval_watch_init(&watch);
+    TEST_ASSERT_EQUAL_INT(0, refda_eval_watch_target(&agent, &watch, &cond));
+    TEST_ASSERT_EQUAL(expect_poll, watch.must_poll);
+    TEST_ASSERT_EQUAL_size_t(expect_poll ? 0 : 1, refda_amm_modval_seen_list_size(watch.items));
+
+    refda_amm_modval_watch_deinit(&watch);
+    cace_ari_deinit(&cond);
+}
+
+/** Produce a value from a specific run context.
+ */
+static void produce_from(refda_runctx_t *runctx, cace_ari_int_id_t model_enum, cace_ari_int_id_t obj_enum,
+                         cace_ari_t *value)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_objref_path_intid(&target, REFDA_ADM_IETF_ENUM, model_enum, CACE_ARI_TYPE_EDD, obj_enum);
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+    TEST_ASSERT_EQUAL_INT(0, cace_amm_lookup_deref(&deref, &(agent.objs), &target));
+
+    refda_valprod_ctx_t prodctx;
+    refda_valprod_ctx_init(&prodctx, runctx, &target, &deref);
+    TEST_ASSERT_EQUAL_INT(0, refda_valprod_run(&prodctx));
+    cace_ari_set_move(value, &(prodctx.value));
+
+    refda_valprod_ctx_deinit(&prodctx);
+    cace_amm_lookup_deinit(&deref);
+    cace_ari_deinit(&target);
+}
+
+void test_refda_adm_ietf_dtnma_agent_prodcache_runctx(void)
+{
+    refda_runctx_t runctx_a, runctx_b;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx_a, &agent));
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx_b, &agent));
+    // an additional group only for the second context
+    refda_acl_id_tree_push(runctx_b.acl_groups, 5);
+
+    refda_prodcache_begin(&(agent.prod_cache));
+    const uint64_t init_hits = agent.prod_cache.num_hits;
+
+    // context-dependent value is not shared between contexts
+    {
+        cace_ari_t value_a = CACE_ARI_INIT_UNDEFINED;
+        produce_from(&runctx_a, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_ADM,
+                     REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_CURRENT_GROUPS, &value_a);
+        cace_ari_t value_b = CACE_ARI_INIT_UNDEFINED;
+        produce_from(&runctx_b, REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_ADM,
+                     REFDA_ADM_IETF_DTNMA_AGENT_ACL_ENUM_OBJID_EDD_CURRENT_GROUPS, &value_b);
+
+        const cace_ari_ac_t *groups_a = cace_ari_cget_ac(&value_a);
+        TEST_ASSERT_NOT_NULL(groups_a);
+        TEST_ASSERT_EQUAL_size_t(1, cace_ari_list_size(groups_a->items));
+        const cace_ari_ac_t *groups_b = cace_ari_cget_ac(&value_b);
+        TEST_ASSERT_NOT_NULL(groups_b);
+        TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(groups_b->items));
+        TEST_ASSERT_EQUAL_UINT64(init_hits, agent.prod_cache.num_hits);
+
+        cace_ari_deinit(&value_b);
+        cace_ari_deinit(&value_a);
+    }
+
+    // context-free value is shared
+    {
+        cace_ari_t value_a = CACE_ARI_INIT_UNDEFINED;
+        produce_from(&runctx_a, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_ADM,
+                     REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_SW_VENDOR, &value_a);
+        cace_ari_t value_b = CACE_ARI_INIT_UNDEFINED;
+        produce_from(&runctx_b, REFDA_ADM_IETF_DTNMA_AGENT_ENUM_ADM,
+                     REFDA_ADM_IETF_DTNMA_AGENT_ENUM_OBJID_EDD_SW_VENDOR, &value_b);
+
+        TEST_ASSERT_TRUE(cace_ari_equal(&value_a, &value_b));
+        TEST_ASSERT_EQUAL_UINT64(init_hits + 1, agent.prod_cache.num_hits);
+
+        cace_ari_deinit(&value_b);
+        cace_ari_deinit(&value_a);
+    }
+
+    refda_prodcache_end(&(agent.prod_cache));
+    refda_runctx_deinit(&runctx_b);
+    refda_runctx_deinit(&runctx_a);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the modifiable value state and watch set.
+ */
+#include <refda/amm/modval.h>
+#include <cace/util/defs.h>
+
+#include <unity.h>
+
+static int notify_count = 0;
+
+static void count_notify(refda_amm_modval_state_t *obj _U_, void *user_data)
+{
+    TEST_ASSERT_EQUAL_PTR(&notify_count, user_data);
+    ++notify_count;
+}
+
+void setUp(void)
+{
+    notify_count = 0;
+}
+
+void test_amm_modval_state_inc(void)
+{
+    refda_amm_modval_state_t state;
+    refda_amm_modval_state_init(&state);
+    TEST_ASSERT_EQUAL_UINT64(0, refda_amm_modval_state_get(&state));
+
+    // no callback registered
+    refda_amm_modval_state_inc(&state);
+    TEST_ASSERT_EQUAL_UINT64(1, refda_amm_modval_state_get(&state));
+
+    const refda_amm_modval_notifier_t notifier = {
+        .notify    = count_notify,
+        .user_data = &notify_count,
+    };
+    refda_amm_modval_state_set_notifier(&state, &notifier);
+    refda_amm_modval_state_inc(&state);
+    TEST_ASSERT_EQUAL_UINT64(2, refda_amm_modval_state_get(&state));
+    TEST_ASSERT_EQUAL_INT(1, notify_count);
+
+    // unbound again
+    refda_amm_modval_state_set_notifier(&state, NULL);
+    refda_amm_modval_state_inc(&state);
+    TEST_ASSERT_EQUAL_UINT64(3, refda_amm_modval_state_get(&state));
+    TEST_ASSERT_EQUAL_INT(1, notify_count);
+
+    refda_amm_modval_state_deinit(&state);
+}
+
+void test_amm_modval_watch_changed(void)
+{
+    refda_amm_modval_state_t state_a, state_b;
+    refda_amm_modval_state_init(&state_a);
+    refda_amm_modval_state_init(&state_b);
+
+    refda_amm_modval_watch_t watch;
+    refda_amm_modval_watch_init(&watch);
+    TEST_ASSERT_FALSE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_watch_add(&watch, &state_a);
+    refda_amm_modval_watch_add(&watch, &state_b);
+    // duplicate is ignored
+    refda_amm_modval_watch_add(&watch, &state_a);
+    TEST_ASSERT_EQUAL_size_t(2, refda_amm_modval_seen_list_size(watch.items));
+    TEST_ASSERT_FALSE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_state_inc(&state_b);
+    TEST_ASSERT_TRUE(refda_amm_modval_watch_changed(&watch));
+    refda_amm_modval_watch_mark(&watch);
+    TEST_ASSERT_FALSE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_state_inc(&state_a);
+    TEST_ASSERT_TRUE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_watch_reset(&watch);
+    TEST_ASSERT_EQUAL_size_t(0, refda_amm_modval_seen_list_size(watch.items));
+    TEST_ASSERT_FALSE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_watch_deinit(&watch);
+    refda_amm_modval_state_deinit(&state_b);
+    refda_amm_modval_state_deinit(&state_a);
+}
+
+void test_amm_modval_watch_must_poll(void)
+{
+    refda_amm_modval_watch_t watch;
+    refda_amm_modval_watch_init(&watch);
+
+    watch.must_poll = true;
+    TEST_ASSERT_TRUE(refda_amm_modval_watch_changed(&watch));
+    refda_amm_modval_watch_mark(&watch);
+    TEST_ASSERT_TRUE(refda_amm_modval_watch_changed(&watch));
+
+    refda_amm_modval_watch_deinit(&watch);
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the compiled EID pattern matcher.
+ */
+#include <refda/eid_pattern.h>
+#include <cace/ari/text_util.h>
+#include <cace/util/logging.h>
+#include <cace/config.h>
+
+#include <string.h>
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void suiteSetUp(void)
+{
+    cace_openlog();
+}
+
+int suiteTearDown(int failures)
+{
+    refda_eid_pattern_cache_clear();
+#if PCRE_FOUND
+    cace_util_regex_cache_clear();
+#endif /* PCRE_FOUND */
+    cace_closelog();
+    return failures;
+}
+
+static void decode_hex(cace_data_t *out, const char *inhex)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, inhex);
+    cace_data_init(out);
+    int res = cace_base16_decode(out, intext);
+    m_string_clear(intext);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_base16_decode() failed");
+}
+
+static void check_decode(refda_eid_pattern_t *pat, const char *pathex, int expect)
+{
+    cace_data_t patdata;
+    decode_hex(&patdata, pathex);
+    int res = refda_eid_pattern_decode(pat, &patdata);
+    cace_data_deinit(&patdata);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(expect, res, "refda_eid_pattern_decode() disagrees");
+}
+
+TEST_CASE("F5", 0)                         // true
+TEST_CASE("80", 0)                         // []
+TEST_CASE("81820282820182050AF5", 0)       // [[2, [[1, [5, 10]], true]]]
+TEST_CASE("81820283810081018107", 0)       // [[2, [[0], [1], [7]]]]
+TEST_CASE("818201F5", 0)                   // [[1, true]]
+TEST_CASE("81", 2)                         // truncated
+TEST_CASE("F4", 3)                         // false
+TEST_CASE("8182028281820A05F5", 3)         // [[2, [[[10, 5]], true]]]
+TEST_CASE("818202828080", 3)               // [[2, [[], []]]]
+TEST_CASE("818202848101810181018101", 3)   // [[2, [[1], [1], [1], [1]]]]
+TEST_CASE("8182036178", 4)                 // [[3, "x"]]
+TEST_CASE("81820382F5F5", 4)               // [[3, [true, true]]]
+void test_eid_pattern_decode(const char *pathex, int expect)
+{
+    refda_eid_pattern_t pat;
+    refda_eid_pattern_init(&pat);
+    check_decode(&pat, pathex, expect);
+    refda_eid_pattern_deinit(&pat);
+}
+
+TEST_CASE("F5", "ipn:1.2", true)
+TEST_CASE("F5", "other:value", true)
+TEST_CASE("80", "ipn:1.2", false)
+TEST_CASE("81820282820182050AF5", "ipn:1.2", true)
+TEST_CASE("81820282820182050AF5", "ipn:7.99", true)
+TEST_CASE("81820282820182050AF5", "ipn:10.0", true)
+TEST_CASE("81820282820182050AF5", "ipn:11.1", false)
+TEST_CASE("81820282820182050AF5", "ipn:0.5.3", true)           // fully-qualified node 5
+TEST_CASE("81820282820182050AF5", "ipn:1.5.3", false)          // fully-qualified node 2^32+5
+TEST_CASE("81820282820182050AF5", "ipn:4294967296.5.3", false) // allocator out of range
+TEST_CASE("81820282820182050AF5", "ipn:0.4294967301.3", false) // node out of range
+TEST_CASE("818202F5", "ipn:4294967296.5.3", false)             // allocator out of range for any-SSP
+TEST_CASE("81820282820182050AF5", "ipn:1", false)
+TEST_CASE("81820282820182050AF5", "ipn:1.2.3.4", false)
+TEST_CASE("81820282820182050AF5", "ipn:1.x", false)
+TEST_CASE("81820282820182050AF5", "dtn:none", false)
+TEST_CASE("81820283810081018107", "ipn:0.1.7", true)
+TEST_CASE("81820283810081018107", "ipn:1.7", true)
+TEST_CASE("81820283810081018107", "ipn:1.8", false)
+TEST_CASE("81820283810081018107", "ipn:1.1.7", false)
+TEST_CASE("818201F5", "dtn://node/svc", true)
+TEST_CASE("818201F5", "ipn:1.2", false)
+TEST_CASE("81820100", "dtn:none", true)
+TEST_CASE("81820100", "dtn://node/svc", false)
+void test_eid_pattern_match_text(const char *pathex, const char *eid, bool expect)
+{
+    refda_eid_pattern_t pat;
+    refda_eid_pattern_init(&pat);
+    check_decode(&pat, pathex, 0);
+
+    TEST_ASSERT_EQUAL(expect, refda_eid_pattern_match_text(&pat, eid, strlen(eid)));
+    refda_eid_pattern_deinit(&pat);
+}
+
+#if PCRE_FOUND
+TEST_CASE("818201692F2F6E6F64652F2A2A", "dtn://node/a", true)
+TEST_CASE("818201692F2F6E6F64652F2A2A", "dtn://node/a/b", true)
+TEST_CASE("818201692F2F6E6F64652F2A2A", "dtn://other/a", false)
+TEST_CASE("818201692F2F6E6F64652F2A2A", "dtn:none", false)
+TEST_CASE("818201682F2F6E6F64652F2A", "dtn://node/a", true)
+TEST_CASE("818201682F2F6E6F64652F2A", "dtn://node/a/b", false)
+void test_eid_pattern_match_text_dtn(const char *pathex, const char *eid, bool expect)
+{
+    refda_eid_pattern_t pat;
+    refda_eid_pattern_init(&pat);
+    check_decode(&pat, pathex, 0);
+
+    TEST_ASSERT_EQUAL(expect, refda_eid_pattern_match_text(&pat, eid, strlen(eid)));
+    refda_eid_pattern_deinit(&pat);
+}
+#endif /* PCRE_FOUND */
+
+TEST_CASE("81820282820182050AF5", "8202820102", true)                    // [2, [1, 2]]
+TEST_CASE("81820282820182050AF5", "8202820B02", false)                   // [2, [11, 2]]
+TEST_CASE("81820282820182050AF5", "820283000507", true)                  // [2, [0, 5, 7]]
+TEST_CASE("81820282820182050AF5", "8202831B00000001000000000503", false) // [2, [4294967296, 5, 3]]
+TEST_CASE("81820282820182050AF5", "8202820A", false)                     // truncated
+TEST_CASE("81820282820182050AF5", "82028401020304", false)               // [2, [1, 2, 3, 4]]
+TEST_CASE("81820283810081018107", "820283000107", true)                  // [2, [0, 1, 7]]
+TEST_CASE("81820283810081018107", "8202820107", true)                    // [2, [1, 7]]
+TEST_CASE("81820100", "820100", true)                                    // [1, 0]
+TEST_CASE("81820100", "8201682F2F6E6F64652F78", false)                   // [1, "//node/x"]
+TEST_CASE("818201F5", "8201682F2F6E6F64652F78", true)                    // [1, "//node/x"]
+TEST_CASE("F5", "820A00", true)                                          // [10, 0]
+TEST_CASE("818201F5", "820A00", false)                                   // [10, 0]
+void test_eid_pattern_match_cbor(const char *pathex, const char *eidhex, bool expect)
+{
+    refda_eid_pattern_t pat;
+    refda_eid_pattern_init(&pat);
+    check_decode(&pat, pathex, 0);
+
+    cace_data_t eid;
+    decode_hex(&eid, eidhex);
+    TEST_ASSERT_EQUAL(expect, refda_eid_pattern_match_cbor(&pat, &eid));
+    cace_data_deinit(&eid);
+    refda_eid_pattern_deinit(&pat);
+}
+
+void test_eid_pattern_merge_intervals(void)
+{
+    refda_eid_pattern_t pat;
+    refda_eid_pattern_init(&pat);
+    // [[2, [[[5, 10], 1, [2, 4], [8, 20]], true]]]
+    check_decode(&pat, "818202828482050A01820204820814F5", 0);
+
+    const refda_eid_pattern_item_t *item = refda_eid_pattern_item_list_cget(pat.items, 0);
+    // merged into the single interval [1, 20]
+    TEST_ASSERT_EQUAL_INT(1, cace_util_range_uint64_size(item->ipn_parts[1].values));
+    TEST_ASSERT_TRUE(refda_eid_pattern_match_text(&pat, "ipn:1.0", 7));
+    TEST_ASSERT_TRUE(refda_eid_pattern_match_text(&pat, "ipn:20.0", 8));
+    TEST_ASSERT_FALSE(refda_eid_pattern_match_text(&pat, "ipn:21.0", 8));
+    TEST_ASSERT_FALSE(refda_eid_pattern_match_text(&pat, "ipn:0.0", 7));
+
+    refda_eid_pattern_deinit(&pat);
+}
+
+void test_eid_pattern_cache(void)
+{
+    cace_data_t patdata;
+    decode_hex(&patdata, "81820282820182050AF5");
+
+    refda_eid_pattern_t *first = refda_eid_pattern_acquire(&patdata);
+    TEST_ASSERT_NOT_NULL(first);
+    refda_eid_pattern_t *second = refda_eid_pattern_acquire(&patdata);
+    TEST_ASSERT_EQUAL_PTR(first, second);
+
+    // still valid after removal from the cache
+    refda_eid_pattern_cache_clear();
+    TEST_ASSERT_TRUE(refda_eid_pattern_match_text(first, "ipn:1.2", 7));
+    refda_eid_pattern_release(first);
+    TEST_ASSERT_TRUE(refda_eid_pattern_match_text(second, "ipn:1.2", 7));
+    refda_eid_pattern_release(second);
+
+    cace_data_deinit(&patdata);
+
+    decode_hex(&patdata, "8182036178");
+    TEST_ASSERT_NULL(refda_eid_pattern_acquire(&patdata));
+    cace_data_deinit(&patdata);
+}
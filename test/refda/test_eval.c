@@ -506,47 +506,129 @@ TEST_CASE("821183820C1903E882041903E88401012566646976696465", "F7")
 // ari:/AC/(/INT/1000,/TP/20000101T001640Z,//1/1/OPER/divide) -> undefined
 TEST_CASE("82118382041903E8820C1903E88401012566646976696465", "F7")
 
+void test_refda_eval_target_check(const char *targethex, const char *expectloghex)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, targethex));
+
+    cace_ari_t expect_result = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&expect_result, expectloghex));
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+
+    int res = refda_eval_target(&runctx, &result, &target);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "refda_eval_target() disagrees");
+
+    TEST_ASSERT_TRUE_MESSAGE(test_util_ari_equal(&expect_result, &result), "result ARI is different");
+
+    cace_ari_deinit(&result);
+    refda_runctx_deinit(&runctx);
+    cace_ari_deinit(&expect_result);
+    cace_ari_deinit(&target);
+}
+
+/** Evaluate a target and determine whether it used tbl-filter column kernels.
+ */
+static void check_tbl_filter_eval(cace_ari_t *result, const char *targethex, bool *vectorized)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, targethex));
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+
+    const unsigned long long before = atomic_load(&agent.instr.num_tbl_filter_vector);
+    int                      res    = refda_eval_target(&runctx, result, &target);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "refda_eval_target() disagrees");
+    *vectorized = (atomic_load(&agent.instr.num_tbl_filter_vector) != before);
+
+    refda_runctx_deinit(&runctx);
+    cace_ari_deinit(&target);
+}
+
 // Table filter tests
 //
 // ari:/AC/(/TBL/c=3;(1,1,1)(2,2,2),//1/1/OPER/tbl-filter(/AC/(false),/AC/())) -> /TBL/c=0;
-TEST_CASE("82118282138703010101020202850101256A74626C2D66696C74657282821181F4821180", "82138100")
+TEST_CASE("82118282138703010101020202850101256A74626C2D66696C74657282821181F4821180", "82138100", false)
 // ari:/AC/(/TBL/c=3;(1,2,3)(4,5,6),//1/1/OPER/tbl-filter(/AC/(true),/AC/(0,1,2))) -> /TBL/c=3;(1,2,3)(4,5,6)
-TEST_CASE("82118282138703010203040506850101256A74626C2D66696C74657282821181F5821183000102", "82138703010203040506")
+TEST_CASE("82118282138703010203040506850101256A74626C2D66696C74657282821181F5821183000102", "82138703010203040506",
+          false)
 // ari:/AC/(/TBL/c=3;(1,2,3)(4,5,6),//1/1/OPER/tbl-filter(/AC/(true),/AC/(1,2,3))) -> undefined -- fails because invalid
 // filter index!!
-TEST_CASE("82118282138703010203040506850101256A74626C2D66696C74657282821181F5821183010203", "F7")
+TEST_CASE("82118282138703010203040506850101256A74626C2D66696C74657282821181F5821183010203", "F7", false)
 // ari:/AC/(/TBL/c=2;(0,0)(1,1)(2,2)(3,3),//1/1/OPER/tbl-filter(/AC/(0,/LABEL/0,//1/1/OPER/compare-lt),/AC/(1))) ->
 // /TBL/c=1;(1)(2)(3)
 TEST_CASE("821182821389020000010102020303850101256A74626C2D66696C7465728282118300820E00840101256A636F6D706172652D6C7482"
           "118101",
-          "82138401010203")
+          "82138401010203", true)
 // ari:/AC/(/TBL/c=3;(0,0,a)(1,1,b)(2,2,c)(3,3,d),//1/1/OPER/tbl-filter(/AC/(0,/LABEL/0,//1/1/OPER/compare-lt),/AC/(1,2)))
 // -> /TBL/c=2;(1,b)(2,c)(3,d)
 TEST_CASE("82118282138D0300006161010161620202616303036164850101256A74626C2D66696C7465728282118300820E00840101256A636F6D"
           "706172652D6C748211820102",
-          "82138702016162026163036164")
-void test_refda_eval_target_check(const char *targethex, const char *expectloghex)
+          "82138702016162026163036164", true)
+// ari:/AC/(/TBL/c=2;(0,0)(1,1)(2,2)(3,3),//1/1/OPER/tbl-filter(/AC/(/LABEL/0,1,//1/1/OPER/compare-gt,/LABEL/0,3,
+// //1/1/OPER/compare-lt,//1/1/OPER/bool-and),/AC/(1))) -> /TBL/c=1;(2)
+TEST_CASE("821182821389020000010102020303850101256A74626C2D66696C74657282821187820E0001840101256A636F6D706172652D67"
+          "74820E0003840101256A636F6D706172652D6C748401012568626F6F6C2D616E6482118101",
+          "8213820102", true)
+// ari:/AC/(/TBL/c=2;(0,0)(1,1)(2,2)(3,3),//1/1/OPER/tbl-filter(/AC/(/LABEL/0,1,//1/1/OPER/compare-gt,
+// //1/1/OPER/bool-not),/AC/(1))) -> /TBL/c=1;(0)(1)
+TEST_CASE("821182821389020000010102020303850101256A74626C2D66696C74657282821184820E0001840101256A636F6D706172652D67"
+          "748401012568626F6F6C2D6E6F7482118101",
+          "821383010001", true)
+// ari:/AC/(/TBL/c=1;(0)(1)...(15),//1/1/OPER/tbl-filter(/AC/(/LABEL/0,13,//1/1/OPER/compare-gt),/AC/(0)))
+// -> /TBL/c=1;(14)(15) with the input table decoded in columnar form
+TEST_CASE("82118282139101000102030405060708090A0B0C0D0E0F850101256A74626C2D66696C74657282821183820E000D840101256A"
+          "636F6D706172652D677482118100",
+          "821383010E0F", true)
+void test_refda_eval_tbl_filter(const char *targethex, const char *expectloghex, bool expect_vector)
 {
-    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
-    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, targethex));
-
     cace_ari_t expect_result = CACE_ARI_INIT_UNDEFINED;
     TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&expect_result, expectloghex));
 
-    refda_runctx_t runctx;
-    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
-
-    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
-
-    int res = refda_eval_target(&runctx, &result, &target);
-    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "refda_eval_target() disagrees");
+    cace_ari_t result     = CACE_ARI_INIT_UNDEFINED;
+    bool       vectorized = false;
+    check_tbl_filter_eval(&result, targethex, &vectorized);
+    TEST_ASSERT_EQUAL_MESSAGE(expect_vector, vectorized, "column kernel use disagrees");
 
     TEST_ASSERT_TRUE_MESSAGE(test_util_ari_equal(&expect_result, &result), "result ARI is different");
 
     cace_ari_deinit(&result);
-    refda_runctx_deinit(&runctx);
     cace_ari_deinit(&expect_result);
-    cace_ari_deinit(&target);
+}
+
+// ari:/AC/(/TBL/c=2;(0,0)(1,1)(2,2)(3,3),//1/1/OPER/tbl-filter(/AC/(/LABEL/0,1,//1/1/OPER/compare-gt),/AC/(1))) and
+// ari:/AC/(/TBL/c=2;(0,0)(1,1)(2,2)(3,3),//1/1/OPER/tbl-filter(/AC/(/LABEL/0,0,//1/1/OPER/add,1,
+// //1/1/OPER/compare-gt),/AC/(1))) -> /TBL/c=1;(2)(3)
+TEST_CASE("821182821389020000010102020303850101256A74626C2D66696C74657282821183820E0001840101256A636F6D706172652D67"
+          "7482118101",
+          "821182821389020000010102020303850101256A74626C2D66696C74657282821185820E000084010125636164640184010125"
+          "6A636F6D706172652D677482118101",
+          "821383010203")
+void test_refda_eval_tbl_filter_fallback(const char *vectorhex, const char *fallbackhex, const char *expectloghex)
+{
+    cace_ari_t expect_result = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&expect_result, expectloghex));
+
+    cace_ari_t vector_result = CACE_ARI_INIT_UNDEFINED;
+    bool       vectorized    = false;
+    check_tbl_filter_eval(&vector_result, vectorhex, &vectorized);
+    TEST_ASSERT_TRUE_MESSAGE(vectorized, "column kernels not used");
+
+    // the unsupported OPER must cause per-row evaluation
+    cace_ari_t fallback_result = CACE_ARI_INIT_UNDEFINED;
+    check_tbl_filter_eval(&fallback_result, fallbackhex, &vectorized);
+    TEST_ASSERT_FALSE_MESSAGE(vectorized, "column kernels used");
+
+    TEST_ASSERT_TRUE_MESSAGE(test_util_ari_equal(&expect_result, &vector_result), "vector result ARI is different");
+    TEST_ASSERT_TRUE_MESSAGE(test_util_ari_equal(&vector_result, &fallback_result), "result ARIs are different");
+
+    cace_ari_deinit(&fallback_result);
+    cace_ari_deinit(&vector_result);
+    cace_ari_deinit(&expect_result);
 }
 
 TEST_CASE("821180", 6)             // Empty stack ari:/AC/()
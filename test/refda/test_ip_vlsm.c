@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the IP VLSM block matcher.
+ */
+#include <refda/ip_vlsm.h>
+#include <cace/ari/text_util.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+static void decode_hex(cace_data_t *out, const char *inhex)
+{
+    m_string_t intext;
+    m_string_init_set_cstr(intext, inhex);
+    cace_data_init(out);
+    int res = cace_base16_decode(out, intext);
+    m_string_clear(intext);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, res, "cace_base16_decode() failed");
+}
+
+TEST_CASE("C0A80000", 16, 0)
+TEST_CASE("C0A80000", 0, 0)
+TEST_CASE("C0A80000", 32, 0)
+TEST_CASE("C0A80000", 33, 3)
+TEST_CASE("20010DB8000000000000000000000000", 128, 0)
+TEST_CASE("20010DB8000000000000000000000000", 129, 3)
+TEST_CASE("C0A800", 16, 2)
+TEST_CASE("", 0, 2)
+void test_ip_vlsm_set(const char *basehex, int prefix, int expect)
+{
+    cace_data_t base;
+    decode_hex(&base, basehex);
+
+    refda_ip_vlsm_t vlsm;
+    TEST_ASSERT_EQUAL_INT(expect, refda_ip_vlsm_set(&vlsm, &base, prefix));
+    cace_data_deinit(&base);
+}
+
+TEST_CASE("C0A80000", 16, "C0A80101", true)
+TEST_CASE("C0A80000", 16, "C0A9FFFF", false)
+TEST_CASE("C0A80000", 16, "C0A8", false)
+TEST_CASE("C0A8FFFF", 16, "C0A80000", true) // host bits of the base are ignored
+TEST_CASE("C0A88000", 17, "C0A88001", true)
+TEST_CASE("C0A88000", 17, "C0A87FFF", false)
+TEST_CASE("C0A80101", 32, "C0A80101", true)
+TEST_CASE("C0A80101", 32, "C0A80100", false)
+TEST_CASE("00000000", 0, "FFFFFFFF", true)
+TEST_CASE("00000000", 0, "20010DB8000000000000000000000001", false)
+TEST_CASE("20010DB8000000000000000000000000", 32, "20010DB8FFFF00000000000000000001", true)
+TEST_CASE("20010DB8000000000000000000000000", 33, "20010DB8800000000000000000000001", false)
+TEST_CASE("20010DB8000000000000000000000000", 32, "C0A80101", false)
+void test_ip_vlsm_match(const char *basehex, int prefix, const char *addrhex, bool expect)
+{
+    cace_data_t base;
+    decode_hex(&base, basehex);
+    refda_ip_vlsm_t vlsm;
+    TEST_ASSERT_EQUAL_INT(0, refda_ip_vlsm_set(&vlsm, &base, prefix));
+    cace_data_deinit(&base);
+
+    cace_data_t addr;
+    decode_hex(&addr, addrhex);
+    TEST_ASSERT_EQUAL(expect, refda_ip_vlsm_match(&vlsm, &addr));
+    cace_data_deinit(&addr);
+}
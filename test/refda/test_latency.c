@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the latency histogram bookkeeping.
+ */
+#include <refda/latency.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+void test_latency_hist_empty(void)
+{
+    refda_latency_hist_t hist;
+    refda_latency_hist_init(&hist);
+
+    TEST_ASSERT_EQUAL_UINT64(0, hist.count);
+    TEST_ASSERT_EQUAL_UINT64(0, refda_latency_hist_quantile(&hist, 0.5));
+}
+
+void test_latency_hist_exact_small(void)
+{
+    refda_latency_hist_t hist;
+    refda_latency_hist_init(&hist);
+
+    // small values have exact buckets
+    for (uint64_t val = 1; val <= 10; ++val)
+    {
+        refda_latency_hist_record(&hist, val);
+    }
+    TEST_ASSERT_EQUAL_UINT64(10, hist.count);
+    TEST_ASSERT_EQUAL_UINT64(55, hist.sum);
+    TEST_ASSERT_EQUAL_UINT64(1, hist.min);
+    TEST_ASSERT_EQUAL_UINT64(10, hist.max);
+    TEST_ASSERT_EQUAL_UINT64(1, refda_latency_hist_quantile(&hist, 0));
+    TEST_ASSERT_EQUAL_UINT64(5, refda_latency_hist_quantile(&hist, 0.5));
+    TEST_ASSERT_EQUAL_UINT64(9, refda_latency_hist_quantile(&hist, 0.9));
+    TEST_ASSERT_EQUAL_UINT64(10, refda_latency_hist_quantile(&hist, 1));
+}
+
+TEST_CASE(1000)
+TEST_CASE(123456)
+TEST_CASE(987654321)
+TEST_CASE(UINT64_C(30000000000))
+void test_latency_hist_relative_error(uint64_t value)
+{
+    refda_latency_hist_t hist;
+    refda_latency_hist_init(&hist);
+
+    // other values are recorded with bucket ranges
+    refda_latency_hist_record(&hist, value);
+    refda_latency_hist_record(&hist, value * 2);
+
+    const uint64_t got = refda_latency_hist_quantile(&hist, 0.5);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT64(value, got);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT64(value + (value >> (REFDA_LATENCY_SUB_BITS - 1)), got);
+}
+
+void test_latency_hist_merge(void)
+{
+    refda_latency_hist_t hist_a;
+    refda_latency_hist_init(&hist_a);
+    refda_latency_hist_t hist_b;
+    refda_latency_hist_init(&hist_b);
+
+    refda_latency_hist_record(&hist_a, 3);
+    refda_latency_hist_record(&hist_a, 5);
+    refda_latency_hist_record(&hist_b, 2);
+    refda_latency_hist_record(&hist_b, 7);
+
+    refda_latency_hist_merge(&hist_a, &hist_b);
+    TEST_ASSERT_EQUAL_UINT64(4, hist_a.count);
+    TEST_ASSERT_EQUAL_UINT64(17, hist_a.sum);
+    TEST_ASSERT_EQUAL_UINT64(2, hist_a.min);
+    TEST_ASSERT_EQUAL_UINT64(7, hist_a.max);
+    TEST_ASSERT_EQUAL_UINT64(3, refda_latency_hist_quantile(&hist_a, 0.5));
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the per-iteration EDD production cache.
+ */
+#include <refda/prodcache.h>
+
+#include <cace/amm/obj_desc.h>
+#include <cace/ari/algo.h>
+#include <cace/ari/containers.h>
+
+#include <unity.h>
+
+static cace_amm_obj_desc_t obj_a, obj_b;
+
+void setUp(void)
+{
+    cace_amm_obj_desc_init(&obj_a);
+    cace_amm_obj_desc_init(&obj_b);
+}
+
+void tearDown(void)
+{
+    cace_amm_obj_desc_deinit(&obj_b);
+    cace_amm_obj_desc_deinit(&obj_a);
+}
+
+static void set_deref(cace_amm_lookup_t *deref, cace_amm_obj_desc_t *obj, cace_ari_uvast param)
+{
+    deref->obj = obj;
+    cace_ari_itemized_reset(&(deref->aparams));
+
+    cace_ari_t *item = cace_ari_array_push_new(deref->aparams.ordered);
+    cace_ari_set_uvast(item, param);
+}
+
+void test_prodcache_inactive(void)
+{
+    refda_prodcache_t cache;
+    refda_prodcache_init(&cache);
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+    set_deref(&deref, &obj_a, 1);
+
+    cace_ari_t value = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_uvast(&value, 10);
+
+    // nothing is stored when not active
+    refda_prodcache_put(&cache, &deref, &value);
+    TEST_ASSERT_EQUAL_UINT64(0, cache.num_miss);
+
+    refda_prodcache_begin(&cache);
+    TEST_ASSERT_FALSE(refda_prodcache_get(&cache, &deref, &value));
+    refda_prodcache_end(&cache);
+
+    cace_ari_deinit(&value);
+    cace_amm_lookup_deinit(&deref);
+    refda_prodcache_deinit(&cache);
+}
+
+void test_prodcache_keyed(void)
+{
+    refda_prodcache_t cache;
+    refda_prodcache_init(&cache);
+    refda_prodcache_begin(&cache);
+
+    cace_amm_lookup_t deref;
+    cace_amm_lookup_init(&deref);
+
+    cace_ari_t value = CACE_ARI_INIT_UNDEFINED;
+    set_deref(&deref, &obj_a, 1);
+    cace_ari_set_uvast(&value, 10);
+    refda_prodcache_put(&cache, &deref, &value);
+    set_deref(&deref, &obj_a, 2);
+    cace_ari_set_uvast(&value, 20);
+    refda_prodcache_put(&cache, &deref, &value);
+    TEST_ASSERT_EQUAL_UINT64(2, cache.num_miss);
+
+    cace_ari_uvast got;
+    set_deref(&deref, &obj_a, 1);
+    TEST_ASSERT_TRUE(refda_prodcache_get(&cache, &deref, &value));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&value, &got));
+    TEST_ASSERT_EQUAL_UINT64(10, got);
+
+    set_deref(&deref, &obj_a, 2);
+    TEST_ASSERT_TRUE(refda_prodcache_get(&cache, &deref, &value));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_uvast(&value, &got));
+    TEST_ASSERT_EQUAL_UINT64(20, got);
+
+    // different object same parameters
+    set_deref(&deref, &obj_b, 1);
+    TEST_ASSERT_FALSE(refda_prodcache_get(&cache, &deref, &value));
+    TEST_ASSERT_EQUAL_UINT64(2, cache.num_hits);
+
+    refda_prodcache_invalidate(&cache);
+    set_deref(&deref, &obj_a, 1);
+    TEST_ASSERT_FALSE(refda_prodcache_get(&cache, &deref, &value));
+
+    refda_prodcache_end(&cache);
+    cace_ari_deinit(&value);
+    cace_amm_lookup_deinit(&deref);
+    refda_prodcache_deinit(&cache);
+}
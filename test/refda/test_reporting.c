@@ -42,6 +42,10 @@ static refda_agent_t agent;
 
 // State for test_reporting_edd_int()
 static atomic_int edd_one_state = ATOMIC_VAR_INIT(0);
+// State for test_reporting_edd_defer()
+static refda_edd_pending_ptr_t *edd_deferred = NULL;
+// State for test_reporting_group_produce()
+static atomic_int group_calls = ATOMIC_VAR_INIT(0);
 
 // Initialize the test #agent
 static void suite_adms_init(refda_agent_t *agent);
@@ -69,6 +73,7 @@ int suiteTearDown(int failures)
 void setUp(void)
 {
     atomic_store(&edd_one_state, 1);
+    atomic_store(&group_calls, 0);
 }
 
 #define EXAMPLE_ORG_ENUM 65535
@@ -97,6 +102,43 @@ static void test_reporting_edd_one_int(refda_edd_prod_ctx_t *ctx)
     refda_edd_prod_ctx_set_result_copy(ctx, param);
 }
 
+static void test_reporting_edd_defer(refda_edd_prod_ctx_t *ctx)
+{
+    edd_deferred = refda_edd_prod_ctx_defer(ctx);
+    if (!edd_deferred)
+    {
+        cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+        cace_ari_set_int(&result, -1);
+        refda_edd_prod_ctx_set_result_move(ctx, &result);
+    }
+}
+
+static void test_reporting_edd_member(refda_edd_prod_ctx_t *ctx)
+{
+    // individual production differs from group production
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_int(&result, -1);
+    refda_edd_prod_ctx_set_result_move(ctx, &result);
+}
+
+static void test_reporting_group_produce(refda_edd_group_prod_ctx_t *ctx)
+{
+    atomic_fetch_add(&group_calls, 1);
+    for (size_t ix = 0; ix < 2; ++ix)
+    {
+        if (refda_edd_group_prod_ctx_is_requested(ctx, ix))
+        {
+            cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+            cace_ari_set_int(&result, 10 * (ix + 1));
+            refda_edd_group_prod_ctx_set_result_move(ctx, ix, &result);
+        }
+    }
+}
+
+static const refda_amm_edd_group_t test_reporting_group = {
+    .produce = test_reporting_group_produce,
+};
+
 static void suite_adms_init(refda_agent_t *agent)
 {
     // ADM initialization
@@ -172,6 +214,27 @@ static void suite_adms_init(refda_agent_t *agent)
             obj = refda_register_edd(adm, cace_amm_idseg_ref_withenum("edd2", 2), objdata);
             // no parameters
         }
+        {
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            assert(0 == cace_amm_type_set_use_builtin(&(objdata->prod_type), CACE_ARI_TYPE_INT));
+            objdata->produce = test_reporting_edd_defer;
+
+            obj = refda_register_edd(adm, cace_amm_idseg_ref_withenum("edd3", 3), objdata);
+            // no parameters
+        }
+        for (size_t ix = 0; ix < 2; ++ix)
+        {
+            refda_amm_edd_desc_t *objdata = CACE_MALLOC(sizeof(refda_amm_edd_desc_t));
+            refda_amm_edd_desc_init(objdata);
+            assert(0 == cace_amm_type_set_use_builtin(&(objdata->prod_type), CACE_ARI_TYPE_INT));
+            objdata->produce     = test_reporting_edd_member;
+            objdata->group       = &test_reporting_group;
+            objdata->group_index = ix;
+
+            obj = refda_register_edd(adm, cace_amm_idseg_ref_withenum(ix ? "edd5" : "edd4", 4 + ix), objdata);
+            // no parameters
+        }
     }
 
     int res = refda_agent_bindrefs(agent);
@@ -245,3 +308,190 @@ void test_refda_reporting_target(const char *targethex, int expect_res, const ch
     cace_ari_deinit(&destination);
     cace_ari_deinit(&target);
 }
+
+void test_refda_reporting_plan_cached(void)
+{
+    refda_rpt_plan_cache_invalidate(&agent.rpt_plans);
+    const uint64_t hits_before = agent.rpt_plans.num_hits;
+    const uint64_t miss_before = agent.rpt_plans.num_miss;
+
+    // ari:/AC/(//65535/10/EDD/1,//65535/10/VAR/1)
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, "8211828419FFFF0A23018419FFFF0A2A01"));
+
+    cace_ari_t destination = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_tstr(&destination, "data:foo", false);
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+
+    for (int ix = 1; ix <= 2; ++ix)
+    {
+        TEST_ASSERT_EQUAL_INT(0, refda_reporting_target(&runctx, &target, &destination));
+
+        refda_msgdata_t got_rptset;
+        TEST_ASSERT_TRUE(refda_msgdata_queue_pop_move(&got_rptset, agent.rptgs));
+        cace_ari_report_t *rpt = assert_rptset_items(&got_rptset.value);
+        TEST_ASSERT_NOT_NULL(rpt);
+        TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(rpt->items));
+
+        // the EDD is produced again with each report
+        cace_ari_int got;
+        TEST_ASSERT_EQUAL_INT(0, cace_ari_get_int(cace_ari_list_front(rpt->items), &got));
+        TEST_ASSERT_EQUAL_INT(ix, got);
+
+        refda_msgdata_deinit(&got_rptset);
+    }
+    TEST_ASSERT_EQUAL_UINT64(miss_before + 1, agent.rpt_plans.num_miss);
+    TEST_ASSERT_EQUAL_UINT64(hits_before + 1, agent.rpt_plans.num_hits);
+
+    refda_rpt_plan_cache_invalidate(&agent.rpt_plans);
+    TEST_ASSERT_EQUAL_size_t(0, refda_rpt_plan_dict_size(agent.rpt_plans.plans));
+
+    refda_runctx_deinit(&runctx);
+    cace_ari_deinit(&destination);
+    cace_ari_deinit(&target);
+}
+
+/** Report on ari:/AC/(//65535/10/EDD/3,//65535/10/VAR/1) and expect it
+ * to be deferred.
+ */
+static void report_deferred(refda_runctx_t *runctx)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    {
+        cace_ari_ac_t *acval = cace_ari_set_ac(&target, NULL);
+        cace_ari_set_objref_path_intid(cace_ari_list_push_back_new(acval->items), EXAMPLE_ORG_ENUM, EXAMPLE_ADM_ENUM,
+                                       CACE_ARI_TYPE_EDD, 3);
+        cace_ari_set_objref_path_intid(cace_ari_list_push_back_new(acval->items), EXAMPLE_ORG_ENUM, EXAMPLE_ADM_ENUM,
+                                       CACE_ARI_TYPE_VAR, 1);
+    }
+
+    cace_ari_t destination = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_tstr(&destination, "data:foo", false);
+
+    edd_deferred = NULL;
+    TEST_ASSERT_EQUAL_INT(0, refda_reporting_target(runctx, &target, &destination));
+    TEST_ASSERT_NOT_NULL(edd_deferred);
+    TEST_ASSERT_EQUAL_INT(0, refda_msgdata_queue_size(agent.rptgs));
+    TEST_ASSERT_EQUAL_size_t(1, refda_reporting_pending_list_size(agent.rpt_pending));
+
+    cace_ari_deinit(&destination);
+    cace_ari_deinit(&target);
+}
+
+void test_refda_reporting_deferred_complete(void)
+{
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+    report_deferred(&runctx);
+
+    // nothing changes before completion
+    refda_reporting_pending_check(&agent);
+    TEST_ASSERT_EQUAL_INT(0, refda_msgdata_queue_size(agent.rptgs));
+
+    cace_ari_t result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_int(&result, 7);
+    TEST_ASSERT_EQUAL_INT(0, refda_edd_prod_ctx_complete_move(edd_deferred, &result));
+    cace_ari_deinit(&result);
+    TEST_ASSERT_TRUE(atomic_exchange(&agent.rpt_pending_changed, false));
+
+    refda_reporting_pending_check(&agent);
+    TEST_ASSERT_EQUAL_size_t(0, refda_reporting_pending_list_size(agent.rpt_pending));
+
+    refda_msgdata_t got_rptset;
+    TEST_ASSERT_TRUE(refda_msgdata_queue_pop_move(&got_rptset, agent.rptgs));
+    cace_ari_report_t *rpt = assert_rptset_items(&got_rptset.value);
+    TEST_ASSERT_NOT_NULL(rpt);
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(rpt->items));
+
+    cace_ari_int got_int;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_int(cace_ari_list_get(rpt->items, 0), &got_int));
+    TEST_ASSERT_EQUAL_INT(7, got_int);
+    cace_ari_vast got_vast;
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_get_vast(cace_ari_list_get(rpt->items, 1), &got_vast));
+    TEST_ASSERT_EQUAL_INT64(123456, got_vast);
+
+    refda_msgdata_deinit(&got_rptset);
+
+    // the deadline event is left on the timeline
+    refda_timeline_reset(agent.exec_timeline);
+
+    refda_runctx_deinit(&runctx);
+}
+
+void test_refda_reporting_deferred_deadline(void)
+{
+    const struct timespec timeout = agent.rpt_pending_timeout;
+    agent.rpt_pending_timeout     = (struct timespec) { 0 };
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+    report_deferred(&runctx);
+
+    // deadline has already passed
+    refda_reporting_pending_check(&agent);
+    TEST_ASSERT_EQUAL_size_t(0, refda_reporting_pending_list_size(agent.rpt_pending));
+
+    refda_msgdata_t got_rptset;
+    TEST_ASSERT_TRUE(refda_msgdata_queue_pop_move(&got_rptset, agent.rptgs));
+    cace_ari_report_t *rpt = assert_rptset_items(&got_rptset.value);
+    TEST_ASSERT_NOT_NULL(rpt);
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(rpt->items));
+    TEST_ASSERT_TRUE(cace_ari_is_undefined(cace_ari_list_get(rpt->items, 0)));
+    refda_msgdata_deinit(&got_rptset);
+
+    // late completion is harmless
+    TEST_ASSERT_EQUAL_INT(0, refda_edd_prod_ctx_complete_move(edd_deferred, NULL));
+    atomic_store(&agent.rpt_pending_changed, false);
+
+    // the deadline event is left on the timeline
+    refda_timeline_reset(agent.exec_timeline);
+
+    refda_runctx_deinit(&runctx);
+    agent.rpt_pending_timeout = timeout;
+}
+
+// clang-format off
+// both group members ari:/AC/(//65535/10/EDD/4,//65535/10/VAR/1,//65535/10/EDD/5) -> (/INT/10,/VAST/123456,/INT/20)
+TEST_CASE("8211838419FFFF0A23048419FFFF0A2A018419FFFF0A2305", 1, "821183""82040A""82061A0001E240""820414")
+// single group member ari:/AC/(//65535/10/EDD/5,//65535/10/VAR/1) -> (/INT/-1,/VAST/123456)
+TEST_CASE("8211828419FFFF0A23058419FFFF0A2A01", 0, "821182""820420""82061A0001E240")
+// clang-format on
+void test_refda_reporting_group(const char *targethex, int expect_calls, const char *expectloghex)
+{
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&target, targethex));
+
+    cace_ari_t destination = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_tstr(&destination, "data:foo", false);
+
+    cace_ari_t expect_rpt_items = CACE_ARI_INIT_UNDEFINED;
+    TEST_ASSERT_EQUAL_INT(0, test_util_ari_decode(&expect_rpt_items, expectloghex));
+    cace_ari_ac_t *expect_seq = cace_ari_get_ac(&expect_rpt_items);
+    TEST_ASSERT_NOT_NULL(expect_seq);
+
+    refda_runctx_t runctx;
+    TEST_ASSERT_EQUAL_INT(0, test_util_runctx_init(&runctx, &agent));
+
+    TEST_ASSERT_EQUAL_INT(0, refda_reporting_target(&runctx, &target, &destination));
+    TEST_ASSERT_EQUAL_INT(expect_calls, atomic_load(&group_calls));
+
+    refda_msgdata_t got_rptset;
+    TEST_ASSERT_TRUE(refda_msgdata_queue_pop_move(&got_rptset, agent.rptgs));
+    cace_ari_report_t *rpt = assert_rptset_items(&got_rptset.value);
+    TEST_ASSERT_NOT_NULL(rpt);
+    TEST_ASSERT_EQUAL_size_t(cace_ari_list_size(expect_seq->items), cace_ari_list_size(rpt->items));
+    for (size_t ix = 0; ix < cace_ari_list_size(rpt->items); ++ix)
+    {
+        TEST_PRINTF("Checking ARI %zu", ix);
+        const bool equal = cace_ari_equal(cace_ari_list_get(expect_seq->items, ix), cace_ari_list_get(rpt->items, ix));
+        TEST_ASSERT_TRUE_MESSAGE(equal, "RPT ARI is different");
+    }
+
+    refda_msgdata_deinit(&got_rptset);
+    refda_runctx_deinit(&runctx);
+    cace_ari_deinit(&expect_rpt_items);
+    cace_ari_deinit(&destination);
+    cace_ari_deinit(&target);
+}
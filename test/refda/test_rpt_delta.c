@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the agent report-by-exception state.
+ */
+#include <refda/rpt_delta.h>
+
+#include <cace/ari/containers.h>
+#include <cace/ari/rpt_delta.h>
+
+#include <unity.h>
+
+static refda_rpt_delta_t state;
+static cace_ari_t        manager, source;
+
+void setUp(void)
+{
+    refda_rpt_delta_init(&state);
+    cace_ari_init(&manager);
+    cace_ari_set_tstr(&manager, "data:mgr", false);
+    cace_ari_init(&source);
+    cace_ari_set_tstr(&source, "data:src", false);
+}
+
+void tearDown(void)
+{
+    cace_ari_deinit(&source);
+    cace_ari_deinit(&manager);
+    refda_rpt_delta_deinit(&state);
+}
+
+static void set_items(cace_ari_list_t items, cace_ari_uvast first, cace_ari_uvast second)
+{
+    cace_ari_list_reset(items);
+    cace_ari_set_uvast(cace_ari_list_push_back_new(items), first);
+    cace_ari_set_uvast(cace_ari_list_push_back_new(items), second);
+}
+
+TEST_CASE("none", REFDA_RPT_DELTA_NONE)
+TEST_CASE("suppress", REFDA_RPT_DELTA_SUPPRESS)
+TEST_CASE("changed", REFDA_RPT_DELTA_CHANGED)
+void test_rpt_delta_mode_from_text(const char *text, int expect)
+{
+    refda_rpt_delta_mode_t mode;
+    TEST_ASSERT_EQUAL_INT(0, refda_rpt_delta_mode_from_text(&mode, text));
+    TEST_ASSERT_EQUAL_INT(expect, mode);
+    TEST_ASSERT_EQUAL_STRING(text, refda_rpt_delta_mode_name(mode));
+}
+
+void test_rpt_delta_mode_from_text_invalid(void)
+{
+    refda_rpt_delta_mode_t mode;
+    TEST_ASSERT_NOT_EQUAL_INT(0, refda_rpt_delta_mode_from_text(&mode, "other"));
+}
+
+void test_rpt_delta_apply_none(void)
+{
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_encoded(items));
+
+    cace_ari_list_clear(items);
+}
+
+void test_rpt_delta_apply_suppress(void)
+{
+    refda_rpt_delta_set_mode(&state, &manager, REFDA_RPT_DELTA_SUPPRESS);
+    TEST_ASSERT_EQUAL_INT(REFDA_RPT_DELTA_SUPPRESS, refda_rpt_delta_get_mode(&state, &manager));
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_TRUE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 3);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_FALSE(cace_ari_rpt_delta_is_encoded(items));
+    TEST_ASSERT_EQUAL_size_t(2, cace_ari_list_size(items));
+
+    cace_ari_list_clear(items);
+}
+
+void test_rpt_delta_apply_changed(void)
+{
+    refda_rpt_delta_set_mode(&state, NULL, REFDA_RPT_DELTA_CHANGED);
+    TEST_ASSERT_EQUAL_INT(REFDA_RPT_DELTA_CHANGED, refda_rpt_delta_get_mode(&state, &manager));
+
+    cace_ari_list_t items, expect;
+    cace_ari_list_init(items);
+    cace_ari_list_init(expect);
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+
+    // first report has all items present
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_TRUE(cace_ari_rpt_delta_is_encoded(items));
+    TEST_ASSERT_EQUAL_size_t(CACE_ARI_RPT_DELTA_HEAD_COUNT + 2, cace_ari_list_size(items));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(items, &base));
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_TRUE(refda_rpt_delta_apply(&state, &manager, &source, items));
+
+    set_items(items, 1, 3);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_EQUAL_size_t(CACE_ARI_RPT_DELTA_HEAD_COUNT + 1, cace_ari_list_size(items));
+
+    // suppressed reports do not use a sequence number
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(items, &base));
+    set_items(expect, 1, 3);
+    TEST_ASSERT_TRUE(cace_ari_list_equal_p(expect, items));
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(expect);
+    cace_ari_list_clear(items);
+}
+
+void test_rpt_delta_apply_gap(void)
+{
+    refda_rpt_delta_set_mode(&state, NULL, REFDA_RPT_DELTA_CHANGED);
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+    cace_ari_rpt_delta_base_t base;
+    cace_ari_rpt_delta_base_init(&base);
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(items, &base));
+
+    // this report is lost
+    set_items(items, 1, 3);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+
+    set_items(items, 4, 3);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_EQUAL_INT(3, cace_ari_rpt_delta_decode(items, &base));
+
+    // after resync the next report is complete
+    refda_rpt_delta_resync(&state, &manager);
+    set_items(items, 4, 3);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_EQUAL_size_t(CACE_ARI_RPT_DELTA_HEAD_COUNT + 2, cace_ari_list_size(items));
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_rpt_delta_decode(items, &base));
+
+    cace_ari_rpt_delta_base_deinit(&base);
+    cace_ari_list_clear(items);
+}
+
+void test_rpt_delta_apply_full_period(void)
+{
+    refda_rpt_delta_set_mode(&state, NULL, REFDA_RPT_DELTA_SUPPRESS);
+    state.full_period = 3;
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_TRUE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_TRUE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    // complete report even though nothing changed
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_TRUE(refda_rpt_delta_apply(&state, &manager, &source, items));
+
+    cace_ari_list_clear(items);
+}
+
+void test_rpt_delta_apply_max_entries(void)
+{
+    refda_rpt_delta_set_mode(&state, NULL, REFDA_RPT_DELTA_SUPPRESS);
+    state.max_entries = 1;
+
+    cace_ari_t other = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_tstr(&other, "data:other", false);
+
+    cace_ari_list_t items;
+    cace_ari_list_init(items);
+
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &other, items));
+    TEST_ASSERT_EQUAL_size_t(1, refda_rpt_delta_dict_size(state.last));
+
+    // state for the first source was discarded
+    set_items(items, 1, 2);
+    TEST_ASSERT_FALSE(refda_rpt_delta_apply(&state, &manager, &source, items));
+    TEST_ASSERT_EQUAL_size_t(1, refda_rpt_delta_dict_size(state.last));
+
+    cace_ari_list_clear(items);
+    cace_ari_deinit(&other);
+}
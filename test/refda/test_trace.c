@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2011-2026 The Johns Hopkins University Applied Physics
+ * Laboratory LLC.
+ *
+ * This file is part of the Delay-Tolerant Networking Management
+ * Architecture (DTNMA) Tools package.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * Test the EXECSET pipeline trace ring.
+ */
+#include <refda/trace.h>
+
+#include <unity.h>
+
+// Allow this macro
+#define TEST_CASE(...)
+
+static refda_trace_t trace;
+
+void setUp(void)
+{
+    refda_trace_init(&trace);
+}
+
+void tearDown(void)
+{
+    refda_trace_deinit(&trace);
+}
+
+void test_trace_ignore_null_nonce(void)
+{
+    cace_ari_t nonce = CACE_ARI_INIT_NULL;
+    refda_trace_mark(&trace, &nonce, REFDA_TRACE_RECV, NULL);
+
+    cace_ari_t      result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_tbl_t *table  = cace_ari_set_tbl(&result, NULL);
+    TEST_ASSERT_EQUAL_INT(0, refda_trace_get_table(&trace, table));
+    TEST_ASSERT_EQUAL_INT(4, table->ncols);
+    TEST_ASSERT_EQUAL_INT(0, cace_ari_array_size(table->items));
+    cace_ari_deinit(&result);
+}
+
+void test_trace_order(void)
+{
+    cace_ari_t nonce = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_uint(&nonce, 10);
+    cace_ari_t target = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_set_objref_path_intid(&target, 1, 1, CACE_ARI_TYPE_CTRL, 2);
+
+    refda_trace_mark(&trace, &nonce, REFDA_TRACE_RECV, NULL);
+    refda_trace_mark(&trace, &nonce, REFDA_TRACE_CTRL_START, &target);
+
+    cace_ari_t      result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_tbl_t *table  = cace_ari_set_tbl(&result, NULL);
+    TEST_ASSERT_EQUAL_INT(0, refda_trace_get_table(&trace, table));
+    TEST_ASSERT_EQUAL_INT(2 * 4, cace_ari_array_size(table->items));
+
+    TEST_ASSERT_TRUE(cace_ari_equal(&nonce, cace_ari_array_get(table->items, 0)));
+    TEST_ASSERT_EQUAL_STRING("recv", cace_ari_cget_tstr_cstr(cace_ari_array_get(table->items, 1)));
+    TEST_ASSERT_TRUE(cace_ari_is_null(cace_ari_array_get(table->items, 3)));
+    TEST_ASSERT_EQUAL_STRING("ctrl-start", cace_ari_cget_tstr_cstr(cace_ari_array_get(table->items, 5)));
+    TEST_ASSERT_TRUE(cace_ari_equal(&target, cace_ari_array_get(table->items, 7)));
+
+    cace_ari_deinit(&result);
+    cace_ari_deinit(&target);
+    cace_ari_deinit(&nonce);
+}
+
+void test_trace_overwrite(void)
+{
+    cace_ari_t nonce = CACE_ARI_INIT_UNDEFINED;
+    for (size_t ix = 0; ix < REFDA_TRACE_RING_SIZE + 3; ++ix)
+    {
+        cace_ari_set_uint(&nonce, ix);
+        refda_trace_mark(&trace, &nonce, REFDA_TRACE_SEND, NULL);
+    }
+
+    cace_ari_t      result = CACE_ARI_INIT_UNDEFINED;
+    cace_ari_tbl_t *table  = cace_ari_set_tbl(&result, NULL);
+    TEST_ASSERT_EQUAL_INT(0, refda_trace_get_table(&trace, table));
+    TEST_ASSERT_EQUAL_INT(REFDA_TRACE_RING_SIZE * 4, cace_ari_array_size(table->items));
+
+    // oldest retained record
+    cace_ari_set_uint(&nonce, 3);
+    TEST_ASSERT_TRUE(cace_ari_equal(&nonce, cace_ari_array_get(table->items, 0)));
+
+    cace_ari_deinit(&result);
+    cace_ari_deinit(&nonce);
+}